@@ -0,0 +1,296 @@
+// 01 堆疊應用：運算式編譯與求值（C++）/ Stack application: expression compiler + evaluator (C++).  // Bilingual header line for this unit.
+#ifndef EXPRESSION_ENGINE_HPP  // Header guard to prevent multiple inclusion.
+#define EXPRESSION_ENGINE_HPP  // Header guard definition.
+
+#include "Stack.hpp"  // Reuse ArrayStack<T> for the operator stack and the evaluation stack.
+
+#include <algorithm>  // Provide std::max for stack-depth tracking.
+#include <cctype>  // Provide std::isdigit/std::isalpha for tokenizing.
+#include <cmath>  // Provide std::fmod/std::pow for arithmetic opcodes.
+#include <cstdint>  // Provide std::uint8_t for compact opcodes.
+#include <cstdlib>  // Provide std::strtod for number parsing.
+#include <stdexcept>  // Provide exceptions for syntax errors.
+#include <string>  // Provide std::string for source text and variable names.
+#include <vector>  // Provide std::vector for bytecode and constant pools.
+
+namespace stackunit {  // Same namespace as ArrayStack.
+
+enum class OpCode : std::uint8_t {  // One byte per instruction kind.
+    PUSH_CONST,  // Push constants[operand].
+    LOAD_VAR,  // Push variables[operand].
+    NEG,  // Unary minus.
+    NOT,  // Logical not (0 -> 1, non-zero -> 0).
+    ADD,  // a + b.
+    SUB,  // a - b.
+    MUL,  // a * b.
+    DIV,  // a / b (IEEE semantics: x/0 = inf).
+    MOD,  // fmod(a, b).
+    POW,  // pow(a, b).
+    LT,  // a < b.
+    LE,  // a <= b.
+    GT,  // a > b.
+    GE,  // a >= b.
+    EQ,  // a == b.
+    NE,  // a != b.
+    AND,  // a && b (both sides are evaluated; expressions have no side effects).
+    OR  // a || b.
+};  // End OpCode.
+
+struct Instruction {  // One flat RPN instruction.
+    OpCode op;  // What to do.
+    int operand;  // Constant index or variable slot (unused for operators).
+};  // End Instruction.
+
+struct CompiledExpression {  // Flat RPN bytecode produced once by compileExpression().
+    std::vector<Instruction> code;  // Instructions in postfix order.
+    std::vector<double> constants;  // Constant pool referenced by PUSH_CONST.
+    std::vector<std::string> variables;  // Variable names; index = slot used by LOAD_VAR.
+    int maxStackDepth = 0;  // Deepest evaluation stack needed (used to preallocate once).
+
+    int variableSlot(const std::string& name) const {  // Find the slot for a variable name (-1 if unused).
+        for (size_t i = 0; i < variables.size(); i++) {  // Linear scan (few variables per rule).
+            if (variables[i] == name) {  // Match found.
+                return static_cast<int>(i);  // Return slot.
+            }  // Close match branch.
+        }  // Close loop.
+        return -1;  // Not referenced by this expression.
+    }  // End variableSlot().
+};  // End CompiledExpression.
+
+namespace detail {  // Shunting-yard helpers (not part of the public API).
+
+struct PendingOp {  // Operator waiting on the shunting-yard operator stack.
+    OpCode op;  // Operator opcode (only meaningful when isParen is false).
+    int precedence;  // Binding strength (higher binds tighter).
+    bool rightAssoc;  // True for ^ and prefix operators.
+    bool isParen;  // True for a '(' marker.
+};  // End PendingOp.
+
+inline int stackEffect(OpCode op) {  // Net change in evaluation stack depth for one instruction.
+    switch (op) {  // Classify by arity.
+        case OpCode::PUSH_CONST:  // Pushes one value.
+        case OpCode::LOAD_VAR:  // Pushes one value.
+            return 1;  // Depth grows by one.
+        case OpCode::NEG:  // Unary: pop one, push one.
+        case OpCode::NOT:  // Unary: pop one, push one.
+            return 0;  // Depth unchanged.
+        default:  // Binary: pop two, push one.
+            return -1;  // Depth shrinks by one.
+    }  // Close switch.
+}  // End stackEffect().
+
+inline bool readBinaryOperator(const std::string& s, size_t& i, OpCode& op, int& precedence, bool& rightAssoc) {  // Parse a binary operator at s[i].
+    char c = s[i];  // Current character.
+    char n = (i + 1 < s.size()) ? s[i + 1] : '\0';  // Lookahead for two-character operators.
+    rightAssoc = false;  // Most operators are left-associative.
+    if (c == '|' && n == '|') { op = OpCode::OR; precedence = 1; i += 2; return true; }  // Logical or.
+    if (c == '&' && n == '&') { op = OpCode::AND; precedence = 2; i += 2; return true; }  // Logical and.
+    if (c == '=' && n == '=') { op = OpCode::EQ; precedence = 3; i += 2; return true; }  // Equality.
+    if (c == '!' && n == '=') { op = OpCode::NE; precedence = 3; i += 2; return true; }  // Inequality.
+    if (c == '<' && n == '=') { op = OpCode::LE; precedence = 4; i += 2; return true; }  // Less-or-equal.
+    if (c == '>' && n == '=') { op = OpCode::GE; precedence = 4; i += 2; return true; }  // Greater-or-equal.
+    if (c == '<') { op = OpCode::LT; precedence = 4; i += 1; return true; }  // Less-than.
+    if (c == '>') { op = OpCode::GT; precedence = 4; i += 1; return true; }  // Greater-than.
+    if (c == '+') { op = OpCode::ADD; precedence = 5; i += 1; return true; }  // Addition.
+    if (c == '-') { op = OpCode::SUB; precedence = 5; i += 1; return true; }  // Subtraction.
+    if (c == '*') { op = OpCode::MUL; precedence = 6; i += 1; return true; }  // Multiplication.
+    if (c == '/') { op = OpCode::DIV; precedence = 6; i += 1; return true; }  // Division.
+    if (c == '%') { op = OpCode::MOD; precedence = 6; i += 1; return true; }  // Remainder.
+    if (c == '^') { op = OpCode::POW; precedence = 8; rightAssoc = true; i += 1; return true; }  // Power (binds tighter than unary minus).
+    return false;  // Not a binary operator.
+}  // End readBinaryOperator().
+
+}  // namespace detail  // Close helper namespace.
+
+inline CompiledExpression compileExpression(const std::string& source) {  // Shunting-yard: infix text -> flat RPN bytecode.
+    const int UNARY_PRECEDENCE = 7;  // Prefix - and ! bind tighter than * but looser than ^.
+    CompiledExpression out;  // Result program.
+    ArrayStack<detail::PendingOp> ops;  // Operator stack (the classic shunting-yard stack).
+    int depth = 0;  // Simulated evaluation stack depth.
+
+    auto emit = [&](OpCode op, int operand) {  // Append one instruction and track stack depth.
+        depth += detail::stackEffect(op);  // Apply stack effect.
+        out.maxStackDepth = std::max(out.maxStackDepth, depth);  // Record deepest point.
+        out.code.push_back(Instruction{op, operand});  // Append instruction.
+    };  // End emit.
+
+    bool expectOperand = true;  // True at the start, after an operator, and after '('.
+    size_t i = 0;  // Read position.
+    while (i < source.size()) {  // Tokenize and translate in one pass.
+        char c = source[i];  // Current character.
+        if (std::isspace(static_cast<unsigned char>(c))) {  // Skip whitespace.
+            i += 1;  // Advance.
+            continue;  // Next token.
+        }  // Close whitespace branch.
+        if (expectOperand) {  // Operand position: number, variable, '(' or prefix operator.
+            if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {  // Numeric literal.
+                char* end = nullptr;  // strtod end pointer.
+                double value = std::strtod(source.c_str() + i, &end);  // Parse number (handles exponents).
+                size_t consumed = static_cast<size_t>(end - (source.c_str() + i));  // Characters used.
+                if (consumed == 0) {  // strtod rejected it (e.g. a lone '.').
+                    throw std::invalid_argument("invalid number at position " + std::to_string(i));  // Report syntax error.
+                }  // Close validation.
+                out.constants.push_back(value);  // Add to constant pool.
+                emit(OpCode::PUSH_CONST, static_cast<int>(out.constants.size()) - 1);  // Operands go straight to output.
+                i += consumed;  // Advance past literal.
+                expectOperand = false;  // Next we need an operator or ')'.
+            } else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {  // Identifier.
+                size_t start = i;  // Remember start.
+                while (i < source.size() && (std::isalnum(static_cast<unsigned char>(source[i])) || source[i] == '_')) {  // Consume identifier chars.
+                    i += 1;  // Advance.
+                }  // Close identifier loop.
+                std::string name = source.substr(start, i - start);  // Extract identifier.
+                if (name == "true" || name == "false") {  // Boolean literals become 1/0 constants.
+                    out.constants.push_back(name == "true" ? 1.0 : 0.0);  // Add to constant pool.
+                    emit(OpCode::PUSH_CONST, static_cast<int>(out.constants.size()) - 1);  // Emit constant.
+                } else {  // Regular variable.
+                    int slot = out.variableSlot(name);  // Reuse slot if seen before.
+                    if (slot < 0) {  // First occurrence.
+                        out.variables.push_back(name);  // Allocate new slot.
+                        slot = static_cast<int>(out.variables.size()) - 1;  // Slot index.
+                    }  // Close new-slot branch.
+                    emit(OpCode::LOAD_VAR, slot);  // Emit variable load.
+                }  // Close identifier kind branch.
+                expectOperand = false;  // Next we need an operator or ')'.
+            } else if (c == '(') {  // Group start.
+                ops.push(detail::PendingOp{OpCode::ADD, 0, false, true});  // Push paren marker.
+                i += 1;  // Advance.
+            } else if (c == '-' || c == '!' || c == '+') {  // Prefix operator.
+                if (c != '+') {  // Unary plus is a no-op.
+                    ops.push(detail::PendingOp{c == '-' ? OpCode::NEG : OpCode::NOT, UNARY_PRECEDENCE, true, false});  // Push prefix op.
+                }  // Close unary-plus branch.
+                i += 1;  // Advance.
+            } else {  // Anything else cannot start an operand.
+                throw std::invalid_argument("expected operand at position " + std::to_string(i));  // Report syntax error.
+            }  // Close operand dispatch.
+            continue;  // Next token.
+        }  // Close operand-position branch.
+
+        if (c == ')') {  // Group end: flush until the matching '('.
+            while (!ops.isEmpty() && !ops.peek().isParen) {  // Pop operators inside the group.
+                emit(ops.pop().value.op, 0);  // Emit operator.
+            }  // Close flush loop.
+            if (ops.isEmpty()) {  // No matching '('.
+                throw std::invalid_argument("unmatched ')' at position " + std::to_string(i));  // Report syntax error.
+            }  // Close validation.
+            ops.pop();  // Discard the '(' marker.
+            i += 1;  // Advance.
+            continue;  // Still in operator position.
+        }  // Close ')' branch.
+
+        OpCode op;  // Parsed binary operator.
+        int precedence = 0;  // Its precedence.
+        bool rightAssoc = false;  // Its associativity.
+        if (!detail::readBinaryOperator(source, i, op, precedence, rightAssoc)) {  // Must be a binary operator here.
+            throw std::invalid_argument("expected operator at position " + std::to_string(i));  // Report syntax error.
+        }  // Close validation.
+        while (!ops.isEmpty() && !ops.peek().isParen) {  // Pop operators that bind at least as tightly.
+            const detail::PendingOp& top = ops.peek();  // Look at stacked operator.
+            bool popIt = rightAssoc ? (top.precedence > precedence) : (top.precedence >= precedence);  // Standard rule.
+            if (!popIt) {  // Stacked operator binds looser: stop.
+                break;  // Keep it for later.
+            }  // Close stop branch.
+            emit(ops.pop().value.op, 0);  // Emit stacked operator.
+        }  // Close pop loop.
+        ops.push(detail::PendingOp{op, precedence, rightAssoc, false});  // Stack the new operator.
+        expectOperand = true;  // Binary operator needs a right operand.
+    }  // Close tokenizer loop.
+
+    if (expectOperand) {  // Input ended right after an operator (or was empty).
+        throw std::invalid_argument("unexpected end of expression");  // Report syntax error.
+    }  // Close validation.
+    while (!ops.isEmpty()) {  // Flush remaining operators.
+        detail::PendingOp top = ops.pop().value;  // Take one.
+        if (top.isParen) {  // Leftover '(' means missing ')'.
+            throw std::invalid_argument("unmatched '('");  // Report syntax error.
+        }  // Close validation.
+        emit(top.op, 0);  // Emit operator.
+    }  // Close flush loop.
+    return out;  // Return compiled program.
+}  // End compileExpression().
+
+class ExpressionEvaluator {  // Runs one CompiledExpression on a stack allocated exactly once.
+public:
+    explicit ExpressionEvaluator(const CompiledExpression& program)  // Bind program and preallocate stack.
+        : program_(program) {  // Keep a reference (program must outlive the evaluator).
+        stack_.reserve(std::max(1, program_.maxStackDepth));  // One allocation for the evaluator's lifetime.
+    }  // Close constructor.
+    ExpressionEvaluator(CompiledExpression&&) = delete;  // A temporary program would dangle; bind a named one.
+
+    double evaluate(const double* variables) {  // Evaluate with variables[slot] bindings (no allocation).
+        stack_.clear();  // Reset depth; capacity stays.
+        for (const Instruction& ins : program_.code) {  // Run bytecode.
+            switch (ins.op) {  // Dispatch on opcode.
+                case OpCode::PUSH_CONST:  // Constant operand.
+                    stack_.push(program_.constants[static_cast<size_t>(ins.operand)]);  // Push constant.
+                    break;  // Next instruction.
+                case OpCode::LOAD_VAR:  // Variable operand.
+                    stack_.push(variables[ins.operand]);  // Push bound value.
+                    break;  // Next instruction.
+                case OpCode::NEG:  // Unary minus.
+                    stack_.push(-stack_.pop().value);  // Replace top with its negation.
+                    break;  // Next instruction.
+                case OpCode::NOT:  // Logical not.
+                    stack_.push(stack_.pop().value == 0.0 ? 1.0 : 0.0);  // Replace top with !top.
+                    break;  // Next instruction.
+                default: {  // Binary operator.
+                    double b = stack_.pop().value;  // Right operand (pushed last).
+                    double a = stack_.pop().value;  // Left operand.
+                    stack_.push(applyBinary(ins.op, a, b));  // Push result.
+                    break;  // Next instruction.
+                }  // Close binary case.
+            }  // Close switch.
+        }  // Close bytecode loop.
+        return stack_.pop().value;  // Single remaining value is the result.
+    }  // End evaluate().
+
+    void evaluateBatch(const std::vector<const double*>& columns, int rows, double* out) {  // columns[slot][row] -> out[row].
+        if (columns.size() != program_.variables.size()) {  // Every variable slot needs a column.
+            throw std::invalid_argument("need exactly one column per variable slot");  // Signal invalid input.
+        }  // Close validation.
+        std::vector<double> row(std::max<size_t>(1, columns.size()));  // Row buffer allocated once per batch.
+        for (int r = 0; r < rows; r++) {  // Evaluate each row.
+            for (size_t v = 0; v < columns.size(); v++) {  // Gather bindings for this row.
+                row[v] = columns[v][r];  // Copy one binding.
+            }  // Close gather loop.
+            out[r] = evaluate(row.data());  // Evaluate row.
+        }  // Close row loop.
+    }  // End evaluateBatch().
+
+private:
+    const CompiledExpression& program_;  // Bytecode being evaluated.
+    ArrayStack<double> stack_;  // Evaluation stack (reserved to maxStackDepth once).
+
+    static double applyBinary(OpCode op, double a, double b) {  // Apply one binary opcode.
+        switch (op) {  // Dispatch on opcode.
+            case OpCode::ADD: return a + b;  // Addition.
+            case OpCode::SUB: return a - b;  // Subtraction.
+            case OpCode::MUL: return a * b;  // Multiplication.
+            case OpCode::DIV: return a / b;  // Division.
+            case OpCode::MOD: return std::fmod(a, b);  // Floating remainder.
+            case OpCode::POW: return std::pow(a, b);  // Power.
+            case OpCode::LT: return a < b ? 1.0 : 0.0;  // Comparison.
+            case OpCode::LE: return a <= b ? 1.0 : 0.0;  // Comparison.
+            case OpCode::GT: return a > b ? 1.0 : 0.0;  // Comparison.
+            case OpCode::GE: return a >= b ? 1.0 : 0.0;  // Comparison.
+            case OpCode::EQ: return a == b ? 1.0 : 0.0;  // Comparison.
+            case OpCode::NE: return a != b ? 1.0 : 0.0;  // Comparison.
+            case OpCode::AND: return (a != 0.0 && b != 0.0) ? 1.0 : 0.0;  // Logical and.
+            case OpCode::OR: return (a != 0.0 || b != 0.0) ? 1.0 : 0.0;  // Logical or.
+            default: throw std::logic_error("not a binary opcode");  // Unreachable for compiled programs.
+        }  // Close switch.
+    }  // End applyBinary().
+};  // End ExpressionEvaluator.
+
+inline double evaluateExpression(const std::string& source, const std::vector<double>& bindings) {  // One-shot helper (compiles every call).
+    CompiledExpression program = compileExpression(source);  // Compile.
+    if (bindings.size() < program.variables.size()) {  // Need one binding per variable slot.
+        throw std::invalid_argument("missing variable bindings");  // Signal invalid input.
+    }  // Close validation.
+    ExpressionEvaluator evaluator(program);  // Bind evaluator.
+    return evaluator.evaluate(bindings.data());  // Evaluate once.
+}  // End evaluateExpression().
+
+}  // namespace stackunit  // Close namespace.
+
+#endif  // EXPRESSION_ENGINE_HPP  // End of header guard.
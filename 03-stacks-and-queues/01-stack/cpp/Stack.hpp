@@ -2,7 +2,8 @@
 #ifndef STACK_HPP  // Header guard to prevent multiple inclusion.
 #define STACK_HPP  // Header guard definition.
 
-#include <algorithm>  // Provide std::max for max-cost tracking.
+#include <algorithm>  // Provide std::max for max-cost tracking and std::copy for bulk moves.
+#include <iterator>  // Provide std::make_move_iterator for moving elements on resize.
 #include <memory>  // Provide std::unique_ptr for owning the backing buffer safely.
 #include <stdexcept>  // Provide exceptions for validation.
 #include <vector>  // Provide std::vector for returning copies of used elements.
@@ -13,11 +14,18 @@ struct OperationCost {  // Record per-operation resize copy counts.
     int copied;  // How many elements were copied due to resize (0 if no resize).
 };  // End of OperationCost.
 
+template <typename T = int>  // Element type (int for the classic teaching stack).
 struct PopResult {  // Return popped value plus its operation cost.
-    int value;  // The popped element value.
+    T value;  // The popped element value.
     OperationCost cost;  // Resize-copy cost for this pop (always 0 in this unit).
 };  // End of PopResult.
 
+struct BatchCost {  // Aggregated cost record for one pushN/popN call (instead of one record per element).
+    int count;  // How many elements were pushed or popped.
+    int copied;  // How many existing elements were copied by the (single) resize.
+    int resizes;  // How many resizes happened (0 or 1: capacity is checked once per batch).
+};  // End of BatchCost.
+
 struct PushSummary {  // Summarize a sequence of pushes (growth behavior).
     int m;  // Number of pushes performed.
     int finalSize;  // Final size after pushes.
@@ -27,12 +35,13 @@ struct PushSummary {  // Summarize a sequence of pushes (growth behavior).
     int maxCopiedInOneOp;  // Maximum copies in any single push.
 };  // End of PushSummary.
 
+template <typename T = int>  // Element type; ArrayStack<> keeps the original int stack.
 class ArrayStack {  // An array-backed stack with doubling growth (teaching-oriented).
 public:
     ArrayStack()  // Initialize an empty stack with capacity 1.
         : size_(0),  // Start with no stored elements.
           capacity_(1),  // Start with capacity 1 for deterministic doubling.
-          data_(std::make_unique<int[]>(static_cast<size_t>(capacity_))),  // Allocate backing buffer.
+          data_(std::make_unique<T[]>(static_cast<size_t>(capacity_))),  // Allocate backing buffer.
           totalCopies_(0) {  // Start with zero total copies.
     }  // Close constructor.
 
@@ -52,8 +61,8 @@ public:
         return size_ == 0;  // Empty iff size is zero.
     }  // End isEmpty().
 
-    std::vector<int> toVector() const {  // Return a copy of the used portion (bottom -> top).
-        std::vector<int> out;  // Output container.
+    std::vector<T> toVector() const {  // Return a copy of the used portion (bottom -> top).
+        std::vector<T> out;  // Output container.
         out.reserve(static_cast<size_t>(size_));  // Reserve to avoid reallocations.
         for (int i = 0; i < size_; i++) {  // Copy used portion.
             out.push_back(data_[static_cast<size_t>(i)]);  // Append one element.
@@ -61,33 +70,77 @@ public:
         return out;  // Return copy.
     }  // End toVector().
 
-    OperationCost push(int value) {  // Push to top (amortized O(1)).
+    OperationCost push(const T& value) {  // Push to top (amortized O(1)).
         int copied = ensureCapacityForOneMore();  // Resize if needed.
         data_[static_cast<size_t>(size_)] = value;  // Write new value at the top slot.
         size_ += 1;  // Increase size.
         return OperationCost{copied};  // Return deterministic resize-copy cost.
     }  // End push().
 
-    int peek() const {  // Return top value without removing it (O(1)).
+    const T& peek() const {  // Return top value without removing it (O(1)).
         if (size_ == 0) {  // Reject peeking an empty stack.
             throw std::out_of_range("peek from empty stack");  // Signal invalid operation.
         }  // Close validation.
         return data_[static_cast<size_t>(size_ - 1)];  // Return top slot.
     }  // End peek().
 
-    PopResult pop() {  // Pop top value (O(1) in this unit; no shrinking).
+    PopResult<T> pop() {  // Pop top value (O(1) in this unit; no shrinking).
         if (size_ == 0) {  // Reject popping an empty stack.
             throw std::out_of_range("pop from empty stack");  // Signal invalid operation.
         }  // Close validation.
         size_ -= 1;  // Decrease size first so top index becomes size.
-        int v = data_[static_cast<size_t>(size_)];  // Read removed slot.
-        return PopResult{v, OperationCost{0}};  // Pop does not resize/copy in this unit.
+        return PopResult<T>{std::move(data_[static_cast<size_t>(size_)]), OperationCost{0}};  // Pop does not resize/copy in this unit.
     }  // End pop().
 
+    int reserve(int minCapacity) {  // Grow (by doubling) until minCapacity fits; return copied elements.
+        if (minCapacity <= capacity_) {  // Fast path: already large enough.
+            return 0;  // No resize needed.
+        }  // Close fast path.
+        int newCapacity = capacity_;  // Start from current capacity.
+        while (newCapacity < minCapacity) {  // Keep the doubling schedule (same capacities as repeated push).
+            newCapacity *= 2;  // Double.
+        }  // Close loop.
+        return resize(newCapacity);  // One resize covers the whole batch.
+    }  // End reserve().
+
+    BatchCost pushN(const T* values, int count) {  // Push count values in order (values[count-1] ends on top).
+        if (count < 0) {  // Reject invalid counts.
+            throw std::invalid_argument("count must be >= 0");  // Signal invalid input.
+        }  // Close validation.
+        int oldCapacity = capacity_;  // Remember capacity to detect the (single) resize.
+        int copied = reserve(size_ + count);  // Check capacity once for the whole burst.
+        std::copy(values, values + count, data_.get() + size_);  // Bulk copy (memmove for trivially copyable T).
+        size_ += count;  // Increase size once.
+        return BatchCost{count, copied, capacity_ != oldCapacity ? 1 : 0};  // One aggregated cost record.
+    }  // End pushN().
+
+    BatchCost pushN(const std::vector<T>& values) {  // Convenience overload for a whole vector.
+        return pushN(values.data(), static_cast<int>(values.size()));  // Forward to pointer version.
+    }  // End pushN(vector).
+
+    BatchCost popN(T* out, int k) {  // Pop k values into out in pop order (out[0] = old top).
+        if (k < 0) {  // Reject invalid counts.
+            throw std::invalid_argument("k must be >= 0");  // Signal invalid input.
+        }  // Close validation.
+        if (k > size_) {  // Reject popping more than we hold (nothing is popped).
+            throw std::out_of_range("pop from empty stack");  // Signal invalid operation.
+        }  // Close validation.
+        T* top = data_.get() + size_;  // One past the current top.
+        for (int i = 0; i < k; i++) {  // Reverse copy so the caller sees LIFO order.
+            out[i] = std::move(top[-1 - i]);  // Move one element out.
+        }  // Close loop.
+        size_ -= k;  // Decrease size once.
+        return BatchCost{k, 0, 0};  // Pop never resizes in this unit.
+    }  // End popN().
+
+    void clear() {  // Drop all elements but keep the allocated capacity (no frees).
+        size_ = 0;  // Reset size only.
+    }  // End clear().
+
 private:
     int size_;  // Number of stored elements.
     int capacity_;  // Allocated slots (always >= 1 in this unit).
-    std::unique_ptr<int[]> data_;  // Backing buffer.
+    std::unique_ptr<T[]> data_;  // Backing buffer.
     long long totalCopies_;  // Total copied elements due to resizes.
 
     int resize(int newCapacity) {  // Resize buffer and return number of copied elements.
@@ -98,12 +151,9 @@ private:
             throw std::invalid_argument("newCapacity must be >= 1");  // Signal invalid request.
         }  // Close validation.
 
-        std::unique_ptr<int[]> newData = std::make_unique<int[]>(static_cast<size_t>(newCapacity));  // Allocate new buffer.
-        int copied = 0;  // Count copied elements deterministically.
-        for (int i = 0; i < size_; i++) {  // Copy exactly the used portion.
-            newData[static_cast<size_t>(i)] = data_[static_cast<size_t>(i)];  // Copy one element.
-            copied += 1;  // Count one copy.
-        }  // Close copy loop.
+        std::unique_ptr<T[]> newData = std::make_unique<T[]>(static_cast<size_t>(newCapacity));  // Allocate new buffer.
+        std::copy(std::make_move_iterator(data_.get()), std::make_move_iterator(data_.get() + size_), newData.get());  // Move exactly the used portion.
+        int copied = size_;  // Every used element was transferred once.
         data_ = std::move(newData);  // Swap buffer.
         capacity_ = newCapacity;  // Update capacity.
         totalCopies_ += static_cast<long long>(copied);  // Accumulate total copies.
@@ -122,7 +172,7 @@ inline PushSummary simulatePushes(int m) {  // Simulate m pushes and summarize g
     if (m < 0) {  // Reject invalid counts.
         throw std::invalid_argument("m must be >= 0");  // Signal invalid input.
     }  // Close validation.
-    ArrayStack s;  // Fresh stack for deterministic results.
+    ArrayStack<int> s;  // Fresh stack for deterministic results.
     long long totalActualCost = 0;  // Accumulate total cost (1 write + copied).
     int maxCopied = 0;  // Track maximum copied elements in a single push.
     for (int i = 0; i < m; i++) {  // Perform m pushes.
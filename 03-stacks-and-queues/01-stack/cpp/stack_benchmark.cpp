@@ -0,0 +1,66 @@
+// 01 堆疊批次操作效能比較（C++）/ Stack benchmark: per-element vs batched push/pop (C++).  // Bilingual file header.
+
+#include "Stack.hpp"  // ArrayStack<T> with push/pop and pushN/popN.
+
+#include <chrono>  // Provide steady_clock for timing.
+#include <iomanip>  // Provide std::setw for table formatting.
+#include <iostream>  // Provide std::cout for console output.
+#include <string>  // Provide std::string for argument parsing and labels.
+#include <vector>  // Provide std::vector for burst buffers.
+
+using Clock = std::chrono::steady_clock;  // Monotonic clock for measurements.
+
+template <typename T>  // Element type under test.
+static double runPerElement(int rounds, int burst, long long& checksum) {  // Push/pop bursts one element at a time.
+    stackunit::ArrayStack<T> s;  // Fresh stack.
+    Clock::time_point start = Clock::now();  // Start timer.
+    for (int r = 0; r < rounds; r++) {  // Repeat bursts.
+        for (int i = 0; i < burst; i++) {  // Push burst.
+            s.push(static_cast<T>(i + r));  // One capacity check per element.
+        }  // Close push loop.
+        for (int i = 0; i < burst; i++) {  // Pop burst.
+            checksum += static_cast<long long>(s.pop().value);  // One PopResult per element.
+        }  // Close pop loop.
+    }  // Close rounds loop.
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();  // Elapsed ns.
+}  // End runPerElement().
+
+template <typename T>  // Element type under test.
+static double runBatched(int rounds, int burst, long long& checksum) {  // Push/pop bursts with pushN/popN.
+    stackunit::ArrayStack<T> s;  // Fresh stack.
+    std::vector<T> in(static_cast<size_t>(burst));  // Input burst buffer.
+    std::vector<T> out(static_cast<size_t>(burst));  // Output burst buffer.
+    Clock::time_point start = Clock::now();  // Start timer.
+    for (int r = 0; r < rounds; r++) {  // Repeat bursts.
+        for (int i = 0; i < burst; i++) {  // Prepare burst values (same values as per-element run).
+            in[static_cast<size_t>(i)] = static_cast<T>(i + r);  // Fill one slot.
+        }  // Close fill loop.
+        s.pushN(in.data(), burst);  // One capacity check + bulk copy.
+        s.popN(out.data(), burst);  // One bounds check + bulk copy.
+        for (int i = 0; i < burst; i++) {  // Consume popped values.
+            checksum += static_cast<long long>(out[static_cast<size_t>(i)]);  // Accumulate.
+        }  // Close consume loop.
+    }  // Close rounds loop.
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();  // Elapsed ns.
+}  // End runBatched().
+
+template <typename T>  // Element type under test.
+static void report(const std::string& label, int rounds, int burst) {  // Print one comparison row pair.
+    long long a = 0;  // Checksum for per-element run.
+    long long b = 0;  // Checksum for batched run.
+    double per = runPerElement<T>(rounds, burst, a);  // Per-element timing.
+    double bat = runBatched<T>(rounds, burst, b);  // Batched timing.
+    double ops = 2.0 * static_cast<double>(rounds) * static_cast<double>(burst);  // push + pop per element.
+    std::cout << std::setw(8) << label << " | " << std::setw(12) << "per-element" << " | " << std::setw(10) << ops / per * 1e3 << " Mops/s\n";  // Row.
+    std::cout << std::setw(8) << label << " | " << std::setw(12) << "pushN/popN" << " | " << std::setw(10) << ops / bat * 1e3 << " Mops/s" << (a == b ? "" : "  (checksum mismatch!)") << "\n";  // Row.
+}  // End report().
+
+int main(int argc, char** argv) {  // argv[1]=burst size, argv[2]=rounds.
+    int burst = (argc > 1) ? std::stoi(std::string(argv[1])) : 256;  // Default burst of a few hundred.
+    int rounds = (argc > 2) ? std::stoi(std::string(argv[2])) : 200000;  // Default number of bursts.
+    std::cout << "burst=" << burst << " rounds=" << rounds << "\n";  // Print workload.
+    std::cout << std::fixed << std::setprecision(1);  // Format floating-point output.
+    report<int>("int", rounds, burst);  // Compare for int.
+    report<double>("double", rounds, burst);  // Compare for double.
+    return 0;  // Exit success.
+}  // Close main().
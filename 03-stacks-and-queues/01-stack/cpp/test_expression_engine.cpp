@@ -0,0 +1,99 @@
+// 01 運算式引擎測試（C++）/ Tests for the expression engine (C++).  // Bilingual file header.
+
+#include "ExpressionEngine.hpp"  // Include the API under test.
+
+#include <cmath>  // Provide std::fabs for floating-point comparisons.
+#include <iostream>  // Provide std::cout for status output.
+#include <stdexcept>  // Provide exception base types for assertions.
+#include <string>  // Provide std::string for expressions.
+#include <type_traits>  // Provide std::is_constructible for the binding check.
+#include <vector>  // Provide std::vector for bindings and columns.
+
+static void assertTrue(bool condition, const std::string& message) {  // Minimal assertion helper.
+    if (!condition) {  // Fail when condition is false.
+        throw std::runtime_error("FAIL: " + message);  // Throw to signal test failure.
+    }  // Close failure branch.
+}  // Close assertTrue().
+
+static void assertNear(double expected, double actual, const std::string& message) {  // Floating-point equality helper.
+    if (std::fabs(expected - actual) > 1e-9) {  // Fail when values differ.
+        throw std::runtime_error("FAIL: " + message + " (expected=" + std::to_string(expected) + ", actual=" + std::to_string(actual) + ")");  // Throw mismatch.
+    }  // Close failure branch.
+}  // Close assertNear().
+
+static double eval(const std::string& source) {  // Evaluate an expression without variables.
+    return stackunit::evaluateExpression(source, {});  // One-shot compile + evaluate.
+}  // Close eval().
+
+static void testArithmeticPrecedenceAndAssociativity() {  // Operators should follow usual math rules.
+    assertNear(7.0, eval("1 + 2 * 3"), "* binds tighter than +");  // Precedence.
+    assertNear(9.0, eval("(1 + 2) * 3"), "parentheses override precedence");  // Grouping.
+    assertNear(2.0, eval("8 - 4 - 2"), "- is left-associative");  // Left associativity.
+    assertNear(512.0, eval("2 ^ 3 ^ 2"), "^ is right-associative");  // Right associativity.
+    assertNear(-4.0, eval("-2 ^ 2"), "^ binds tighter than unary minus");  // Unary vs power.
+    assertNear(0.5, eval("2 ^ -1"), "unary minus in exponent");  // Prefix operator after binary.
+    assertNear(1.0, eval("7 % 3"), "% computes remainder");  // Remainder.
+    assertNear(-6.0, eval("-(1 + 2) * 2"), "unary minus before group");  // Prefix before group.
+    assertNear(2.5e3, eval("2.5e3"), "scientific notation literals");  // Number parsing.
+}  // Close testArithmeticPrecedenceAndAssociativity().
+
+static void testBooleanOperators() {  // Comparisons and logic should yield 1/0.
+    assertNear(1.0, eval("1 < 2 && 3 >= 3"), "&& of two true comparisons");  // And.
+    assertNear(1.0, eval("1 > 2 || 2 != 3"), "|| with one true side");  // Or.
+    assertNear(0.0, eval("!(2 == 2)"), "! negates true");  // Not.
+    assertNear(1.0, eval("1 + 1 == 2"), "arithmetic binds tighter than ==");  // Precedence.
+    assertNear(1.0, eval("true || false && false"), "&& binds tighter than ||");  // Logic precedence.
+}  // Close testBooleanOperators().
+
+static void testVariablesAndStackDepth() {  // Variables get stable slots and depth is computed at compile time.
+    stackunit::CompiledExpression program = stackunit::compileExpression("(x + y) * (x - z)");  // Compile once.
+    assertTrue(program.variables.size() == 3, "x, y, z should each get one slot");  // Slot count.
+    assertTrue(program.variableSlot("x") == 0 && program.variableSlot("z") == 2, "slots follow first appearance");  // Slot order.
+    assertTrue(program.maxStackDepth == 3, "(x+y)*(x-z) needs a depth of 3");  // x+y result, x, z.
+    stackunit::ExpressionEvaluator evaluator(program);  // Bind evaluator.
+    double vars[3] = {5.0, 1.0, 2.0};  // x=5, y=1, z=2.
+    assertNear(18.0, evaluator.evaluate(vars), "(5+1)*(5-2)");  // Evaluate.
+    vars[0] = 10.0;  // Rebind x without recompiling.
+    assertNear(88.0, evaluator.evaluate(vars), "(10+1)*(10-2)");  // Evaluate again.
+    static_assert(!std::is_constructible<stackunit::ExpressionEvaluator, stackunit::CompiledExpression&&>::value,  // Evaluator keeps a reference,
+                  "an evaluator must not bind a temporary program");  // so a temporary program is rejected.
+}  // Close testVariablesAndStackDepth().
+
+static void testBatchEvaluationOverColumns() {  // evaluateBatch should match per-row evaluation.
+    stackunit::CompiledExpression program = stackunit::compileExpression("price * qty > 100 && !blocked");  // Rule.
+    std::vector<double> price{10.0, 50.0, 20.0, 1.0};  // Column for slot 0.
+    std::vector<double> qty{5.0, 3.0, 6.0, 1000.0};  // Column for slot 1.
+    std::vector<double> blocked{0.0, 0.0, 1.0, 0.0};  // Column for slot 2.
+    std::vector<double> out(4, -1.0);  // Output column.
+    stackunit::ExpressionEvaluator evaluator(program);  // Bind evaluator.
+    evaluator.evaluateBatch({price.data(), qty.data(), blocked.data()}, 4, out.data());  // Evaluate all rows.
+    assertTrue(out == std::vector<double>({0.0, 1.0, 0.0, 1.0}), "batch results should match per-row logic");  // Compare.
+}  // Close testBatchEvaluationOverColumns().
+
+static void testSyntaxErrorsThrow() {  // Malformed input should be rejected at compile time.
+    const char* bad[] = {"1 +", "(1 + 2", "1 + 2)", "* 3", "1 2", "", "a $ b"};  // Invalid sources.
+    for (const char* source : bad) {  // Try each.
+        bool threw = false;  // Track exception.
+        try {  // Compile.
+            (void)stackunit::compileExpression(source);  // Should throw.
+        } catch (const std::invalid_argument&) {  // Expected type.
+            threw = true;  // Record.
+        }  // Close catch.
+        assertTrue(threw, std::string("should reject: '") + source + "'");  // Validate.
+    }  // Close loop.
+}  // Close testSyntaxErrorsThrow().
+
+int main() {  // Run all tests and print status.
+    try {  // Catch failures and print a clean message.
+        testArithmeticPrecedenceAndAssociativity();  // Run arithmetic tests.
+        testBooleanOperators();  // Run boolean tests.
+        testVariablesAndStackDepth();  // Run variable/depth tests.
+        testBatchEvaluationOverColumns();  // Run batch tests.
+        testSyntaxErrorsThrow();  // Run syntax-error tests.
+        std::cout << "All tests PASSED.\n";  // Print success.
+        return 0;  // Exit success.
+    } catch (const std::exception& ex) {  // Print any test failure.
+        std::cerr << ex.what() << "\n";  // Print failure message.
+        return 1;  // Exit failure.
+    }  // Close catch.
+}  // Close main().
@@ -4,6 +4,7 @@
 
 #include <iostream>  // Provide std::cout for status output.
 #include <stdexcept>  // Provide exception base types for assertions.
+#include <string>  // Provide std::string for the templated-stack test.
 #include <vector>  // Provide std::vector for expected snapshots.
 
 static void assertTrue(bool condition, const char* message) {  // Minimal assertion helper.
@@ -67,11 +68,55 @@ static void testEmptyOperationsThrow() {  // pop/peek should reject empty stack.
     assertThrowsOutOfRange([&]() { (void)s.pop(); }, "pop should throw on empty");  // Invalid pop.
 }  // Close testEmptyOperationsThrow().
 
+static void testPushNResizesOnceAndMatchesPushes() {  // pushN should check capacity once and land on the same layout.
+    stackunit::ArrayStack<int> bulk;  // Stack filled with one burst.
+    stackunit::ArrayStack<int> single;  // Stack filled one push at a time.
+    std::vector<int> values{1, 2, 3, 4, 5, 6, 7, 8, 9};  // Burst of 9 values.
+    stackunit::BatchCost cost = bulk.pushN(values);  // Push whole burst.
+    for (int v : values) {  // Reference: per-element pushes.
+        single.push(v);  // Push one value.
+    }  // Close loop.
+    assertEquals(9, cost.count, "pushN should report 9 pushed elements");  // Validate count.
+    assertEquals(1, cost.resizes, "pushN should resize at most once");  // Validate single resize.
+    assertEquals(0, cost.copied, "empty stack has nothing to copy");  // Validate copies.
+    assertEquals(single.capacity(), bulk.capacity(), "pushN should follow the doubling schedule");  // Same capacity (16).
+    assertVectorEquals(single.toVector(), bulk.toVector(), "pushN should keep push order");  // Same contents.
+    cost = bulk.pushN(values);  // Second burst needs 18 slots => one resize copying 9.
+    assertEquals(1, cost.resizes, "second burst should resize once");  // Validate single resize.
+    assertEquals(9, cost.copied, "resize should copy the 9 existing elements");  // Validate copies.
+}  // Close testPushNResizesOnceAndMatchesPushes().
+
+static void testPopNReturnsLifoOrder() {  // popN should emit values top-first.
+    stackunit::ArrayStack<int> s;  // Start with empty stack.
+    s.pushN(std::vector<int>{10, 20, 30, 40});  // Stack bottom->top: 10,20,30,40.
+    int out[3] = {0, 0, 0};  // Output buffer.
+    stackunit::BatchCost cost = s.popN(out, 3);  // Pop three.
+    assertEquals(3, cost.count, "popN should report 3 popped elements");  // Validate count.
+    assertVectorEquals(std::vector<int>{40, 30, 20}, std::vector<int>(out, out + 3), "popN should return top first");  // Validate order.
+    assertEquals(10, s.peek(), "bottom element should remain");  // Validate remainder.
+    assertThrowsOutOfRange([&]() { (void)s.popN(out, 2); }, "popN beyond size should throw");  // Invalid popN.
+    assertEquals(1, s.size(), "failed popN should not change the stack");  // Validate no partial pop.
+}  // Close testPopNReturnsLifoOrder().
+
+static void testTemplatedStackWithStrings() {  // ArrayStack<T> should work for non-int element types.
+    stackunit::ArrayStack<std::string> s;  // String stack.
+    s.push("a");  // Push one value.
+    s.pushN(std::vector<std::string>{"b", "c"});  // Push a burst.
+    assertTrue(s.pop().value == "c", "pop should return last pushed string");  // Validate LIFO.
+    assertTrue(s.peek() == "b", "peek should see the next string");  // Validate peek.
+    s.clear();  // Drop everything but keep capacity.
+    assertTrue(s.isEmpty(), "clear should empty the stack");  // Validate clear.
+    assertEquals(4, s.capacity(), "clear should keep capacity");  // Validate capacity retained.
+}  // Close testTemplatedStackWithStrings().
+
 int main() {  // Run all tests and print status.
     try {  // Catch failures and print a clean message.
         testLifoPushPopAndPeek();  // Run LIFO tests.
         testPushResizeCopiedCounts();  // Run resize cost tests.
         testEmptyOperationsThrow();  // Run empty-operation tests.
+        testPushNResizesOnceAndMatchesPushes();  // Run bulk push tests.
+        testPopNReturnsLifoOrder();  // Run bulk pop tests.
+        testTemplatedStackWithStrings();  // Run templated stack tests.
         std::cout << "All tests PASSED.\n";  // Print success.
         return 0;  // Exit success.
     } catch (const std::exception& ex) {  // Print any test failure.
@@ -0,0 +1,154 @@
+// 03 多層回饋佇列（C++）/ Multi-level feedback queue built from CircularQueue (C++).  // Bilingual header line for this unit.
+#ifndef MULTI_LEVEL_FEEDBACK_QUEUE_HPP  // Header guard to prevent multiple inclusion.
+#define MULTI_LEVEL_FEEDBACK_QUEUE_HPP  // Header guard definition.
+
+#include "CircularQueue.hpp"  // Each priority level is one CircularQueue.
+
+#include <cstdint>  // Provide std::uint64_t for the non-empty bitmap.
+#include <stdexcept>  // Provide exceptions for validation.
+#include <utility>  // Provide std::swap for O(1) bulk moves into empty levels.
+#include <vector>  // Provide std::vector to hold the level queues.
+
+namespace circularqueueunit {  // Share the namespace with CircularQueue.
+
+struct ScheduledTask {  // One scheduling decision.
+    int task;  // Task id taken from the queue.
+    int level;  // Level it was taken from (0 = highest priority).
+};  // End ScheduledTask.
+
+inline int lowestSetBit(std::uint64_t mask) {  // Index of the least-significant 1 bit (mask must be non-zero).
+#if defined(__GNUC__) || defined(__clang__)  // Use the count-trailing-zeros instruction when available.
+    return __builtin_ctzll(mask);  // Single instruction (tzcnt/bsf) on x86.
+#else  // Portable fallback.
+    int index = 0;  // Bit position.
+    while ((mask & 1u) == 0u) {  // Shift until the lowest bit is set.
+        mask >>= 1;  // Drop one zero bit.
+        index += 1;  // Count it.
+    }  // Close loop.
+    return index;  // Return bit position.
+#endif  // End builtin selection.
+}  // End lowestSetBit().
+
+class MultiLevelFeedbackQueue {  // N CircularQueues + a bitmap of non-empty levels.
+public:
+    static constexpr int MAX_LEVELS = 64;  // One bit per level in a 64-bit mask.
+
+    explicit MultiLevelFeedbackQueue(int levels)  // Create `levels` empty priority levels.
+        : queues_(),  // Filled below after validation.
+          nonEmpty_(0u),  // No level holds tasks yet.
+          size_(0) {  // No tasks yet.
+        if (levels < 1 || levels > MAX_LEVELS) {  // Bitmap holds at most 64 levels.
+            throw std::invalid_argument("levels must be in [1, 64]");  // Signal invalid input.
+        }  // Close validation.
+        queues_.resize(static_cast<size_t>(levels));  // One CircularQueue per level.
+    }  // Close constructor.
+
+    int levels() const {  // Expose number of priority levels.
+        return static_cast<int>(queues_.size());  // Return level count.
+    }  // End levels().
+
+    int size() const {  // Expose total queued tasks across levels.
+        return size_;  // Return task count.
+    }  // End size().
+
+    bool isEmpty() const {  // Convenience helper to check emptiness.
+        return size_ == 0;  // Empty iff no tasks.
+    }  // End isEmpty().
+
+    int levelSize(int level) const {  // Expose number of tasks waiting at one level.
+        checkLevel(level);  // Validate level.
+        return queues_[static_cast<size_t>(level)].size();  // Return that queue's size.
+    }  // End levelSize().
+
+    std::uint64_t nonEmptyMask() const {  // Bit i is set iff level i holds at least one task.
+        return nonEmpty_;  // Return bitmap.
+    }  // End nonEmptyMask().
+
+    void enqueue(int task, int level) {  // Add a task at the back of a level (amortized O(1)).
+        checkLevel(level);  // Validate level.
+        queues_[static_cast<size_t>(level)].enqueue(task);  // Append to that level.
+        nonEmpty_ |= bit(level);  // Level is now non-empty.
+        size_ += 1;  // Count task.
+    }  // End enqueue().
+
+    int highestNonEmptyLevel() const {  // Highest-priority level with work, or -1 when idle (O(1)).
+        return nonEmpty_ == 0u ? -1 : lowestSetBit(nonEmpty_);  // ctz of the bitmap.
+    }  // End highestNonEmptyLevel().
+
+    ScheduledTask dequeueNext() {  // Take the next task to run (O(1): ctz + one dequeue).
+        if (nonEmpty_ == 0u) {  // Reject scheduling with no tasks.
+            throw std::out_of_range("dequeue from empty scheduler");  // Signal invalid operation.
+        }  // Close validation.
+        int level = lowestSetBit(nonEmpty_);  // Highest-priority non-empty level.
+        CircularQueue& q = queues_[static_cast<size_t>(level)];  // That level's queue.
+        int task = q.dequeue().value;  // Take its oldest task.
+        if (q.isEmpty()) {  // Level drained.
+            nonEmpty_ &= ~bit(level);  // Clear its bit.
+        }  // Close drained branch.
+        size_ -= 1;  // Count removal.
+        return ScheduledTask{task, level};  // Report decision.
+    }  // End dequeueNext().
+
+    int requeueDemoted(const ScheduledTask& ran) {  // Task used its full quantum: requeue one level lower.
+        int target = ran.level + 1 < levels() ? ran.level + 1 : ran.level;  // Lowest level keeps round-robin.
+        enqueue(ran.task, target);  // Requeue.
+        return target;  // Report new level.
+    }  // End requeueDemoted().
+
+    int demoteLevel(int level) {  // Move every task at `level` to `level + 1`; return tasks moved.
+        checkLevel(level);  // Validate level.
+        if (level + 1 >= levels()) {  // Lowest level cannot be demoted further.
+            return 0;  // Nothing moved.
+        }  // Close boundary branch.
+        return moveAll(level, level + 1);  // Bulk move (O(1) when the target is empty).
+    }  // End demoteLevel().
+
+    int boostAll() {  // Priority boost (aging): move every task to level 0; return tasks moved.
+        int moved = 0;  // Count moved tasks.
+        std::uint64_t pending = nonEmpty_ & ~bit(0);  // Non-empty levels other than 0.
+        while (pending != 0u) {  // Visit only non-empty levels, highest priority first (keeps their order).
+            int level = lowestSetBit(pending);  // Next non-empty level.
+            pending &= pending - 1u;  // Clear that bit from the worklist.
+            moved += moveAll(level, 0);  // Append its tasks to level 0.
+        }  // Close loop.
+        return moved;  // Report moved tasks.
+    }  // End boostAll().
+
+private:
+    std::vector<CircularQueue> queues_;  // Level i queue (0 = highest priority).
+    std::uint64_t nonEmpty_;  // Bit i set iff queues_[i] is non-empty.
+    int size_;  // Total tasks across levels.
+
+    static std::uint64_t bit(int level) {  // Single-bit mask for a level.
+        return std::uint64_t{1} << level;  // Shift 1 into place.
+    }  // End bit().
+
+    void checkLevel(int level) const {  // Validate a level index.
+        if (level < 0 || level >= levels()) {  // Reject out-of-range levels.
+            throw std::out_of_range("level out of range");  // Signal invalid access.
+        }  // Close validation.
+    }  // End checkLevel().
+
+    int moveAll(int from, int to) {  // Append all tasks of `from` to `to` in FIFO order; return count.
+        CircularQueue& src = queues_[static_cast<size_t>(from)];  // Source level.
+        CircularQueue& dst = queues_[static_cast<size_t>(to)];  // Target level.
+        int moved = src.size();  // Tasks to move.
+        if (moved == 0) {  // Nothing to do.
+            return 0;  // No change.
+        }  // Close empty branch.
+        if (dst.isEmpty()) {  // Empty target: swap buffers instead of copying (O(1)).
+            std::swap(src, dst);  // Exchange the two queues wholesale.
+        } else {  // Non-empty target: append task by task (O(moved)).
+            while (!src.isEmpty()) {  // Drain source in order.
+                dst.enqueue(src.dequeue().value);  // Move one task.
+            }  // Close drain loop.
+        }  // Close move strategy branch.
+        nonEmpty_ &= ~bit(from);  // Source is now empty.
+        nonEmpty_ |= bit(to);  // Target is now non-empty.
+        return moved;  // Report moved tasks.
+    }  // End moveAll().
+};  // End MultiLevelFeedbackQueue.
+
+}  // namespace circularqueueunit  // Close namespace.
+
+#endif  // MULTI_LEVEL_FEEDBACK_QUEUE_HPP  // End of header guard.
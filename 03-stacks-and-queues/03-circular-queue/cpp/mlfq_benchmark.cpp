@@ -0,0 +1,80 @@
+// 03 多層回饋佇列效能量測（C++）/ Multi-level feedback queue scheduling benchmark (C++).  // Bilingual file header.
+
+#include "MultiLevelFeedbackQueue.hpp"  // Scheduler under test.
+
+#include <chrono>  // Provide steady_clock for timing.
+#include <iomanip>  // Provide std::setw for table formatting.
+#include <iostream>  // Provide std::cout for console output.
+#include <string>  // Provide std::string for argument parsing.
+#include <type_traits>  // Provide std::is_same for the aging branch.
+#include <vector>  // Provide std::vector for the naive baseline.
+
+using Clock = std::chrono::steady_clock;  // Monotonic clock for measurements.
+
+class LinearScanScheduler {  // Baseline: same level queues, but scan levels from 0 to find work.
+public:
+    explicit LinearScanScheduler(int levels) : queues_(static_cast<size_t>(levels)) {}  // One queue per level.
+
+    void enqueue(int task, int level) {  // Append at a level.
+        queues_[static_cast<size_t>(level)].enqueue(task);  // Delegate to CircularQueue.
+    }  // End enqueue().
+
+    circularqueueunit::ScheduledTask dequeueNext() {  // O(levels) scan for the first non-empty level.
+        for (size_t level = 0; level < queues_.size(); level++) {  // Scan from highest priority.
+            if (!queues_[level].isEmpty()) {  // Found work.
+                return circularqueueunit::ScheduledTask{queues_[level].dequeue().value, static_cast<int>(level)};  // Take it.
+            }  // Close found branch.
+        }  // Close scan loop.
+        return circularqueueunit::ScheduledTask{-1, -1};  // Idle (not reached in this benchmark).
+    }  // End dequeueNext().
+
+    void requeueDemoted(const circularqueueunit::ScheduledTask& ran) {  // Requeue one level lower.
+        int last = static_cast<int>(queues_.size()) - 1;  // Lowest level.
+        enqueue(ran.task, ran.level < last ? ran.level + 1 : last);  // Demote.
+    }  // End requeueDemoted().
+
+private:
+    std::vector<circularqueueunit::CircularQueue> queues_;  // Level queues.
+};  // End LinearScanScheduler.
+
+template <typename Scheduler>  // Works with both schedulers.
+static double runDecisions(Scheduler& scheduler, long long decisions, int boostEvery, long long& checksum) {  // Return seconds.
+    Clock::time_point start = Clock::now();  // Start timer.
+    for (long long d = 0; d < decisions; d++) {  // Each iteration is one scheduling decision.
+        circularqueueunit::ScheduledTask t = scheduler.dequeueNext();  // Pick next task.
+        checksum += t.task + t.level;  // Consume decision.
+        scheduler.requeueDemoted(t);  // Quantum expired: demote and requeue.
+        if constexpr (std::is_same<Scheduler, circularqueueunit::MultiLevelFeedbackQueue>::value) {  // Only the real MLFQ has aging.
+            if (boostEvery > 0 && (d + 1) % boostEvery == 0) {  // Periodic priority boost.
+                checksum += scheduler.boostAll();  // Bulk move everything to level 0.
+            }  // Close boost branch.
+        }  // Close compile-time branch.
+    }  // Close decision loop.
+    return std::chrono::duration<double>(Clock::now() - start).count();  // Elapsed seconds.
+}  // End runDecisions().
+
+int main(int argc, char** argv) {  // argv[1]=queued tasks, argv[2]=decisions, argv[3]=levels.
+    int tasks = (argc > 1) ? std::stoi(std::string(argv[1])) : 1000000;  // Default 10^6 queued tasks.
+    long long decisions = (argc > 2) ? std::stoll(std::string(argv[2])) : 10000000LL;  // Default 10^7 decisions.
+    int levels = (argc > 3) ? std::stoi(std::string(argv[3])) : 64;  // Default 64 levels.
+    int boostEvery = tasks * 4;  // Boost after roughly four rounds over the whole population.
+
+    circularqueueunit::MultiLevelFeedbackQueue mlfq(levels);  // Bitmap + ctz scheduler.
+    LinearScanScheduler naive(levels);  // Linear-scan baseline.
+    for (int i = 0; i < tasks; i++) {  // Spread tasks over the lowest levels so the scan has work to do.
+        int level = levels - 1 - (i % 4);  // Bottom four levels.
+        mlfq.enqueue(i, level);  // Fill scheduler.
+        naive.enqueue(i, level);  // Fill baseline.
+    }  // Close fill loop.
+
+    long long checksum = 0;  // Observable result.
+    double mlfqSeconds = runDecisions(mlfq, decisions, boostEvery, checksum);  // Measure bitmap scheduler.
+    double naiveSeconds = runDecisions(naive, decisions, 0, checksum);  // Measure baseline.
+
+    std::cout << "tasks=" << tasks << " levels=" << levels << " decisions=" << decisions << "\n";  // Print configuration.
+    std::cout << std::fixed << std::setprecision(2);  // Format rates.
+    std::cout << std::setw(22) << "bitmap + ctz" << " | " << std::setw(8) << static_cast<double>(decisions) / mlfqSeconds / 1e6 << " M decisions/s\n";  // Row.
+    std::cout << std::setw(22) << "linear level scan" << " | " << std::setw(8) << static_cast<double>(decisions) / naiveSeconds / 1e6 << " M decisions/s\n";  // Row.
+    std::cout << "checksum=" << checksum << "\n";  // Print checksum so the work is observable.
+    return 0;  // Exit success.
+}  // Close main().
@@ -0,0 +1,107 @@
+// 03 多層回饋佇列測試（C++）/ Tests for the multi-level feedback queue (C++).  // Bilingual file header.
+
+#include "MultiLevelFeedbackQueue.hpp"  // Include the API under test.
+
+#include <iostream>  // Provide std::cout for status output.
+#include <stdexcept>  // Provide exception base types for assertions.
+#include <string>  // Provide std::string for failure messages.
+#include <vector>  // Provide std::vector for expected schedules.
+
+static void assertTrue(bool condition, const char* message) {  // Minimal assertion helper.
+    if (!condition) {  // Fail when condition is false.
+        throw std::runtime_error(std::string("FAIL: ") + message);  // Throw to signal test failure.
+    }  // Close failure branch.
+}  // Close assertTrue().
+
+static void assertEquals(long long expected, long long actual, const char* message) {  // Minimal equality assertion helper.
+    if (expected != actual) {  // Fail when values differ.
+        throw std::runtime_error(std::string("FAIL: ") + message + " (expected=" + std::to_string(expected) + ", actual=" + std::to_string(actual) + ")");  // Throw mismatch.
+    }  // Close failure branch.
+}  // Close assertEquals().
+
+template <typename Func>  // Template for simple exception assertions.
+static void assertThrowsOutOfRange(Func f, const char* message) {  // Assert that f throws std::out_of_range.
+    try {  // Run action.
+        f();  // Execute function.
+    } catch (const std::out_of_range&) {  // Accept expected type.
+        return;  // Test passed.
+    } catch (...) {  // Reject other exceptions.
+        throw std::runtime_error(std::string("FAIL: ") + message + " (wrong exception type)");  // Wrong type.
+    }  // Close catch.
+    throw std::runtime_error(std::string("FAIL: ") + message + " (no exception thrown)");  // Fail if nothing thrown.
+}  // Close assertThrowsOutOfRange().
+
+static std::vector<int> drain(circularqueueunit::MultiLevelFeedbackQueue& q) {  // Dequeue everything in schedule order.
+    std::vector<int> order;  // Scheduled task ids.
+    while (!q.isEmpty()) {  // Until idle.
+        order.push_back(q.dequeueNext().task);  // Record next decision.
+    }  // Close loop.
+    return order;  // Return schedule.
+}  // Close drain().
+
+static void testHighestLevelFirstAndFifoWithinLevel() {  // Level 0 runs first; each level is FIFO.
+    circularqueueunit::MultiLevelFeedbackQueue q(4);  // Four levels.
+    q.enqueue(30, 3);  // Low priority.
+    q.enqueue(10, 1);  // Medium priority.
+    q.enqueue(11, 1);  // Medium priority, later.
+    q.enqueue(0, 0);  // Highest priority.
+    assertEquals(0b1011, static_cast<long long>(q.nonEmptyMask()), "bitmap should mark levels 0, 1 and 3");  // Validate bitmap.
+    assertEquals(0, q.highestNonEmptyLevel(), "level 0 should be chosen first");  // Validate ctz.
+    assertTrue(drain(q) == std::vector<int>({0, 10, 11, 30}), "schedule should be by level then FIFO");  // Validate order.
+    assertEquals(0, static_cast<long long>(q.nonEmptyMask()), "bitmap should be clear when idle");  // Validate bitmap.
+    assertEquals(-1, q.highestNonEmptyLevel(), "idle scheduler should report -1");  // Validate idle.
+}  // Close testHighestLevelFirstAndFifoWithinLevel().
+
+static void testRequeueDemotesUntilLowestLevel() {  // Quantum expiry should demote one level per round.
+    circularqueueunit::MultiLevelFeedbackQueue q(3);  // Three levels.
+    q.enqueue(7, 0);  // One task at top.
+    circularqueueunit::ScheduledTask t = q.dequeueNext();  // Run at level 0.
+    assertEquals(1, q.requeueDemoted(t), "first demotion goes to level 1");  // Validate target.
+    t = q.dequeueNext();  // Run at level 1.
+    assertEquals(2, q.requeueDemoted(t), "second demotion goes to level 2");  // Validate target.
+    t = q.dequeueNext();  // Run at level 2.
+    assertEquals(2, q.requeueDemoted(t), "lowest level keeps the task");  // Validate floor.
+    assertEquals(1, q.levelSize(2), "task should wait at level 2");  // Validate placement.
+}  // Close testRequeueDemotesUntilLowestLevel().
+
+static void testBulkDemoteAndBoostPreserveOrder() {  // Bulk moves should keep FIFO order and the bitmap in sync.
+    circularqueueunit::MultiLevelFeedbackQueue q(4);  // Four levels.
+    q.enqueue(1, 1);  // Level 1: [1,2].
+    q.enqueue(2, 1);  // Level 1.
+    q.enqueue(3, 2);  // Level 2: [3].
+    assertEquals(2, q.demoteLevel(1), "demoteLevel should move both level-1 tasks");  // Move [1,2] after [3].
+    assertEquals(0, q.levelSize(1), "level 1 should be empty after demotion");  // Validate source.
+    assertEquals(0b0100, static_cast<long long>(q.nonEmptyMask()), "only level 2 should be non-empty");  // Validate bitmap.
+    q.enqueue(9, 3);  // Level 3: [9].
+    q.enqueue(0, 0);  // Level 0: [0].
+    assertEquals(4, q.boostAll(), "boostAll should move every non-top task");  // Move 3,1,2,9 to level 0.
+    assertEquals(1, static_cast<long long>(q.nonEmptyMask()), "only level 0 should be non-empty after boost");  // Validate bitmap.
+    assertTrue(drain(q) == std::vector<int>({0, 3, 1, 2, 9}), "boost should keep level order then FIFO order");  // Validate order.
+}  // Close testBulkDemoteAndBoostPreserveOrder().
+
+static void testInvalidUsageThrows() {  // Invalid levels and empty scheduling should be rejected.
+    circularqueueunit::MultiLevelFeedbackQueue q(2);  // Two levels.
+    assertThrowsOutOfRange([&]() { q.enqueue(1, 2); }, "enqueue at level >= levels should throw");  // Bad level.
+    assertThrowsOutOfRange([&]() { (void)q.dequeueNext(); }, "dequeueNext on idle scheduler should throw");  // Empty.
+    bool threw = false;  // Track constructor validation.
+    try {  // Too many levels for a 64-bit bitmap.
+        circularqueueunit::MultiLevelFeedbackQueue tooMany(65);  // Should throw.
+    } catch (const std::invalid_argument&) {  // Expected type.
+        threw = true;  // Record.
+    }  // Close catch.
+    assertTrue(threw, "more than 64 levels should be rejected");  // Validate.
+}  // Close testInvalidUsageThrows().
+
+int main() {  // Run all tests and print status.
+    try {  // Catch failures and print a clean message.
+        testHighestLevelFirstAndFifoWithinLevel();  // Run ordering tests.
+        testRequeueDemotesUntilLowestLevel();  // Run demotion tests.
+        testBulkDemoteAndBoostPreserveOrder();  // Run bulk-move tests.
+        testInvalidUsageThrows();  // Run validation tests.
+        std::cout << "All tests PASSED.\n";  // Print success.
+        return 0;  // Exit success.
+    } catch (const std::exception& ex) {  // Print any test failure.
+        std::cerr << ex.what() << "\n";  // Print failure message.
+        return 1;  // Exit failure.
+    }  // Close catch.
+}  // Close main().
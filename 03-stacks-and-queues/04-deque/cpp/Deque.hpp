@@ -79,6 +79,13 @@ public:
         return OperationCost{copied, 0};  // moved stays 0 (no shifting).
     }  // End pushFront().
 
+    int at(int index) const {  // Return the element at logical position index (0 = front) in O(1).
+        if (index < 0 || index >= size_) {  // Reject out-of-range positions.
+            throw std::out_of_range("deque index out of range");  // Signal invalid access.
+        }  // Close validation.
+        return data_[static_cast<size_t>(indexAt(index))];  // Map logical index to physical slot.
+    }  // End at().
+
     int peekFront() const {  // Return front value without removing it (O(1)).
         if (size_ == 0) {  // Reject peeking an empty deque.
             throw std::out_of_range("peek from empty deque");  // Signal invalid operation.
@@ -0,0 +1,209 @@
+// 04 分段雙端佇列（C++）/ Segmented (blocked) deque (C++).  // Bilingual header line for this unit.
+#ifndef SEGMENTED_DEQUE_HPP  // Header guard to prevent multiple inclusion.
+#define SEGMENTED_DEQUE_HPP  // Header guard definition.
+
+#include "Deque.hpp"  // Reuse OperationCost/PopResult so both deques report costs the same way.
+
+#include <algorithm>  // Provide std::max for map sizing.
+#include <memory>  // Provide std::unique_ptr for owning blocks.
+#include <stdexcept>  // Provide exceptions for validation.
+#include <vector>  // Provide std::vector for the block map and snapshots.
+
+namespace dequeunit {  // Share the namespace with Deque so callers can mix both types.
+
+class SegmentedDeque {  // A deque made of fixed-size blocks plus a block map (like std::deque).
+public:
+    static constexpr int BLOCK_SHIFT = 7;  // log2 of block size (128 ints = 512 bytes per block).
+    static constexpr int BLOCK_SIZE = 1 << BLOCK_SHIFT;  // Number of elements stored in one block.
+    static constexpr int BLOCK_MASK = BLOCK_SIZE - 1;  // Mask for "position within block".
+
+    SegmentedDeque()  // Initialize an empty deque with a small, centered block map.
+        : map_(INITIAL_MAP_SIZE),  // Start with a few empty map slots (no blocks allocated yet).
+          firstBlock_(INITIAL_MAP_SIZE / 2),  // Center the first block so both ends can grow.
+          headOffset_(BLOCK_SIZE / 2),  // Start mid-block so the first pushFront needs no new block.
+          size_(0),  // Start with no stored elements.
+          allocatedBlocks_(0),  // No blocks are allocated until the first push.
+          mapMoves_(0) {  // No block pointers moved yet.
+    }  // Close constructor.
+
+    int size() const {  // Expose current size for callers/tests.
+        return size_;  // Return number of stored items.
+    }  // End size().
+
+    bool isEmpty() const {  // Convenience helper to check emptiness.
+        return size_ == 0;  // Empty iff size is zero.
+    }  // End isEmpty().
+
+    int blockCount() const {  // Expose how many element blocks are currently allocated.
+        return allocatedBlocks_;  // Return live block count.
+    }  // End blockCount().
+
+    int mapCapacity() const {  // Expose how many block pointers the map can hold.
+        return static_cast<int>(map_.size());  // Return map slot count.
+    }  // End mapCapacity().
+
+    long long mapMoves() const {  // Expose total block pointers moved while growing/recentering the map.
+        return mapMoves_;  // Return pointer-move count (elements themselves are never copied).
+    }  // End mapMoves().
+
+    std::vector<int> toVector() const {  // Return a copy of the elements (front -> back).
+        std::vector<int> out;  // Output container.
+        out.reserve(static_cast<size_t>(size_));  // Reserve to avoid reallocations.
+        for (int i = 0; i < size_; i++) {  // Copy elements in deque order.
+            out.push_back(*slotAt(i));  // Append one element.
+        }  // Close loop.
+        return out;  // Return copy.
+    }  // End toVector().
+
+    int& operator[](int index) {  // Unchecked O(1) access by logical position (0 = front).
+        return *slotAt(index);  // Translate position to (block, offset) and return reference.
+    }  // End operator[]().
+
+    const int& operator[](int index) const {  // Unchecked O(1) read access by logical position.
+        return *slotAt(index);  // Translate position to (block, offset) and return reference.
+    }  // End operator[]() const.
+
+    int& at(int index) {  // Checked O(1) access by logical position.
+        checkIndex(index);  // Reject out-of-range positions.
+        return *slotAt(index);  // Return reference to the stored element.
+    }  // End at().
+
+    const int& at(int index) const {  // Checked O(1) read access by logical position.
+        checkIndex(index);  // Reject out-of-range positions.
+        return *slotAt(index);  // Return reference to the stored element.
+    }  // End at() const.
+
+    OperationCost pushBack(int value) {  // Push at back (no element is ever copied).
+        int pos = headOffset_ + size_;  // Global position of the new tail slot.
+        int block = firstBlock_ + (pos >> BLOCK_SHIFT);  // Map slot of the block holding that position.
+        if (block >= static_cast<int>(map_.size())) {  // No map slot to the right: grow/recenter the map.
+            reallocateMap();  // Move block pointers (never elements) into a roomier map.
+            block = firstBlock_ + (pos >> BLOCK_SHIFT);  // Recompute block slot after recentering.
+        }  // Close map-growth branch.
+        ensureBlock(block);  // Allocate the block on first use.
+        map_[static_cast<size_t>(block)][static_cast<size_t>(pos & BLOCK_MASK)] = value;  // Store value in place.
+        size_ += 1;  // Increase size.
+        return OperationCost{0, 0};  // Blocks never move, so copied/moved stay 0.
+    }  // End pushBack().
+
+    OperationCost pushFront(int value) {  // Push at front (no element is ever copied).
+        if (headOffset_ == 0) {  // Front block is full on the left: step into the previous block.
+            if (firstBlock_ == 0) {  // No map slot to the left: grow/recenter the map.
+                reallocateMap();  // Move block pointers (never elements) into a roomier map.
+            }  // Close map-growth branch.
+            firstBlock_ -= 1;  // New front block sits just before the old one.
+            headOffset_ = BLOCK_SIZE;  // Position just past the end of the new block.
+        }  // Close block-step branch.
+        ensureBlock(firstBlock_);  // Allocate the front block on first use.
+        headOffset_ -= 1;  // Move head left by one within the block.
+        map_[static_cast<size_t>(firstBlock_)][static_cast<size_t>(headOffset_)] = value;  // Store value in place.
+        size_ += 1;  // Increase size.
+        return OperationCost{0, 0};  // Blocks never move, so copied/moved stay 0.
+    }  // End pushFront().
+
+    int peekFront() const {  // Return front value without removing it (O(1)).
+        if (size_ == 0) {  // Reject peeking an empty deque.
+            throw std::out_of_range("peek from empty deque");  // Signal invalid operation.
+        }  // Close validation.
+        return *slotAt(0);  // Return front element.
+    }  // End peekFront().
+
+    int peekBack() const {  // Return back value without removing it (O(1)).
+        if (size_ == 0) {  // Reject peeking an empty deque.
+            throw std::out_of_range("peek from empty deque");  // Signal invalid operation.
+        }  // Close validation.
+        return *slotAt(size_ - 1);  // Return back element.
+    }  // End peekBack().
+
+    PopResult popFront() {  // Pop from front (O(1); frees a block once it is fully consumed).
+        if (size_ == 0) {  // Reject popping an empty deque.
+            throw std::out_of_range("pop from empty deque");  // Signal invalid operation.
+        }  // Close validation.
+        int removed = *slotAt(0);  // Capture front value.
+        headOffset_ += 1;  // Advance head within the front block.
+        size_ -= 1;  // Decrease size.
+        if (size_ == 0) {  // Deque became empty: release everything and recenter.
+            resetEmpty();  // Free remaining block(s) and restore the initial layout.
+        } else if (headOffset_ == BLOCK_SIZE) {  // Front block is fully consumed.
+            releaseBlock(firstBlock_);  // Free the consumed block.
+            firstBlock_ += 1;  // Next block becomes the front block.
+            headOffset_ = 0;  // Head is now at the start of that block.
+        }  // Close block-release branch.
+        return PopResult{removed, OperationCost{0, 0}};  // moved stays 0 (no shift).
+    }  // End popFront().
+
+    PopResult popBack() {  // Pop from back (O(1); frees a block once it is fully consumed).
+        if (size_ == 0) {  // Reject popping an empty deque.
+            throw std::out_of_range("pop from empty deque");  // Signal invalid operation.
+        }  // Close validation.
+        int pos = headOffset_ + size_ - 1;  // Global position of the tail element.
+        int removed = *slotAt(size_ - 1);  // Capture back value.
+        size_ -= 1;  // Decrease size.
+        if (size_ == 0) {  // Deque became empty: release everything and recenter.
+            resetEmpty();  // Free remaining block(s) and restore the initial layout.
+        } else if ((pos & BLOCK_MASK) == 0) {  // Tail was the first slot of its block: block is now unused.
+            releaseBlock(firstBlock_ + (pos >> BLOCK_SHIFT));  // Free that block.
+        }  // Close block-release branch.
+        return PopResult{removed, OperationCost{0, 0}};  // moved stays 0 (no shift).
+    }  // End popBack().
+
+private:
+    static constexpr int INITIAL_MAP_SIZE = 8;  // Initial number of block pointers in the map.
+
+    std::vector<std::unique_ptr<int[]>> map_;  // Block map: each non-null entry owns one fixed-size block.
+    int firstBlock_;  // Map slot of the block holding the front element.
+    int headOffset_;  // Offset of the front element within the first block.
+    int size_;  // Number of stored elements.
+    int allocatedBlocks_;  // Number of blocks currently allocated.
+    long long mapMoves_;  // Total block pointers moved during map reallocation.
+
+    void checkIndex(int index) const {  // Validate a logical position.
+        if (index < 0 || index >= size_) {  // Reject out-of-range positions.
+            throw std::out_of_range("deque index out of range");  // Signal invalid access.
+        }  // Close validation.
+    }  // End checkIndex().
+
+    int* slotAt(int index) const {  // Map logical position [0..size) to its element address.
+        int pos = headOffset_ + index;  // Global position counted from the first block's start.
+        int block = firstBlock_ + (pos >> BLOCK_SHIFT);  // Block slot in the map.
+        return &map_[static_cast<size_t>(block)][static_cast<size_t>(pos & BLOCK_MASK)];  // Address inside that block.
+    }  // End slotAt().
+
+    void ensureBlock(int block) {  // Allocate the block at a map slot if it does not exist yet.
+        if (!map_[static_cast<size_t>(block)]) {  // Only allocate on first use.
+            map_[static_cast<size_t>(block)] = std::make_unique<int[]>(static_cast<size_t>(BLOCK_SIZE));  // Allocate one block.
+            allocatedBlocks_ += 1;  // Count live block.
+        }  // Close allocation branch.
+    }  // End ensureBlock().
+
+    void releaseBlock(int block) {  // Free the block at a map slot.
+        if (map_[static_cast<size_t>(block)]) {  // Only release allocated blocks.
+            map_[static_cast<size_t>(block)].reset();  // Free block memory.
+            allocatedBlocks_ -= 1;  // Count released block.
+        }  // Close release branch.
+    }  // End releaseBlock().
+
+    void resetEmpty() {  // Release the last live block and restore the centered initial layout.
+        releaseBlock(firstBlock_);  // Only the front block can still be allocated once size hits 0.
+        firstBlock_ = static_cast<int>(map_.size()) / 2;  // Recenter the front block slot.
+        headOffset_ = BLOCK_SIZE / 2;  // Start mid-block again.
+    }  // End resetEmpty().
+
+    void reallocateMap() {  // Rebuild the map with the used blocks centered (moves pointers, not elements).
+        int usedBlocks = ((headOffset_ + size_ + BLOCK_MASK) >> BLOCK_SHIFT);  // Blocks spanned by current elements.
+        usedBlocks = std::max(usedBlocks, 1);  // Keep the (possibly empty) front block.
+        int newMapSize = std::max(INITIAL_MAP_SIZE, usedBlocks * 2 + 2);  // Leave slack on both sides.
+        std::vector<std::unique_ptr<int[]>> newMap(static_cast<size_t>(newMapSize));  // Allocate the new map.
+        int newFirst = (newMapSize - usedBlocks) / 2;  // Center the used range.
+        for (int i = 0; i < usedBlocks; i++) {  // Move each used block pointer.
+            newMap[static_cast<size_t>(newFirst + i)] = std::move(map_[static_cast<size_t>(firstBlock_ + i)]);  // Transfer ownership.
+            mapMoves_ += 1;  // Count one pointer move.
+        }  // Close move loop.
+        map_ = std::move(newMap);  // Swap in the new map.
+        firstBlock_ = newFirst;  // Update front block slot.
+    }  // End reallocateMap().
+};  // End SegmentedDeque.
+
+}  // namespace dequeunit  // Close namespace.
+
+#endif  // SEGMENTED_DEQUE_HPP  // End of header guard.
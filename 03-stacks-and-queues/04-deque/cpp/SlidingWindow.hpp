@@ -0,0 +1,174 @@
+// 04 滑動視窗聚合（C++）/ Sliding-window aggregation on Deque (C++).  // Bilingual header line for this unit.
+#ifndef SLIDING_WINDOW_HPP  // Header guard to prevent multiple inclusion.
+#define SLIDING_WINDOW_HPP  // Header guard definition.
+
+#include "Deque.hpp"  // Reuse the ring-buffer Deque as the window and monotonic storage.
+
+#include <stdexcept>  // Provide exceptions for validation.
+#include <utility>  // Provide std::pair and std::move for the two-stack entries.
+#include <vector>  // Provide std::vector as the two-stack storage for generic T.
+
+namespace dequeunit {  // Share the namespace with Deque.
+
+enum class MonotonicOrder {  // Which extreme a MonotonicQueue tracks.
+    MIN,  // Front is the minimum of the current window.
+    MAX  // Front is the maximum of the current window.
+};  // End MonotonicOrder.
+
+class MonotonicQueue {  // Monotonic deque: front is always the window's min (or max).
+public:
+    explicit MonotonicQueue(MonotonicOrder order)  // Choose min or max tracking.
+        : order_(order) {  // Store tracking order.
+    }  // Close constructor.
+
+    int size() const {  // Expose number of candidates kept.
+        return candidates_.size();  // Only "not dominated" values remain.
+    }  // End size().
+
+    bool isEmpty() const {  // Convenience helper to check emptiness.
+        return candidates_.isEmpty();  // Empty iff no candidates.
+    }  // End isEmpty().
+
+    void push(int value) {  // Add a new sample (amortized O(1)).
+        while (!candidates_.isEmpty() && dominates(value, candidates_.peekBack())) {  // Drop candidates the new value beats.
+            candidates_.popBack();  // They can never be the answer again.
+        }  // Close pruning loop.
+        candidates_.pushBack(value);  // Keep the new value as the last candidate.
+    }  // End push().
+
+    void evict(int value) {  // Remove the oldest window sample (its value must be passed in).
+        if (!candidates_.isEmpty() && candidates_.peekFront() == value) {  // Only the front can be the oldest survivor.
+            candidates_.popFront();  // Drop it; equal values are kept separately, so one pop per eviction is exact.
+        }  // Close eviction branch.
+    }  // End evict().
+
+    int best() const {  // Return current min/max (O(1)).
+        if (candidates_.isEmpty()) {  // Reject queries on an empty window.
+            throw std::out_of_range("query on empty window");  // Signal invalid operation.
+        }  // Close validation.
+        return candidates_.peekFront();  // Front is the extreme value.
+    }  // End best().
+
+private:
+    MonotonicOrder order_;  // Min or max tracking.
+    Deque candidates_;  // Non-dominated samples in arrival order (monotonic values).
+
+    bool dominates(int incoming, int existing) const {  // True when existing can be discarded.
+        return (order_ == MonotonicOrder::MIN) ? (incoming < existing) : (incoming > existing);  // Strict, so duplicates survive.
+    }  // End dominates().
+};  // End MonotonicQueue.
+
+template <typename T, typename Combine>  // T = value type, Combine = associative binary operation.
+class TwoStackAggregator {  // FIFO queue answering fold(Combine) over its contents in amortized O(1).
+public:
+    explicit TwoStackAggregator(T identity, Combine combine = Combine())  // identity must satisfy combine(identity, x) == x.
+        : identity_(identity),  // Store identity element.
+          combine_(combine),  // Store operation.
+          backAggregate_(identity) {  // Empty back stack folds to identity.
+    }  // Close constructor.
+
+    size_t size() const {  // Expose number of queued values.
+        return front_.size() + back_.size();  // Both stacks together.
+    }  // End size().
+
+    bool isEmpty() const {  // Convenience helper to check emptiness.
+        return front_.empty() && back_.empty();  // Empty iff both stacks empty.
+    }  // End isEmpty().
+
+    void push(const T& value) {  // Enqueue at the back (O(1)).
+        backAggregate_ = combine_(backAggregate_, value);  // Extend back fold (oldest -> newest).
+        back_.push_back(value);  // Store raw value for a later flip.
+    }  // End push().
+
+    void pop() {  // Dequeue the oldest value (amortized O(1)).
+        if (front_.empty()) {  // Front stack exhausted: flip the back stack over.
+            if (back_.empty()) {  // Nothing to pop.
+                throw std::out_of_range("pop from empty aggregator");  // Signal invalid operation.
+            }  // Close validation.
+            flip();  // Each value is flipped at most once => amortized O(1).
+        }  // Close flip branch.
+        front_.pop_back();  // Top of the front stack is the oldest value.
+    }  // End pop().
+
+    T query() const {  // Fold of all queued values in FIFO order (O(1)).
+        T frontAggregate = front_.empty() ? identity_ : front_.back().second;  // Fold of the older half.
+        return combine_(frontAggregate, backAggregate_);  // Older half then newer half.
+    }  // End query().
+
+private:
+    T identity_;  // Identity element of Combine.
+    Combine combine_;  // Associative operation.
+    std::vector<std::pair<T, T>> front_;  // (value, fold of this value and everything newer in front_).
+    std::vector<T> back_;  // Raw values in arrival order.
+    T backAggregate_;  // Fold of back_ in arrival order.
+
+    void flip() {  // Move back_ onto front_ so the oldest value ends up on top.
+        for (size_t i = back_.size(); i-- > 0;) {  // Walk newest -> oldest.
+            T suffix = front_.empty() ? back_[i] : combine_(back_[i], front_.back().second);  // Fold from here to newest.
+            front_.emplace_back(std::move(back_[i]), suffix);  // Push with its suffix fold.
+        }  // Close flip loop.
+        back_.clear();  // Back stack is now empty.
+        backAggregate_ = identity_;  // Reset back fold.
+    }  // End flip().
+};  // End TwoStackAggregator.
+
+class SlidingWindowAggregator {  // Fixed-size window with O(1) amortized min/max/sum.
+public:
+    explicit SlidingWindowAggregator(int windowSize)  // Window holds the last windowSize samples.
+        : windowSize_(windowSize),  // Store window length.
+          minQueue_(MonotonicOrder::MIN),  // Track minimum.
+          maxQueue_(MonotonicOrder::MAX),  // Track maximum.
+          sum_(0) {  // Empty window sums to 0.
+        if (windowSize_ < 1) {  // Reject empty windows.
+            throw std::invalid_argument("windowSize must be >= 1");  // Signal invalid input.
+        }  // Close validation.
+    }  // Close constructor.
+
+    int windowSize() const {  // Expose configured window length.
+        return windowSize_;  // Return window length.
+    }  // End windowSize().
+
+    int size() const {  // Expose current number of samples in the window.
+        return window_.size();  // Return window occupancy.
+    }  // End size().
+
+    bool isFull() const {  // True once windowSize samples have been seen.
+        return window_.size() == windowSize_;  // Compare occupancy with window length.
+    }  // End isFull().
+
+    void push(int sample) {  // Slide the window by one sample (amortized O(1)).
+        window_.pushBack(sample);  // Append newest sample.
+        minQueue_.push(sample);  // Update min candidates.
+        maxQueue_.push(sample);  // Update max candidates.
+        sum_ += sample;  // Update running sum.
+        if (window_.size() > windowSize_) {  // Window overflowed: evict oldest sample.
+            int oldest = window_.popFront().value;  // Remove oldest sample.
+            minQueue_.evict(oldest);  // Drop it from min candidates if present.
+            maxQueue_.evict(oldest);  // Drop it from max candidates if present.
+            sum_ -= oldest;  // Remove it from the running sum.
+        }  // Close eviction branch.
+    }  // End push().
+
+    int min() const {  // Window minimum (O(1)).
+        return minQueue_.best();  // Front of the min queue.
+    }  // End min().
+
+    int max() const {  // Window maximum (O(1)).
+        return maxQueue_.best();  // Front of the max queue.
+    }  // End max().
+
+    long long sum() const {  // Window sum (O(1)).
+        return sum_;  // Running sum.
+    }  // End sum().
+
+private:
+    int windowSize_;  // Window length.
+    Deque window_;  // Raw samples in arrival order (needed to know what leaves the window).
+    MonotonicQueue minQueue_;  // Min candidates.
+    MonotonicQueue maxQueue_;  // Max candidates.
+    long long sum_;  // Running sum of window samples.
+};  // End SlidingWindowAggregator.
+
+}  // namespace dequeunit  // Close namespace.
+
+#endif  // SLIDING_WINDOW_HPP  // End of header guard.
@@ -0,0 +1,90 @@
+// 04 雙端佇列效能比較（C++）/ Deque benchmark: ring buffer vs segmented blocks (C++).  // Bilingual file header.
+
+#include "Deque.hpp"  // Ring-buffer deque (copies everything on growth).
+#include "SegmentedDeque.hpp"  // Block-map deque (never copies elements).
+
+#include <algorithm>  // Provide std::max for worst-case tracking.
+#include <chrono>  // Provide steady_clock for timing.
+#include <iomanip>  // Provide std::setw for table formatting.
+#include <iostream>  // Provide std::cout for console output.
+#include <string>  // Provide std::string for argument parsing.
+
+using Clock = std::chrono::steady_clock;  // Monotonic clock for measurements.
+
+static double nsSince(Clock::time_point start) {  // Return elapsed nanoseconds since start.
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());  // Convert duration.
+}  // End nsSince().
+
+struct PushTrace {  // Result of a push-heavy trace.
+    double nsPerOp;  // Average nanoseconds per push.
+    double worstNs;  // Slowest single push observed.
+    long long copies;  // Elements copied due to growth.
+};  // End PushTrace.
+
+template <typename D>  // Works for both deque types (same push API).
+static PushTrace runPushTrace(int n) {  // Alternate pushBack/pushFront n times.
+    D d;  // Fresh deque.
+    long long copies = 0;  // Accumulate reported copies.
+    Clock::time_point start = Clock::now();  // Start throughput timer.
+    for (int i = 0; i < n; i++) {  // Push-heavy trace.
+        dequeunit::OperationCost cost = (i & 1) ? d.pushFront(i) : d.pushBack(i);  // Alternate ends.
+        copies += cost.copied;  // Track growth copies.
+    }  // Close loop.
+    double total = nsSince(start);  // Stop throughput timer.
+
+    D probe;  // Second deque for per-op worst-case timing.
+    double worst = 0.0;  // Track slowest push.
+    for (int i = 0; i < n; i++) {  // Same trace, timed per operation.
+        Clock::time_point t = Clock::now();  // Start single-op timer.
+        if (i & 1) {  // Alternate ends.
+            probe.pushFront(i);  // Push at front.
+        } else {  // Otherwise push at back.
+            probe.pushBack(i);  // Push at back.
+        }  // Close branch.
+        worst = std::max(worst, nsSince(t));  // Update worst case.
+    }  // Close loop.
+    return PushTrace{total / static_cast<double>(n), worst, copies};  // Return summary.
+}  // End runPushTrace().
+
+template <typename D>  // Works for both deque types (both expose at()).
+static double runRandomAccessTrace(const D& d, int reads, long long& checksum) {  // Read random positions; return ns/read.
+    unsigned state = 2463534242u;  // Deterministic xorshift state.
+    int n = d.size();  // Index range.
+    Clock::time_point start = Clock::now();  // Start timer.
+    for (int i = 0; i < reads; i++) {  // Random reads.
+        state ^= state << 13;  // xorshift step 1.
+        state ^= state >> 17;  // xorshift step 2.
+        state ^= state << 5;  // xorshift step 3.
+        checksum += d.at(static_cast<int>(state % static_cast<unsigned>(n)));  // Read one element.
+    }  // Close loop.
+    return nsSince(start) / static_cast<double>(reads);  // Average ns per read.
+}  // End runRandomAccessTrace().
+
+int main(int argc, char** argv) {  // Entry point: optional argv[1] = number of operations.
+    int n = (argc > 1) ? std::stoi(std::string(argv[1])) : (1 << 22);  // Default to ~4M operations.
+    std::cout << "n = " << n << "\n\n";  // Print workload size.
+
+    std::cout << "=== push-heavy trace (alternating pushBack/pushFront) ===\n";  // Section title.
+    std::cout << std::setw(16) << "impl" << " | " << std::setw(8) << "ns/op" << " | " << std::setw(12) << "worst ns" << " | " << std::setw(10) << "copies" << "\n";  // Header.
+    PushTrace ring = runPushTrace<dequeunit::Deque>(n);  // Ring-buffer trace.
+    PushTrace seg = runPushTrace<dequeunit::SegmentedDeque>(n);  // Segmented trace.
+    std::cout << std::fixed << std::setprecision(2);  // Format floating-point output.
+    std::cout << std::setw(16) << "Deque" << " | " << std::setw(8) << ring.nsPerOp << " | " << std::setw(12) << ring.worstNs << " | " << std::setw(10) << ring.copies << "\n";  // Row.
+    std::cout << std::setw(16) << "SegmentedDeque" << " | " << std::setw(8) << seg.nsPerOp << " | " << std::setw(12) << seg.worstNs << " | " << std::setw(10) << seg.copies << "\n";  // Row.
+
+    std::cout << "\n=== random-access trace (at(i)) ===\n";  // Section title.
+    dequeunit::Deque ringFilled;  // Ring deque to read from.
+    dequeunit::SegmentedDeque segFilled;  // Segmented deque to read from.
+    for (int i = 0; i < n; i++) {  // Fill both with the same contents.
+        ringFilled.pushBack(i);  // Fill ring deque.
+        segFilled.pushBack(i);  // Fill segmented deque.
+    }  // Close fill loop.
+    long long checksumRing = 0;  // Prevent the reads from being optimized away.
+    long long checksumSeg = 0;  // Prevent the reads from being optimized away.
+    double ringRead = runRandomAccessTrace(ringFilled, n, checksumRing);  // Ring random reads.
+    double segRead = runRandomAccessTrace(segFilled, n, checksumSeg);  // Segmented random reads.
+    std::cout << std::setw(16) << "Deque" << " | " << std::setw(8) << ringRead << " ns/read\n";  // Row.
+    std::cout << std::setw(16) << "SegmentedDeque" << " | " << std::setw(8) << segRead << " ns/read\n";  // Row.
+    std::cout << "checksums match: " << (checksumRing == checksumSeg ? "yes" : "NO") << "\n";  // Sanity check.
+    return 0;  // Exit success.
+}  // Close main().
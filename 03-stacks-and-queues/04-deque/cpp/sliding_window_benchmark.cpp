@@ -0,0 +1,84 @@
+// 04 滑動視窗效能比較（C++）/ Sliding-window benchmark: monotonic deque vs naive rescan (C++).  // Bilingual file header.
+
+#include "SlidingWindow.hpp"  // Aggregators under test.
+
+#include <algorithm>  // Provide std::min/std::max for the naive rescan.
+#include <chrono>  // Provide steady_clock for timing.
+#include <iomanip>  // Provide std::setw for table formatting.
+#include <iostream>  // Provide std::cout for console output.
+#include <string>  // Provide std::string for argument parsing.
+#include <vector>  // Provide std::vector for the naive window.
+
+using Clock = std::chrono::steady_clock;  // Monotonic clock for measurements.
+
+struct Sum {  // Plain addition for the generic two-stack aggregator.
+    long long operator()(long long a, long long b) const {  // Add two partial sums.
+        return a + b;  // Associative and commutative.
+    }  // End operator().
+};  // End Sum.
+
+static int nextSample(unsigned& state) {  // Deterministic xorshift sample generator.
+    state ^= state << 13;  // xorshift step 1.
+    state ^= state >> 17;  // xorshift step 2.
+    state ^= state << 5;  // xorshift step 3.
+    return static_cast<int>(state % 1000000u);  // Metric-like values in [0, 1e6).
+}  // End nextSample().
+
+static double secondsSince(Clock::time_point start) {  // Return elapsed seconds since start.
+    return std::chrono::duration<double>(Clock::now() - start).count();  // Convert duration.
+}  // End secondsSince().
+
+int main(int argc, char** argv) {  // argv[1]=samples, argv[2]=window, argv[3]=naive samples.
+    long long n = (argc > 1) ? std::stoll(std::string(argv[1])) : 10000000LL;  // Default 1e7 (pass 100000000 for 1e8).
+    int w = (argc > 2) ? std::stoi(std::string(argv[2])) : 1024;  // Default window length.
+    long long naiveN = (argc > 3) ? std::stoll(std::string(argv[3])) : std::min(n, 200000LL);  // Naive is O(w) per sample.
+    std::cout << "samples=" << n << " window=" << w << " naiveSamples=" << naiveN << "\n\n";  // Print workload.
+
+    unsigned state = 88172645u;  // Generator state.
+    long long checksum = 0;  // Prevent results from being optimized away.
+    dequeunit::SlidingWindowAggregator agg(w);  // Monotonic min/max + running sum.
+    Clock::time_point start = Clock::now();  // Start timer.
+    for (long long i = 0; i < n; i++) {  // Stream samples.
+        agg.push(nextSample(state));  // Slide window.
+        checksum += agg.min() + agg.max() + agg.sum();  // Query all three aggregates every sample.
+    }  // Close stream loop.
+    double aggSeconds = secondsSince(start);  // Stop timer.
+
+    state = 88172645u;  // Same stream again.
+    dequeunit::TwoStackAggregator<long long, Sum> twoStack(0);  // Generic associative aggregate.
+    start = Clock::now();  // Start timer.
+    for (long long i = 0; i < n; i++) {  // Stream samples.
+        twoStack.push(nextSample(state));  // Enqueue newest.
+        if (twoStack.size() > static_cast<size_t>(w)) {  // Keep window length.
+            twoStack.pop();  // Dequeue oldest.
+        }  // Close eviction branch.
+        checksum += twoStack.query();  // Query fold every sample.
+    }  // Close stream loop.
+    double twoStackSeconds = secondsSince(start);  // Stop timer.
+
+    state = 88172645u;  // Same stream again.
+    std::vector<int> ring(static_cast<size_t>(w), 0);  // Naive window storage.
+    start = Clock::now();  // Start timer.
+    for (long long i = 0; i < naiveN; i++) {  // Stream samples.
+        ring[static_cast<size_t>(i % w)] = nextSample(state);  // Overwrite oldest slot.
+        int filled = static_cast<int>(std::min<long long>(i + 1, w));  // Valid slots so far.
+        int mn = ring[0];  // Rescan min.
+        int mx = ring[0];  // Rescan max.
+        long long sum = 0;  // Rescan sum.
+        for (int j = 0; j < filled; j++) {  // O(w) rescan.
+            mn = std::min(mn, ring[static_cast<size_t>(j)]);  // Update min.
+            mx = std::max(mx, ring[static_cast<size_t>(j)]);  // Update max.
+            sum += ring[static_cast<size_t>(j)];  // Update sum.
+        }  // Close rescan.
+        checksum += mn + mx + sum;  // Consume results.
+    }  // Close stream loop.
+    double naiveSeconds = secondsSince(start);  // Stop timer.
+
+    std::cout << std::fixed << std::setprecision(2);  // Format floating-point output.
+    std::cout << std::setw(26) << "impl" << " | " << std::setw(10) << "ns/sample" << " | " << std::setw(12) << "Msamples/s" << "\n";  // Header.
+    std::cout << std::setw(26) << "monotonic min/max + sum" << " | " << std::setw(10) << aggSeconds * 1e9 / static_cast<double>(n) << " | " << std::setw(12) << static_cast<double>(n) / aggSeconds / 1e6 << "\n";  // Row.
+    std::cout << std::setw(26) << "two-stack fold (sum)" << " | " << std::setw(10) << twoStackSeconds * 1e9 / static_cast<double>(n) << " | " << std::setw(12) << static_cast<double>(n) / twoStackSeconds / 1e6 << "\n";  // Row.
+    std::cout << std::setw(26) << "naive O(w) rescan" << " | " << std::setw(10) << naiveSeconds * 1e9 / static_cast<double>(naiveN) << " | " << std::setw(12) << static_cast<double>(naiveN) / naiveSeconds / 1e6 << "\n";  // Row.
+    std::cout << "checksum=" << checksum << "\n";  // Print checksum so the work is observable.
+    return 0;  // Exit success.
+}  // Close main().
@@ -112,6 +112,19 @@ static void testPushFrontTriggersResizeAndPreservesOrder() {  // pushFront shoul
     assertVectorEquals(std::vector<int>{1, 2, 3, 4, 5}, d.toVector(), "order should be [1,2,3,4,5] after resize");  // Validate ordering.
 }  // Close testPushFrontTriggersResizeAndPreservesOrder().
 
+static void testIndexedAccessFollowsLogicalOrder() {  // at(i) should follow front->back order even after wrap-around.
+    dequeunit::Deque d;  // Start with empty deque.
+    for (int v : std::vector<int>{0, 1, 2, 3}) {  // Fill to capacity 4.
+        d.pushBack(v);  // Push one value.
+    }  // Close loop.
+    d.popFront();  // Remove 0 (head moves).
+    d.pushBack(4);  // Push 4 (wrap-around) => [1,2,3,4].
+    assertEquals(1, d.at(0), "at(0) should return the front");  // Validate first element.
+    assertEquals(4, d.at(3), "at(3) should return the wrapped back element");  // Validate wrapped element.
+    assertThrowsOutOfRange([&]() { (void)d.at(4); }, "at(size) should throw");  // Index past end.
+    assertThrowsOutOfRange([&]() { (void)d.at(-1); }, "at(-1) should throw");  // Negative index.
+}  // Close testIndexedAccessFollowsLogicalOrder().
+
 static void testEmptyOperationsThrow() {  // peek/pop should reject empty deque.
     dequeunit::Deque d;  // Create empty deque.
     assertThrowsOutOfRange([&]() { (void)d.peekFront(); }, "peekFront should throw on empty");  // Invalid peek.
@@ -127,6 +140,7 @@ int main() {  // Run all tests and print status.
         testWrapAroundWorks();  // Run wrap-around test.
         testResizeWhenHeadNotZeroPreservesOrder();  // Run resize-with-offset-head test.
         testPushFrontTriggersResizeAndPreservesOrder();  // Run pushFront-triggered resize test.
+        testIndexedAccessFollowsLogicalOrder();  // Run indexed-access test.
         testEmptyOperationsThrow();  // Run empty-operation tests.
         std::cout << "All tests PASSED.\n";  // Print success.
         return 0;  // Exit success.
@@ -0,0 +1,122 @@
+// 04 分段雙端佇列測試（C++）/ Tests for segmented deque (C++).  // Bilingual file header.
+
+#include "SegmentedDeque.hpp"  // Include the API under test.
+
+#include <iostream>  // Provide std::cout for status output.
+#include <stdexcept>  // Provide exception base types for assertions.
+#include <vector>  // Provide std::vector for expected snapshots.
+
+static void assertTrue(bool condition, const char* message) {  // Minimal assertion helper.
+    if (!condition) {  // Fail when condition is false.
+        throw std::runtime_error(std::string("FAIL: ") + message);  // Throw to signal test failure.
+    }  // Close failure branch.
+}  // Close assertTrue().
+
+static void assertEquals(long long expected, long long actual, const char* message) {  // Minimal equality assertion helper.
+    if (expected != actual) {  // Fail when values differ.
+        throw std::runtime_error(std::string("FAIL: ") + message + " (expected=" + std::to_string(expected) + ", actual=" + std::to_string(actual) + ")");  // Throw mismatch.
+    }  // Close failure branch.
+}  // Close assertEquals().
+
+template <typename Func>  // Template for simple exception assertions.
+static void assertThrowsOutOfRange(Func f, const char* message) {  // Assert that f throws std::out_of_range.
+    try {  // Run action.
+        f();  // Execute function.
+    } catch (const std::out_of_range&) {  // Accept expected type.
+        return;  // Test passed.
+    } catch (...) {  // Reject other exceptions.
+        throw std::runtime_error(std::string("FAIL: ") + message + " (wrong exception type)");  // Wrong type.
+    }  // Close catch.
+    throw std::runtime_error(std::string("FAIL: ") + message + " (no exception thrown)");  // Fail if nothing thrown.
+}  // Close assertThrowsOutOfRange().
+
+static void testMatchesRingDequeOnMixedOperations() {  // Segmented deque should behave exactly like the ring deque.
+    dequeunit::Deque ring;  // Reference implementation.
+    dequeunit::SegmentedDeque seg;  // Implementation under test.
+    unsigned state = 12345u;  // Deterministic LCG state.
+    for (int step = 0; step < 20000; step++) {  // Run a long mixed trace that crosses many block boundaries.
+        state = state * 1103515245u + 12345u;  // Advance LCG.
+        int op = static_cast<int>((state >> 16) % 6u);  // Pick an operation (pushes are more likely than pops).
+        if (op <= 1) {  // pushBack.
+            ring.pushBack(step);  // Apply to reference.
+            seg.pushBack(step);  // Apply to segmented deque.
+        } else if (op <= 3) {  // pushFront.
+            ring.pushFront(-step);  // Apply to reference.
+            seg.pushFront(-step);  // Apply to segmented deque.
+        } else if (!ring.isEmpty() && op == 4) {  // popFront.
+            assertEquals(ring.popFront().value, seg.popFront().value, "popFront should match ring deque");  // Compare values.
+        } else if (!ring.isEmpty()) {  // popBack.
+            assertEquals(ring.popBack().value, seg.popBack().value, "popBack should match ring deque");  // Compare values.
+        }  // Close op dispatch.
+        assertEquals(ring.size(), seg.size(), "sizes should match");  // Compare sizes.
+    }  // Close trace loop.
+    std::vector<int> expected = ring.toVector();  // Snapshot reference contents.
+    assertTrue(expected == seg.toVector(), "final contents should match ring deque");  // Compare contents.
+    for (int i = 0; i < seg.size(); i++) {  // Check indexed access everywhere.
+        assertEquals(ring.at(i), seg.at(i), "at(i) should match ring deque");  // Compare element i.
+    }  // Close index loop.
+}  // Close testMatchesRingDequeOnMixedOperations().
+
+static void testElementAddressesStayStable() {  // Pushing at either end must not move existing elements.
+    dequeunit::SegmentedDeque d;  // Start with empty deque.
+    d.pushBack(42);  // Insert one tracked element.
+    const int* tracked = &d[0];  // Remember its address.
+    for (int i = 0; i < 10000; i++) {  // Push enough to force many new blocks and map reallocations.
+        d.pushBack(i);  // Grow at the back.
+        d.pushFront(-i);  // Grow at the front.
+    }  // Close loop.
+    assertTrue(d.mapMoves() > 0, "map should have been reallocated at least once");  // Ensure the growth path ran.
+    assertTrue(tracked == &d[10000], "tracked element address should be unchanged");  // Same address after growth.
+    assertEquals(42, *tracked, "tracked element value should be unchanged");  // Same value after growth.
+}  // Close testElementAddressesStayStable().
+
+static void testPushesNeverCopyElements() {  // Every push should report zero copied/moved elements.
+    dequeunit::SegmentedDeque d;  // Start with empty deque.
+    for (int i = 0; i < 5000; i++) {  // Push across many blocks.
+        dequeunit::OperationCost back = d.pushBack(i);  // Push at back.
+        dequeunit::OperationCost front = d.pushFront(i);  // Push at front.
+        assertEquals(0, back.copied + back.moved + front.copied + front.moved, "push should not copy or move elements");  // Validate cost.
+    }  // Close loop.
+}  // Close testPushesNeverCopyElements().
+
+static void testBlocksAreReleasedWhenDrained() {  // Popping everything should free all blocks.
+    dequeunit::SegmentedDeque d;  // Start with empty deque.
+    for (int i = 0; i < 3 * dequeunit::SegmentedDeque::BLOCK_SIZE; i++) {  // Fill several blocks.
+        d.pushBack(i);  // Push one value.
+    }  // Close loop.
+    assertTrue(d.blockCount() >= 3, "several blocks should be allocated");  // Validate allocation.
+    while (d.size() > 1) {  // Drain from the front, leaving one element.
+        d.popFront();  // Pop one value.
+    }  // Close loop.
+    assertEquals(1, d.blockCount(), "only the block holding the last element should remain");  // Validate release.
+    d.popBack();  // Remove the last element.
+    assertEquals(0, d.blockCount(), "empty deque should hold no blocks");  // Validate full release.
+    d.pushFront(7);  // Deque should be reusable after draining.
+    assertEquals(7, d.peekBack(), "deque should be usable after draining");  // Validate reuse.
+}  // Close testBlocksAreReleasedWhenDrained().
+
+static void testEmptyAndOutOfRangeThrow() {  // Invalid access should throw std::out_of_range.
+    dequeunit::SegmentedDeque d;  // Create empty deque.
+    assertThrowsOutOfRange([&]() { (void)d.peekFront(); }, "peekFront should throw on empty");  // Invalid peek.
+    assertThrowsOutOfRange([&]() { (void)d.peekBack(); }, "peekBack should throw on empty");  // Invalid peek.
+    assertThrowsOutOfRange([&]() { (void)d.popFront(); }, "popFront should throw on empty");  // Invalid pop.
+    assertThrowsOutOfRange([&]() { (void)d.popBack(); }, "popBack should throw on empty");  // Invalid pop.
+    d.pushBack(1);  // Add one element.
+    assertThrowsOutOfRange([&]() { (void)d.at(1); }, "at(size) should throw");  // Index past end.
+    assertThrowsOutOfRange([&]() { (void)d.at(-1); }, "at(-1) should throw");  // Negative index.
+}  // Close testEmptyAndOutOfRangeThrow().
+
+int main() {  // Run all tests and print status.
+    try {  // Catch failures and print a clean message.
+        testMatchesRingDequeOnMixedOperations();  // Run differential test against Deque.
+        testElementAddressesStayStable();  // Run address-stability test.
+        testPushesNeverCopyElements();  // Run zero-copy test.
+        testBlocksAreReleasedWhenDrained();  // Run block-release test.
+        testEmptyAndOutOfRangeThrow();  // Run invalid-access tests.
+        std::cout << "All tests PASSED.\n";  // Print success.
+        return 0;  // Exit success.
+    } catch (const std::exception& ex) {  // Print any test failure.
+        std::cerr << ex.what() << "\n";  // Print failure message.
+        return 1;  // Exit failure.
+    }  // Close catch.
+}  // Close main().
@@ -0,0 +1,133 @@
+// 04 滑動視窗聚合測試（C++）/ Tests for sliding-window aggregation (C++).  // Bilingual file header.
+
+#include "SlidingWindow.hpp"  // Include the API under test.
+
+#include <algorithm>  // Provide std::min/std::max for the naive reference.
+#include <iostream>  // Provide std::cout for status output.
+#include <stdexcept>  // Provide exception base types for assertions.
+#include <string>  // Provide std::string for the non-commutative fold test.
+#include <vector>  // Provide std::vector for sample streams.
+
+static void assertEquals(long long expected, long long actual, const char* message) {  // Minimal equality assertion helper.
+    if (expected != actual) {  // Fail when values differ.
+        throw std::runtime_error(std::string("FAIL: ") + message + " (expected=" + std::to_string(expected) + ", actual=" + std::to_string(actual) + ")");  // Throw mismatch.
+    }  // Close failure branch.
+}  // Close assertEquals().
+
+template <typename Func>  // Template for simple exception assertions.
+static void assertThrowsOutOfRange(Func f, const char* message) {  // Assert that f throws std::out_of_range.
+    try {  // Run action.
+        f();  // Execute function.
+    } catch (const std::out_of_range&) {  // Accept expected type.
+        return;  // Test passed.
+    } catch (...) {  // Reject other exceptions.
+        throw std::runtime_error(std::string("FAIL: ") + message + " (wrong exception type)");  // Wrong type.
+    }  // Close catch.
+    throw std::runtime_error(std::string("FAIL: ") + message + " (no exception thrown)");  // Fail if nothing thrown.
+}  // Close assertThrowsOutOfRange().
+
+struct Concat {  // Non-commutative associative operation (checks FIFO order).
+    std::string operator()(const std::string& a, const std::string& b) const {  // Concatenate in order.
+        return a + b;  // a then b.
+    }  // End operator().
+};  // End Concat.
+
+struct GcdOp {  // Associative operation with no inverse (cannot be done with a running total).
+    int operator()(int a, int b) const {  // Euclid's algorithm.
+        while (b != 0) {  // Standard gcd loop.
+            int t = a % b;  // Remainder.
+            a = b;  // Shift.
+            b = t;  // Shift.
+        }  // Close loop.
+        return a;  // gcd(a, 0) = a.
+    }  // End operator().
+};  // End GcdOp.
+
+static void testWindowMatchesNaiveRescan() {  // min/max/sum should equal a full rescan of the window.
+    const int w = 7;  // Small window so duplicates and ties are common.
+    dequeunit::SlidingWindowAggregator agg(w);  // Aggregator under test.
+    std::vector<int> samples;  // Keep all samples for the naive reference.
+    unsigned state = 7u;  // Deterministic LCG state.
+    for (int i = 0; i < 2000; i++) {  // Stream samples.
+        state = state * 1664525u + 1013904223u;  // Advance LCG.
+        int sample = static_cast<int>((state >> 20) % 21u) - 10;  // Small range => many duplicates.
+        samples.push_back(sample);  // Record sample.
+        agg.push(sample);  // Feed aggregator.
+        int begin = std::max(0, static_cast<int>(samples.size()) - w);  // Naive window start.
+        int mn = samples[static_cast<size_t>(begin)];  // Naive min.
+        int mx = mn;  // Naive max.
+        long long sum = 0;  // Naive sum.
+        for (size_t j = static_cast<size_t>(begin); j < samples.size(); j++) {  // Rescan window.
+            mn = std::min(mn, samples[j]);  // Update min.
+            mx = std::max(mx, samples[j]);  // Update max.
+            sum += samples[j];  // Update sum.
+        }  // Close rescan.
+        assertEquals(mn, agg.min(), "window min should match rescan");  // Compare min.
+        assertEquals(mx, agg.max(), "window max should match rescan");  // Compare max.
+        assertEquals(sum, agg.sum(), "window sum should match rescan");  // Compare sum.
+    }  // Close stream loop.
+    assertEquals(w, agg.size(), "window should hold exactly windowSize samples");  // Validate occupancy.
+}  // Close testWindowMatchesNaiveRescan().
+
+static void testMonotonicQueueKeepsDuplicates() {  // Evicting one copy of a duplicate must keep the other.
+    dequeunit::MonotonicQueue q(dequeunit::MonotonicOrder::MIN);  // Min queue.
+    q.push(3);  // Window [3].
+    q.push(3);  // Window [3,3].
+    q.evict(3);  // Window [3].
+    assertEquals(3, q.best(), "second 3 should still be the minimum");  // Validate duplicate survived.
+    q.evict(3);  // Window [].
+    assertThrowsOutOfRange([&]() { (void)q.best(); }, "best on empty queue should throw");  // Invalid query.
+}  // Close testMonotonicQueueKeepsDuplicates().
+
+static void testTwoStackPreservesFifoOrder() {  // A non-commutative fold must see values oldest -> newest.
+    dequeunit::TwoStackAggregator<std::string, Concat> q(std::string(""));  // Concat queue.
+    q.push("a");  // [a].
+    q.push("b");  // [a,b].
+    q.push("c");  // [a,b,c].
+    if (q.query() != "abc") {  // Fold should be in FIFO order.
+        throw std::runtime_error("FAIL: fold should be abc");  // Report mismatch.
+    }  // Close check.
+    q.pop();  // [b,c] (forces a flip).
+    q.push("d");  // [b,c,d] (front and back stacks both non-empty).
+    if (q.query() != "bcd") {  // Fold should span both stacks in order.
+        throw std::runtime_error("FAIL: fold should be bcd");  // Report mismatch.
+    }  // Close check.
+    q.pop();  // [c,d].
+    q.pop();  // [d].
+    q.pop();  // [].
+    if (q.query() != "") {  // Empty fold is the identity.
+        throw std::runtime_error("FAIL: empty fold should be identity");  // Report mismatch.
+    }  // Close check.
+    assertThrowsOutOfRange([&]() { q.pop(); }, "pop on empty aggregator should throw");  // Invalid pop.
+}  // Close testTwoStackPreservesFifoOrder().
+
+static void testTwoStackGcdWindow() {  // Sliding gcd (no inverse) should match a naive rescan.
+    dequeunit::TwoStackAggregator<int, GcdOp> q(0);  // gcd(0, x) = x, so 0 is the identity.
+    std::vector<int> values{12, 18, 24, 7, 14, 21, 28, 35, 10, 20};  // Sample values.
+    const size_t w = 3;  // Window length.
+    for (size_t i = 0; i < values.size(); i++) {  // Slide over values.
+        q.push(values[i]);  // Add newest.
+        if (q.size() > w) {  // Keep window length.
+            q.pop();  // Remove oldest.
+        }  // Close eviction branch.
+        int expected = 0;  // Naive gcd.
+        for (size_t j = (i + 1 >= w ? i + 1 - w : 0); j <= i; j++) {  // Rescan window.
+            expected = GcdOp()(expected, values[j]);  // Fold one value.
+        }  // Close rescan.
+        assertEquals(expected, q.query(), "sliding gcd should match rescan");  // Compare.
+    }  // Close slide loop.
+}  // Close testTwoStackGcdWindow().
+
+int main() {  // Run all tests and print status.
+    try {  // Catch failures and print a clean message.
+        testWindowMatchesNaiveRescan();  // Run min/max/sum differential test.
+        testMonotonicQueueKeepsDuplicates();  // Run duplicate-eviction test.
+        testTwoStackPreservesFifoOrder();  // Run non-commutative fold test.
+        testTwoStackGcdWindow();  // Run no-inverse fold test.
+        std::cout << "All tests PASSED.\n";  // Print success.
+        return 0;  // Exit success.
+    } catch (const std::exception& ex) {  // Print any test failure.
+        std::cerr << ex.what() << "\n";  // Print failure message.
+        return 1;  // Exit failure.
+    }  // Close catch.
+}  // Close main().
@@ -0,0 +1,303 @@
+/** Doc block start
+ * 批次雜湊（一次呼叫雜湊多個 key）- C++ 實作
+ * 與 seededHash 逐一計算的結果完全相同，但把 key 放進 AVX2 的 64 位元通道一起算：整數 key 的 fmix64
+ * 每 4 個一個向量（AVX2 沒有 64 位元乘法，以三次 32×32 乘法組合），短字串的 SipHash-1-3 每 16 個交錯成 4 個向量。
+ * AVX2 版本以 target("avx2") 個別編譯，執行期由 __builtin_cpu_supports 選擇；其他 CPU 與編譯器走純量迴圈。
+ *(blank line)
+ * Batch hashing (many keys per call).
+ * Produces exactly what seededHash computes key by key, but runs keys in the 64-bit lanes of AVX2
+ * registers: fmix64 for integer keys, 4 per vector (AVX2 has no 64-bit multiply, so it is built
+ * from three 32x32 multiplies), and SipHash-1-3 for short strings, 16 at a time interleaved across
+ * 4 vectors. The AVX2 kernels are compiled with
+ * target("avx2") and picked at runtime with __builtin_cpu_supports; other CPUs and compilers use
+ * the scalar loops.
+ */  // End of block comment
+
+#ifndef BATCH_HASH_HPP  // Execute this statement as part of the data structure implementation.
+#define BATCH_HASH_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <cstddef>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <string_view>  // Execute this statement as part of the data structure implementation.
+#include <type_traits>  // Execute this statement as part of the data structure implementation.
+#include "SeededHash.hpp"  // fmix64、sipHash13、HashTableHasher - fmix64, sipHash13, HashTableHasher
+
+// GCC／Clang 的 x86 目標可以逐函數指定指令集 - GCC/Clang on x86 can pick the instruction set per function
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))  // Evaluate the condition and branch into the appropriate code path.
+#define BATCH_HASH_AVX2 1  // Execute this statement as part of the data structure implementation.
+#include <immintrin.h>  // Execute this statement as part of the data structure implementation.
+#else  // Handle the alternative branch when the condition is false.
+#define BATCH_HASH_AVX2 0  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
+// libstdc++ 與 libc++ 的整數 std::hash 是恆等函數，整數快速路徑依賴這一點 - The integer fast path relies on std::hash being the identity
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)  // Evaluate the condition and branch into the appropriate code path.
+#define BATCH_HASH_IDENTITY_INT_HASH 1  // Execute this statement as part of the data structure implementation.
+#else  // Handle the alternative branch when the condition is false.
+#define BATCH_HASH_IDENTITY_INT_HASH 0  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
+constexpr size_t BATCH_HASH_LANES = 4;  // 一個 AVX2 暫存器的 64 位元通道數 - 64-bit lanes per AVX2 register
+constexpr size_t BATCH_HASH_STRING_KEYS = 16;  // 字串一次 4 組向量交錯（4 組比 1、2 組快）- Strings interleave 4 vectors per call (faster than 1 or 2)
+constexpr size_t BATCH_HASH_MAX_SIMD_BYTES = 64;  // 超過此長度的字串組改走純量 - String groups longer than this go scalar
+constexpr size_t BATCH_HASH_CHUNK = 16;  // seededHashBatch 每次轉換的 key 數 - Keys converted per step by seededHashBatch
+
+// ========== 純量版本 Scalar Kernels ==========
+
+/** Doc block start
+ * out[i] = fmix64(keys[i] ^ seed.k0)，即 seededHash 對恆等 std::hash 的整數 key 的結果
+ * out[i] = fmix64(keys[i] ^ seed.k0): what seededHash gives for integer keys under an identity std::hash
+ */  // End of block comment
+inline void hashBatchScalar(const uint64_t* keys, size_t count, const HashSeed& seed, uint64_t* out) {  // Compute a hash-based index so keys map into the table's storage.
+    for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        out[i] = fmix64(keys[i] ^ seed.k0);  // Compute a hash-based index so keys map into the table's storage.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+/** Doc block start
+ * out[i] = sipHash13(keys[i], seed)，即 HashTableHasher<std::string> 的帶種子結果
+ * out[i] = sipHash13(keys[i], seed): the seeded result of HashTableHasher<std::string>
+ */  // End of block comment
+inline void hashBatchScalar(const std::string_view* keys, size_t count, const HashSeed& seed, uint64_t* out) {  // Compute a hash-based index so keys map into the table's storage.
+    for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        out[i] = sipHash13(keys[i].data(), keys[i].size(), seed);  // Compute a hash-based index so keys map into the table's storage.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+// ========== AVX2 版本 AVX2 Kernels ==========
+
+#if BATCH_HASH_AVX2  // Evaluate the condition and branch into the appropriate code path.
+
+/** Doc block start
+ * 每條通道的 64 位元乘法取低 64 位元：lo×lo + ((hi×lo + lo×hi) << 32)
+ * Per-lane 64-bit multiply, low half: lo*lo + ((hi*lo + lo*hi) << 32)
+ */  // End of block comment
+__attribute__((target("avx2"))) inline __m256i mulLow64x4(__m256i a, __m256i b) {  // Execute this statement as part of the data structure implementation.
+    __m256i low = _mm256_mul_epu32(a, b);  // 兩個低 32 位元相乘的完整 64 位元 - Full 64-bit product of the low halves
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),  // Assign or update a variable that represents the current algorithm state.
+                                     _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));  // Execute this statement as part of the data structure implementation.
+    return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+__attribute__((target("avx2"))) inline __m256i rotl64x4(__m256i x, int bits) {  // Execute this statement as part of the data structure implementation.
+    return _mm256_or_si256(_mm256_slli_epi64(x, bits), _mm256_srli_epi64(x, 64 - bits));  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 4 條通道同時做 fmix64(key ^ k0)；不足 4 個的尾端交給純量版本
+ * fmix64(key ^ k0) in 4 lanes at once; a tail shorter than 4 goes to the scalar kernel
+ */  // End of block comment
+__attribute__((target("avx2"))) inline void hashBatchAvx2(const uint64_t* keys, size_t count, const HashSeed& seed, uint64_t* out) {  // Compute a hash-based index so keys map into the table's storage.
+    const __m256i k0 = _mm256_set1_epi64x(static_cast<long long>(seed.k0));  // Assign or update a variable that represents the current algorithm state.
+    const __m256i c1 = _mm256_set1_epi64x(static_cast<long long>(0xff51afd7ed558ccdULL));  // Assign or update a variable that represents the current algorithm state.
+    const __m256i c2 = _mm256_set1_epi64x(static_cast<long long>(0xc4ceb9fe1a85ec53ULL));  // Assign or update a variable that represents the current algorithm state.
+    size_t i = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (; i + BATCH_HASH_LANES <= count; i += BATCH_HASH_LANES) {  // Iterate over a range/collection to process each item in sequence.
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), k0);  // Assign or update a variable that represents the current algorithm state.
+        x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 33));  // Assign or update a variable that represents the current algorithm state.
+        x = mulLow64x4(x, c1);  // Assign or update a variable that represents the current algorithm state.
+        x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 33));  // Assign or update a variable that represents the current algorithm state.
+        x = mulLow64x4(x, c2);  // Assign or update a variable that represents the current algorithm state.
+        x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 33));  // Assign or update a variable that represents the current algorithm state.
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), x);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    hashBatchScalar(keys + i, count - i, seed, out + i);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 4 條通道同時做一輪 SipRound；32 位元旋轉用 shuffle，其他用兩次移位
+ * One SipRound in 4 lanes; the 32-bit rotation is a shuffle, the others two shifts
+ */  // End of block comment
+__attribute__((target("avx2"))) inline void sipRound4(__m256i& v0, __m256i& v1, __m256i& v2, __m256i& v3) {  // Execute this statement as part of the data structure implementation.
+    v0 = _mm256_add_epi64(v0, v1); v1 = rotl64x4(v1, 13); v1 = _mm256_xor_si256(v1, v0); v0 = _mm256_shuffle_epi32(v0, 0xB1);  // Assign or update a variable that represents the current algorithm state.
+    v2 = _mm256_add_epi64(v2, v3); v3 = rotl64x4(v3, 16); v3 = _mm256_xor_si256(v3, v2);  // Assign or update a variable that represents the current algorithm state.
+    v0 = _mm256_add_epi64(v0, v3); v3 = rotl64x4(v3, 21); v3 = _mm256_xor_si256(v3, v0);  // Assign or update a variable that represents the current algorithm state.
+    v2 = _mm256_add_epi64(v2, v1); v1 = rotl64x4(v1, 17); v1 = _mm256_xor_si256(v1, v2); v2 = _mm256_shuffle_epi32(v2, 0xB1);  // Assign or update a variable that represents the current algorithm state.
+}  // Close the current block scope.
+
+/** Doc block start
+ * GROUPS × 4 個字串各佔一條通道同時做 SipHash-1-3。一輪 SipRound 在向量上是一條很長的相依鏈，
+ * 交錯處理 GROUPS 組互不相依的狀態才能填滿執行單元。長度不同時，已處理完最後一塊的通道以遮罩保留狀態，
+ * 所以一組的成本是其中最長字串的區塊數；呼叫端只把短字串組送進來。
+ * SipHash-1-3 on GROUPS x 4 strings, one per lane. A vector SipRound is one long dependency chain,
+ * so GROUPS independent states are interleaved to keep the execution units busy. When lengths
+ * differ, a lane that has consumed its last block keeps its state through a blend mask, so a group
+ * costs as many blocks as its longest key; callers only send groups of short keys.
+ */  // End of block comment
+template <size_t GROUPS>  // Execute this statement as part of the data structure implementation.
+__attribute__((target("avx2"))) inline void sipHash13Avx2(const std::string_view* keys, const HashSeed& seed, uint64_t* out) {  // Compute a hash-based index so keys map into the table's storage.
+    constexpr size_t LANES = GROUPS * BATCH_HASH_LANES;  // Assign or update a variable that represents the current algorithm state.
+
+    // 每條通道的區塊數（完整區塊 + 含長度的最後一塊）與最後一塊的內容 - Per-lane block count (whole blocks + the length block) and that last block
+    const unsigned char* data[LANES];  // Assign or update a variable that represents the current algorithm state.
+    size_t blocks[LANES];  // Assign or update a variable that represents the current algorithm state.
+    uint64_t last[LANES];  // Assign or update a variable that represents the current algorithm state.
+    size_t maxBlocks = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t lane = 0; lane < LANES; ++lane) {  // Iterate over a range/collection to process each item in sequence.
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(keys[lane].data());  // Assign or update a variable that represents the current algorithm state.
+        size_t length = keys[lane].size();  // Assign or update a variable that represents the current algorithm state.
+        size_t whole = length / 8;  // Assign or update a variable that represents the current algorithm state.
+        size_t tail = length % 8;  // Assign or update a variable that represents the current algorithm state.
+        uint64_t block = static_cast<uint64_t>(length) << 56;  // 長度放最高位元組 - Length in the top byte
+        if (tail != 0 && length >= 8) {  // 讀最後 8 個位元組再右移掉已處理的部分 - Load the last 8 bytes and shift out the consumed part
+            block |= loadLittleEndian64(bytes + length - 8) >> (8 * (8 - tail));  // Assign or update a variable that represents the current algorithm state.
+        } else {  // Handle the alternative branch when the condition is false.
+            for (size_t b = tail; b > 0; --b) {  // 少於 8 個位元組 - Fewer than 8 bytes in total
+                block |= static_cast<uint64_t>(bytes[whole * 8 + b - 1]) << (8 * (b - 1));  // Assign or update a variable that represents the current algorithm state.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        data[lane] = bytes;  // Assign or update a variable that represents the current algorithm state.
+        last[lane] = block;  // Assign or update a variable that represents the current algorithm state.
+        blocks[lane] = whole + 1;  // Assign or update a variable that represents the current algorithm state.
+        maxBlocks = std::max(maxBlocks, whole + 1);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    auto word = [&](size_t lane, size_t j) -> long long {  // 通道 lane 的第 j 塊；已結束的通道不在乎 - Block j of a lane; finished lanes do not care
+        return static_cast<long long>(j + 1 < blocks[lane] ? loadLittleEndian64(data[lane] + 8 * j) : (j + 1 == blocks[lane] ? last[lane] : 0));  // Return the computed result to the caller.
+    };  // Execute this statement as part of the data structure implementation.
+
+    const __m256i key0 = _mm256_set1_epi64x(static_cast<long long>(seed.k0));  // Assign or update a variable that represents the current algorithm state.
+    const __m256i key1 = _mm256_set1_epi64x(static_cast<long long>(seed.k1));  // Assign or update a variable that represents the current algorithm state.
+    __m256i v0[GROUPS], v1[GROUPS], v2[GROUPS], v3[GROUPS], blockCount[GROUPS];  // Assign or update a variable that represents the current algorithm state.
+    for (size_t g = 0; g < GROUPS; ++g) {  // Iterate over a range/collection to process each item in sequence.
+        v0[g] = _mm256_xor_si256(key0, _mm256_set1_epi64x(0x736f6d6570736575LL));  // Assign or update a variable that represents the current algorithm state.
+        v1[g] = _mm256_xor_si256(key1, _mm256_set1_epi64x(0x646f72616e646f6dLL));  // Assign or update a variable that represents the current algorithm state.
+        v2[g] = _mm256_xor_si256(key0, _mm256_set1_epi64x(0x6c7967656e657261LL));  // Assign or update a variable that represents the current algorithm state.
+        v3[g] = _mm256_xor_si256(key1, _mm256_set1_epi64x(0x7465646279746573LL));  // Assign or update a variable that represents the current algorithm state.
+        // 以 set 組成向量：四次 8 位元組寫入後的 32 位元組載入無法轉送，每塊都會停頓
+        // Vectors are built with set: a 32-byte load after four 8-byte stores cannot be forwarded and would stall every block
+        const size_t* b = blocks + g * BATCH_HASH_LANES;  // Assign or update a variable that represents the current algorithm state.
+        blockCount[g] = _mm256_set_epi64x(static_cast<long long>(b[3]), static_cast<long long>(b[2]), static_cast<long long>(b[1]), static_cast<long long>(b[0]));  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    for (size_t j = 0; j < maxBlocks; ++j) {  // Iterate over a range/collection to process each item in sequence.
+        const __m256i index = _mm256_set1_epi64x(static_cast<long long>(j));  // Assign or update a variable that represents the current algorithm state.
+        for (size_t g = 0; g < GROUPS; ++g) {  // Iterate over a range/collection to process each item in sequence.
+            size_t lane = g * BATCH_HASH_LANES;  // Assign or update a variable that represents the current algorithm state.
+            __m256i m = _mm256_set_epi64x(word(lane + 3, j), word(lane + 2, j), word(lane + 1, j), word(lane, j));  // Assign or update a variable that represents the current algorithm state.
+            __m256i active = _mm256_cmpgt_epi64(blockCount[g], index);  // 還有區塊的通道 - Lanes that still have a block
+            __m256i n0 = v0[g], n1 = v1[g], n2 = v2[g], n3 = _mm256_xor_si256(v3[g], m);  // Assign or update a variable that represents the current algorithm state.
+            sipRound4(n0, n1, n2, n3);  // c = 1
+            n0 = _mm256_xor_si256(n0, m);  // Assign or update a variable that represents the current algorithm state.
+            v0[g] = _mm256_blendv_epi8(v0[g], n0, active);  // Assign or update a variable that represents the current algorithm state.
+            v1[g] = _mm256_blendv_epi8(v1[g], n1, active);  // Assign or update a variable that represents the current algorithm state.
+            v2[g] = _mm256_blendv_epi8(v2[g], n2, active);  // Assign or update a variable that represents the current algorithm state.
+            v3[g] = _mm256_blendv_epi8(v3[g], n3, active);  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    for (size_t g = 0; g < GROUPS; ++g) {  // Iterate over a range/collection to process each item in sequence.
+        v2[g] = _mm256_xor_si256(v2[g], _mm256_set1_epi64x(0xff));  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    for (int r = 0; r < 3; ++r) {  // 三輪收尾（d = 3）- Three finalization rounds (d = 3)
+        for (size_t g = 0; g < GROUPS; ++g) {  // Iterate over a range/collection to process each item in sequence.
+            sipRound4(v0[g], v1[g], v2[g], v3[g]);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    for (size_t g = 0; g < GROUPS; ++g) {  // Iterate over a range/collection to process each item in sequence.
+        __m256i result = _mm256_xor_si256(_mm256_xor_si256(v0[g], v1[g]), _mm256_xor_si256(v2[g], v3[g]));  // Assign or update a variable that represents the current algorithm state.
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + g * BATCH_HASH_LANES), result);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+#endif  // BATCH_HASH_AVX2
+
+// ========== 執行期選擇 Runtime Dispatch ==========
+
+/** Doc block start
+ * 這顆 CPU 是否走 AVX2 版本（查一次 CPUID 後快取）
+ * Whether this CPU takes the AVX2 kernels (CPUID is queried once and cached)
+ */  // End of block comment
+inline bool batchHashUsesAvx2() {  // Execute this statement as part of the data structure implementation.
+#if BATCH_HASH_AVX2  // Evaluate the condition and branch into the appropriate code path.
+    static const bool supported = __builtin_cpu_supports("avx2");  // Assign or update a variable that represents the current algorithm state.
+    return supported;  // Return the computed result to the caller.
+#else  // Handle the alternative branch when the condition is false.
+    return false;  // Return the computed result to the caller.
+#endif  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 整數 key 的批次雜湊：out[i] = fmix64(keys[i] ^ seed.k0)
+ * Batch hash for integer keys: out[i] = fmix64(keys[i] ^ seed.k0)
+ */  // End of block comment
+inline void hashBatch(const uint64_t* keys, size_t count, const HashSeed& seed, uint64_t* out) {  // Compute a hash-based index so keys map into the table's storage.
+#if BATCH_HASH_AVX2  // Evaluate the condition and branch into the appropriate code path.
+    if (batchHashUsesAvx2()) {  // Evaluate the condition and branch into the appropriate code path.
+        hashBatchAvx2(keys, count, seed, out);  // Execute this statement as part of the data structure implementation.
+        return;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+#endif  // Execute this statement as part of the data structure implementation.
+    hashBatchScalar(keys, count, seed, out);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 字串 key 的批次雜湊：out[i] = sipHash13(keys[i], seed)。每 BATCH_HASH_STRING_KEYS 個一組，最長不超過
+ * BATCH_HASH_MAX_SIMD_BYTES 的組走 AVX2，其餘（含不足一組的尾端）走純量。
+ * Batch hash for string keys: out[i] = sipHash13(keys[i], seed). Groups of BATCH_HASH_STRING_KEYS
+ * whose longest key fits in BATCH_HASH_MAX_SIMD_BYTES take AVX2; the rest (and a short tail) go scalar.
+ */  // End of block comment
+inline void hashBatch(const std::string_view* keys, size_t count, const HashSeed& seed, uint64_t* out) {  // Compute a hash-based index so keys map into the table's storage.
+    size_t i = 0;  // Assign or update a variable that represents the current algorithm state.
+#if BATCH_HASH_AVX2  // Evaluate the condition and branch into the appropriate code path.
+    if (batchHashUsesAvx2()) {  // Evaluate the condition and branch into the appropriate code path.
+        for (; i + BATCH_HASH_STRING_KEYS <= count; i += BATCH_HASH_STRING_KEYS) {  // Iterate over a range/collection to process each item in sequence.
+            size_t longest = 0;  // Assign or update a variable that represents the current algorithm state.
+            for (size_t k = i; k < i + BATCH_HASH_STRING_KEYS; ++k) {  // Iterate over a range/collection to process each item in sequence.
+                longest = std::max(longest, keys[k].size());  // Assign or update a variable that represents the current algorithm state.
+            }  // Close the current block scope.
+            if (longest <= BATCH_HASH_MAX_SIMD_BYTES) {  // Evaluate the condition and branch into the appropriate code path.
+                sipHash13Avx2<BATCH_HASH_STRING_KEYS / BATCH_HASH_LANES>(keys + i, seed, out + i);  // Execute this statement as part of the data structure implementation.
+            } else {  // 長字串逐一計算較快 - Long keys are faster one at a time
+                hashBatchScalar(keys + i, BATCH_HASH_STRING_KEYS, seed, out + i);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+#endif  // Execute this statement as part of the data structure implementation.
+    hashBatchScalar(keys + i, count - i, seed, out + i);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+// ========== 雜湊表使用的入口 Entry Point for the Tables ==========
+
+/** Doc block start
+ * out[i] = seededHash(hasher, keys[i], seed)。雜湊函數是預設的 HashTableHasher 時：整數 key
+ * （std::hash 為恆等函數的標準函式庫）與字串 key 走 hashBatch，其他組合逐一呼叫 seededHash。
+ * out[i] = seededHash(hasher, keys[i], seed). With the default HashTableHasher, integer keys
+ * (on standard libraries whose std::hash is the identity) and string keys go through hashBatch;
+ * any other combination calls seededHash per key.
+ */  // End of block comment
+template <typename H, typename K>  // Execute this statement as part of the data structure implementation.
+void seededHashBatch(const H& hasher, const K* keys, size_t count, const HashSeed& seed, size_t* out) {  // Compute a hash-based index so keys map into the table's storage.
+    constexpr bool integerPath = BATCH_HASH_IDENTITY_INT_HASH && sizeof(size_t) == sizeof(uint64_t) &&  // Assign or update a variable that represents the current algorithm state.
+                                 std::is_integral<K>::value && std::is_same<H, HashTableHasher<K>>::value;  // Execute this statement as part of the data structure implementation.
+    constexpr bool stringPath = std::is_same<H, HashTableHasher<std::string>>::value &&  // Assign or update a variable that represents the current algorithm state.
+                                std::is_convertible<const K&, std::string_view>::value;  // Execute this statement as part of the data structure implementation.
+    if constexpr (integerPath || stringPath) {  // Evaluate the condition and branch into the appropriate code path.
+        uint64_t hashes[BATCH_HASH_CHUNK];  // Compute a hash-based index so keys map into the table's storage.
+        for (size_t base = 0; base < count; base += BATCH_HASH_CHUNK) {  // Iterate over a range/collection to process each item in sequence.
+            size_t n = std::min(BATCH_HASH_CHUNK, count - base);  // Assign or update a variable that represents the current algorithm state.
+            if constexpr (integerPath) {  // Evaluate the condition and branch into the appropriate code path.
+                uint64_t words[BATCH_HASH_CHUNK];  // Assign or update a variable that represents the current algorithm state.
+                for (size_t i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                    words[i] = static_cast<uint64_t>(static_cast<size_t>(keys[base + i]));  // 與 std::hash 相同的轉換（有號數符號擴展）- Same conversion as std::hash (signed keys sign-extend)
+                }  // Close the current block scope.
+                hashBatch(words, n, seed, hashes);  // Compute a hash-based index so keys map into the table's storage.
+            } else {  // Handle the alternative branch when the condition is false.
+                std::string_view views[BATCH_HASH_CHUNK];  // Assign or update a variable that represents the current algorithm state.
+                for (size_t i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                    views[i] = std::string_view(keys[base + i]);  // Assign or update a variable that represents the current algorithm state.
+                }  // Close the current block scope.
+                hashBatch(views, n, seed, hashes);  // Compute a hash-based index so keys map into the table's storage.
+            }  // Close the current block scope.
+            for (size_t i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                out[base + i] = static_cast<size_t>(hashes[i]);  // Compute a hash-based index so keys map into the table's storage.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    } else {  // Handle the alternative branch when the condition is false.
+        for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            out[i] = seededHash(hasher, keys[i], seed);  // Compute a hash-based index so keys map into the table's storage.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+#endif // BATCH_HASH_HPP
@@ -0,0 +1,252 @@
+/** Doc block start
+ * 並行分片雜湊表（Concurrent Sharded Hash Map）- C++ 實作
+ * 每個分片是一個獨立的 HashTable，並由自己的讀寫鎖保護
+ *(blank line)
+ * Concurrent hash map built from independent HashTable shards,
+ * each guarded by its own cache-line-padded reader-writer lock
+ */  // End of block comment
+
+#ifndef CONCURRENT_HASH_MAP_HPP  // Execute this statement as part of the data structure implementation.
+#define CONCURRENT_HASH_MAP_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <memory>  // Execute this statement as part of the data structure implementation.
+#include <mutex>  // Execute this statement as part of the data structure implementation.
+#include <optional>  // Execute this statement as part of the data structure implementation.
+#include <shared_mutex>  // Execute this statement as part of the data structure implementation.
+#include <stdexcept>  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SeededHash.hpp"  // 分片與桶共用一次帶種子的雜湊 - Shard and bucket share one seeded hash
+
+/** Doc block start
+ * 並行雜湊表模板類別 / Concurrent hash map template class
+ *(blank line)
+ * 每個 key 只以整張表的種子雜湊一次（seededHash）：分片索引取雜湊值的最高位元，分片內 HashTable
+ * 沿用同一個種子、以最低位元當桶索引，兩者互不相關。攻擊者不知道種子，就無法讓所有 key 擠進同一個分片、
+ * 讓所有寫入者排隊等同一把鎖；只有同分片的寫入才會互相等待。
+ * Every key is hashed once with the map's seed (seededHash): the shard index is the top bits of
+ * that hash, and each shard's HashTable shares the seed and uses the low bits as its bucket index,
+ * so the two are independent. An attacker who does not know the seed cannot pile every key onto one
+ * shard and serialize all writers on its lock; only same-shard writers wait.
+ *(blank line)
+ * @tparam K 鍵的型別（key type）
+ * @tparam V 值的型別（value type）
+ */  // End of block comment
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+class ConcurrentHashMap {  // Execute this statement as part of the data structure implementation.
+public:  // Execute this statement as part of the data structure implementation.
+    /** Doc block start
+     * 建構子 / Constructor
+     *(blank line)
+     * @param shardCount 分片數（會向上取到 2 的冪次）/ number of shards (rounded up to a power of two)
+     * @param shardCapacity 每個分片的初始桶數 / initial bucket count per shard
+     * @param seed 雜湊種子，預設每個表各自隨機；所有分片共用（hash seed, random per map by default; shared by every shard）
+     */  // End of block comment
+    explicit ConcurrentHashMap(size_t shardCount = DEFAULT_SHARDS, size_t shardCapacity = 16,  // Execute this statement as part of the data structure implementation.
+                               HashSeed seed = HashSeed::random());  // Execute this statement as part of the data structure implementation.
+
+    // ========== 基本操作 Basic Operations ==========
+
+    /** Doc block start
+     * 插入或更新鍵值對（寫鎖）/ Insert or update a key-value pair (exclusive lock)
+     */  // End of block comment
+    void insert(const K& key, const V& value);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 搜尋（讀鎖，可與同分片的其他讀者並行；HASH_TABLE_STATS=1 時改用寫鎖，見 ReadLock）
+     * Search (shared lock: runs alongside other readers of the same shard; exclusive under
+     * HASH_TABLE_STATS=1, see ReadLock)
+     */  // End of block comment
+    std::optional<V> search(const K& key) const;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 刪除鍵（寫鎖）/ Remove a key (exclusive lock)
+     */  // End of block comment
+    bool remove(const K& key);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 檢查鍵是否存在（與 search 相同的鎖）/ Check whether a key exists (same lock as search)
+     */  // End of block comment
+    bool contains(const K& key) const;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 原子性的讀取-修改-寫入：在寫鎖內對 value 呼叫 fn(V&)；key 不存在時先插入 V{}
+     * Atomic read-modify-write: call fn(V&) under the shard's exclusive lock, inserting V{} first if absent
+     *(blank line)
+     * 例 Example: counter.upsert(word, [](int& c) { ++c; });
+     */  // End of block comment
+    template <typename Fn>  // Execute this statement as part of the data structure implementation.
+    void upsert(const K& key, Fn&& fn);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 依序以讀鎖走訪每個分片，對每一對呼叫 fn(key, value)
+     * Visit every pair with fn(key, value), holding each shard's read lock in turn
+     *(blank line)
+     * 不是整體快照：走訪期間其他分片仍可被修改 / Not a global snapshot: other shards may change meanwhile
+     */  // End of block comment
+    template <typename Fn>  // Execute this statement as part of the data structure implementation.
+    void forEach(Fn&& fn);  // Execute this statement as part of the data structure implementation.
+
+    // ========== 容量 Capacity ==========
+
+    /** Doc block start
+     * 元素總數（逐一讀取每個分片的大小）/ Total element count (reads each shard's size in turn)
+     */  // End of block comment
+    size_t size() const;  // Execute this statement as part of the data structure implementation.
+    bool empty() const { return size() == 0; }  // Return the computed result to the caller.
+    size_t shardCount() const { return shardCount_; }  // Return the computed result to the caller.
+    const HashSeed& hashSeed() const { return seed_; }  // Return the computed result to the caller.
+
+    /** Doc block start
+     * 清空所有分片 / Clear every shard
+     */  // End of block comment
+    void clear();  // Execute this statement as part of the data structure implementation.
+
+private:  // Execute this statement as part of the data structure implementation.
+    /** Doc block start
+     * 一個分片：鎖與表放在同一個對齊到 64 bytes 的結構中，
+     * 避免相鄰分片的鎖落在同一條 cache line 上（false sharing）
+     * One shard: lock and table share a 64-byte-aligned struct so
+     * neighbouring shards' locks never share a cache line (false sharing)
+     */  // End of block comment
+    struct alignas(64) Shard {  // Execute this statement as part of the data structure implementation.
+        mutable std::shared_mutex mutex;  // Execute this statement as part of the data structure implementation.
+        HashTable<K, V> table;  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * search / contains 使用的鎖。HASH_TABLE_STATS=1 時 HashTable 的 const 查詢會寫入它的統計記錄器，
+     * 同分片的兩個讀者若共享讀鎖就會同時寫記錄器（資料競爭），所以此時改用寫鎖。forEach 與 size
+     * 不碰記錄器，維持讀鎖。
+     * Lock taken by search / contains. With HASH_TABLE_STATS=1 a HashTable's const lookups write its
+     * statistics recorder, so two readers sharing a shard's read lock would race on it; lookups take
+     * the exclusive lock instead. forEach and size never touch the recorder and keep the shared lock.
+     */  // End of block comment
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    using ReadLock = std::unique_lock<std::shared_mutex>;  // Execute this statement as part of the data structure implementation.
+#else  // Handle the alternative branch when the condition is false.
+    using ReadLock = std::shared_lock<std::shared_mutex>;  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
+    std::unique_ptr<Shard[]> shards_;  // shared_mutex 不可移動，所以不用 vector - shared_mutex is not movable, so no vector
+    size_t shardCount_;  // Execute this statement as part of the data structure implementation.
+    size_t shardMask_;  // Execute this statement as part of the data structure implementation.
+    unsigned shardShift_;  // 雜湊值右移幾位得到分片索引 - Right shift that leaves the shard index
+    HashTableHasher<K> hasher_;  // Execute this statement as part of the data structure implementation.
+    HashSeed seed_;  // 整張表與所有分片共用 - Shared by the map and every shard
+
+    static constexpr size_t DEFAULT_SHARDS = 64;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 完整雜湊值（與分片內 HashTable 算出的相同，可直接傳給 *Hashed 方法）
+     * Full hash (identical to what the shard's HashTable computes, so it can be passed to the *Hashed methods)
+     */  // End of block comment
+    size_t hashOf(const K& key) const {  // Compute a hash-based index so keys map into the table's storage.
+        return seededHash(hasher_, key, seed_);  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 選擇分片：取雜湊值的最高位元，桶索引用的是最低位元
+     * Pick a shard from the top bits of the hash; bucket indices use the low bits
+     */  // End of block comment
+    Shard& shardFor(size_t code) const {  // Execute this statement as part of the data structure implementation.
+        return shards_[(code >> shardShift_) & shardMask_];  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+
+// ============================================================
+// 實作部分 Implementation
+// ============================================================
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+ConcurrentHashMap<K, V>::ConcurrentHashMap(size_t shardCount, size_t shardCapacity, HashSeed seed)  // Execute this statement as part of the data structure implementation.
+    : shardCount_(1), shardMask_(0), shardShift_(0), seed_(seed) {  // Execute this statement as part of the data structure implementation.
+    if (shardCount == 0 || shardCapacity == 0) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::invalid_argument(  // Throw an exception to signal an invalid operation or state.
+            "分片數與容量必須為正整數 / Shard count and capacity must be positive");  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    unsigned shardBits = 0;  // 分片數的 log2 - log2 of the shard count
+    while (shardCount_ < shardCount) {  // 向上取到 2 的冪次，分片索引只需一個遮罩 - Round up to a power of two so the index is one mask
+        shardCount_ <<= 1;  // Assign or update a variable that represents the current algorithm state.
+        ++shardBits;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    shardMask_ = shardCount_ - 1;  // Assign or update a variable that represents the current algorithm state.
+    shardShift_ = (shardBits == 0) ? 0 : static_cast<unsigned>(sizeof(size_t) * 8) - shardBits;  // 只有一個分片時遮罩為 0 - With one shard the mask is 0
+
+    shards_.reset(new Shard[shardCount_]);  // C++17 的 new[] 會遵守 alignas(64) - C++17 new[] honours alignas(64)
+    for (size_t i = 0; i < shardCount_; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        shards_[i].table = HashTable<K, V>(shardCapacity, seed_);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void ConcurrentHashMap<K, V>::insert(const K& key, const V& value) {  // Execute this statement as part of the data structure implementation.
+    size_t code = hashOf(key);  // 只雜湊一次 - Hash once
+    Shard& shard = shardFor(code);  // Assign or update a variable that represents the current algorithm state.
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);  // Execute this statement as part of the data structure implementation.
+    shard.table.insertHashed(code, key, value);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+std::optional<V> ConcurrentHashMap<K, V>::search(const K& key) const {  // Execute this statement as part of the data structure implementation.
+    size_t code = hashOf(key);  // Compute a hash-based index so keys map into the table's storage.
+    Shard& shard = shardFor(code);  // Assign or update a variable that represents the current algorithm state.
+    ReadLock lock(shard.mutex);  // Execute this statement as part of the data structure implementation.
+    return shard.table.searchHashed(code, key);  // 回傳複本，鎖釋放後仍然安全 - Returns a copy, safe after the lock is released
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool ConcurrentHashMap<K, V>::remove(const K& key) {  // Execute this statement as part of the data structure implementation.
+    size_t code = hashOf(key);  // Compute a hash-based index so keys map into the table's storage.
+    Shard& shard = shardFor(code);  // Assign or update a variable that represents the current algorithm state.
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);  // Execute this statement as part of the data structure implementation.
+    return shard.table.removeHashed(code, key);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool ConcurrentHashMap<K, V>::contains(const K& key) const {  // Execute this statement as part of the data structure implementation.
+    size_t code = hashOf(key);  // Compute a hash-based index so keys map into the table's storage.
+    Shard& shard = shardFor(code);  // Assign or update a variable that represents the current algorithm state.
+    ReadLock lock(shard.mutex);  // Execute this statement as part of the data structure implementation.
+    return shard.table.containsHashed(code, key);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+template <typename Fn>  // Execute this statement as part of the data structure implementation.
+void ConcurrentHashMap<K, V>::upsert(const K& key, Fn&& fn) {  // Execute this statement as part of the data structure implementation.
+    size_t code = hashOf(key);  // Compute a hash-based index so keys map into the table's storage.
+    Shard& shard = shardFor(code);  // Assign or update a variable that represents the current algorithm state.
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);  // Execute this statement as part of the data structure implementation.
+    fn(shard.table.findOrInsertHashed(code, key));  // 不存在時插入 V{} - Inserts V{} when absent
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+template <typename Fn>  // Execute this statement as part of the data structure implementation.
+void ConcurrentHashMap<K, V>::forEach(Fn&& fn) {  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < shardCount_; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);  // Execute this statement as part of the data structure implementation.
+        for (auto& pair : shards_[i].table) {  // Iterate over a range/collection to process each item in sequence.
+            fn(static_cast<const K&>(pair.first), static_cast<const V&>(pair.second));  // 只給唯讀存取 - Read-only access only
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+size_t ConcurrentHashMap<K, V>::size() const {  // Execute this statement as part of the data structure implementation.
+    size_t total = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < shardCount_; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);  // Execute this statement as part of the data structure implementation.
+        total += shards_[i].table.size();  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return total;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void ConcurrentHashMap<K, V>::clear() {  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < shardCount_; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);  // Execute this statement as part of the data structure implementation.
+        shards_[i].table.clear();  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+#endif // CONCURRENT_HASH_MAP_HPP
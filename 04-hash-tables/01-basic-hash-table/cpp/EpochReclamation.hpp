@@ -0,0 +1,204 @@
+/** Doc block start
+ * 以世代為基礎的記憶體回收（Epoch-Based Reclamation, EBR）- C++ 實作
+ * 無鎖資料結構刪除節點後，必須等到所有可能仍持有指標的執行緒離開，才能真正釋放
+ *(blank line)
+ * Epoch-based memory reclamation for lock-free structures: an unlinked node is
+ * freed only once every thread that could still hold a pointer to it has moved on
+ */  // End of block comment
+
+#ifndef EPOCH_RECLAMATION_HPP  // Execute this statement as part of the data structure implementation.
+#define EPOCH_RECLAMATION_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <atomic>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <functional>  // Execute this statement as part of the data structure implementation.
+#include <stdexcept>  // Execute this statement as part of the data structure implementation.
+#include <thread>  // Execute this statement as part of the data structure implementation.
+#include <utility>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 世代回收網域 / Epoch reclamation domain
+ *(blank line)
+ * 規則 Rules:
+ *   - 讀取共享指標前先 pin()，用完後 unpin()（建議使用 EpochDomain::Guard）
+ *     pin() before reading shared pointers and unpin() afterwards (use EpochDomain::Guard)
+ *   - 節點自結構中摘除後呼叫 retire()，而不是直接 delete
+ *     After unlinking a node, call retire() instead of delete
+ *   - 在全域世代 e 被 retire 的節點，要等全域世代到 e + 2 才釋放：
+ *     那時每個仍在臨界區內的執行緒都是在摘除之後才進入的
+ *     A node retired in global epoch e is freed once the global epoch reaches e + 2:
+ *     by then every thread still inside a critical section entered after the unlink
+ *(blank line)
+ * 每次 pin 會佔用一個 slot（固定 MAX_SLOTS 個，各自對齊到 cache line），unpin 時歸還。
+ * 以「每次操作佔用 slot」而非「每個執行緒註冊一次」，執行緒結束時就不需要任何清理。
+ * Each pin claims one of MAX_SLOTS cache-line-aligned slots and unpin releases it.
+ * Claiming per operation rather than registering per thread means exiting threads need no cleanup.
+ */  // End of block comment
+class EpochDomain {  // Execute this statement as part of the data structure implementation.
+public:  // Execute this statement as part of the data structure implementation.
+    static constexpr size_t MAX_SLOTS = 128;  // 同時 pin 的執行緒上限 - Maximum concurrently pinned threads
+    static constexpr size_t RETIRE_THRESHOLD = 64;  // limbo 累積到此數量時嘗試推進世代 - Try advancing at this limbo size
+
+    using Deleter = void (*)(void*);  // Assign or update a variable that represents the current algorithm state.
+
+    EpochDomain() : globalEpoch_(0), slots_(new Slot[MAX_SLOTS]) {}  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 解構子：此時不應有任何執行緒仍在使用，直接釋放所有待回收節點
+     * Destructor: no thread may still be inside; free everything left in limbo
+     */  // End of block comment
+    ~EpochDomain() {  // Execute this statement as part of the data structure implementation.
+        for (size_t i = 0; i < MAX_SLOTS; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            for (const Retired& r : slots_[i].limbo) {  // Iterate over a range/collection to process each item in sequence.
+                r.deleter(r.pointer);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        delete[] slots_;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    EpochDomain(const EpochDomain&) = delete;  // Execute this statement as part of the data structure implementation.
+    EpochDomain& operator=(const EpochDomain&) = delete;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 進入臨界區，回傳佔用的 slot 編號 / Enter a critical section; returns the claimed slot index
+     */  // End of block comment
+    size_t pin();  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 離開臨界區並歸還 slot / Leave the critical section and release the slot
+     */  // End of block comment
+    void unpin(size_t slot);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 延後釋放 pointer（呼叫者必須持有 slot）/ Defer freeing pointer (caller must hold slot)
+     */  // End of block comment
+    void retire(size_t slot, void* pointer, Deleter deleter);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 若所有 pin 住的執行緒都已觀察到目前世代，則推進一代 / Advance the epoch if every pinned thread has seen it
+     */  // End of block comment
+    bool tryAdvance();  // Execute this statement as part of the data structure implementation.
+
+    uint64_t epoch() const { return globalEpoch_.load(std::memory_order_acquire); }  // Return the computed result to the caller.
+
+    /** Doc block start
+     * 尚未釋放的節點數（僅供測試與統計，非精確快照）/ Nodes still waiting (tests/stats only, not an exact snapshot)
+     */  // End of block comment
+    size_t pendingCount() const;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * RAII 守衛：建構時 pin，解構時 unpin / RAII guard: pins on construction, unpins on destruction
+     */  // End of block comment
+    class Guard {  // Execute this statement as part of the data structure implementation.
+    public:  // Execute this statement as part of the data structure implementation.
+        explicit Guard(EpochDomain& domain) : domain_(domain), slot_(domain.pin()) {}  // Execute this statement as part of the data structure implementation.
+        ~Guard() { domain_.unpin(slot_); }  // Execute this statement as part of the data structure implementation.
+        Guard(const Guard&) = delete;  // Execute this statement as part of the data structure implementation.
+        Guard& operator=(const Guard&) = delete;  // Execute this statement as part of the data structure implementation.
+
+        void retire(void* pointer, Deleter deleter) { domain_.retire(slot_, pointer, deleter); }  // Execute this statement as part of the data structure implementation.
+
+    private:  // Execute this statement as part of the data structure implementation.
+        EpochDomain& domain_;  // Execute this statement as part of the data structure implementation.
+        size_t slot_;  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+
+private:  // Execute this statement as part of the data structure implementation.
+    struct Retired {  // Execute this statement as part of the data structure implementation.
+        void* pointer;  // Execute this statement as part of the data structure implementation.
+        Deleter deleter;  // Execute this statement as part of the data structure implementation.
+        uint64_t epoch;  // 被 retire 時的全域世代 - Global epoch at retire time
+    };  // Execute this statement as part of the data structure implementation.
+
+    static constexpr uint64_t FREE = 0;  // slot 未被佔用 - Slot not claimed
+
+    /** Doc block start
+     * 一個 slot：state = (世代 << 1) | 佔用位元，由所有執行緒讀取；limbo 只由目前佔用者存取
+     * One slot: state = (epoch << 1) | claimed bit, read by everyone; limbo is touched only by the current holder
+     */  // End of block comment
+    struct alignas(64) Slot {  // Execute this statement as part of the data structure implementation.
+        std::atomic<uint64_t> state{FREE};  // Execute this statement as part of the data structure implementation.
+        std::vector<Retired> limbo;  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+
+    std::atomic<uint64_t> globalEpoch_;  // Execute this statement as part of the data structure implementation.
+    Slot* slots_;  // Execute this statement as part of the data structure implementation.
+
+    void collect(Slot& slot);  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+// ============================================================
+// 實作部分 Implementation
+// ============================================================
+
+inline size_t EpochDomain::pin() {  // Execute this statement as part of the data structure implementation.
+    // 從執行緒專屬的起點開始找，通常第一次就能拿到上次用過的 slot
+    // Start from a per-thread hint so the same slot is usually claimed on the first try
+    thread_local size_t hint = std::hash<std::thread::id>{}(std::this_thread::get_id()) % MAX_SLOTS;  // Assign or update a variable that represents the current algorithm state.
+    for (;;) {  // Execute this statement as part of the data structure implementation.
+        for (size_t i = 0; i < MAX_SLOTS; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            size_t index = (hint + i) % MAX_SLOTS;  // Assign or update a variable that represents the current algorithm state.
+            Slot& slot = slots_[index];  // Assign or update a variable that represents the current algorithm state.
+            uint64_t expected = FREE;  // Assign or update a variable that represents the current algorithm state.
+            // 一次 seq_cst CAS 同時佔用 slot 並發布世代，且排在之後所有指標讀取之前；
+            // 讀到的世代若已過時只會讓回收變保守，不會不安全
+            // One seq_cst CAS both claims the slot and publishes the epoch, ordered before every later
+            // pointer load; a stale epoch only makes reclamation more conservative, never unsafe
+            uint64_t pinned = (globalEpoch_.load(std::memory_order_relaxed) << 1) | 1u;  // Assign or update a variable that represents the current algorithm state.
+            if (slot.state.load(std::memory_order_relaxed) == FREE &&  // Evaluate the condition and branch into the appropriate code path.
+                slot.state.compare_exchange_strong(expected, pinned, std::memory_order_seq_cst)) {  // Execute this statement as part of the data structure implementation.
+                hint = index;  // Assign or update a variable that represents the current algorithm state.
+                return index;  // Return the computed result to the caller.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        std::this_thread::yield();  // 所有 slot 都被佔用：稍後再試 - Every slot is busy: retry later
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+inline void EpochDomain::unpin(size_t slot) {  // Execute this statement as part of the data structure implementation.
+    slots_[slot].state.store(FREE, std::memory_order_release);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+inline void EpochDomain::retire(size_t slot, void* pointer, Deleter deleter) {  // Execute this statement as part of the data structure implementation.
+    Slot& s = slots_[slot];  // Assign or update a variable that represents the current algorithm state.
+    s.limbo.push_back(Retired{pointer, deleter, globalEpoch_.load(std::memory_order_seq_cst)});  // Execute this statement as part of the data structure implementation.
+    if (s.limbo.size() >= RETIRE_THRESHOLD) {  // Evaluate the condition and branch into the appropriate code path.
+        tryAdvance();  // Execute this statement as part of the data structure implementation.
+        collect(s);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+inline bool EpochDomain::tryAdvance() {  // Execute this statement as part of the data structure implementation.
+    uint64_t current = globalEpoch_.load(std::memory_order_seq_cst);  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < MAX_SLOTS; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        uint64_t state = slots_[i].state.load(std::memory_order_seq_cst);  // Assign or update a variable that represents the current algorithm state.
+        if (state != FREE && (state >> 1) != current) {  // 仍有執行緒停在舊世代 - A thread is still in an older epoch
+            return false;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    return globalEpoch_.compare_exchange_strong(current, current + 1, std::memory_order_seq_cst);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+inline void EpochDomain::collect(Slot& slot) {  // Execute this statement as part of the data structure implementation.
+    uint64_t current = globalEpoch_.load(std::memory_order_seq_cst);  // Assign or update a variable that represents the current algorithm state.
+    size_t kept = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < slot.limbo.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        if (slot.limbo[i].epoch + 2 <= current) {  // 已經過兩個世代，不可能再被讀到 - Two epochs later: unreachable
+            slot.limbo[i].deleter(slot.limbo[i].pointer);  // Execute this statement as part of the data structure implementation.
+        } else {  // Handle the alternative branch when the condition is false.
+            slot.limbo[kept++] = slot.limbo[i];  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    slot.limbo.resize(kept);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+inline size_t EpochDomain::pendingCount() const {  // Execute this statement as part of the data structure implementation.
+    size_t total = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < MAX_SLOTS; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        total += slots_[i].limbo.size();  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return total;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+#endif // EPOCH_RECLAMATION_HPP
@@ -1,20 +1,41 @@
 /** Doc block start
  * 雜湊表（Hash Table）- C++ 實作
- * 使用鏈結法（chaining）處理碰撞
+ * 使用鏈結法（chaining）處理碰撞，並以漸進式擴容（incremental rehashing）避免一次性停頓
  *(blank line)
- * Hash Table implementation using chaining for collision resolution
+ * Hash Table implementation using chaining for collision resolution, with incremental
+ * rehashing so growth never stops the world
  */  // End of block comment
 
 #ifndef HASH_TABLE_HPP  // Execute this statement as part of the data structure implementation.
 #define HASH_TABLE_HPP  // Execute this statement as part of the data structure implementation.
 
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
 #include <vector>  // Execute this statement as part of the data structure implementation.
 #include <list>  // Execute this statement as part of the data structure implementation.
+#include <memory>  // Execute this statement as part of the data structure implementation.
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
 #include <utility>  // Execute this statement as part of the data structure implementation.
 #include <functional>  // Execute this statement as part of the data structure implementation.
 #include <optional>  // Execute this statement as part of the data structure implementation.
 #include <stdexcept>  // Execute this statement as part of the data structure implementation.
 #include <string>  // Execute this statement as part of the data structure implementation.
+#include <string_view>  // Execute this statement as part of the data structure implementation.
+#include <tuple>  // Execute this statement as part of the data structure implementation.
+#include <type_traits>  // Execute this statement as part of the data structure implementation.
+#include "HashTableStats.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SeededHash.hpp"  // HashTableHasher 與每表各自的種子 - HashTableHasher and per-table seeds
+#include "BatchHash.hpp"  // 批次查詢一次雜湊整組 key - Batched lookups hash a whole group per call
+
+// 雜湊函數是否宣告 is_transparent - Whether a hash functor declares is_transparent
+template <typename H, typename = void>  // Execute this statement as part of the data structure implementation.
+struct IsTransparentHash : std::false_type {};  // Execute this statement as part of the data structure implementation.
+template <typename H>  // Execute this statement as part of the data structure implementation.
+struct IsTransparentHash<H, std::void_t<typename H::is_transparent>> : std::true_type {};  // Execute this statement as part of the data structure implementation.
+
+// 只在雜湊透明且 Q 不是 K 本身時啟用異質查詢 - Heterogeneous lookup only when the hash is transparent and Q is not K
+template <typename K, typename Q>  // Execute this statement as part of the data structure implementation.
+using EnableIfTransparentKey = std::enable_if_t<IsTransparentHash<HashTableHasher<K>>::value &&  // Execute this statement as part of the data structure implementation.
+                                                !std::is_same<std::decay_t<Q>, K>::value>;  // Execute this statement as part of the data structure implementation.
 
 /** Doc block start
  * 雜湊表模板類別 / Hash Table template class
@@ -33,9 +54,10 @@ public:  // Execute this statement as part of the data structure implementation.
     /** Doc block start
      * 建構子：初始化雜湊表 / Constructor: Initialize hash table
      *(blank line)
-     * @param capacity 桶的數量（number of buckets）
+     * @param capacity 桶的數量，向上取到 2 的冪次（number of buckets, rounded up to a power of two）
+     * @param seed 雜湊種子，預設每個表各自隨機（hash seed, random per table by default）
      */  // End of block comment
-    explicit HashTable(size_t capacity = DEFAULT_CAPACITY);  // Assign or update a variable that represents the current algorithm state.
+    explicit HashTable(size_t capacity = DEFAULT_CAPACITY, HashSeed seed = HashSeed::random());  // Assign or update a variable that represents the current algorithm state.
 
     /** Doc block start
      * 解構子 / Destructor
@@ -83,6 +105,62 @@ public:  // Execute this statement as part of the data structure implementation.
      */  // End of block comment
     bool contains(const K& key) const;  // Execute this statement as part of the data structure implementation.
 
+    // ========== 就地建構 In-place Construction ==========
+
+    /** Doc block start
+     * 以參數直接建構鍵值對；key 已存在時捨棄新建的節點，不修改原值
+     * Construct the pair in place from the arguments; if the key already exists the new node is
+     * discarded and the stored value is left untouched
+     *(blank line)
+     * @return 是否插入新元素 / true if a new element was inserted
+     */  // End of block comment
+    template <typename... Args>  // Execute this statement as part of the data structure implementation.
+    bool emplace(Args&&... args);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * key 不存在時才以 args 建構 value；key 存在時完全不動 args（右值不會被搬走）
+     * Construct the value from args only if key is absent; otherwise args are untouched
+     * (rvalues are not moved from)
+     *(blank line)
+     * @return 是否插入新元素 / true if a new element was inserted
+     */  // End of block comment
+    template <typename... Args>  // Execute this statement as part of the data structure implementation.
+    bool try_emplace(const K& key, Args&&... args);  // Execute this statement as part of the data structure implementation.
+    template <typename... Args>  // Execute this statement as part of the data structure implementation.
+    bool try_emplace(K&& key, Args&&... args);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 插入或覆寫：右值的 key / value 會被搬移而非複製
+     * Insert or overwrite: rvalue keys and values are moved instead of copied
+     *(blank line)
+     * @return 插入新元素回傳 true，覆寫既有元素回傳 false / true if inserted, false if assigned
+     */  // End of block comment
+    template <typename M>  // Execute this statement as part of the data structure implementation.
+    bool insert_or_assign(const K& key, M&& value);  // Execute this statement as part of the data structure implementation.
+    template <typename M>  // Execute this statement as part of the data structure implementation.
+    bool insert_or_assign(K&& key, M&& value);  // Execute this statement as part of the data structure implementation.
+
+    // ========== 批次操作 Batch Operations ==========
+
+    /** Doc block start
+     * 批次插入（若 key 已存在則更新）：先一次擴容到能容納全部元素，插入過程中不再觸發擴容
+     * Batch insert (updates existing keys): grow once to fit every element up front, so no
+     * rehash is triggered while inserting
+     *(blank line)
+     * @throws std::invalid_argument 若 keys 與 values 長度不同
+     */  // End of block comment
+    void insertBatch(const std::vector<K>& keys, const std::vector<V>& values);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 批次查詢：每 BATCH_GROUP 個 key 一組，先以 seededHashBatch 一次算好整組雜湊值（AVX2 時 4 個一起）並預取桶，
+     * 再預取各鏈的第一個節點，最後才逐一比對，讓同一組的快取未命中重疊而不是依序等待。out[i] 對應 keys[i]。
+     * Batch lookup: for each group of BATCH_GROUP keys, hash the whole group with seededHashBatch
+     * (4 lanes at a time under AVX2) and prefetch their buckets, then prefetch the first node of
+     * each chain, and only then compare, so the group's cache misses overlap instead of being
+     * waited on one by one. out[i] answers keys[i].
+     */  // End of block comment
+    void searchBatch(const std::vector<K>& keys, std::vector<std::optional<V>>& out) const;  // Execute this statement as part of the data structure implementation.
+
     // ========== 容量操作 Capacity Operations ==========
 
     /** Doc block start
@@ -91,7 +169,7 @@ public:  // Execute this statement as part of the data structure implementation.
     size_t size() const { return size_; }  // Execute this statement as part of the data structure implementation.
 
     /** Doc block start
-     * 回傳桶的數量 / Return number of buckets
+     * 回傳桶的數量（擴容中回傳新陣列的大小）/ Return number of buckets (the new array's size during a rehash)
      */  // End of block comment
     size_t capacity() const { return capacity_; }  // Execute this statement as part of the data structure implementation.
 
@@ -100,6 +178,11 @@ public:  // Execute this statement as part of the data structure implementation.
      */  // End of block comment
     bool empty() const { return size_ == 0; }  // Execute this statement as part of the data structure implementation.
 
+    /** Doc block start
+     * 回傳這個表的雜湊種子（複製出的表沿用同一個種子）/ Return this table's hash seed (copies keep it)
+     */  // End of block comment
+    const HashSeed& hashSeed() const { return seed_; }  // Execute this statement as part of the data structure implementation.
+
     /** Doc block start
      * 計算負載因子 α = n / m
      * Calculate load factor
@@ -108,6 +191,13 @@ public:  // Execute this statement as part of the data structure implementation.
         return static_cast<double>(size_) / capacity_;  // Return the computed result to the caller.
     }  // Close the current block scope.
 
+    /** Doc block start
+     * 預先擴容，讓 n 個元素不超過負載上限；進行中的擴容與這次擴容都會立即搬完
+     * Grow so that n elements stay under the load limit; any rehash in progress and this one
+     * are both completed immediately
+     */  // End of block comment
+    void reserve(size_t n);  // Execute this statement as part of the data structure implementation.
+
     /** Doc block start
      * 清空雜湊表 / Clear all elements
      */  // End of block comment
@@ -125,6 +215,7 @@ public:  // Execute this statement as part of the data structure implementation.
      * @return 值的參考
      */  // End of block comment
     V& operator[](const K& key);  // Execute this statement as part of the data structure implementation.
+    V& operator[](K&& key);  // 不存在時搬移 key - Moves the key in when it is absent
 
     /** Doc block start
      * 取得 value（若不存在則拋出例外）
@@ -137,35 +228,225 @@ public:  // Execute this statement as part of the data structure implementation.
     V& at(const K& key);  // Execute this statement as part of the data structure implementation.
     const V& at(const K& key) const;  // Execute this statement as part of the data structure implementation.
 
+    // ========== 異質查詢 Heterogeneous Lookup ==========
+
+    /** Doc block start
+     * 雜湊函數為透明（如 std::string 鍵）時，可用能與 K 比較的型別查詢（如 std::string_view、const char*），
+     * 不會為了查詢而建出暫時的 K。
+     * When the hash is transparent (e.g. std::string keys), probe with any type comparable to K
+     * (e.g. std::string_view, const char*) without building a temporary K.
+     */  // End of block comment
+    template <typename Q, typename = EnableIfTransparentKey<K, Q>>  // Execute this statement as part of the data structure implementation.
+    std::optional<V> search(const Q& key) const {  // Execute this statement as part of the data structure implementation.
+        const PairType* pair = findPair(key, hash(key));  // Execute this statement as part of the data structure implementation.
+        if (pair != nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+            return pair->second;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        return std::nullopt;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    template <typename Q, typename = EnableIfTransparentKey<K, Q>>  // Execute this statement as part of the data structure implementation.
+    bool contains(const Q& key) const {  // Execute this statement as part of the data structure implementation.
+        return findPair(key, hash(key)) != nullptr;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    template <typename Q, typename = EnableIfTransparentKey<K, Q>>  // Execute this statement as part of the data structure implementation.
+    bool remove(const Q& key) {  // Execute this statement as part of the data structure implementation.
+        return removeKey(key, hash(key));  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    template <typename Q, typename = EnableIfTransparentKey<K, Q>>  // Execute this statement as part of the data structure implementation.
+    V& at(const Q& key) {  // Execute this statement as part of the data structure implementation.
+        if (PairType* pair = findPair(key, hash(key))) {  // Evaluate the condition and branch into the appropriate code path.
+            return pair->second;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        throw std::out_of_range("Key not found in hash table");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+
+    template <typename Q, typename = EnableIfTransparentKey<K, Q>>  // Execute this statement as part of the data structure implementation.
+    const V& at(const Q& key) const {  // Execute this statement as part of the data structure implementation.
+        if (const PairType* pair = findPair(key, hash(key))) {  // Evaluate the condition and branch into the appropriate code path.
+            return pair->second;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        throw std::out_of_range("Key not found in hash table");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+
+    // ========== 預先算好雜湊值的操作 Prehashed Operations ==========
+
+    /** Doc block start
+     * 呼叫端已經算過完整雜湊值時（如 ConcurrentHashMap 用它挑分片）直接傳入，不再雜湊第二次。
+     * code 必須等於 seededHash(HashTableHasher<K>{}, key, hashSeed())，否則會查錯桶。
+     * For callers that already hold the full hash (e.g. ConcurrentHashMap, which picks the shard
+     * from it), so the key is not hashed a second time. code must equal
+     * seededHash(HashTableHasher<K>{}, key, hashSeed()), or the wrong bucket is probed.
+     */  // End of block comment
+    void insertHashed(size_t code, const K& key, const V& value);  // Execute this statement as part of the data structure implementation.
+    std::optional<V> searchHashed(size_t code, const K& key) const;  // Execute this statement as part of the data structure implementation.
+    bool containsHashed(size_t code, const K& key) const { return findPair(key, code) != nullptr; }  // Return the computed result to the caller.
+    bool removeHashed(size_t code, const K& key) { return removeKey(key, code); }  // Return the computed result to the caller.
+    V& findOrInsertHashed(size_t code, const K& key);  // operator[] 的預先雜湊版本 - Prehashed operator[]
+
+    // ========== 漸進式擴容 Incremental Rehashing ==========
+
+    /** Doc block start
+     * 是否正在漸進式擴容（新舊兩個桶陣列並存）
+     * Whether an incremental rehash is in progress (old and new bucket arrays coexist)
+     */  // End of block comment
+    bool isRehashing() const { return oldBuckets_.count != 0; }  // Return the computed result to the caller.
+
+    /** Doc block start
+     * 從舊桶陣列搬移最多 buckets 個非空桶到新陣列（以 splice 搬節點，不重新配置）
+     * Migrate up to `buckets` non-empty old buckets into the new array (nodes are spliced, not reallocated)
+     *(blank line)
+     * 每次 insert / remove / operator[] 會自動呼叫 rehashStep(REHASH_STEPS_PER_OP)；
+     * 唯讀操作不搬移，因此 const 方法不會改動桶；但以 HASH_TABLE_STATS=1 編譯時 const 查詢會寫入統計記錄器，
+     * 此時不能在共享鎖下並行呼叫（ConcurrentHashMap 因此改用寫鎖）。
+     * insert / remove / operator[] call rehashStep(REHASH_STEPS_PER_OP) automatically; read-only
+     * operations never migrate, so const methods never touch the buckets. Under HASH_TABLE_STATS=1,
+     * though, const lookups write the statistics recorder and must not run concurrently under a
+     * shared lock (ConcurrentHashMap takes the exclusive lock instead).
+     *(blank line)
+     * @param buckets 本次最多搬移的非空桶數 / Maximum number of non-empty buckets to move
+     * @return 搬移後是否仍在擴容中 / true if the rehash is still in progress afterwards
+     */  // End of block comment
+    bool rehashStep(size_t buckets);  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    // ========== 統計資訊 Statistics ==========
+
+    /** Doc block start
+     * 統計快照（需以 HASH_TABLE_STATS=1 編譯）：探測數為比對過的節點數，鏈長分布含擴容中舊陣列的鏈；
+     * 耗時 O(最長鏈 + 最長探測 + 已配置區段數)
+     * Statistics snapshot (requires HASH_TABLE_STATS=1): probes are nodes compared, and the chain
+     * distribution includes chains still in the old array during a rehash; costs
+     * O(longest chain + longest probe + segments)
+     */  // End of block comment
+    HashTableStats stats() const;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 歸零探測與重建計數器 / Zero the probe and rebuild counters
+     */  // End of block comment
+    void resetStats() { stats_.resetCounters(); }  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
+private:  // Execute this statement as part of the data structure implementation.
+    /** Doc block start
+     * 串列節點：鍵值對加上完整（已混合）的雜湊值。擴容時直接用快取的雜湊值計算新索引，
+     * 不必重新雜湊 key；比對時先比雜湊值，長字串 key 大多不必逐字比較。
+     * List node: the key-value pair plus its full (mixed) hash. Rehashing reuses the cached hash
+     * instead of rehashing the key, and lookups compare hashes before keys, so most long string
+     * keys are never compared byte by byte.
+     */  // End of block comment
+    struct Node {  // Execute this statement as part of the data structure implementation.
+        size_t hash;  // 混合後的完整雜湊值 - Full hash after mixing
+        PairType pair;  // Execute this statement as part of the data structure implementation.
+
+        template <typename... Args>  // Execute this statement as part of the data structure implementation.
+        explicit Node(size_t code, Args&&... args) : hash(code), pair(std::forward<Args>(args)...) {}  // Assign or update a variable that represents the current algorithm state.
+    };  // Execute this statement as part of the data structure implementation.
+
+    // 桶的型別：每個桶是一個鏈結串列 / Bucket type: each bucket is a linked list
+    using Bucket = std::list<Node>;  // Assign or update a variable that represents the current algorithm state.
+
+    // 每個區段 2^8 個桶（約 6 KB）- 2^8 buckets per segment (about 6 KB)
+    static constexpr size_t SEGMENT_SHIFT = 8;  // Assign or update a variable that represents the current algorithm state.
+    static constexpr size_t SEGMENT_SIZE = size_t{1} << SEGMENT_SHIFT;  // Assign or update a variable that represents the current algorithm state.
+
+    /** Doc block start
+     * 分段的桶陣列：區段在第一次寫入時才配置，因此擴容時配置新陣列只需 O(m / 256)，
+     * 舊陣列也能在搬移經過後逐段釋放，不會出現 O(m) 的單次停頓。
+     * Segmented bucket array: segments are allocated on first write, so starting a rehash costs only
+     * O(m / 256), and old segments are freed as migration passes them, so nothing costs O(m) at once.
+     */  // End of block comment
+    struct BucketArray {  // Access or update the bucket storage used to hold entries or chains.
+        std::vector<std::unique_ptr<Bucket[]>> segments;  // Access or update the bucket storage used to hold entries or chains.
+        size_t count = 0;  // 桶的數量（0 代表未使用）- Number of buckets (0 means unused)
+
+        BucketArray() = default;  // Assign or update a variable that represents the current algorithm state.
+
+        // 深拷貝已配置的區段，維持 HashTable 可複製 - Deep-copy allocated segments so HashTable stays copyable
+        BucketArray(const BucketArray& other) : segments(other.segments.size()), count(other.count) {  // Access or update the bucket storage used to hold entries or chains.
+            for (size_t s = 0; s < segments.size(); ++s) {  // Iterate over a range/collection to process each item in sequence.
+                if (other.segments[s]) {  // Evaluate the condition and branch into the appropriate code path.
+                    size_t length = std::min(SEGMENT_SIZE, count - (s << SEGMENT_SHIFT));  // Assign or update a variable that represents the current algorithm state.
+                    segments[s].reset(new Bucket[length]);  // Access or update the bucket storage used to hold entries or chains.
+                    std::copy(other.segments[s].get(), other.segments[s].get() + length, segments[s].get());  // Access or update the bucket storage used to hold entries or chains.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+
+        BucketArray(BucketArray&& other) noexcept  // Access or update the bucket storage used to hold entries or chains.
+            : segments(std::move(other.segments)), count(other.count) {  // Access or update the bucket storage used to hold entries or chains.
+            other.count = 0;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+
+        BucketArray& operator=(BucketArray other) noexcept {  // 複製並交換 - Copy and swap
+            segments.swap(other.segments);  // Access or update the bucket storage used to hold entries or chains.
+            std::swap(count, other.count);  // Assign or update a variable that represents the current algorithm state.
+            return *this;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+
+        void reset(size_t buckets) {  // Access or update the bucket storage used to hold entries or chains.
+            segments.clear();  // Access or update the bucket storage used to hold entries or chains.
+            segments.resize((buckets + SEGMENT_SIZE - 1) >> SEGMENT_SHIFT);  // Access or update the bucket storage used to hold entries or chains.
+            count = buckets;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+
+        // 唯讀查詢：區段未配置代表桶是空的 - Read-only lookup: an unallocated segment means an empty bucket
+        Bucket* find(size_t index) const {  // Access or update the bucket storage used to hold entries or chains.
+            const std::unique_ptr<Bucket[]>& segment = segments[index >> SEGMENT_SHIFT];  // Access or update the bucket storage used to hold entries or chains.
+            return segment ? &segment[index & (SEGMENT_SIZE - 1)] : nullptr;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+
+        // 寫入用：必要時配置區段 - For writes: allocate the segment on demand
+        Bucket& get(size_t index) {  // Access or update the bucket storage used to hold entries or chains.
+            std::unique_ptr<Bucket[]>& segment = segments[index >> SEGMENT_SHIFT];  // Access or update the bucket storage used to hold entries or chains.
+            if (!segment) {  // Evaluate the condition and branch into the appropriate code path.
+                size_t first = index & ~(SEGMENT_SIZE - 1);  // Assign or update a variable that represents the current algorithm state.
+                segment.reset(new Bucket[std::min(SEGMENT_SIZE, count - first)]);  // Access or update the bucket storage used to hold entries or chains.
+            }  // Close the current block scope.
+            return segment[index & (SEGMENT_SIZE - 1)];  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    };  // Execute this statement as part of the data structure implementation.
+
+public:  // Execute this statement as part of the data structure implementation.
     // ========== 迭代器支援 Iterator Support ==========
 
     /** Doc block start
      * 迭代器類別 / Iterator class for traversing all key-value pairs
+     *(blank line)
+     * 擴容期間先走訪新桶陣列，再走訪舊桶陣列中尚未搬移的桶；
+     * 迭代期間請勿修改雜湊表（修改會推進搬移）。
+     * During a rehash it walks the new bucket array first, then the not-yet-migrated old buckets;
+     * do not modify the table while iterating (mutations advance the migration).
      */  // End of block comment
     class Iterator {  // Execute this statement as part of the data structure implementation.
     public:  // Execute this statement as part of the data structure implementation.
-        using BucketIterator = typename std::list<PairType>::iterator;  // Assign or update a variable that represents the current algorithm state.
-        using BucketsIterator = typename std::vector<std::list<PairType>>::iterator;  // Assign or update a variable that represents the current algorithm state.
+        using BucketIterator = typename Bucket::iterator;  // Assign or update a variable that represents the current algorithm state.
 
-        Iterator(BucketsIterator bucketsBegin, BucketsIterator bucketsEnd,  // Access or update the bucket storage used to hold entries or chains.
-                 BucketIterator current)  // Execute this statement as part of the data structure implementation.
-            : bucketsIt_(bucketsBegin), bucketsEnd_(bucketsEnd), current_(current) {  // Access or update the bucket storage used to hold entries or chains.
+        Iterator(HashTable* table, bool atEnd)  // Execute this statement as part of the data structure implementation.
+            : table_(table), array_(atEnd ? 2 : 0), bucket_(0), current_() {  // Access or update the bucket storage used to hold entries or chains.
             // 找到第一個非空桶 - Find first non-empty bucket
-            advanceToValid();  // Execute this statement as part of the data structure implementation.
+            if (!atEnd) {  // Evaluate the condition and branch into the appropriate code path.
+                seekBucket();  // Access or update the bucket storage used to hold entries or chains.
+            }  // Close the current block scope.
         }  // Close the current block scope.
 
-        PairType& operator*() { return *current_; }  // Execute this statement as part of the data structure implementation.
-        PairType* operator->() { return &(*current_); }  // Execute this statement as part of the data structure implementation.
+        PairType& operator*() { return current_->pair; }  // Execute this statement as part of the data structure implementation.
+        PairType* operator->() { return &current_->pair; }  // Execute this statement as part of the data structure implementation.
 
         Iterator& operator++() {  // Execute this statement as part of the data structure implementation.
             ++current_;  // Execute this statement as part of the data structure implementation.
-            advanceToValid();  // Execute this statement as part of the data structure implementation.
+            if (current_ == arrayAt(array_).find(bucket_)->end()) {  // Evaluate the condition and branch into the appropriate code path.
+                ++bucket_;  // Access or update the bucket storage used to hold entries or chains.
+                seekBucket();  // Access or update the bucket storage used to hold entries or chains.
+            }  // Close the current block scope.
             return *this;  // Return the computed result to the caller.
         }  // Close the current block scope.
 
         bool operator==(const Iterator& other) const {  // Execute this statement as part of the data structure implementation.
-            return bucketsIt_ == other.bucketsIt_ &&  // Return the computed result to the caller.
-                   (bucketsIt_ == bucketsEnd_ || current_ == other.current_);  // Access or update the bucket storage used to hold entries or chains.
+            return array_ == other.array_ &&  // Return the computed result to the caller.
+                   (array_ == 2 || (bucket_ == other.bucket_ && current_ == other.current_));  // Access or update the bucket storage used to hold entries or chains.
         }  // Close the current block scope.
 
         bool operator!=(const Iterator& other) const {  // Execute this statement as part of the data structure implementation.
@@ -173,63 +454,149 @@ public:  // Execute this statement as part of the data structure implementation.
         }  // Close the current block scope.
 
     private:  // Execute this statement as part of the data structure implementation.
-        void advanceToValid() {  // Execute this statement as part of the data structure implementation.
-            while (bucketsIt_ != bucketsEnd_ && current_ == bucketsIt_->end()) {  // Repeat while the loop condition remains true.
-                ++bucketsIt_;  // Access or update the bucket storage used to hold entries or chains.
-                if (bucketsIt_ != bucketsEnd_) {  // Evaluate the condition and branch into the appropriate code path.
-                    current_ = bucketsIt_->begin();  // Access or update the bucket storage used to hold entries or chains.
+        BucketArray& arrayAt(size_t which) {  // Access or update the bucket storage used to hold entries or chains.
+            return which == 0 ? table_->buckets_ : table_->oldBuckets_;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+
+        /** Doc block start
+         * 從 (array_, bucket_) 起找下一個非空桶；未配置的區段整段略過
+         * Find the next non-empty bucket from (array_, bucket_); unallocated segments are skipped whole
+         */  // End of block comment
+        void seekBucket() {  // Access or update the bucket storage used to hold entries or chains.
+            while (array_ < 2) {  // Repeat while the loop condition remains true.
+                BucketArray& buckets = arrayAt(array_);  // Access or update the bucket storage used to hold entries or chains.
+                while (bucket_ < buckets.count) {  // Repeat while the loop condition remains true.
+                    Bucket* bucket = buckets.find(bucket_);  // Access or update the bucket storage used to hold entries or chains.
+                    if (bucket == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+                        bucket_ = ((bucket_ >> SEGMENT_SHIFT) + 1) << SEGMENT_SHIFT;  // 跳到下一個區段 - Jump to the next segment
+                    } else if (bucket->empty()) {  // Evaluate the condition and branch into the appropriate code path.
+                        ++bucket_;  // Access or update the bucket storage used to hold entries or chains.
+                    } else {  // Handle the alternative branch when the condition is false.
+                        current_ = bucket->begin();  // Access or update the bucket storage used to hold entries or chains.
+                        return;  // 指向有效元素 - Points at a valid element
+                    }  // Close the current block scope.
                 }  // Close the current block scope.
+                ++array_;  // 此陣列走完，換下一個 - This array is exhausted, move to the next one
+                bucket_ = 0;  // Access or update the bucket storage used to hold entries or chains.
             }  // Close the current block scope.
         }  // Close the current block scope.
 
-        BucketsIterator bucketsIt_;  // Access or update the bucket storage used to hold entries or chains.
-        BucketsIterator bucketsEnd_;  // Access or update the bucket storage used to hold entries or chains.
+        HashTable* table_;  // Execute this statement as part of the data structure implementation.
+        size_t array_;  // 0 = 新桶陣列, 1 = 舊桶陣列, 2 = 結束 - 0 = new buckets, 1 = old buckets, 2 = end
+        size_t bucket_;  // Access or update the bucket storage used to hold entries or chains.
         BucketIterator current_;  // Execute this statement as part of the data structure implementation.
     };  // Execute this statement as part of the data structure implementation.
 
-    Iterator begin() {  // Execute this statement as part of the data structure implementation.
-        if (buckets_.empty()) {  // Evaluate the condition and branch into the appropriate code path.
-            return end();  // Return the computed result to the caller.
+    /** Doc block start
+     * 對每一對呼叫 fn(key, value)（唯讀，順序不固定）；可供 PerfectHashBuilder::fromTable 等工具匯出內容
+     * Call fn(key, value) for every pair (read-only, unspecified order); lets tools such as
+     * PerfectHashBuilder::fromTable export the contents
+     */  // End of block comment
+    template <typename Fn>  // Execute this statement as part of the data structure implementation.
+    void forEach(Fn&& fn) const {  // Execute this statement as part of the data structure implementation.
+        for (const BucketArray* buckets : {&buckets_, &oldBuckets_}) {  // 擴容中兩個陣列都要走 - Both arrays during a rehash
+            for (size_t b = 0; b < buckets->count; ++b) {  // Iterate over a range/collection to process each item in sequence.
+                const Bucket* bucket = buckets->find(b);  // Access or update the bucket storage used to hold entries or chains.
+                if (bucket == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+                    b = (((b >> SEGMENT_SHIFT) + 1) << SEGMENT_SHIFT) - 1;  // 跳過未配置的區段 - Skip an unallocated segment
+                    continue;  // Skip to the next loop iteration.
+                }  // Close the current block scope.
+                for (const Node& node : *bucket) {  // Iterate over a range/collection to process each item in sequence.
+                    fn(node.pair.first, node.pair.second);  // Execute this statement as part of the data structure implementation.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
         }  // Close the current block scope.
-        return Iterator(buckets_.begin(), buckets_.end(), buckets_.front().begin());  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    Iterator begin() {  // Execute this statement as part of the data structure implementation.
+        return Iterator(this, false);  // Return the computed result to the caller.
     }  // Close the current block scope.
 
     Iterator end() {  // Execute this statement as part of the data structure implementation.
-        return Iterator(buckets_.end(), buckets_.end(),  // Return the computed result to the caller.
-                       buckets_.empty() ? typename std::list<PairType>::iterator()  // Access or update the bucket storage used to hold entries or chains.
-                                       : buckets_.back().end());  // Access or update the bucket storage used to hold entries or chains.
+        return Iterator(this, true);  // Return the computed result to the caller.
     }  // Close the current block scope.
 
 private:  // Execute this statement as part of the data structure implementation.
-    // 桶的型別：每個桶是一個鏈結串列 / Bucket type: each bucket is a linked list
-    using Bucket = std::list<PairType>;  // Assign or update a variable that represents the current algorithm state.
-
     // ========== 私有成員 Private Members ==========
-    std::vector<Bucket> buckets_;  // 桶陣列 - Array of buckets
+    BucketArray buckets_;           // 桶陣列 - Array of buckets
     size_t capacity_;               // 桶的數量 - Number of buckets
     size_t size_;                   // 元素數量 - Number of elements
-    std::hash<K> hasher_;          // 雜湊函數 - Hash function
+    HashTableHasher<K> hasher_;    // 雜湊函數 - Hash function
+    HashSeed seed_;                 // 雜湊種子（節點快取的雜湊值依賴它）- Hash seed (cached node hashes depend on it)
+    BucketArray oldBuckets_;        // 擴容中的舊桶陣列（不擴容時 count 為 0）- Old buckets during a rehash (count 0 otherwise)
+    size_t rehashIndex_;            // 下一個待搬移的舊桶 - Next old bucket to migrate
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    mutable HashTableStatsRecorder stats_;  // 即時統計（查詢是 const）- Live statistics (lookups are const)
+#endif  // Execute this statement as part of the data structure implementation.
 
     // ========== 常數 Constants ==========
     static constexpr size_t DEFAULT_CAPACITY = 16;  // Assign or update a variable that represents the current algorithm state.
     static constexpr double MAX_LOAD_FACTOR = 0.75;  // Assign or update a variable that represents the current algorithm state.
+    static constexpr size_t REHASH_STEPS_PER_OP = 4;  // 每次修改操作搬移的非空桶數 - Non-empty buckets moved per mutation
+    static constexpr size_t EMPTY_VISITS_PER_STEP = 10;  // 每個步驟可略過的空桶數 - Empty buckets skipped per step unit
+    static constexpr size_t BATCH_GROUP = 16;  // 批次查詢同時預取的 key 數 - Keys prefetched together by searchBatch
 
     // ========== 私有方法 Private Methods ==========
 
     /** Doc block start
-     * 計算雜湊索引 / Compute hash index
+     * 計算完整雜湊值（見 seededHash）：字串走 SipHash-1-3，其他 key 的 std::hash 混入種子後經 fmix64，
+     * 低位元都分布均勻，桶索引即可用遮罩取代除法。
+     * Compute the full hash (see seededHash): SipHash-1-3 for strings, seed-folded std::hash plus
+     * fmix64 for other keys; either way the low bits are well spread, so the bucket index is a mask.
      *(blank line)
-     * @param key 要雜湊的鍵
-     * @return 桶的索引
+     * @param key 要雜湊的鍵（K 或透明查詢型別）
+     * @return 完整雜湊值，桶索引為 hash & (桶數 - 1)
      */  // End of block comment
-    size_t hash(const K& key) const {  // Compute a hash-based index so keys map into the table's storage.
-        return hasher_(key) % capacity_;  // Return the computed result to the caller.
+    template <typename Q>  // Execute this statement as part of the data structure implementation.
+    size_t hash(const Q& key) const {  // Compute a hash-based index so keys map into the table's storage.
+        return seededHash(hasher_, key, seed_);  // Return the computed result to the caller.
     }  // Close the current block scope.
 
     /** Doc block start
-     * 擴容並重新雜湊 / Resize and rehash
+     * 在新、舊兩個桶陣列中尋找 key（Q 可以是 K 或可與 K 比較的型別）
+     * Find key in the new and old bucket arrays (Q is K or a type comparable with K)
+     *(blank line)
+     * @param code 已算好的完整雜湊值 / Precomputed full hash value
+     * @return 指向鍵值對的指標，找不到回傳 nullptr / Pointer to the pair, nullptr if absent
+     */  // End of block comment
+    template <typename Q>  // Execute this statement as part of the data structure implementation.
+    const PairType* findPair(const Q& key, size_t code) const;  // Execute this statement as part of the data structure implementation.
+    template <typename Q>  // Execute this statement as part of the data structure implementation.
+    PairType* findPair(const Q& key, size_t code) {  // Execute this statement as part of the data structure implementation.
+        return const_cast<PairType*>(static_cast<const HashTable&>(*this).findPair(key, code));  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 在新桶尾端以 piecewise 方式建構新元素，必要時開始擴容；回傳的參考在搬移後仍有效
+     * Piecewise-construct a new element at the tail of its new bucket and start a rehash if
+     * needed; the returned reference stays valid across migration
+     */  // End of block comment
+    template <typename KK, typename... Args>  // Execute this statement as part of the data structure implementation.
+    PairType& emplaceNew(size_t code, KK&& key, Args&&... args);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * remove 的共用實作 / Shared implementation of remove
+     */  // End of block comment
+    template <typename Q>  // Execute this statement as part of the data structure implementation.
+    bool removeKey(const Q& key, size_t code);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 開始擴容：舊陣列移到 oldBuckets_，配置兩倍大小的新陣列
+     * Start a rehash: move the current array to oldBuckets_ and allocate one twice as large
      */  // End of block comment
     void rehash();  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+    /** Doc block start
+     * 預取一個快取行供讀取（非 GCC/Clang 編譯器上不做任何事）
+     * Prefetch one cache line for reading (a no-op on compilers other than GCC/Clang)
+     */  // End of block comment
+    static void prefetch(const void* address) {  // Execute this statement as part of the data structure implementation.
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);  // Execute this statement as part of the data structure implementation.
+#else
+        (void)address;  // Execute this statement as part of the data structure implementation.
+#endif
+    }  // Close the current block scope.
 };  // Execute this statement as part of the data structure implementation.
 
 // ============================================================
@@ -237,149 +604,418 @@ private:  // Execute this statement as part of the data structure implementation
 // ============================================================
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
-HashTable<K, V>::HashTable(size_t capacity)  // Execute this statement as part of the data structure implementation.
-    : capacity_(capacity), size_(0) {  // Execute this statement as part of the data structure implementation.
+HashTable<K, V>::HashTable(size_t capacity, HashSeed seed)  // Execute this statement as part of the data structure implementation.
+    : capacity_(1), size_(0), seed_(seed), rehashIndex_(0) {  // Execute this statement as part of the data structure implementation.
     if (capacity == 0) {  // Evaluate the condition and branch into the appropriate code path.
         throw std::invalid_argument(  // Throw an exception to signal an invalid argument or operation.
             "容量必須為正整數 / Capacity must be positive");  // Execute this statement as part of the data structure implementation.
     }  // Close the current block scope.
-    buckets_.resize(capacity_);  // Access or update the bucket storage used to hold entries or chains.
+    if (capacity > (SIZE_MAX >> 1) + 1) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::invalid_argument("容量過大 / Capacity too large");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    // 向上取到 2 的冪次，桶索引用遮罩 - Round up to a power of two so the bucket index is a mask
+    while (capacity_ < capacity) {  // Repeat while the loop condition remains true.
+        capacity_ <<= 1;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    buckets_.reset(capacity_);  // Access or update the bucket storage used to hold entries or chains.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
-void HashTable<K, V>::insert(const K& key, const V& value) {  // Execute this statement as part of the data structure implementation.
-    size_t index = hash(key);  // Compute a hash-based index so keys map into the table's storage.
-    Bucket& bucket = buckets_[index];  // Access or update the bucket storage used to hold entries or chains.
-
-    // 檢查 key 是否已存在 - Check if key exists
-    for (auto& pair : bucket) {  // Iterate over a range/collection to process each item in sequence.
-        if (pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
-            pair.second = value;  // 更新 - Update existing
-            return;  // Return the computed result to the caller.
+template <typename Q>  // Execute this statement as part of the data structure implementation.
+const typename HashTable<K, V>::PairType* HashTable<K, V>::findPair(const Q& key, size_t code) const {  // Execute this statement as part of the data structure implementation.
+    HASH_TABLE_STATS_ONLY(size_t probes = 0;)  // 比對過的節點數 - Nodes compared
+
+    // 先查新桶 - Check the new bucket first
+    if (const Bucket* bucket = buckets_.find(code & (capacity_ - 1))) {  // Evaluate the condition and branch into the appropriate code path.
+        for (const Node& node : *bucket) {  // Iterate over a range/collection to process each item in sequence.
+            HASH_TABLE_STATS_ONLY(++probes);  // Advance or track the probing sequence used by open addressing.
+            if (node.hash == code && node.pair.first == key) {  // 先比雜湊值 - Compare hashes first
+                HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+                return &node.pair;  // Return the computed result to the caller.
+            }  // Close the current block scope.
         }  // Close the current block scope.
     }  // Close the current block scope.
 
-    // 新增鍵值對 - Add new key-value pair
-    bucket.emplace_back(key, value);  // Access or update the bucket storage used to hold entries or chains.
+    // 擴容中且舊桶尚未搬移時再查舊桶 - During a rehash, also check the old bucket if not yet migrated
+    if (isRehashing()) {  // Evaluate the condition and branch into the appropriate code path.
+        size_t oldIndex = code & (oldBuckets_.count - 1);  // Compute a hash-based index so keys map into the table's storage.
+        const Bucket* oldBucket = (oldIndex >= rehashIndex_) ? oldBuckets_.find(oldIndex) : nullptr;  // Access or update the bucket storage used to hold entries or chains.
+        if (oldBucket != nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+            for (const Node& node : *oldBucket) {  // Iterate over a range/collection to process each item in sequence.
+                HASH_TABLE_STATS_ONLY(++probes);  // Advance or track the probing sequence used by open addressing.
+                if (node.hash == code && node.pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
+                    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+                    return &node.pair;  // Return the computed result to the caller.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+    return nullptr;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+template <typename KK, typename... Args>  // Execute this statement as part of the data structure implementation.
+typename HashTable<K, V>::PairType& HashTable<K, V>::emplaceNew(size_t code, KK&& key, Args&&... args) {  // Execute this statement as part of the data structure implementation.
+    // 新元素一律放入新桶 - New elements always go into the new array
+    Bucket& bucket = buckets_.get(code & (capacity_ - 1));  // Access or update the bucket storage used to hold entries or chains.
+    bucket.emplace_back(code, std::piecewise_construct,  // Access or update the bucket storage used to hold entries or chains.
+                        std::forward_as_tuple(std::forward<KK>(key)),  // Execute this statement as part of the data structure implementation.
+                        std::forward_as_tuple(std::forward<Args>(args)...));  // Execute this statement as part of the data structure implementation.
+    PairType& pair = bucket.back().pair;  // 串列節點在 splice 後位址不變 - List nodes keep their address across splices
+    HASH_TABLE_STATS_ONLY(stats_.chainResized(bucket.size() - 1, bucket.size()));  // Access or update the bucket storage used to hold entries or chains.
     ++size_;  // Execute this statement as part of the data structure implementation.
 
     // 檢查是否需要擴容 - Check if rehashing needed
     if (loadFactor() > MAX_LOAD_FACTOR) {  // Evaluate the condition and branch into the appropriate code path.
         rehash();  // Rehash entries into a larger table to keep operations near O(1) on average.
     }  // Close the current block scope.
+    return pair;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void HashTable<K, V>::insert(const K& key, const V& value) {  // Execute this statement as part of the data structure implementation.
+    insert_or_assign(key, value);  // 存在則更新 - Update if the key exists
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void HashTable<K, V>::insertHashed(size_t code, const K& key, const V& value) {  // Execute this statement as part of the data structure implementation.
+    rehashStep(REHASH_STEPS_PER_OP);  // 分攤搬移 - Amortized migration
+    if (PairType* pair = findPair(key, code)) {  // Evaluate the condition and branch into the appropriate code path.
+        pair->second = value;  // 更新 - Update existing
+        return;  // Return to the caller.
+    }  // Close the current block scope.
+    emplaceNew(code, key, value);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+template <typename... Args>  // Execute this statement as part of the data structure implementation.
+bool HashTable<K, V>::emplace(Args&&... args) {  // Execute this statement as part of the data structure implementation.
+    rehashStep(REHASH_STEPS_PER_OP);  // 分攤搬移 - Amortized migration
+
+    // 先在暫存串列中建好節點，拿到 key 才能查重 - Build the node in a scratch list first; the key is needed to check for duplicates
+    Bucket node;  // Access or update the bucket storage used to hold entries or chains.
+    node.emplace_back(0, std::forward<Args>(args)...);  // Execute this statement as part of the data structure implementation.
+    size_t code = hash(node.front().pair.first);  // Compute a hash-based index so keys map into the table's storage.
+    node.front().hash = code;  // Assign or update a variable that represents the current algorithm state.
+    if (findPair(node.front().pair.first, code) != nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+        return false;  // 已存在：暫存節點隨 node 釋放 - Already present: the scratch node dies with `node`
+    }  // Close the current block scope.
+
+    // 把節點接進新桶，不複製也不重新配置 - Splice the node into its new bucket without copying or reallocating
+    Bucket& bucket = buckets_.get(code & (capacity_ - 1));  // Access or update the bucket storage used to hold entries or chains.
+    bucket.splice(bucket.end(), node);  // Access or update the bucket storage used to hold entries or chains.
+    HASH_TABLE_STATS_ONLY(stats_.chainResized(bucket.size() - 1, bucket.size()));  // Access or update the bucket storage used to hold entries or chains.
+    ++size_;  // Execute this statement as part of the data structure implementation.
+    if (loadFactor() > MAX_LOAD_FACTOR) {  // Evaluate the condition and branch into the appropriate code path.
+        rehash();  // Rehash entries into a larger table to keep operations near O(1) on average.
+    }  // Close the current block scope.
+    return true;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+template <typename... Args>  // Execute this statement as part of the data structure implementation.
+bool HashTable<K, V>::try_emplace(const K& key, Args&&... args) {  // Execute this statement as part of the data structure implementation.
+    rehashStep(REHASH_STEPS_PER_OP);  // 分攤搬移 - Amortized migration
+    size_t code = hash(key);  // Compute a hash-based index so keys map into the table's storage.
+    if (findPair(key, code) != nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+        return false;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    emplaceNew(code, key, std::forward<Args>(args)...);  // Execute this statement as part of the data structure implementation.
+    return true;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+template <typename... Args>  // Execute this statement as part of the data structure implementation.
+bool HashTable<K, V>::try_emplace(K&& key, Args&&... args) {  // Execute this statement as part of the data structure implementation.
+    rehashStep(REHASH_STEPS_PER_OP);  // 分攤搬移 - Amortized migration
+    size_t code = hash(key);  // Compute a hash-based index so keys map into the table's storage.
+    if (findPair(key, code) != nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+        return false;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    emplaceNew(code, std::move(key), std::forward<Args>(args)...);  // Execute this statement as part of the data structure implementation.
+    return true;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+template <typename M>  // Execute this statement as part of the data structure implementation.
+bool HashTable<K, V>::insert_or_assign(const K& key, M&& value) {  // Execute this statement as part of the data structure implementation.
+    rehashStep(REHASH_STEPS_PER_OP);  // 分攤搬移 - Amortized migration
+    size_t code = hash(key);  // Compute a hash-based index so keys map into the table's storage.
+    if (PairType* pair = findPair(key, code)) {  // Evaluate the condition and branch into the appropriate code path.
+        pair->second = std::forward<M>(value);  // 更新 - Update existing
+        return false;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    emplaceNew(code, key, std::forward<M>(value));  // Execute this statement as part of the data structure implementation.
+    return true;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+template <typename M>  // Execute this statement as part of the data structure implementation.
+bool HashTable<K, V>::insert_or_assign(K&& key, M&& value) {  // Execute this statement as part of the data structure implementation.
+    rehashStep(REHASH_STEPS_PER_OP);  // 分攤搬移 - Amortized migration
+    size_t code = hash(key);  // Compute a hash-based index so keys map into the table's storage.
+    if (PairType* pair = findPair(key, code)) {  // Evaluate the condition and branch into the appropriate code path.
+        pair->second = std::forward<M>(value);  // 更新 - Update existing
+        return false;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    emplaceNew(code, std::move(key), std::forward<M>(value));  // Execute this statement as part of the data structure implementation.
+    return true;  // Return the computed result to the caller.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 std::optional<V> HashTable<K, V>::search(const K& key) const {  // Execute this statement as part of the data structure implementation.
-    size_t index = hash(key);  // Compute a hash-based index so keys map into the table's storage.
-    const Bucket& bucket = buckets_[index];  // Access or update the bucket storage used to hold entries or chains.
+    return searchHashed(hash(key), key);  // Return the computed result to the caller.
+}  // Close the current block scope.
 
-    // 在桶中搜尋 - Search in bucket
-    for (const auto& pair : bucket) {  // Iterate over a range/collection to process each item in sequence.
-        if (pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
-            return pair.second;  // Return the computed result to the caller.
-        }  // Close the current block scope.
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+std::optional<V> HashTable<K, V>::searchHashed(size_t code, const K& key) const {  // Execute this statement as part of the data structure implementation.
+    const PairType* pair = findPair(key, code);  // Execute this statement as part of the data structure implementation.
+    if (pair != nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+        return pair->second;  // Return the computed result to the caller.
     }  // Close the current block scope.
     return std::nullopt;  // Return the computed result to the caller.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 bool HashTable<K, V>::remove(const K& key) {  // Execute this statement as part of the data structure implementation.
-    size_t index = hash(key);  // Compute a hash-based index so keys map into the table's storage.
-    Bucket& bucket = buckets_[index];  // Access or update the bucket storage used to hold entries or chains.
-
-    // 在桶中尋找並刪除 - Find and delete from bucket
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {  // Iterate over a range/collection to process each item in sequence.
-        if (it->first == key) {  // Evaluate the condition and branch into the appropriate code path.
-            bucket.erase(it);  // Access or update the bucket storage used to hold entries or chains.
-            --size_;  // Execute this statement as part of the data structure implementation.
-            return true;  // Return the computed result to the caller.
+    return removeKey(key, hash(key));  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+template <typename Q>  // Execute this statement as part of the data structure implementation.
+bool HashTable<K, V>::removeKey(const Q& key, size_t code) {  // Execute this statement as part of the data structure implementation.
+    rehashStep(REHASH_STEPS_PER_OP);  // 分攤搬移 - Amortized migration
+
+    // 先查新桶，擴容中再查尚未搬移的舊桶 - New bucket first, then the not-yet-migrated old bucket
+    Bucket* candidates[2] = {buckets_.find(code & (capacity_ - 1)), nullptr};  // Access or update the bucket storage used to hold entries or chains.
+    if (isRehashing() && (code & (oldBuckets_.count - 1)) >= rehashIndex_) {  // Evaluate the condition and branch into the appropriate code path.
+        candidates[1] = oldBuckets_.find(code & (oldBuckets_.count - 1));  // Access or update the bucket storage used to hold entries or chains.
+    }  // Close the current block scope.
+    HASH_TABLE_STATS_ONLY(size_t probes = 0;)  // Advance or track the probing sequence used by open addressing.
+    for (Bucket* bucket : candidates) {  // Iterate over a range/collection to process each item in sequence.
+        if (bucket == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+            continue;  // Skip to the next loop iteration.
+        }  // Close the current block scope.
+        for (auto it = bucket->begin(); it != bucket->end(); ++it) {  // Iterate over a range/collection to process each item in sequence.
+            HASH_TABLE_STATS_ONLY(++probes;)  // Advance or track the probing sequence used by open addressing.
+            if (it->hash == code && it->pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
+                bucket->erase(it);  // Access or update the bucket storage used to hold entries or chains.
+                HASH_TABLE_STATS_ONLY(stats_.chainResized(bucket->size() + 1, bucket->size()));  // Access or update the bucket storage used to hold entries or chains.
+                HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+                --size_;  // Execute this statement as part of the data structure implementation.
+                return true;  // Return the computed result to the caller.
+            }  // Close the current block scope.
         }  // Close the current block scope.
     }  // Close the current block scope.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
     return false;  // Return the computed result to the caller.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 bool HashTable<K, V>::contains(const K& key) const {  // Execute this statement as part of the data structure implementation.
-    return search(key).has_value();  // Return the computed result to the caller.
+    return containsHashed(hash(key), key);  // Return the computed result to the caller.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
-void HashTable<K, V>::clear() {  // Execute this statement as part of the data structure implementation.
-    for (auto& bucket : buckets_) {  // Iterate over a range/collection to process each item in sequence.
-        bucket.clear();  // Access or update the bucket storage used to hold entries or chains.
+void HashTable<K, V>::reserve(size_t n) {  // Execute this statement as part of the data structure implementation.
+    size_t needed = capacity_;  // Assign or update a variable that represents the current algorithm state.
+    while (static_cast<double>(n) > MAX_LOAD_FACTOR * needed) {  // Repeat while the loop condition remains true.
+        needed <<= 1;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    if (needed == capacity_) {  // Evaluate the condition and branch into the appropriate code path.
+        return;  // 已足夠 - Already large enough
+    }  // Close the current block scope.
+    HASH_TABLE_STATS_ONLY(stats_.countRehash());  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HASH_TABLE_STATS_ONLY(HashTableStatsRecorder::RehashScope rehashScope(stats_);)  // Rehash entries into a larger table to keep operations near O(1) on average.
+    rehashStep(SIZE_MAX);  // 先完成進行中的擴容 - Finish any rehash in progress
+    oldBuckets_ = std::move(buckets_);  // Access or update the bucket storage used to hold entries or chains.
+    rehashIndex_ = 0;  // Assign or update a variable that represents the current algorithm state.
+    capacity_ = needed;  // Assign or update a variable that represents the current algorithm state.
+    buckets_.reset(capacity_);  // Access or update the bucket storage used to hold entries or chains.
+    rehashStep(SIZE_MAX);  // 一次搬完，之後的查詢只看一個陣列 - Move everything now so later lookups see one array
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void HashTable<K, V>::insertBatch(const std::vector<K>& keys, const std::vector<V>& values) {  // Execute this statement as part of the data structure implementation.
+    if (keys.size() != values.size()) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::invalid_argument("keys 與 values 長度必須相同 / keys and values must have the same length");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    reserve(size_ + keys.size());  // 只擴容一次 - Grow once
+    for (size_t i = 0; i < keys.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        insert_or_assign(keys[i], values[i]);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void HashTable<K, V>::searchBatch(const std::vector<K>& keys, std::vector<std::optional<V>>& out) const {  // Execute this statement as part of the data structure implementation.
+    out.resize(keys.size());  // Execute this statement as part of the data structure implementation.
+    size_t codes[BATCH_GROUP];  // Compute a hash-based index so keys map into the table's storage.
+    for (size_t base = 0; base < keys.size(); base += BATCH_GROUP) {  // Iterate over a range/collection to process each item in sequence.
+        size_t count = std::min(BATCH_GROUP, keys.size() - base);  // Assign or update a variable that represents the current algorithm state.
+
+        // 第一輪：整組一次算雜湊值，再預取桶（串列標頭）- Pass 1: hash the group in one call, then prefetch the buckets (list headers)
+        seededHashBatch(hasher_, keys.data() + base, count, seed_, codes);  // Compute a hash-based index so keys map into the table's storage.
+        for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            if (const Bucket* bucket = buckets_.find(codes[i] & (capacity_ - 1))) {  // Evaluate the condition and branch into the appropriate code path.
+                prefetch(bucket);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+
+        // 第二輪：標頭已到，預取各鏈第一個節點 - Pass 2: headers have arrived, prefetch each chain's first node
+        for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            const Bucket* bucket = buckets_.find(codes[i] & (capacity_ - 1));  // Access or update the bucket storage used to hold entries or chains.
+            if (bucket != nullptr && !bucket->empty()) {  // Evaluate the condition and branch into the appropriate code path.
+                prefetch(&bucket->front());  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+
+        // 第三輪：比對（擴容中的舊桶在這裡才讀取）- Pass 3: compare (old buckets during a rehash are read only here)
+        for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            const PairType* pair = findPair(keys[base + i], codes[i]);  // Execute this statement as part of the data structure implementation.
+            out[base + i] = (pair != nullptr) ? std::optional<V>(pair->second) : std::nullopt;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
     }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void HashTable<K, V>::clear() {  // Execute this statement as part of the data structure implementation.
+    buckets_.reset(capacity_);  // 釋放所有區段與節點 - Frees every segment and node
+    oldBuckets_.reset(0);  // 放棄進行中的擴容 - Abandon any rehash in progress
+    rehashIndex_ = 0;  // Assign or update a variable that represents the current algorithm state.
     size_ = 0;  // Assign or update a variable that represents the current algorithm state.
+    HASH_TABLE_STATS_ONLY(stats_.resetChains());  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 V& HashTable<K, V>::operator[](const K& key) {  // Execute this statement as part of the data structure implementation.
-    size_t index = hash(key);  // Compute a hash-based index so keys map into the table's storage.
-    Bucket& bucket = buckets_[index];  // Access or update the bucket storage used to hold entries or chains.
+    return findOrInsertHashed(hash(key), key);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+V& HashTable<K, V>::findOrInsertHashed(size_t code, const K& key) {  // Execute this statement as part of the data structure implementation.
+    rehashStep(REHASH_STEPS_PER_OP);  // 分攤搬移 - Amortized migration
 
     // 搜尋現有的鍵 - Search for existing key
-    for (auto& pair : bucket) {  // Iterate over a range/collection to process each item in sequence.
-        if (pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
-            return pair.second;  // Return the computed result to the caller.
-        }  // Close the current block scope.
+    if (PairType* pair = findPair(key, code)) {  // Evaluate the condition and branch into the appropriate code path.
+        return pair->second;  // Return the computed result to the caller.
     }  // Close the current block scope.
 
     // 不存在則插入預設值 - Insert default value if not found
-    bucket.emplace_back(key, V{});  // Access or update the bucket storage used to hold entries or chains.
-    ++size_;  // Execute this statement as part of the data structure implementation.
+    return emplaceNew(code, key).second;  // Return the computed result to the caller.
+}  // Close the current block scope.
 
-    if (loadFactor() > MAX_LOAD_FACTOR) {  // Evaluate the condition and branch into the appropriate code path.
-        rehash();  // Rehash entries into a larger table to keep operations near O(1) on average.
-        // rehash 後需要重新找到元素 - Need to find element again after rehash
-        return (*this)[key];  // Return the computed result to the caller.
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+V& HashTable<K, V>::operator[](K&& key) {  // Execute this statement as part of the data structure implementation.
+    rehashStep(REHASH_STEPS_PER_OP);  // 分攤搬移 - Amortized migration
+    size_t code = hash(key);  // Compute a hash-based index so keys map into the table's storage.
+    if (PairType* pair = findPair(key, code)) {  // Evaluate the condition and branch into the appropriate code path.
+        return pair->second;  // Return the computed result to the caller.
     }  // Close the current block scope.
-
-    return bucket.back().second;  // Return the computed result to the caller.
+    return emplaceNew(code, std::move(key)).second;  // Return the computed result to the caller.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 V& HashTable<K, V>::at(const K& key) {  // Execute this statement as part of the data structure implementation.
-    size_t index = hash(key);  // Compute a hash-based index so keys map into the table's storage.
-    Bucket& bucket = buckets_[index];  // Access or update the bucket storage used to hold entries or chains.
-
-    for (auto& pair : bucket) {  // Iterate over a range/collection to process each item in sequence.
-        if (pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
-            return pair.second;  // Return the computed result to the caller.
-        }  // Close the current block scope.
+    if (PairType* pair = findPair(key, hash(key))) {  // Evaluate the condition and branch into the appropriate code path.
+        return pair->second;  // Return the computed result to the caller.
     }  // Close the current block scope.
     throw std::out_of_range("Key not found in hash table");  // Throw an exception to signal an invalid argument or operation.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 const V& HashTable<K, V>::at(const K& key) const {  // Execute this statement as part of the data structure implementation.
-    size_t index = hash(key);  // Compute a hash-based index so keys map into the table's storage.
-    const Bucket& bucket = buckets_[index];  // Access or update the bucket storage used to hold entries or chains.
+    if (const PairType* pair = findPair(key, hash(key))) {  // Evaluate the condition and branch into the appropriate code path.
+        return pair->second;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    throw std::out_of_range("Key not found in hash table");  // Throw an exception to signal an invalid argument or operation.
+}  // Close the current block scope.
 
-    for (const auto& pair : bucket) {  // Iterate over a range/collection to process each item in sequence.
-        if (pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
-            return pair.second;  // Return the computed result to the caller.
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool HashTable<K, V>::rehashStep(size_t buckets) {  // Rehash entries into a larger table to keep operations near O(1) on average.
+    if (!isRehashing()) {  // Evaluate the condition and branch into the appropriate code path.
+        return false;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    HASH_TABLE_STATS_ONLY(HashTableStatsRecorder::RehashScope rehashScope(stats_);)  // 搬移時間計入重建耗時 - Migration time counts as rehash time
+
+    // 空桶也要限量，避免稀疏區域造成長停頓 - Cap empty visits too so sparse regions cannot cause a long pause
+    size_t emptyVisits = (buckets > SIZE_MAX / EMPTY_VISITS_PER_STEP) ? SIZE_MAX : buckets * EMPTY_VISITS_PER_STEP;  // Assign or update a variable that represents the current algorithm state.
+    while (buckets > 0 && emptyVisits > 0 && rehashIndex_ < oldBuckets_.count) {  // Repeat while the loop condition remains true.
+        size_t segment = rehashIndex_ >> SEGMENT_SHIFT;  // Assign or update a variable that represents the current algorithm state.
+        Bucket* oldBucket = oldBuckets_.find(rehashIndex_);  // Access or update the bucket storage used to hold entries or chains.
+        if (oldBucket == nullptr) {  // 從未配置的區段整段略過 - Skip a never-allocated segment whole
+            rehashIndex_ = (segment + 1) << SEGMENT_SHIFT;  // Assign or update a variable that represents the current algorithm state.
+            --emptyVisits;  // Execute this statement as part of the data structure implementation.
+            continue;  // Skip to the next loop iteration.
+        }  // Close the current block scope.
+        if (oldBucket->empty()) {  // Evaluate the condition and branch into the appropriate code path.
+            --emptyVisits;  // Execute this statement as part of the data structure implementation.
+        } else {  // Handle the alternative branch when the condition is false.
+            // 逐一把節點接到新桶尾端 - Splice each node onto the tail of its new bucket
+            HASH_TABLE_STATS_ONLY(stats_.chainResized(oldBucket->size(), 0));  // Access or update the bucket storage used to hold entries or chains.
+            while (!oldBucket->empty()) {  // Repeat while the loop condition remains true.
+                // 用快取的雜湊值，不重新雜湊 key - Reuse the cached hash instead of rehashing the key
+                Bucket& target = buckets_.get(oldBucket->front().hash & (capacity_ - 1));  // Access or update the bucket storage used to hold entries or chains.
+                target.splice(target.end(), *oldBucket, oldBucket->begin());  // Access or update the bucket storage used to hold entries or chains.
+                HASH_TABLE_STATS_ONLY(stats_.chainResized(target.size() - 1, target.size()));  // Access or update the bucket storage used to hold entries or chains.
+            }  // Close the current block scope.
+            --buckets;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        ++rehashIndex_;  // Assign or update a variable that represents the current algorithm state.
+        // 走完一個區段就釋放它 - Free a segment as soon as migration has passed it
+        if ((rehashIndex_ & (SEGMENT_SIZE - 1)) == 0 || rehashIndex_ >= oldBuckets_.count) {  // Evaluate the condition and branch into the appropriate code path.
+            oldBuckets_.segments[segment].reset();  // Access or update the bucket storage used to hold entries or chains.
         }  // Close the current block scope.
     }  // Close the current block scope.
-    throw std::out_of_range("Key not found in hash table");  // Throw an exception to signal an invalid argument or operation.
+
+    // 全部搬完則結束擴容 - The rehash ends once everything has moved
+    if (rehashIndex_ >= oldBuckets_.count) {  // Evaluate the condition and branch into the appropriate code path.
+        oldBuckets_.reset(0);  // Access or update the bucket storage used to hold entries or chains.
+        rehashIndex_ = 0;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    return isRehashing();  // Return the computed result to the caller.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 void HashTable<K, V>::rehash() {  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HASH_TABLE_STATS_ONLY(stats_.countRehash());  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HASH_TABLE_STATS_ONLY(HashTableStatsRecorder::RehashScope rehashScope(stats_);)  // Rehash entries into a larger table to keep operations near O(1) on average.
+    // 上一輪尚未搬完則先完成（每步 4 桶時幾乎不會發生）- Finish a previous round first (rare with 4 buckets per step)
+    if (isRehashing()) {  // Evaluate the condition and branch into the appropriate code path.
+        rehashStep(SIZE_MAX);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    }  // Close the current block scope.
+
     // 儲存舊的桶 - Store old buckets
-    std::vector<Bucket> oldBuckets = std::move(buckets_);  // Access or update the bucket storage used to hold entries or chains.
+    oldBuckets_ = std::move(buckets_);  // Access or update the bucket storage used to hold entries or chains.
+    rehashIndex_ = 0;  // Assign or update a variable that represents the current algorithm state.
 
-    // 容量加倍 - Double capacity
+    // 容量加倍；元素留在舊桶，由之後的操作逐步搬移 - Double capacity; entries stay in the old buckets and move gradually
     capacity_ *= 2;  // Assign or update a variable that represents the current algorithm state.
-    buckets_.clear();  // Access or update the bucket storage used to hold entries or chains.
-    buckets_.resize(capacity_);  // Access or update the bucket storage used to hold entries or chains.
-    size_ = 0;  // Assign or update a variable that represents the current algorithm state.
+    buckets_.reset(capacity_);  // Access or update the bucket storage used to hold entries or chains.
+}  // Close the current block scope.
 
-    // 重新插入所有元素 - Reinsert all elements
-    for (const auto& bucket : oldBuckets) {  // Iterate over a range/collection to process each item in sequence.
-        for (const auto& pair : bucket) {  // Iterate over a range/collection to process each item in sequence.
-            insert(pair.first, pair.second);  // Execute this statement as part of the data structure implementation.
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+HashTableStats HashTable<K, V>::stats() const {  // Execute this statement as part of the data structure implementation.
+    HashTableStats result;  // Assign or update a variable that represents the current algorithm state.
+    result.size = size_;  // Assign or update a variable that represents the current algorithm state.
+    result.capacity = capacity_;  // Assign or update a variable that represents the current algorithm state.
+    // 擴容中尚未搬移的舊桶也算在桶數內 - Old buckets not yet migrated count as buckets too
+    stats_.fill(result, capacity_ + (isRehashing() ? oldBuckets_.count - rehashIndex_ : 0));  // Access or update the bucket storage used to hold entries or chains.
+
+    // 位元組數：區段指標陣列 + 已配置的區段 + 每個串列節點 - Bytes: segment pointer arrays + allocated segments + one list node per element
+    size_t bytes = size_ * listNodeBytes<Node>();  // Assign or update a variable that represents the current algorithm state.
+    for (const BucketArray* buckets : {&buckets_, &oldBuckets_}) {  // Iterate over a range/collection to process each item in sequence.
+        bytes += buckets->segments.capacity() * sizeof(std::unique_ptr<Bucket[]>);  // Access or update the bucket storage used to hold entries or chains.
+        for (size_t s = 0; s < buckets->segments.size(); ++s) {  // Iterate over a range/collection to process each item in sequence.
+            if (buckets->segments[s]) {  // Evaluate the condition and branch into the appropriate code path.
+                bytes += std::min(SEGMENT_SIZE, buckets->count - (s << SEGMENT_SHIFT)) * sizeof(Bucket);  // Access or update the bucket storage used to hold entries or chains.
+            }  // Close the current block scope.
         }  // Close the current block scope.
     }  // Close the current block scope.
+    result.bytesAllocated = bytes;  // Assign or update a variable that represents the current algorithm state.
+    return result;  // Return the computed result to the caller.
 }  // Close the current block scope.
+#endif  // Execute this statement as part of the data structure implementation.
 
 #endif // HASH_TABLE_HPP
@@ -0,0 +1,287 @@
+/** Doc block start
+ * 雜湊表統計介面 - C++ 實作
+ * 所有雜湊表（HashTable、ChainedHashTable、FlatChainedHashTable、OpenAddressingHashTable、
+ * SwissTable、UniversalHashTable、CuckooHashTable）共用的統計格式：即時探測長度直方圖、鏈長分布、墓碑比例、
+ * 重建次數與耗時、配置的位元組數。
+ *(blank line)
+ * Hash table statistics interface.
+ * One statistics format shared by every table: a live probe-length histogram, the chain-length
+ * distribution, the tombstone ratio, the rehash count and wall time, and the bytes allocated.
+ *(blank line)
+ * 以 -DHASH_TABLE_STATS=1 編譯時，各表在每次操作當下更新自己的 HashTableStatsRecorder，
+ * stats() 只需 O(最長鏈 + 最長探測) 即可取得快照，不必走訪整個表；預設（0）時記錄器成員、
+ * 記錄呼叫與 stats() 都不會被編譯，表的大小與熱路徑和沒有統計時完全相同。
+ * With -DHASH_TABLE_STATS=1 each table updates its HashTableStatsRecorder as operations happen,
+ * so stats() costs O(longest chain + longest probe) instead of a full scan. By default (0) the
+ * recorder member, the recording calls and stats() are not compiled at all, so table sizes and
+ * hot paths are exactly what they are without statistics.
+ *(blank line)
+ * 注意：啟用時唯讀查詢也會寫入記錄器，因此不可在多執行緒間共用同一個表做並行讀取。
+ * Note: when enabled, read-only lookups also write to the recorder, so a table must not be read
+ * concurrently from several threads.
+ */  // End of block comment
+
+#ifndef HASH_TABLE_STATS_HPP  // Execute this statement as part of the data structure implementation.
+#define HASH_TABLE_STATS_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include <ostream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+
+#ifndef HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+#define HASH_TABLE_STATS 0  // 預設關閉 - Disabled by default
+#endif  // Execute this statement as part of the data structure implementation.
+
+// 只在啟用統計時展開的敘述 - Statement that only exists when statistics are enabled
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+#define HASH_TABLE_STATS_ONLY(...) __VA_ARGS__  // Execute this statement as part of the data structure implementation.
+#else  // Handle the alternative branch when the condition is false.
+#define HASH_TABLE_STATS_ONLY(...)  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 統計快照：stats() 的回傳值 / Statistics snapshot returned by stats()
+ *(blank line)
+ * 「探測」沿用各表原本 getTotalProbes 的定義：鏈結法為比對的節點數（插入新 key 另加 1），
+ * 開放定址法為檢查的槽位數，SwissTable 為檢查的群組數。
+ * A "probe" keeps each table's existing getTotalProbes meaning: nodes compared for chaining
+ * (plus one when a new key is linked in), slots examined for open addressing, groups examined
+ * for SwissTable.
+ */  // End of block comment
+struct HashTableStats {  // Execute this statement as part of the data structure implementation.
+    size_t size = 0;                          // 元素數量 - Number of elements
+    size_t capacity = 0;                      // 桶或槽位數 - Number of buckets or slots
+    uint64_t operations = 0;                  // 記錄到的插入／查詢／刪除次數 - Inserts, lookups and removals recorded
+    uint64_t totalProbes = 0;                 // 這些操作的探測總數 - Probes over those operations
+    std::vector<uint64_t> probeHistogram;     // [i] = 探測 i 次的操作數 - [i] = operations that took i probes
+    std::vector<uint64_t> chainLengths;       // [i] = 長度為 i 的鏈數，[0] 為空桶（僅鏈結法）- [i] = chains of length i, [0] = empty buckets (chaining only)
+    size_t tombstones = 0;                    // 墓碑數量（僅開放定址法）- Tombstones (open addressing only)
+    uint64_t rehashCount = 0;                 // 重建次數（擴容、清除墓碑、換雜湊函數）- Rebuilds (growth, tombstone purges, new hash functions)
+    uint64_t rehashNanos = 0;                 // 重建花費的牆鐘時間 - Wall time spent rebuilding
+    size_t bytesAllocated = 0;                // 表本身持有的堆積記憶體（不含 key / value 自己配置的）- Heap bytes held by the table itself (not by keys or values)
+
+    double loadFactor() const {  // Execute this statement as part of the data structure implementation.
+        return capacity == 0 ? 0.0 : static_cast<double>(size) / capacity;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    double averageProbes() const {  // Advance or track the probing sequence used by open addressing.
+        return operations == 0 ? 0.0 : static_cast<double>(totalProbes) / operations;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    size_t maxProbes() const {  // 直方圖最後一格一定非零 - The histogram's last cell is always non-zero
+        return probeHistogram.empty() ? 0 : probeHistogram.size() - 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    size_t maxChainLength() const {  // Execute this statement as part of the data structure implementation.
+        return chainLengths.empty() ? 0 : chainLengths.size() - 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    double averageChainLength() const {  // 只算非空鏈，與 getAverageChainLength 相同 - Non-empty chains only, as getAverageChainLength
+        uint64_t chains = 0;  // Assign or update a variable that represents the current algorithm state.
+        uint64_t nodes = 0;  // Assign or update a variable that represents the current algorithm state.
+        for (size_t length = 1; length < chainLengths.size(); ++length) {  // Iterate over a range/collection to process each item in sequence.
+            chains += chainLengths[length];  // Assign or update a variable that represents the current algorithm state.
+            nodes += chainLengths[length] * length;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        return chains == 0 ? 0.0 : static_cast<double>(nodes) / chains;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    double tombstoneRatio() const {  // Handle tombstones so deletions do not break the probing/search sequence.
+        return capacity == 0 ? 0.0 : static_cast<double>(tombstones) / capacity;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * std::list 節點的配置大小：元素加上前後兩個指標（libstdc++ / libc++ 的節點配置）
+ * Allocation size of a std::list node: the element plus the prev / next pointers
+ * (the node layout of libstdc++ and libc++)
+ */  // End of block comment
+template <typename T>  // Execute this statement as part of the data structure implementation.
+constexpr size_t listNodeBytes() {  // Execute this statement as part of the data structure implementation.
+    return sizeof(T) + 2 * sizeof(void*);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 即時統計記錄器：每個表在 HASH_TABLE_STATS 啟用時持有一個（查詢是 const，因此宣告為 mutable）。
+ * 每次記錄都是 O(1) 的計數器加一；直方圖只在出現新的最大值時才變長。
+ * Live statistics recorder: each table owns one when HASH_TABLE_STATS is enabled (mutable, since
+ * lookups are const). Every record is an O(1) counter bump; histograms only grow when a new
+ * maximum appears.
+ */  // End of block comment
+class HashTableStatsRecorder {  // Execute this statement as part of the data structure implementation.
+public:  // Execute this statement as part of the data structure implementation.
+    /** Doc block start
+     * RAII：量測一次重建的牆鐘時間。巢狀時（重建中再觸發重建、漸進式搬移）只有最外層計時，
+     * 而且範圍內重新插入的探測不會記入直方圖。
+     * RAII: times one rebuild. When nested (a rebuild triggering another, incremental migration
+     * steps) only the outermost scope is timed, and re-insertions inside a scope are not recorded
+     * in the probe histogram.
+     */  // End of block comment
+    class RehashScope {  // Rehash entries into a larger table to keep operations near O(1) on average.
+    public:  // Execute this statement as part of the data structure implementation.
+        explicit RehashScope(HashTableStatsRecorder& recorder)  // Execute this statement as part of the data structure implementation.
+            : recorder_(recorder), start_(std::chrono::steady_clock::now()) {  // Assign or update a variable that represents the current algorithm state.
+            ++recorder_.rehashDepth_;  // Rehash entries into a larger table to keep operations near O(1) on average.
+        }  // Close the current block scope.
+
+        ~RehashScope() {  // Rehash entries into a larger table to keep operations near O(1) on average.
+            if (--recorder_.rehashDepth_ == 0) {  // Evaluate the condition and branch into the appropriate code path.
+                recorder_.rehashNanos_ += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(  // Rehash entries into a larger table to keep operations near O(1) on average.
+                    std::chrono::steady_clock::now() - start_).count());  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+
+        RehashScope(const RehashScope&) = delete;  // Execute this statement as part of the data structure implementation.
+        RehashScope& operator=(const RehashScope&) = delete;  // Execute this statement as part of the data structure implementation.
+
+    private:  // Execute this statement as part of the data structure implementation.
+        HashTableStatsRecorder& recorder_;  // Execute this statement as part of the data structure implementation.
+        std::chrono::steady_clock::time_point start_;  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 記錄一次操作的探測長度 / Record the probe length of one operation
+     */  // End of block comment
+    void recordProbes(size_t probes) {  // Advance or track the probing sequence used by open addressing.
+        if (rehashDepth_ != 0) {  // 重建中的重新插入不算 - Re-insertions during a rebuild do not count
+            return;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        if (probes >= probeHistogram_.size()) {  // Evaluate the condition and branch into the appropriate code path.
+            probeHistogram_.resize(probes + 1, 0);  // Advance or track the probing sequence used by open addressing.
+        }  // Close the current block scope.
+        ++probeHistogram_[probes];  // Advance or track the probing sequence used by open addressing.
+        ++operations_;  // Execute this statement as part of the data structure implementation.
+        totalProbes_ += probes;  // Advance or track the probing sequence used by open addressing.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 一條鏈的長度由 from 變成 to（0 代表空桶，不另外記錄）
+     * One chain changed length from `from` to `to` (0 means an empty bucket, which is not stored)
+     */  // End of block comment
+    void chainResized(size_t from, size_t to) {  // Execute this statement as part of the data structure implementation.
+        if (from != 0) {  // Evaluate the condition and branch into the appropriate code path.
+            --chainLengths_[from];  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        if (to != 0) {  // Evaluate the condition and branch into the appropriate code path.
+            if (to >= chainLengths_.size()) {  // Evaluate the condition and branch into the appropriate code path.
+                chainLengths_.resize(to + 1, 0);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            ++chainLengths_[to];  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 所有鏈都清空了（clear 或整批重新分配時）/ Every chain became empty (clear or a full redistribution)
+     */  // End of block comment
+    void resetChains() { chainLengths_.clear(); }  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 計入一次重建（耗時另以 RehashScope 量測）/ Count one rebuild (its time is measured by RehashScope)
+     */  // End of block comment
+    void countRehash() { ++rehashCount_; }  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+    /** Doc block start
+     * 歸零探測與重建計數器；鏈長分布反映目前結構，不受影響
+     * Zero the probe and rebuild counters; the chain-length distribution reflects the current
+     * structure and is left alone
+     */  // End of block comment
+    void resetCounters() {  // Execute this statement as part of the data structure implementation.
+        probeHistogram_.clear();  // Advance or track the probing sequence used by open addressing.
+        operations_ = 0;  // Assign or update a variable that represents the current algorithm state.
+        totalProbes_ = 0;  // Advance or track the probing sequence used by open addressing.
+        rehashCount_ = 0;  // Rehash entries into a larger table to keep operations near O(1) on average.
+        rehashNanos_ = 0;  // Rehash entries into a larger table to keep operations near O(1) on average.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 把記錄的內容填入快照；buckets 為目前的桶數，用來算出空桶數（不使用鏈的表傳 0）
+     * Fill a snapshot with what was recorded; `buckets` is the current bucket count, used to
+     * derive the number of empty buckets (tables without chains pass 0)
+     */  // End of block comment
+    void fill(HashTableStats& out, size_t buckets) const {  // Execute this statement as part of the data structure implementation.
+        out.operations = operations_;  // Assign or update a variable that represents the current algorithm state.
+        out.totalProbes = totalProbes_;  // Advance or track the probing sequence used by open addressing.
+        out.probeHistogram.assign(probeHistogram_.begin(), probeHistogram_.end());  // Advance or track the probing sequence used by open addressing.
+        out.rehashCount = rehashCount_;  // Rehash entries into a larger table to keep operations near O(1) on average.
+        out.rehashNanos = rehashNanos_;  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+        // 去掉尾端的 0，讓最後一格就是最大值 - Trim trailing zeros so the last cell is the maximum
+        size_t longest = chainLengths_.size();  // Assign or update a variable that represents the current algorithm state.
+        while (longest > 1 && chainLengths_[longest - 1] == 0) {  // Repeat while the loop condition remains true.
+            --longest;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        out.chainLengths.assign(chainLengths_.begin(), chainLengths_.begin() + longest);  // Execute this statement as part of the data structure implementation.
+        if (buckets != 0) {  // Evaluate the condition and branch into the appropriate code path.
+            uint64_t nonEmpty = 0;  // Assign or update a variable that represents the current algorithm state.
+            for (size_t length = 1; length < out.chainLengths.size(); ++length) {  // Iterate over a range/collection to process each item in sequence.
+                nonEmpty += out.chainLengths[length];  // Assign or update a variable that represents the current algorithm state.
+            }  // Close the current block scope.
+            if (out.chainLengths.empty()) {  // Evaluate the condition and branch into the appropriate code path.
+                out.chainLengths.push_back(0);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            out.chainLengths[0] = buckets > nonEmpty ? buckets - nonEmpty : 0;  // Access or update the bucket storage used to hold entries or chains.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+private:  // Execute this statement as part of the data structure implementation.
+    std::vector<uint64_t> probeHistogram_;  // 探測長度直方圖 - Probe-length histogram
+    std::vector<uint64_t> chainLengths_;    // [i] = 長度為 i 的鏈數（i ≥ 1）- [i] = chains of length i (i ≥ 1)
+    uint64_t operations_ = 0;               // 記錄的操作數 - Operations recorded
+    uint64_t totalProbes_ = 0;              // 探測總數 - Total probes
+    uint64_t rehashCount_ = 0;              // 重建次數 - Rebuild count
+    uint64_t rehashNanos_ = 0;              // 重建耗時 - Rebuild wall time
+    int rehashDepth_ = 0;                   // 進行中的 RehashScope 層數 - Active RehashScope nesting depth
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 以一個 JSON 物件輸出統計（不含結尾換行），供 stats_replay 等工具使用
+ * Write the statistics as one JSON object (no trailing newline), for tools such as stats_replay
+ *(blank line)
+ * @param name 表的名稱，放在 "table" 欄位 / Table name, stored in the "table" field
+ * @param indent 每行前面的空白 / Leading whitespace for each line
+ */  // End of block comment
+inline void writeStatsJson(std::ostream& out, const std::string& name, const HashTableStats& stats,  // Execute this statement as part of the data structure implementation.
+                           const std::string& indent = "") {  // Execute this statement as part of the data structure implementation.
+    auto writeArray = [&out](const std::vector<uint64_t>& values) {  // Assign or update a variable that represents the current algorithm state.
+        out << '[';  // Execute this statement as part of the data structure implementation.
+        for (size_t i = 0; i < values.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+            out << (i == 0 ? "" : ", ") << values[i];  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        out << ']';  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+
+    // 名稱由程式給定，只需跳脫引號與反斜線 - Names come from code, so only quotes and backslashes need escaping
+    std::string escaped;  // Assign or update a variable that represents the current algorithm state.
+    for (char c : name) {  // Iterate over a range/collection to process each item in sequence.
+        if (c == '"' || c == '\\') {  // Evaluate the condition and branch into the appropriate code path.
+            escaped += '\\';  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        escaped += c;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    out << indent << "{\n";  // Execute this statement as part of the data structure implementation.
+    out << indent << "  \"table\": \"" << escaped << "\",\n";  // Execute this statement as part of the data structure implementation.
+    out << indent << "  \"size\": " << stats.size << ",\n";  // Execute this statement as part of the data structure implementation.
+    out << indent << "  \"capacity\": " << stats.capacity << ",\n";  // Execute this statement as part of the data structure implementation.
+    out << indent << "  \"load_factor\": " << stats.loadFactor() << ",\n";  // Execute this statement as part of the data structure implementation.
+    out << indent << "  \"operations\": " << stats.operations << ",\n";  // Execute this statement as part of the data structure implementation.
+    out << indent << "  \"total_probes\": " << stats.totalProbes << ",\n";  // Advance or track the probing sequence used by open addressing.
+    out << indent << "  \"average_probes\": " << stats.averageProbes() << ",\n";  // Advance or track the probing sequence used by open addressing.
+    out << indent << "  \"max_probes\": " << stats.maxProbes() << ",\n";  // Advance or track the probing sequence used by open addressing.
+    out << indent << "  \"probe_histogram\": ";  // Advance or track the probing sequence used by open addressing.
+    writeArray(stats.probeHistogram);  // Advance or track the probing sequence used by open addressing.
+    out << ",\n" << indent << "  \"chain_lengths\": ";  // Execute this statement as part of the data structure implementation.
+    writeArray(stats.chainLengths);  // Execute this statement as part of the data structure implementation.
+    out << ",\n" << indent << "  \"max_chain_length\": " << stats.maxChainLength() << ",\n";  // Execute this statement as part of the data structure implementation.
+    out << indent << "  \"average_chain_length\": " << stats.averageChainLength() << ",\n";  // Execute this statement as part of the data structure implementation.
+    out << indent << "  \"tombstones\": " << stats.tombstones << ",\n";  // Handle tombstones so deletions do not break the probing/search sequence.
+    out << indent << "  \"tombstone_ratio\": " << stats.tombstoneRatio() << ",\n";  // Handle tombstones so deletions do not break the probing/search sequence.
+    out << indent << "  \"rehash_count\": " << stats.rehashCount << ",\n";  // Rehash entries into a larger table to keep operations near O(1) on average.
+    out << indent << "  \"rehash_ms\": " << static_cast<double>(stats.rehashNanos) / 1e6 << ",\n";  // Rehash entries into a larger table to keep operations near O(1) on average.
+    out << indent << "  \"bytes_allocated\": " << stats.bytesAllocated << "\n";  // Execute this statement as part of the data structure implementation.
+    out << indent << "}";  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+#endif // HASH_TABLE_STATS_HPP
@@ -0,0 +1,635 @@
+/** Doc block start
+ * 唯讀完美雜湊字典（CHD：Hash, Displace, and Compress）- C++ 實作
+ * 由任何提供 forEach(fn(key, value)) 的雜湊表建出最小完美雜湊，寫成扁平檔案；
+ * 讀取端以 mmap 映射檔案後直接查詢，不做任何反序列化。
+ *(blank line)
+ * Read-only minimal perfect hash dictionary (CHD: Hash, Displace, and Compress).
+ * Built from any hash table that offers forEach(fn(key, value)) and written to a flat file;
+ * the reader maps the file with mmap and answers lookups with zero deserialization.
+ *(blank line)
+ * 檔案格式（皆為本機位元組序）File layout (native byte order):
+ *   PerfectHashFileHeader
+ *   uint32_t displacement[bucketCount]   每個桶的位移索引 - Displacement index per bucket
+ *   uint64_t offsets[count + 1]          僅字串 key：各筆記錄的起點 - String keys only: start of each record
+ *   records（依槽位順序 in slot order）   key 位元組後面緊接 value，一次快取未命中就能比對並取值
+ *                                        Key bytes immediately followed by the value, so one cache miss
+ *                                        covers both the compare and the fetch
+ */  // End of block comment
+
+#ifndef PERFECT_HASH_HPP  // Execute this statement as part of the data structure implementation.
+#define PERFECT_HASH_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <cstring>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <fstream>  // Execute this statement as part of the data structure implementation.
+#include <optional>  // Execute this statement as part of the data structure implementation.
+#include <stdexcept>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <string_view>  // Execute this statement as part of the data structure implementation.
+#include <type_traits>  // Execute this statement as part of the data structure implementation.
+
+#if defined(__unix__) || defined(__APPLE__)  // Evaluate the condition and branch into the appropriate code path.
+#include <fcntl.h>  // Execute this statement as part of the data structure implementation.
+#include <sys/mman.h>  // Execute this statement as part of the data structure implementation.
+#include <sys/stat.h>  // Execute this statement as part of the data structure implementation.
+#include <unistd.h>  // Execute this statement as part of the data structure implementation.
+#define PERFECT_HASH_HAS_MMAP 1  // Execute this statement as part of the data structure implementation.
+#else  // Handle the alternative branch when the condition is false.
+#define PERFECT_HASH_HAS_MMAP 0  // 沒有 mmap 時整個檔案讀進記憶體 - Without mmap the whole file is read into memory
+#endif  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 檔案標頭（80 位元組）/ File header (80 bytes)
+ */  // End of block comment
+struct PerfectHashFileHeader {  // Execute this statement as part of the data structure implementation.
+    uint32_t magic;               // PERFECT_HASH_MAGIC，也用來偵測位元組序不符 - Also detects a byte-order mismatch
+    uint32_t version;             // 格式版本 - Format version
+    uint32_t keyKind;             // 1 = 固定大小 key, 2 = 字串 - 1 = fixed-size key, 2 = string
+    uint32_t keySize;             // 固定大小 key 的 sizeof，字串為 0 - sizeof(K) for fixed-size keys, 0 for strings
+    uint32_t valueSize;           // sizeof(V)
+    uint32_t reserved;            // 保留，寫入 0 - Reserved, written as 0
+    uint64_t count;               // key 數 = 槽位數（最小完美雜湊）- Keys = slots (minimal perfect hash)
+    uint64_t bucketCount;         // 位移表的桶數 - Buckets in the displacement table
+    uint64_t seed;                // 雜湊種子 - Hash seed
+    uint64_t displacementOffset;  // 位移表的檔案位移 - File offset of the displacement table
+    uint64_t offsetTableOffset;   // 字串 key 的起點表位移，固定大小 key 為 0 - String-key offset table, 0 for fixed-size keys
+    uint64_t recordOffset;        // 記錄區的檔案位移 - File offset of the records
+    uint64_t fileSize;            // 檔案總長度 - Total file length
+};  // Execute this statement as part of the data structure implementation.
+
+static_assert(sizeof(PerfectHashFileHeader) == 80, "header layout must not depend on the compiler");  // Execute this statement as part of the data structure implementation.
+
+constexpr uint32_t PERFECT_HASH_MAGIC = 0x31464850u;  // 檔案開頭的 "PHF1" - "PHF1" at the start of the file
+constexpr uint32_t PERFECT_HASH_VERSION = 1;  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 固定大小 key 的序列化規則：以原始位元組存放與雜湊（要求沒有填充位元組，例如整數）
+ * Serialization rule for fixed-size keys: stored and hashed as raw bytes
+ * (requires no padding bits, e.g. integers)
+ */  // End of block comment
+template <typename K>  // Execute this statement as part of the data structure implementation.
+struct PerfectHashKey {  // Execute this statement as part of the data structure implementation.
+    static_assert(std::has_unique_object_representations_v<K>,  // Execute this statement as part of the data structure implementation.
+                  "PerfectHash keys must be std::string or have a unique byte representation");  // Execute this statement as part of the data structure implementation.
+    using View = K;  // 查詢時傳入的型別 - Type passed to lookups
+    static constexpr uint32_t KIND = 1;  // Execute this statement as part of the data structure implementation.
+    static constexpr uint32_t SIZE = sizeof(K);  // Execute this statement as part of the data structure implementation.
+    static const void* data(const View& key) { return &key; }  // Return the computed result to the caller.
+    static size_t size(const View&) { return sizeof(K); }  // Return the computed result to the caller.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 字串 key：以 std::string_view 查詢，檔案中以起點表找到每筆變長記錄
+ * String keys: looked up by std::string_view; an offset table locates each variable-length record
+ */  // End of block comment
+template <>  // Execute this statement as part of the data structure implementation.
+struct PerfectHashKey<std::string> {  // Execute this statement as part of the data structure implementation.
+    using View = std::string_view;  // Execute this statement as part of the data structure implementation.
+    static constexpr uint32_t KIND = 2;  // Execute this statement as part of the data structure implementation.
+    static constexpr uint32_t SIZE = 0;  // Execute this statement as part of the data structure implementation.
+    static const void* data(const View& key) { return key.data(); }  // Return the computed result to the caller.
+    static size_t size(const View& key) { return key.size(); }  // Return the computed result to the caller.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 64 位元混合函數（murmur3 fmix64）/ 64-bit mixer (murmur3 fmix64)
+ */  // End of block comment
+inline uint64_t perfectHashMix(uint64_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 33;  // Execute this statement as part of the data structure implementation.
+    x *= 0xff51afd7ed558ccdULL;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 33;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc4ceb9fe1a85ec53ULL;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 33;  // Execute this statement as part of the data structure implementation.
+    return x;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 帶種子的位元組雜湊，每次讀 8 位元組。寫進檔案的值必須跨行程穩定，所以不用 std::hash。
+ * Seeded byte hash reading 8 bytes at a time. Values baked into the file must be stable across
+ * processes, so std::hash is not used.
+ */  // End of block comment
+inline uint64_t perfectHashBytes(const void* data, size_t length, uint64_t seed) {  // Compute a hash-based index so keys map into the table's storage.
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);  // Assign or update a variable that represents the current algorithm state.
+    uint64_t h = seed ^ (static_cast<uint64_t>(length) * 0x9E3779B97F4A7C15ULL);  // Assign or update a variable that represents the current algorithm state.
+    while (length >= 8) {  // Repeat while the loop condition remains true.
+        uint64_t word;  // Execute this statement as part of the data structure implementation.
+        std::memcpy(&word, bytes, 8);  // Execute this statement as part of the data structure implementation.
+        h = perfectHashMix(h ^ word);  // Assign or update a variable that represents the current algorithm state.
+        bytes += 8;  // Assign or update a variable that represents the current algorithm state.
+        length -= 8;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    uint64_t tail = 0;  // Assign or update a variable that represents the current algorithm state.
+    std::memcpy(&tail, bytes, length);  // 剩下 0 ~ 7 位元組 - The remaining 0 to 7 bytes
+    return perfectHashMix(h ^ tail ^ 0x2545F4914F6CDD1DULL);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 一個 key 的三個雜湊分量：所屬的桶，以及位移公式 (f1 + d0 * f2 + d1) mod m 中的 f1、f2
+ * A key's three hash components: its bucket, plus f1 and f2 of the displacement formula
+ * (f1 + d0 * f2 + d1) mod m
+ */  // End of block comment
+struct PerfectHashCodes {  // Execute this statement as part of the data structure implementation.
+    uint64_t bucket;  // Execute this statement as part of the data structure implementation.
+    uint64_t f1;  // Execute this statement as part of the data structure implementation.
+    uint64_t f2;  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 把 32 位元雜湊值映射到 [0, n)：相乘後取高 32 位元，取代除法（n ≤ 2^32）
+ * Map a 32-bit hash value into [0, n): multiply and keep the high 32 bits instead of dividing (n ≤ 2^32)
+ */  // End of block comment
+inline uint64_t perfectHashRange(uint64_t hash32, uint64_t n) {  // Compute a hash-based index so keys map into the table's storage.
+    return (hash32 * n) >> 32;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+inline PerfectHashCodes perfectHashCodes(uint64_t h, uint64_t buckets, uint64_t slots) {  // Compute a hash-based index so keys map into the table's storage.
+    uint64_t h2 = perfectHashMix(h + 0x9E3779B97F4A7C15ULL);  // 與選桶用的 h 無關的第二個值 - A second value independent of the bucket choice
+    return PerfectHashCodes{perfectHashRange(h >> 32, buckets), perfectHashRange(h2 >> 32, slots),  // Return the computed result to the caller.
+                            perfectHashRange(h2 & 0xFFFFFFFFu, slots)};  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 由位移索引與 f1、f2 算出槽位：d0 = index / m，d1 = index mod m。
+ * 幾乎所有桶在 d0 = 0 時就能放下，這時不需要任何除法。
+ * Slot for a displacement index and f1, f2: d0 = index / m, d1 = index mod m.
+ * Almost every bucket is placed with d0 = 0, which needs no division at all.
+ */  // End of block comment
+inline uint64_t perfectHashSlot(const PerfectHashCodes& codes, uint32_t index, uint64_t slots) {  // Compute a hash-based index so keys map into the table's storage.
+    if (index < slots) {  // Evaluate the condition and branch into the appropriate code path.
+        uint64_t slot = codes.f1 + index;  // Assign or update a variable that represents the current algorithm state.
+        return slot >= slots ? slot - slots : slot;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    return (codes.f1 + (index / slots) * codes.f2 + index % slots) % slots;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 建置結果統計 / Build statistics
+ */  // End of block comment
+struct PerfectHashBuildStats {  // Execute this statement as part of the data structure implementation.
+    size_t keys = 0;              // key 數 - Number of keys
+    size_t buckets = 0;           // 位移表桶數 - Displacement buckets
+    size_t attempts = 0;          // 用了幾個種子才成功 - Seeds tried before success
+    uint32_t maxDisplacement = 0; // 最大位移索引 - Largest displacement index
+    size_t fileBytes = 0;         // 檔案大小 - File size
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 完美雜湊建置器：收集 (key, value)，以 CHD 找出每個桶的位移，寫成扁平檔案
+ * Perfect hash builder: collects (key, value) pairs, finds a displacement for every bucket
+ * with CHD, and writes the flat file
+ *(blank line)
+ * @tparam K 鍵的類型（std::string 或整數等固定大小型別）
+ * @tparam V 值的類型（必須可直接複製位元組，例如整數或 POD 結構）
+ */  // End of block comment
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+class PerfectHashBuilder {  // Execute this statement as part of the data structure implementation.
+    static_assert(std::is_trivially_copyable_v<V>, "PerfectHash values are stored as raw bytes");  // Execute this statement as part of the data structure implementation.
+
+public:  // Execute this statement as part of the data structure implementation.
+    using KeyTraits = PerfectHashKey<K>;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 從任何提供 forEach(fn(key, value)) 的表收集內容（HashTable、ChainedHashTable、
+     * OpenAddressingHashTable、FlatChainedHashTable、SwissTable、ConcurrentHashMap）
+     * Collect the contents of any table offering forEach(fn(key, value)) (HashTable,
+     * ChainedHashTable, OpenAddressingHashTable, FlatChainedHashTable, SwissTable, ConcurrentHashMap)
+     */  // End of block comment
+    template <typename Table>  // Execute this statement as part of the data structure implementation.
+    static PerfectHashBuilder fromTable(Table& table) {  // Execute this statement as part of the data structure implementation.
+        PerfectHashBuilder builder;  // Execute this statement as part of the data structure implementation.
+        table.forEach([&builder](const K& key, const V& value) { builder.add(key, value); });  // Iterate over a range/collection to process each item in sequence.
+        return builder;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 加入一對 (key, value)；重複的 key 在 writeFile 時才會被發現並丟出例外
+     * Add one (key, value) pair; duplicate keys are detected (and rejected) by writeFile
+     */  // End of block comment
+    void add(const K& key, const V& value) {  // Execute this statement as part of the data structure implementation.
+        keys_.push_back(key);  // Execute this statement as part of the data structure implementation.
+        values_.push_back(value);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    size_t size() const { return keys_.size(); }  // Return the computed result to the caller.
+
+    /** Doc block start
+     * 建立完美雜湊並寫入檔案 / Build the perfect hash and write the file
+     *(blank line)
+     * @throws std::invalid_argument 若有重複的 key，或 key 數超過 2^32 - 1
+     * @throws std::runtime_error 若檔案無法寫入，或所有種子都失敗
+     */  // End of block comment
+    PerfectHashBuildStats writeFile(const std::string& path) const;  // Execute this statement as part of the data structure implementation.
+
+    static constexpr uint64_t KEYS_PER_BUCKET = 4;  // CHD 的平均桶大小 λ - Average CHD bucket size λ
+    static constexpr size_t MAX_ATTEMPTS = 16;  // 最多換幾個種子 - Seeds to try before giving up
+    static constexpr uint64_t MAX_D0 = 255;  // 每個桶最多嘗試的 d0 - Largest d0 tried per bucket
+
+private:  // Execute this statement as part of the data structure implementation.
+    std::vector<K> keys_;  // Execute this statement as part of the data structure implementation.
+    std::vector<V> values_;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 以指定種子嘗試找出所有位移；成功時填入 displacement 與 slotOwner（槽位 → key 索引）
+     * Try to place every bucket with one seed; on success fill displacement and slotOwner (slot → key index)
+     */  // End of block comment
+    bool tryBuild(uint64_t seed, uint64_t buckets, std::vector<uint32_t>& displacement,  // Execute this statement as part of the data structure implementation.
+                  std::vector<size_t>& slotOwner) const;  // Execute this statement as part of the data structure implementation.
+
+    static uint64_t alignUp(uint64_t offset, uint64_t alignment) {  // Execute this statement as part of the data structure implementation.
+        return (offset + alignment - 1) / alignment * alignment;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 以 mmap 映射的唯讀完美雜湊表：開啟時只驗證標頭，查詢直接讀取映射的記憶體
+ * Read-only perfect hash table mapped with mmap: opening only validates the header, and lookups
+ * read the mapped memory directly
+ */  // End of block comment
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+class MappedPerfectHashTable {  // Execute this statement as part of the data structure implementation.
+    static_assert(std::is_trivially_copyable_v<V>, "PerfectHash values are stored as raw bytes");  // Execute this statement as part of the data structure implementation.
+
+public:  // Execute this statement as part of the data structure implementation.
+    using KeyTraits = PerfectHashKey<K>;  // Execute this statement as part of the data structure implementation.
+    using View = typename KeyTraits::View;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 映射並驗證檔案 / Map and validate the file
+     *(blank line)
+     * @throws std::runtime_error 檔案無法開啟、格式錯誤，或 key / value 型別與檔案不符
+     */  // End of block comment
+    explicit MappedPerfectHashTable(const std::string& path);  // Execute this statement as part of the data structure implementation.
+
+    ~MappedPerfectHashTable();  // Execute this statement as part of the data structure implementation.
+
+    MappedPerfectHashTable(const MappedPerfectHashTable&) = delete;  // Execute this statement as part of the data structure implementation.
+    MappedPerfectHashTable& operator=(const MappedPerfectHashTable&) = delete;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 搜尋 key：算出唯一可能的槽位，再比對存放的 key（不在表中的 key 也會落到某個槽位）
+     * Search for a key: compute its only possible slot, then compare the stored key
+     * (keys outside the set also land on some slot)
+     */  // End of block comment
+    std::optional<V> search(const View& key) const;  // Execute this statement as part of the data structure implementation.
+
+    bool contains(const View& key) const { return search(key).has_value(); }  // Return the computed result to the caller.
+
+    size_t size() const { return static_cast<size_t>(header_.count); }  // Return the computed result to the caller.
+
+    bool empty() const { return header_.count == 0; }  // Return the computed result to the caller.
+
+    size_t fileBytes() const { return length_; }  // Return the computed result to the caller.
+
+    /** Doc block start
+     * 是否真的以 mmap 映射（否則整個檔案已讀入記憶體）/ Whether the file is really memory-mapped
+     */  // End of block comment
+    bool isMapped() const { return PERFECT_HASH_HAS_MMAP != 0; }  // Return the computed result to the caller.
+
+private:  // Execute this statement as part of the data structure implementation.
+    const unsigned char* base_;      // 檔案內容起點 - Start of the file contents
+    size_t length_;                  // 檔案長度 - File length
+    PerfectHashFileHeader header_;   // 標頭副本 - Copy of the header
+    const unsigned char* displacement_;  // uint32_t[bucketCount]
+    const unsigned char* offsets_;   // 字串 key 的記錄起點表 - Record starts for string keys
+    const unsigned char* records_;   // 記錄區 - Records
+    uint64_t recordBytes_;           // 記錄區長度 - Length of the record area
+    std::vector<uint64_t> fallback_; // 沒有 mmap 時的檔案緩衝區 - File buffer when mmap is unavailable
+
+    /** Doc block start
+     * 槽位中的 key 相符時回傳其 value 的位址，否則回傳 nullptr
+     * Address of the slot's value when its key matches, nullptr otherwise
+     */  // End of block comment
+    const unsigned char* findValue(uint64_t slot, const View& key) const;  // Execute this statement as part of the data structure implementation.
+
+    void validate();  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+// ============================================================
+// 實作部分 Implementation
+// ============================================================
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool PerfectHashBuilder<K, V>::tryBuild(uint64_t seed, uint64_t buckets, std::vector<uint32_t>& displacement,  // Execute this statement as part of the data structure implementation.
+                                        std::vector<size_t>& slotOwner) const {  // Execute this statement as part of the data structure implementation.
+    const uint64_t slots = keys_.size();  // 最小：槽位數 = key 數 - Minimal: slots = keys
+    std::vector<PerfectHashCodes> codes(keys_.size());  // Execute this statement as part of the data structure implementation.
+    std::vector<uint64_t> bucketStart(buckets + 1, 0);  // Access or update the bucket storage used to hold entries or chains.
+    for (size_t i = 0; i < keys_.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        typename KeyTraits::View view(keys_[i]);  // Assign or update a variable that represents the current algorithm state.
+        codes[i] = perfectHashCodes(perfectHashBytes(KeyTraits::data(view), KeyTraits::size(view), seed), buckets, slots);  // Compute a hash-based index so keys map into the table's storage.
+        ++bucketStart[codes[i].bucket + 1];  // Access or update the bucket storage used to hold entries or chains.
+    }  // Close the current block scope.
+
+    // 計數排序：把 key 依桶分組 - Counting sort: group keys by bucket
+    for (uint64_t b = 0; b < buckets; ++b) {  // Iterate over a range/collection to process each item in sequence.
+        bucketStart[b + 1] += bucketStart[b];  // Access or update the bucket storage used to hold entries or chains.
+    }  // Close the current block scope.
+    std::vector<size_t> members(keys_.size());  // Execute this statement as part of the data structure implementation.
+    std::vector<uint64_t> fill(bucketStart.begin(), bucketStart.end() - 1);  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < keys_.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        members[fill[codes[i].bucket]++] = i;  // Access or update the bucket storage used to hold entries or chains.
+    }  // Close the current block scope.
+
+    // 大桶先放（表還空的時候比較容易找到位移）- Largest buckets first (easier while the table is still empty)
+    std::vector<uint64_t> order(buckets);  // Execute this statement as part of the data structure implementation.
+    for (uint64_t b = 0; b < buckets; ++b) {  // Iterate over a range/collection to process each item in sequence.
+        order[b] = b;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    std::stable_sort(order.begin(), order.end(), [&bucketStart](uint64_t a, uint64_t b) {  // Execute this statement as part of the data structure implementation.
+        return bucketStart[a + 1] - bucketStart[a] > bucketStart[b + 1] - bucketStart[b];  // Return the computed result to the caller.
+    });  // Execute this statement as part of the data structure implementation.
+
+    displacement.assign(buckets, 0);  // Assign or update a variable that represents the current algorithm state.
+    slotOwner.assign(slots, SIZE_MAX);  // SIZE_MAX = 空槽位 - SIZE_MAX = free slot
+    const uint64_t maxD0 = std::min<uint64_t>(MAX_D0, UINT32_MAX / slots);  // index = d0 * m + d1 必須放得進 uint32_t - index must fit in uint32_t
+    std::vector<uint64_t> positions;  // Execute this statement as part of the data structure implementation.
+    std::vector<uint64_t> freeSlots;  // 單一 key 桶可用的空槽位 - Free slots left for single-key buckets
+    for (uint64_t b : order) {  // Iterate over a range/collection to process each item in sequence.
+        uint64_t begin = bucketStart[b];  // Assign or update a variable that represents the current algorithm state.
+        uint64_t end = bucketStart[b + 1];  // Assign or update a variable that represents the current algorithm state.
+        if (begin == end) {  // Evaluate the condition and branch into the appropriate code path.
+            break;  // 其後都是空桶 - Only empty buckets remain
+        }  // Close the current block scope.
+        if (end - begin == 1) {  // Evaluate the condition and branch into the appropriate code path.
+            // 單一 key 的桶在 d0 = 0 時可以放進任何空槽位，直接從空槽位清單取用；
+            // 否則從 f1 往後掃就像滿載的線性探測，叢集會讓建置時間暴增
+            // A single-key bucket can reach any free slot with d0 = 0, so take one from the free list;
+            // scanning forward from f1 would behave like linear probing at full load and blow up on clusters
+            if (freeSlots.empty()) {  // 第一個單一 key 桶：收集剩下的空槽位 - First singleton: collect the remaining free slots
+                for (uint64_t slot = 0; slot < slots; ++slot) {  // Iterate over a range/collection to process each item in sequence.
+                    if (slotOwner[slot] == SIZE_MAX) {  // Evaluate the condition and branch into the appropriate code path.
+                        freeSlots.push_back(slot);  // Execute this statement as part of the data structure implementation.
+                    }  // Close the current block scope.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+            uint64_t slot = freeSlots.back();  // Assign or update a variable that represents the current algorithm state.
+            freeSlots.pop_back();  // Execute this statement as part of the data structure implementation.
+            const PerfectHashCodes& code = codes[members[begin]];  // Assign or update a variable that represents the current algorithm state.
+            displacement[b] = static_cast<uint32_t>(slot >= code.f1 ? slot - code.f1 : slot + slots - code.f1);  // d1 = (slot - f1) mod m
+            slotOwner[slot] = members[begin];  // Assign or update a variable that represents the current algorithm state.
+            continue;  // Skip to the next loop iteration.
+        }  // Close the current block scope.
+
+        // 同一桶內 f1、f2 都相同的兩個 key 永遠分不開：重複 key 丟出例外，否則換種子
+        // Two keys sharing bucket, f1 and f2 can never be separated: reject duplicates, otherwise reseed
+        for (uint64_t i = begin; i < end; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            for (uint64_t j = i + 1; j < end; ++j) {  // Iterate over a range/collection to process each item in sequence.
+                const PerfectHashCodes& a = codes[members[i]];  // Assign or update a variable that represents the current algorithm state.
+                const PerfectHashCodes& c = codes[members[j]];  // Assign or update a variable that represents the current algorithm state.
+                if (a.f1 == c.f1 && a.f2 == c.f2) {  // Evaluate the condition and branch into the appropriate code path.
+                    if (keys_[members[i]] == keys_[members[j]]) {  // Evaluate the condition and branch into the appropriate code path.
+                        throw std::invalid_argument("重複的 key / Duplicate key");  // Throw an exception to signal an invalid argument or operation.
+                    }  // Close the current block scope.
+                    return false;  // Return the computed result to the caller.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+
+        // 固定 d0 時，整桶的槽位隨 d1 一起平移：先確認同桶互不重疊，再把 d1 由 0 往上掃，過程不需要除法
+        // For a fixed d0 the whole bucket shifts together with d1: check the slots are distinct once,
+        // then sweep d1 upward without any division
+        bool placed = false;  // Assign or update a variable that represents the current algorithm state.
+        for (uint64_t d0 = 0; d0 <= maxD0 && !placed; ++d0) {  // Iterate over a range/collection to process each item in sequence.
+            positions.clear();  // Execute this statement as part of the data structure implementation.
+            bool distinct = true;  // Assign or update a variable that represents the current algorithm state.
+            for (uint64_t i = begin; i < end; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                const PerfectHashCodes& code = codes[members[i]];  // Assign or update a variable that represents the current algorithm state.
+                uint64_t slot = (code.f1 + d0 * code.f2) % slots;  // Compute a hash-based index so keys map into the table's storage.
+                distinct = distinct && std::find(positions.begin(), positions.end(), slot) == positions.end();  // Assign or update a variable that represents the current algorithm state.
+                positions.push_back(slot);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            if (!distinct) {  // Evaluate the condition and branch into the appropriate code path.
+                continue;  // 這個 d0 讓同桶的 key 相撞 - This d0 makes keys of the bucket collide
+            }  // Close the current block scope.
+            for (uint64_t d1 = 0; d1 < slots && d0 * slots + d1 <= UINT32_MAX; ++d1) {  // Iterate over a range/collection to process each item in sequence.
+                bool free = true;  // Assign or update a variable that represents the current algorithm state.
+                for (uint64_t slot : positions) {  // Iterate over a range/collection to process each item in sequence.
+                    free = free && slotOwner[slot] == SIZE_MAX;  // Assign or update a variable that represents the current algorithm state.
+                }  // Close the current block scope.
+                if (free) {  // Evaluate the condition and branch into the appropriate code path.
+                    displacement[b] = static_cast<uint32_t>(d0 * slots + d1);  // Assign or update a variable that represents the current algorithm state.
+                    for (uint64_t i = begin; i < end; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                        slotOwner[positions[i - begin]] = members[i];  // Assign or update a variable that represents the current algorithm state.
+                    }  // Close the current block scope.
+                    placed = true;  // Assign or update a variable that represents the current algorithm state.
+                    break;  // Exit the loop early because the target condition was met.
+                }  // Close the current block scope.
+                for (uint64_t& slot : positions) {  // d1 加一 - Advance d1 by one
+                    slot = (slot + 1 == slots) ? 0 : slot + 1;  // Assign or update a variable that represents the current algorithm state.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        if (!placed) {  // Evaluate the condition and branch into the appropriate code path.
+            return false;  // 這個種子放不下 - This seed does not work
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    return true;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+PerfectHashBuildStats PerfectHashBuilder<K, V>::writeFile(const std::string& path) const {  // Execute this statement as part of the data structure implementation.
+    PerfectHashBuildStats stats;  // Execute this statement as part of the data structure implementation.
+    if (keys_.size() > UINT32_MAX) {  // 槽位以 32 位元乘法映射 - Slots are mapped with a 32-bit multiply
+        throw std::invalid_argument("key 數過多（上限 2^32 - 1）/ Too many keys (limit 2^32 - 1)");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    stats.keys = keys_.size();  // Assign or update a variable that represents the current algorithm state.
+    stats.buckets = static_cast<size_t>(std::max<uint64_t>(1, (keys_.size() + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET));  // Access or update the bucket storage used to hold entries or chains.
+
+    std::vector<uint32_t> displacement(stats.buckets, 0);  // Execute this statement as part of the data structure implementation.
+    std::vector<size_t> slotOwner;  // Execute this statement as part of the data structure implementation.
+    uint64_t seed = 0x243F6A8885A308D3ULL;  // Assign or update a variable that represents the current algorithm state.
+    bool built = keys_.empty();  // 空集合不需要位移 - An empty set needs no displacements
+    while (!built && stats.attempts < MAX_ATTEMPTS) {  // Repeat while the loop condition remains true.
+        ++stats.attempts;  // Execute this statement as part of the data structure implementation.
+        seed = perfectHashMix(seed + stats.attempts);  // 每次換一個種子 - A fresh seed each attempt
+        built = tryBuild(seed, stats.buckets, displacement, slotOwner);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    if (!built) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法建立完美雜湊 / Failed to build the perfect hash");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    for (uint32_t d : displacement) {  // Iterate over a range/collection to process each item in sequence.
+        stats.maxDisplacement = std::max(stats.maxDisplacement, d);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    // 字串 key 的記錄長度不一，先依槽位順序算出各記錄的起點 - String records vary in length; compute each start in slot order
+    const uint64_t count = keys_.size();  // Assign or update a variable that represents the current algorithm state.
+    std::vector<uint64_t> recordStarts;  // 只在字串 key 時使用 - Used for string keys only
+    uint64_t recordBytes = count * (KeyTraits::SIZE + sizeof(V));  // Assign or update a variable that represents the current algorithm state.
+    if (KeyTraits::KIND == 2) {  // Evaluate the condition and branch into the appropriate code path.
+        recordStarts.push_back(0);  // Execute this statement as part of the data structure implementation.
+        for (uint64_t slot = 0; slot < count; ++slot) {  // Iterate over a range/collection to process each item in sequence.
+            typename KeyTraits::View view(keys_[slotOwner[slot]]);  // Assign or update a variable that represents the current algorithm state.
+            recordStarts.push_back(recordStarts.back() + KeyTraits::size(view) + sizeof(V));  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        recordBytes = recordStarts.back();  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    PerfectHashFileHeader header{};  // Execute this statement as part of the data structure implementation.
+    header.magic = PERFECT_HASH_MAGIC;  // Assign or update a variable that represents the current algorithm state.
+    header.version = PERFECT_HASH_VERSION;  // Assign or update a variable that represents the current algorithm state.
+    header.keyKind = KeyTraits::KIND;  // Assign or update a variable that represents the current algorithm state.
+    header.keySize = KeyTraits::SIZE;  // Assign or update a variable that represents the current algorithm state.
+    header.valueSize = sizeof(V);  // Assign or update a variable that represents the current algorithm state.
+    header.count = count;  // Assign or update a variable that represents the current algorithm state.
+    header.bucketCount = stats.buckets;  // Access or update the bucket storage used to hold entries or chains.
+    header.seed = seed;  // Assign or update a variable that represents the current algorithm state.
+    header.displacementOffset = sizeof(PerfectHashFileHeader);  // Assign or update a variable that represents the current algorithm state.
+    uint64_t afterDisplacement = alignUp(header.displacementOffset + stats.buckets * sizeof(uint32_t), 8);  // Assign or update a variable that represents the current algorithm state.
+    header.offsetTableOffset = (KeyTraits::KIND == 2) ? afterDisplacement : 0;  // Assign or update a variable that represents the current algorithm state.
+    header.recordOffset = afterDisplacement + recordStarts.size() * sizeof(uint64_t);  // Assign or update a variable that represents the current algorithm state.
+    header.fileSize = header.recordOffset + recordBytes;  // Assign or update a variable that represents the current algorithm state.
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);  // Execute this statement as part of the data structure implementation.
+    if (!out) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法寫入檔案 / Cannot write file: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    auto padTo = [&out](uint64_t offset) {  // 以 0 補齊到指定位移 - Zero-pad up to the given offset
+        while (static_cast<uint64_t>(out.tellp()) < offset) {  // Repeat while the loop condition remains true.
+            out.put('\0');  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    };  // Execute this statement as part of the data structure implementation.
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));  // Execute this statement as part of the data structure implementation.
+    out.write(reinterpret_cast<const char*>(displacement.data()), static_cast<std::streamsize>(displacement.size() * sizeof(uint32_t)));  // Execute this statement as part of the data structure implementation.
+    padTo(afterDisplacement);  // Execute this statement as part of the data structure implementation.
+    out.write(reinterpret_cast<const char*>(recordStarts.data()), static_cast<std::streamsize>(recordStarts.size() * sizeof(uint64_t)));  // Execute this statement as part of the data structure implementation.
+    for (uint64_t slot = 0; slot < count; ++slot) {  // 每筆記錄：key 位元組 + value - Each record: key bytes + value
+        typename KeyTraits::View view(keys_[slotOwner[slot]]);  // Assign or update a variable that represents the current algorithm state.
+        out.write(static_cast<const char*>(KeyTraits::data(view)), static_cast<std::streamsize>(KeyTraits::size(view)));  // Execute this statement as part of the data structure implementation.
+        out.write(reinterpret_cast<const char*>(&values_[slotOwner[slot]]), sizeof(V));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    out.flush();  // Execute this statement as part of the data structure implementation.
+    if (!out) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法寫入檔案 / Cannot write file: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    stats.fileBytes = static_cast<size_t>(header.fileSize);  // Assign or update a variable that represents the current algorithm state.
+    return stats;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+MappedPerfectHashTable<K, V>::MappedPerfectHashTable(const std::string& path)  // Execute this statement as part of the data structure implementation.
+    : base_(nullptr), length_(0), header_{}, displacement_(nullptr), offsets_(nullptr), records_(nullptr), recordBytes_(0) {  // Execute this statement as part of the data structure implementation.
+#if PERFECT_HASH_HAS_MMAP  // Evaluate the condition and branch into the appropriate code path.
+    int fd = ::open(path.c_str(), O_RDONLY);  // Assign or update a variable that represents the current algorithm state.
+    if (fd < 0) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法開啟檔案 / Cannot open file: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    struct stat info;  // Execute this statement as part of the data structure implementation.
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(PerfectHashFileHeader))) {  // Evaluate the condition and branch into the appropriate code path.
+        ::close(fd);  // Execute this statement as part of the data structure implementation.
+        throw std::runtime_error("檔案過短 / File too short: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    length_ = static_cast<size_t>(info.st_size);  // Assign or update a variable that represents the current algorithm state.
+    void* mapped = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);  // 只映射，頁面在第一次讀取時才載入 - Map only; pages load on first touch
+    ::close(fd);  // 映射建立後即可關閉 - The mapping outlives the descriptor
+    if (mapped == MAP_FAILED) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("mmap 失敗 / mmap failed: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    base_ = static_cast<const unsigned char*>(mapped);  // Assign or update a variable that represents the current algorithm state.
+#else  // Handle the alternative branch when the condition is false.
+    std::ifstream in(path, std::ios::binary | std::ios::ate);  // Execute this statement as part of the data structure implementation.
+    if (!in) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法開啟檔案 / Cannot open file: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    length_ = static_cast<size_t>(in.tellg());  // Assign or update a variable that represents the current algorithm state.
+    if (length_ < sizeof(PerfectHashFileHeader)) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("檔案過短 / File too short: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    fallback_.resize((length_ + 7) / 8);  // 以 uint64_t 配置，保證 8 位元組對齊 - uint64_t storage keeps 8-byte alignment
+    in.seekg(0);  // Execute this statement as part of the data structure implementation.
+    in.read(reinterpret_cast<char*>(fallback_.data()), static_cast<std::streamsize>(length_));  // Execute this statement as part of the data structure implementation.
+    base_ = reinterpret_cast<const unsigned char*>(fallback_.data());  // Assign or update a variable that represents the current algorithm state.
+#endif  // Execute this statement as part of the data structure implementation.
+    try {  // Execute this statement as part of the data structure implementation.
+        validate();  // Execute this statement as part of the data structure implementation.
+    } catch (...) {  // Execute this statement as part of the data structure implementation.
+#if PERFECT_HASH_HAS_MMAP  // Evaluate the condition and branch into the appropriate code path.
+        ::munmap(const_cast<unsigned char*>(base_), length_);  // 建構失敗時解構子不會執行 - The destructor does not run when construction fails
+#endif  // Execute this statement as part of the data structure implementation.
+        throw;  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+MappedPerfectHashTable<K, V>::~MappedPerfectHashTable() {  // Execute this statement as part of the data structure implementation.
+#if PERFECT_HASH_HAS_MMAP  // Evaluate the condition and branch into the appropriate code path.
+    ::munmap(const_cast<unsigned char*>(base_), length_);  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void MappedPerfectHashTable<K, V>::validate() {  // Execute this statement as part of the data structure implementation.
+    std::memcpy(&header_, base_, sizeof(header_));  // Execute this statement as part of the data structure implementation.
+    if (header_.magic != PERFECT_HASH_MAGIC || header_.version != PERFECT_HASH_VERSION) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("不是完美雜湊檔案或版本不符 / Not a perfect hash file, or wrong version");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    if (header_.keyKind != KeyTraits::KIND || header_.keySize != KeyTraits::SIZE || header_.valueSize != sizeof(V)) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("key / value 型別與檔案不符 / Key or value type does not match the file");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+
+    // 每個區段都必須落在檔案內：先確認位移依序排列且不超過檔案長度，再以減法比較區段大小，任何一步都不會溢位
+    // Every section must lie inside the file: first check that the offsets are ordered and within the
+    // file, then compare section sizes by subtraction, so no step can overflow
+    uint64_t count = header_.count;  // Assign or update a variable that represents the current algorithm state.
+    uint64_t tableBytes = (KeyTraits::KIND == 2) ? (count + 1) * sizeof(uint64_t) : 0;  // Assign or update a variable that represents the current algorithm state.
+    uint64_t nextSection = (KeyTraits::KIND == 2) ? header_.offsetTableOffset : header_.recordOffset;  // 位移表之後的區段 - Section after the displacement table
+    bool ok = header_.fileSize == length_ && header_.bucketCount >= 1 &&  // Execute this statement as part of the data structure implementation.
+              count <= length_ && count <= UINT32_MAX && header_.bucketCount <= length_ &&  // 先擋下會溢位的乘法 - Rules out overflowing products first
+              header_.displacementOffset >= sizeof(PerfectHashFileHeader) && header_.displacementOffset <= length_ &&  // Execute this statement as part of the data structure implementation.
+              header_.recordOffset >= header_.displacementOffset && header_.recordOffset <= length_ &&  // Execute this statement as part of the data structure implementation.
+              nextSection >= header_.displacementOffset && nextSection <= header_.recordOffset &&  // Execute this statement as part of the data structure implementation.
+              header_.bucketCount * sizeof(uint32_t) <= nextSection - header_.displacementOffset &&  // Execute this statement as part of the data structure implementation.
+              header_.offsetTableOffset % 8 == 0 && header_.offsetTableOffset <= length_ &&  // Execute this statement as part of the data structure implementation.
+              (KeyTraits::KIND != 2 || tableBytes <= header_.recordOffset - header_.offsetTableOffset);  // Execute this statement as part of the data structure implementation.
+    if (ok) {  // 記錄區必須剛好延伸到檔案結尾 - The records must end exactly at the end of the file
+        if (KeyTraits::KIND == 2) {  // 最後一個起點就是記錄區長度 - The last start is the record area length
+            std::memcpy(&recordBytes_, base_ + header_.offsetTableOffset + count * sizeof(uint64_t), sizeof(uint64_t));  // Execute this statement as part of the data structure implementation.
+        } else {  // Handle the alternative branch when the condition is false.
+            recordBytes_ = count * (KeyTraits::SIZE + sizeof(V));  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        ok = recordBytes_ == length_ - header_.recordOffset;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    if (!ok) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("檔案內容損毀 / Corrupt perfect hash file");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    displacement_ = base_ + header_.displacementOffset;  // Assign or update a variable that represents the current algorithm state.
+    offsets_ = base_ + header_.offsetTableOffset;  // Assign or update a variable that represents the current algorithm state.
+    records_ = base_ + header_.recordOffset;  // Assign or update a variable that represents the current algorithm state.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+const unsigned char* MappedPerfectHashTable<K, V>::findValue(uint64_t slot, const View& key) const {  // Execute this statement as part of the data structure implementation.
+    if constexpr (KeyTraits::KIND == 2) {  // Evaluate the condition and branch into the appropriate code path.
+        uint64_t range[2];  // [開始, 結束) 位移 - [begin, end) offsets
+        std::memcpy(range, offsets_ + slot * sizeof(uint64_t), sizeof(range));  // Execute this statement as part of the data structure implementation.
+        if (range[0] > range[1] || range[1] > recordBytes_ || range[1] - range[0] != key.size() + sizeof(V)) {  // 開啟時不逐一檢查 offset，這裡擋下越界 - Offsets are not scanned at open; bound them here
+            return nullptr;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        const unsigned char* record = records_ + range[0];  // Assign or update a variable that represents the current algorithm state.
+        return std::memcmp(record, key.data(), key.size()) == 0 ? record + key.size() : nullptr;  // Return the computed result to the caller.
+    } else {  // Handle the alternative branch when the condition is false.
+        const unsigned char* record = records_ + slot * (sizeof(K) + sizeof(V));  // Assign or update a variable that represents the current algorithm state.
+        return std::memcmp(record, &key, sizeof(K)) == 0 ? record + sizeof(K) : nullptr;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+std::optional<V> MappedPerfectHashTable<K, V>::search(const View& key) const {  // Execute this statement as part of the data structure implementation.
+    if (header_.count == 0) {  // Evaluate the condition and branch into the appropriate code path.
+        return std::nullopt;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    uint64_t h = perfectHashBytes(KeyTraits::data(key), KeyTraits::size(key), header_.seed);  // Compute a hash-based index so keys map into the table's storage.
+    PerfectHashCodes codes = perfectHashCodes(h, header_.bucketCount, header_.count);  // Compute a hash-based index so keys map into the table's storage.
+    uint32_t index;  // Execute this statement as part of the data structure implementation.
+    std::memcpy(&index, displacement_ + codes.bucket * sizeof(uint32_t), sizeof(index));  // Execute this statement as part of the data structure implementation.
+    const unsigned char* found = findValue(perfectHashSlot(codes, index, header_.count), key);  // Compute a hash-based index so keys map into the table's storage.
+    if (found == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+        return std::nullopt;  // 不在集合中 - Not in the set
+    }  // Close the current block scope.
+    V value;  // Execute this statement as part of the data structure implementation.
+    std::memcpy(&value, found, sizeof(V));  // 記錄不一定對齊，以 memcpy 讀取 - Records are not necessarily aligned
+    return value;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+#endif // PERFECT_HASH_HPP
@@ -0,0 +1,207 @@
+/** Doc block start
+ * 帶種子的雜湊（防禦雜湊洪水攻擊）- C++ 實作
+ * 每個雜湊表在建構時取得自己的隨機種子：字串 key 以 SipHash-1-3 計算，其他 key 以
+ * std::hash 的結果混入種子後再經 fmix64。攻擊者不知道種子，就無法預先算出一批全部落在同一桶的 key。
+ *(blank line)
+ * Seeded hashing (hash-flooding defense).
+ * Every hash table draws its own random seed at construction: string keys are hashed with
+ * SipHash-1-3, other keys have the seed folded into their std::hash value before fmix64. An
+ * attacker who does not know the seed cannot precompute a key set that lands in one bucket.
+ *(blank line)
+ * 全為 0 的種子（HashSeed{}）對非字串 key 重現加入種子之前的雜湊值，供測試與量測重現固定的桶配置。
+ * An all-zero seed (HashSeed{}) reproduces the pre-seeding hash for non-string keys, so tests and
+ * benchmarks can pin the bucket layout.
+ */  // End of block comment
+
+#ifndef SEEDED_HASH_HPP  // Execute this statement as part of the data structure implementation.
+#define SEEDED_HASH_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <atomic>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstddef>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <cstring>  // Execute this statement as part of the data structure implementation.
+#include <functional>  // Execute this statement as part of the data structure implementation.
+#include <random>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <string_view>  // Execute this statement as part of the data structure implementation.
+#include <type_traits>  // Execute this statement as part of the data structure implementation.
+#include <utility>  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * murmur3 的 64 位元最終混合（雙射）/ murmur3's 64-bit finalizer (a bijection)
+ */  // End of block comment
+inline uint64_t fmix64(uint64_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 33;  // Assign or update a variable that represents the current algorithm state.
+    x *= 0xff51afd7ed558ccdULL;  // Assign or update a variable that represents the current algorithm state.
+    x ^= x >> 33;  // Assign or update a variable that represents the current algorithm state.
+    x *= 0xc4ceb9fe1a85ec53ULL;  // Assign or update a variable that represents the current algorithm state.
+    x ^= x >> 33;  // Assign or update a variable that represents the current algorithm state.
+    return x;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 雜湊種子：SipHash 的 128 位元金鑰 / Hash seed: the 128-bit SipHash key
+ */  // End of block comment
+struct HashSeed {  // Execute this statement as part of the data structure implementation.
+    uint64_t k0 = 0;  // Assign or update a variable that represents the current algorithm state.
+    uint64_t k1 = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    /** Doc block start
+     * 每次呼叫回傳不同的種子：行程啟動時以 std::random_device 與時鐘取一次基底，
+     * 之後以計數器經 splitmix64 展開，建表不必每次都做系統呼叫。
+     * Returns a different seed on every call: a per-process base is drawn once from
+     * std::random_device and the clock, then a counter is expanded with splitmix64, so building a
+     * table never costs a system call.
+     */  // End of block comment
+    static HashSeed random() {  // Execute this statement as part of the data structure implementation.
+        static const uint64_t base = [] {  // Assign or update a variable that represents the current algorithm state.
+            std::random_device device;  // Execute this statement as part of the data structure implementation.
+            uint64_t entropy = (static_cast<uint64_t>(device()) << 32) ^ device();  // Assign or update a variable that represents the current algorithm state.
+            return entropy ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());  // Return the computed result to the caller.
+        }();  // Execute this statement as part of the data structure implementation.
+        static std::atomic<uint64_t> counter{0};  // Assign or update a variable that represents the current algorithm state.
+        uint64_t n = counter.fetch_add(2, std::memory_order_relaxed);  // Assign or update a variable that represents the current algorithm state.
+        return HashSeed{splitmix64(base + n * 0x9e3779b97f4a7c15ULL),  // Return the computed result to the caller.
+                        splitmix64(base + (n + 1) * 0x9e3779b97f4a7c15ULL)};  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 由一個 64 位元整數展開成固定種子（可重現）/ Expand a 64-bit value into a fixed, reproducible seed
+     */  // End of block comment
+    static HashSeed fromValue(uint64_t value) {  // Execute this statement as part of the data structure implementation.
+        return HashSeed{splitmix64(value), splitmix64(value ^ 0x6a09e667f3bcc909ULL)};  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    bool operator==(const HashSeed& other) const { return k0 == other.k0 && k1 == other.k1; }  // Return the computed result to the caller.
+    bool operator!=(const HashSeed& other) const { return !(*this == other); }  // Return the computed result to the caller.
+
+private:  // Execute this statement as part of the data structure implementation.
+    static uint64_t splitmix64(uint64_t x) {  // Execute this statement as part of the data structure implementation.
+        x += 0x9e3779b97f4a7c15ULL;  // Assign or update a variable that represents the current algorithm state.
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;  // Assign or update a variable that represents the current algorithm state.
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;  // Assign or update a variable that represents the current algorithm state.
+        return x ^ (x >> 31);  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 以小端序讀取 8 個位元組；小端平台上就是一次 memcpy 載入
+ * Read 8 bytes as little-endian; on little-endian hosts this is a single memcpy load
+ */  // End of block comment
+inline uint64_t loadLittleEndian64(const unsigned char* p) {  // Execute this statement as part of the data structure implementation.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__  // Evaluate the condition and branch into the appropriate code path.
+    uint64_t value;  // Assign or update a variable that represents the current algorithm state.
+    std::memcpy(&value, p, sizeof(value));  // Execute this statement as part of the data structure implementation.
+    return value;  // Return the computed result to the caller.
+#else  // Handle the alternative branch when the condition is false.
+    uint64_t value = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (int b = 7; b >= 0; --b) {  // Iterate over a range/collection to process each item in sequence.
+        value = (value << 8) | p[b];  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    return value;  // Return the computed result to the caller.
+#endif  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+/** Doc block start
+ * SipHash-c-d（Aumasson & Bernstein）：以 128 位元金鑰為參數的偽隨機函數。
+ * 雜湊表用 c = 1、d = 3（與 Rust 的 HashMap 相同）；c = 2、d = 4 是原論文的版本，測試用它比對官方測試向量。
+ * 區塊以小端序讀取，結果與平台無關。
+ * SipHash-c-d (Aumasson & Bernstein): a pseudo-random function keyed by 128 bits. Tables use
+ * c = 1, d = 3 (as Rust's HashMap does); c = 2, d = 4 is the paper's variant and the tests check it
+ * against the official test vector. Blocks are read little-endian, so results are platform independent.
+ */  // End of block comment
+template <int C, int D>  // Execute this statement as part of the data structure implementation.
+uint64_t sipHash(const void* data, size_t length, const HashSeed& seed) {  // Compute a hash-based index so keys map into the table's storage.
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);  // Assign or update a variable that represents the current algorithm state.
+    uint64_t v0 = seed.k0 ^ 0x736f6d6570736575ULL;  // Assign or update a variable that represents the current algorithm state.
+    uint64_t v1 = seed.k1 ^ 0x646f72616e646f6dULL;  // Assign or update a variable that represents the current algorithm state.
+    uint64_t v2 = seed.k0 ^ 0x6c7967656e657261ULL;  // Assign or update a variable that represents the current algorithm state.
+    uint64_t v3 = seed.k1 ^ 0x7465646279746573ULL;  // Assign or update a variable that represents the current algorithm state.
+
+    auto rotl = [](uint64_t x, int b) { return (x << b) | (x >> (64 - b)); };  // Assign or update a variable that represents the current algorithm state.
+    auto round = [&]() {  // 一輪 SipRound - One SipRound
+        v0 += v1; v1 = rotl(v1, 13); v1 ^= v0; v0 = rotl(v0, 32);  // Assign or update a variable that represents the current algorithm state.
+        v2 += v3; v3 = rotl(v3, 16); v3 ^= v2;  // Assign or update a variable that represents the current algorithm state.
+        v0 += v3; v3 = rotl(v3, 21); v3 ^= v0;  // Assign or update a variable that represents the current algorithm state.
+        v2 += v1; v1 = rotl(v1, 17); v1 ^= v2; v2 = rotl(v2, 32);  // Assign or update a variable that represents the current algorithm state.
+    };  // Execute this statement as part of the data structure implementation.
+    auto compress = [&](uint64_t m) {  // Execute this statement as part of the data structure implementation.
+        v3 ^= m;  // Assign or update a variable that represents the current algorithm state.
+        for (int i = 0; i < C; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            round();  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        v0 ^= m;  // Assign or update a variable that represents the current algorithm state.
+    };  // Execute this statement as part of the data structure implementation.
+
+    size_t whole = length & ~size_t{7};  // 完整的 8 位元組區塊 - Full 8-byte blocks
+    for (size_t i = 0; i < whole; i += 8) {  // Iterate over a range/collection to process each item in sequence.
+        compress(loadLittleEndian64(bytes + i));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    uint64_t last = static_cast<uint64_t>(length) << 56;  // 最後一塊：長度放最高位元組 - Last block: length in the top byte
+    for (size_t b = length - whole; b > 0; --b) {  // Iterate over a range/collection to process each item in sequence.
+        last |= static_cast<uint64_t>(bytes[whole + b - 1]) << (8 * (b - 1));  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    compress(last);  // Execute this statement as part of the data structure implementation.
+
+    v2 ^= 0xff;  // Assign or update a variable that represents the current algorithm state.
+    for (int i = 0; i < D; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        round();  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return v0 ^ v1 ^ v2 ^ v3;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+inline uint64_t sipHash13(const void* data, size_t length, const HashSeed& seed) {  // Compute a hash-based index so keys map into the table's storage.
+    return sipHash<1, 3>(data, length, seed);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 雜湊表使用的雜湊函數：預設等同 std::hash<K>，種子由 seededHash 在外層混入
+ * Hash functor used by the tables: std::hash<K> by default; seededHash folds the seed in around it
+ */  // End of block comment
+template <typename K>  // Execute this statement as part of the data structure implementation.
+struct HashTableHasher : std::hash<K> {};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * std::string 的透明雜湊：std::string_view 與 const char* 可直接查詢，不必先建出 std::string。
+ * 帶種子的版本對位元組做 SipHash-1-3，所以 string、string_view、const char* 得到相同的值。
+ * Transparent hash for std::string: std::string_view and const char* probe without building a
+ * std::string. The seeded overload runs SipHash-1-3 over the bytes, so all three agree.
+ */  // End of block comment
+template <>  // Execute this statement as part of the data structure implementation.
+struct HashTableHasher<std::string> {  // Execute this statement as part of the data structure implementation.
+    using is_transparent = void;  // Assign or update a variable that represents the current algorithm state.
+    size_t operator()(std::string_view key) const noexcept {  // Compute a hash-based index so keys map into the table's storage.
+        return std::hash<std::string_view>{}(key);  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    size_t operator()(std::string_view key, const HashSeed& seed) const noexcept {  // Compute a hash-based index so keys map into the table's storage.
+        return static_cast<size_t>(sipHash13(key.data(), key.size(), seed));  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+
+// 雜湊函數是否自己處理種子 - Whether a hash functor takes the seed itself
+template <typename H, typename Q, typename = void>  // Execute this statement as part of the data structure implementation.
+struct HasSeededCall : std::false_type {};  // Execute this statement as part of the data structure implementation.
+template <typename H, typename Q>  // Execute this statement as part of the data structure implementation.
+struct HasSeededCall<H, Q, std::void_t<decltype(std::declval<const H&>()(std::declval<const Q&>(), std::declval<const HashSeed&>()))>>  // Execute this statement as part of the data structure implementation.
+    : std::true_type {};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 完整的帶種子雜湊值。雜湊函數有 (key, seed) 多載時交給它（字串走 SipHash），否則把 k0 混入
+ * std::hash 的結果再經 fmix64：整數的恆等雜湊因此在低位元也分布均勻，而且不知道種子就無法反推出碰撞的 key。
+ * 後者不是密碼學等級的偽隨機函數；ChainedHashTable 的樹化是最後一道防線。
+ * The full seeded hash. If the functor has a (key, seed) overload it does the work (SipHash for
+ * strings); otherwise k0 is folded into the std::hash value before fmix64, which spreads identity
+ * hashes into the low bits and cannot be inverted into colliding keys without the seed. The latter
+ * is not a cryptographic PRF; ChainedHashTable's treeification is the backstop.
+ */  // End of block comment
+template <typename H, typename Q>  // Execute this statement as part of the data structure implementation.
+size_t seededHash(const H& hasher, const Q& key, const HashSeed& seed) {  // Compute a hash-based index so keys map into the table's storage.
+    if constexpr (HasSeededCall<H, Q>::value) {  // Evaluate the condition and branch into the appropriate code path.
+        return hasher(key, seed);  // Return the computed result to the caller.
+    } else {  // Handle the alternative branch when the condition is false.
+        return static_cast<size_t>(fmix64(static_cast<uint64_t>(hasher(key)) ^ seed.k0));  // Return the computed result to the caller.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+#endif // SEEDED_HASH_HPP
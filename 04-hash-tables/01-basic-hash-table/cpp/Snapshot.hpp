@@ -0,0 +1,491 @@
+/** Doc block start
+ * 雜湊表快照（二進位存檔與載入）- C++ 實作
+ * 把任何提供 forEach / reserve / insert 的表（HashTable、ChainedHashTable、OpenAddressingHashTable）
+ * 串流寫成緊湊的二進位檔，重新啟動時直接載回，不必重新匯入原始資料。
+ *(blank line)
+ * Hash table snapshots (binary save and load).
+ * Streams any table offering forEach / reserve / insert (HashTable, ChainedHashTable,
+ * OpenAddressingHashTable) into a compact binary file, so a restart can load it back instead of
+ * re-ingesting the original data.
+ *(blank line)
+ * 檔案格式（皆為本機位元組序）File layout (native byte order):
+ *   SnapshotHeader                              magic、版本、key / value 的固定大小（0 = 變長）、筆數
+ *   每筆 entry: uint32_t keyLength, key 位元組, uint32_t valueLength, value 位元組
+ *   SnapshotTrailer                             資料區長度與校驗和 - Payload length and checksum
+ */  // End of block comment
+
+#ifndef SNAPSHOT_HPP  // Execute this statement as part of the data structure implementation.
+#define SNAPSHOT_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <cstring>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <fstream>  // Execute this statement as part of the data structure implementation.
+#include <stdexcept>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <type_traits>  // Execute this statement as part of the data structure implementation.
+#include <utility>  // Execute this statement as part of the data structure implementation.
+
+#if defined(__unix__) || defined(__APPLE__)  // Evaluate the condition and branch into the appropriate code path.
+#include <fcntl.h>  // Execute this statement as part of the data structure implementation.
+#include <sys/mman.h>  // Execute this statement as part of the data structure implementation.
+#include <sys/stat.h>  // Execute this statement as part of the data structure implementation.
+#include <unistd.h>  // Execute this statement as part of the data structure implementation.
+#define SNAPSHOT_HAS_MMAP 1  // Execute this statement as part of the data structure implementation.
+#else  // Handle the alternative branch when the condition is false.
+#define SNAPSHOT_HAS_MMAP 0  // 沒有 mmap 時整個檔案讀進記憶體 - Without mmap the whole file is read into memory
+#endif  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 檔案標頭（32 位元組）/ File header (32 bytes)
+ */  // End of block comment
+struct SnapshotHeader {  // Execute this statement as part of the data structure implementation.
+    uint32_t magic;      // SNAPSHOT_MAGIC，也用來偵測位元組序不符 - Also detects a byte-order mismatch
+    uint32_t version;    // 格式版本 - Format version
+    uint32_t keySize;    // 固定大小 key 的 sizeof，變長為 0 - sizeof(K) for fixed-size keys, 0 for variable length
+    uint32_t valueSize;  // 同上，對 value - The same, for values
+    uint64_t count;      // 筆數，載入時用來預先擴容 - Entry count, used to presize the table on load
+    uint64_t reserved;   // 保留，寫入 0 - Reserved, written as 0
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 檔案結尾（16 位元組）：寫到最後才知道的資訊，放在結尾讓寫入端不必回頭修改
+ * File trailer (16 bytes): values only known at the end, so the writer never seeks back
+ */  // End of block comment
+struct SnapshotTrailer {  // Execute this statement as part of the data structure implementation.
+    uint64_t payloadBytes;  // 標頭與結尾之間的位元組數 - Bytes between the header and the trailer
+    uint64_t checksum;      // 資料區的 SnapshotChecksum - SnapshotChecksum of the payload
+};  // Execute this statement as part of the data structure implementation.
+
+static_assert(sizeof(SnapshotHeader) == 32 && sizeof(SnapshotTrailer) == 16, "snapshot layout must not depend on the compiler");  // Execute this statement as part of the data structure implementation.
+
+constexpr uint32_t SNAPSHOT_MAGIC = 0x31534854u;  // 檔案開頭的 "THS1" - "THS1" at the start of the file
+constexpr uint32_t SNAPSHOT_VERSION = 1;  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 欄位編碼：可直接複製位元組的型別存原始位元組（固定大小），std::string 存字元（變長）
+ * Field encoding: trivially copyable types are stored as raw bytes (fixed size),
+ * std::string as its characters (variable length)
+ */  // End of block comment
+template <typename T, typename = void>  // Execute this statement as part of the data structure implementation.
+struct SnapshotCodec {  // Execute this statement as part of the data structure implementation.
+    static_assert(sizeof(T) == 0, "Snapshot fields must be std::string or trivially copyable");  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+template <typename T>  // Execute this statement as part of the data structure implementation.
+struct SnapshotCodec<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> {  // Execute this statement as part of the data structure implementation.
+    static constexpr uint32_t FIXED_SIZE = sizeof(T);  // Execute this statement as part of the data structure implementation.
+    static const void* data(const T& value) { return &value; }  // Return the computed result to the caller.
+    static size_t size(const T&) { return sizeof(T); }  // Return the computed result to the caller.
+    static T decode(const unsigned char* bytes, size_t) {  // Execute this statement as part of the data structure implementation.
+        T value;  // Execute this statement as part of the data structure implementation.
+        std::memcpy(&value, bytes, sizeof(T));  // 檔案中的欄位不一定對齊 - Fields in the file are not necessarily aligned
+        return value;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+
+template <>  // Execute this statement as part of the data structure implementation.
+struct SnapshotCodec<std::string> {  // Execute this statement as part of the data structure implementation.
+    static constexpr uint32_t FIXED_SIZE = 0;  // Execute this statement as part of the data structure implementation.
+    static const void* data(const std::string& value) { return value.data(); }  // Return the computed result to the caller.
+    static size_t size(const std::string& value) { return value.size(); }  // Return the computed result to the caller.
+    static std::string decode(const unsigned char* bytes, size_t length) {  // Execute this statement as part of the data structure implementation.
+        return std::string(reinterpret_cast<const char*>(bytes), length);  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 可分段更新的 64 位元校驗和：四條獨立的乘法-旋轉通道，每次吃 32 位元組，
+ * 逐位元組的 FNV 只有約 1 GB/s，會變成存檔的瓶頸。用來偵測截斷與損毀，不防惡意竄改。
+ * Incremental 64-bit checksum: four independent multiply-rotate lanes consuming 32 bytes at a time;
+ * byte-wise FNV manages about 1 GB/s and would bottleneck saving. It detects truncation and corruption,
+ * not deliberate tampering.
+ */  // End of block comment
+class SnapshotChecksum {  // Execute this statement as part of the data structure implementation.
+public:  // Execute this statement as part of the data structure implementation.
+    void update(const void* data, size_t length);  // Execute this statement as part of the data structure implementation.
+
+    uint64_t digest() const;  // Execute this statement as part of the data structure implementation.
+
+private:  // Execute this statement as part of the data structure implementation.
+    static constexpr size_t BLOCK = 32;  // Execute this statement as part of the data structure implementation.
+    static constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;  // Execute this statement as part of the data structure implementation.
+    static constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;  // Execute this statement as part of the data structure implementation.
+
+    uint64_t lanes_[4] = {PRIME1, PRIME2, 0x165667B19E3779F9ULL, 0x27D4EB2F165667C5ULL};  // Execute this statement as part of the data structure implementation.
+    unsigned char pending_[BLOCK] = {};  // 還湊不滿一個區塊的位元組 - Bytes that do not yet fill a block
+    size_t pendingBytes_ = 0;  // Execute this statement as part of the data structure implementation.
+    uint64_t totalBytes_ = 0;  // Execute this statement as part of the data structure implementation.
+
+    static uint64_t round(uint64_t lane, uint64_t word) {  // Execute this statement as part of the data structure implementation.
+        lane += word * PRIME2;  // Assign or update a variable that represents the current algorithm state.
+        lane = (lane << 31) | (lane >> 33);  // Assign or update a variable that represents the current algorithm state.
+        return lane * PRIME1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    void consumeBlock(const unsigned char* block);  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 存檔與載入的統計 / Save and load statistics
+ */  // End of block comment
+struct SnapshotStats {  // Execute this statement as part of the data structure implementation.
+    size_t entries = 0;  // 筆數 - Entries
+    uint64_t fileBytes = 0;  // 檔案大小 - File size
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 串流存檔：以 forEach 走訪並寫進固定大小的緩衝區，滿了才寫出，記憶體用量與表的大小無關
+ * Streaming save: walks the table with forEach into a fixed-size buffer that is written out when full,
+ * so memory use does not depend on the table size
+ *(blank line)
+ * @throws std::runtime_error 若檔案無法寫入，或單一欄位超過 4 GiB
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+SnapshotStats saveSnapshot(const Table& table, const std::string& path);  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 串流載入到一個空表：先依標頭的筆數 reserve，之後插入不會再觸發擴容；
+ * 最後比對校驗和，失敗時清空表並丟出例外
+ * Streaming load into an empty table: reserve from the header's count first so no insert rehashes;
+ * the checksum is compared at the end, and on failure the table is cleared before throwing
+ *(blank line)
+ * @throws std::invalid_argument 若目標表不是空的
+ * @throws std::runtime_error 檔案無法開啟、格式錯誤、型別不符或校驗和不符
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+SnapshotStats loadSnapshot(const std::string& path, Table& table);  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 以 mmap 載入（僅限可直接複製位元組的 key 與 value）：映射後先驗證整個資料區的校驗和，
+ * 再直接從映射的記憶體複製欄位插入，不經過 iostream 的緩衝；任何錯誤都不會留下部分內容
+ * mmap-backed load (trivially copyable keys and values only): verifies the whole payload's checksum
+ * after mapping, then inserts fields copied straight from the mapping without iostream buffering;
+ * an error never leaves partial contents behind
+ *(blank line)
+ * @throws std::invalid_argument 若目標表不是空的
+ * @throws std::runtime_error 檔案無法開啟、格式錯誤、型別不符或校驗和不符
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+SnapshotStats loadSnapshotMapped(const std::string& path, Table& table);  // Execute this statement as part of the data structure implementation.
+
+// ============================================================
+// 實作部分 Implementation
+// ============================================================
+
+inline void SnapshotChecksum::consumeBlock(const unsigned char* block) {  // Execute this statement as part of the data structure implementation.
+    for (size_t lane = 0; lane < 4; ++lane) {  // Iterate over a range/collection to process each item in sequence.
+        uint64_t word;  // Execute this statement as part of the data structure implementation.
+        std::memcpy(&word, block + lane * 8, 8);  // Execute this statement as part of the data structure implementation.
+        lanes_[lane] = round(lanes_[lane], word);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+inline void SnapshotChecksum::update(const void* data, size_t length) {  // Execute this statement as part of the data structure implementation.
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);  // Assign or update a variable that represents the current algorithm state.
+    totalBytes_ += length;  // Assign or update a variable that represents the current algorithm state.
+    if (pendingBytes_ > 0) {  // 先補滿上次剩下的區塊 - Top up the block left over from last time
+        size_t take = std::min(length, BLOCK - pendingBytes_);  // Assign or update a variable that represents the current algorithm state.
+        std::memcpy(pending_ + pendingBytes_, bytes, take);  // Execute this statement as part of the data structure implementation.
+        pendingBytes_ += take;  // Assign or update a variable that represents the current algorithm state.
+        bytes += take;  // Assign or update a variable that represents the current algorithm state.
+        length -= take;  // Assign or update a variable that represents the current algorithm state.
+        if (pendingBytes_ < BLOCK) {  // Evaluate the condition and branch into the appropriate code path.
+            return;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        consumeBlock(pending_);  // Execute this statement as part of the data structure implementation.
+        pendingBytes_ = 0;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    while (length >= BLOCK) {  // Repeat while the loop condition remains true.
+        consumeBlock(bytes);  // Execute this statement as part of the data structure implementation.
+        bytes += BLOCK;  // Assign or update a variable that represents the current algorithm state.
+        length -= BLOCK;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    std::memcpy(pending_, bytes, length);  // Execute this statement as part of the data structure implementation.
+    pendingBytes_ = length;  // Assign or update a variable that represents the current algorithm state.
+}  // Close the current block scope.
+
+inline uint64_t SnapshotChecksum::digest() const {  // Execute this statement as part of the data structure implementation.
+    uint64_t h = totalBytes_ * PRIME1;  // 長度也算進去，截斷後補 0 不會碰巧相同 - Length is mixed in, so zero padding cannot collide
+    for (size_t lane = 0; lane < 4; ++lane) {  // Iterate over a range/collection to process each item in sequence.
+        h = round(h ^ lanes_[lane], lane + 1);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    for (size_t i = 0; i < pendingBytes_; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        h = round(h, pending_[i]);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    h ^= h >> 33;  // Execute this statement as part of the data structure implementation.
+    h *= 0xff51afd7ed558ccdULL;  // Execute this statement as part of the data structure implementation.
+    h ^= h >> 33;  // Execute this statement as part of the data structure implementation.
+    return h;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 表若有右值 key 的 try_emplace（HashTable），載入的字串直接搬入，否則呼叫 insert(key, value)
+ * Tables with an rvalue-key try_emplace (HashTable) take the decoded strings by move;
+ * others get insert(key, value)
+ */  // End of block comment
+template <typename Table, typename = void>  // Execute this statement as part of the data structure implementation.
+struct SnapshotHasTryEmplace : std::false_type {};  // Execute this statement as part of the data structure implementation.
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+struct SnapshotHasTryEmplace<Table, std::void_t<decltype(std::declval<Table&>().try_emplace(  // Execute this statement as part of the data structure implementation.
+    std::declval<typename Table::KeyType&&>(), std::declval<typename Table::ValueType&&>()))>> : std::true_type {};  // Execute this statement as part of the data structure implementation.
+
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+void snapshotInsert(Table& table, typename Table::KeyType&& key, typename Table::ValueType&& value) {  // Execute this statement as part of the data structure implementation.
+    if constexpr (SnapshotHasTryEmplace<Table>::value) {  // Evaluate the condition and branch into the appropriate code path.
+        table.try_emplace(std::move(key), std::move(value));  // Execute this statement as part of the data structure implementation.
+    } else {  // Handle the alternative branch when the condition is false.
+        table.insert(key, value);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+SnapshotStats saveSnapshot(const Table& table, const std::string& path) {  // Execute this statement as part of the data structure implementation.
+    using K = typename Table::KeyType;  // Execute this statement as part of the data structure implementation.
+    using V = typename Table::ValueType;  // Execute this statement as part of the data structure implementation.
+    constexpr size_t BUFFER_BYTES = size_t{1} << 20;  // 1 MiB 寫入緩衝區 - 1 MiB write buffer
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);  // Execute this statement as part of the data structure implementation.
+    if (!out) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法寫入檔案 / Cannot write file: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    SnapshotHeader header{};  // Execute this statement as part of the data structure implementation.
+    header.magic = SNAPSHOT_MAGIC;  // Assign or update a variable that represents the current algorithm state.
+    header.version = SNAPSHOT_VERSION;  // Assign or update a variable that represents the current algorithm state.
+    header.keySize = SnapshotCodec<K>::FIXED_SIZE;  // Assign or update a variable that represents the current algorithm state.
+    header.valueSize = SnapshotCodec<V>::FIXED_SIZE;  // Assign or update a variable that represents the current algorithm state.
+    header.count = table.size();  // Assign or update a variable that represents the current algorithm state.
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));  // Execute this statement as part of the data structure implementation.
+
+    std::vector<unsigned char> buffer(BUFFER_BYTES);  // Execute this statement as part of the data structure implementation.
+    size_t used = 0;  // Assign or update a variable that represents the current algorithm state.
+    SnapshotChecksum checksum;  // Execute this statement as part of the data structure implementation.
+    SnapshotTrailer trailer{};  // Execute this statement as part of the data structure implementation.
+    auto emit = [&](const void* data, size_t length) {  // 放進緩衝區；放不下就先寫出 - Buffer it; flush first when it does not fit
+        if (used + length > buffer.size()) {  // Evaluate the condition and branch into the appropriate code path.
+            checksum.update(buffer.data(), used);  // Execute this statement as part of the data structure implementation.
+            out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(used));  // Execute this statement as part of the data structure implementation.
+            used = 0;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        if (length > buffer.size()) {  // 比緩衝區還大的欄位直接寫出 - Fields larger than the buffer go straight out
+            checksum.update(data, length);  // Execute this statement as part of the data structure implementation.
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(length));  // Execute this statement as part of the data structure implementation.
+        } else {  // Handle the alternative branch when the condition is false.
+            std::memcpy(buffer.data() + used, data, length);  // Execute this statement as part of the data structure implementation.
+            used += length;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        trailer.payloadBytes += length;  // Assign or update a variable that represents the current algorithm state.
+    };  // Execute this statement as part of the data structure implementation.
+    auto emitField = [&emit, &path](const void* data, size_t length) {  // 長度前綴 + 內容 - Length prefix + contents
+        if (length > UINT32_MAX) {  // Evaluate the condition and branch into the appropriate code path.
+            throw std::runtime_error("欄位超過 4 GiB / Field larger than 4 GiB: " + path);  // Throw an exception to signal an invalid argument or operation.
+        }  // Close the current block scope.
+        uint32_t prefix = static_cast<uint32_t>(length);  // Assign or update a variable that represents the current algorithm state.
+        emit(&prefix, sizeof(prefix));  // Execute this statement as part of the data structure implementation.
+        emit(data, length);  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+    table.forEach([&emitField](const K& key, const V& value) {  // Iterate over a range/collection to process each item in sequence.
+        emitField(SnapshotCodec<K>::data(key), SnapshotCodec<K>::size(key));  // Execute this statement as part of the data structure implementation.
+        emitField(SnapshotCodec<V>::data(value), SnapshotCodec<V>::size(value));  // Execute this statement as part of the data structure implementation.
+    });  // Execute this statement as part of the data structure implementation.
+    checksum.update(buffer.data(), used);  // Execute this statement as part of the data structure implementation.
+    out.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(used));  // Execute this statement as part of the data structure implementation.
+    trailer.checksum = checksum.digest();  // Assign or update a variable that represents the current algorithm state.
+    out.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));  // Execute this statement as part of the data structure implementation.
+    out.flush();  // Execute this statement as part of the data structure implementation.
+    if (!out) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法寫入檔案 / Cannot write file: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    return SnapshotStats{static_cast<size_t>(header.count), sizeof(header) + trailer.payloadBytes + sizeof(trailer)};  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 檢查標頭是否屬於這個表的 key / value 型別 / Check that the header matches the table's key and value types
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+void validateSnapshotHeader(const SnapshotHeader& header, uint64_t payloadBytes) {  // Execute this statement as part of the data structure implementation.
+    if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("不是快照檔案或版本不符 / Not a snapshot file, or wrong version");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    if (header.keySize != SnapshotCodec<typename Table::KeyType>::FIXED_SIZE ||  // Evaluate the condition and branch into the appropriate code path.
+        header.valueSize != SnapshotCodec<typename Table::ValueType>::FIXED_SIZE) {  // Execute this statement as part of the data structure implementation.
+        throw std::runtime_error("key / value 型別與檔案不符 / Key or value type does not match the file");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    if (header.count > payloadBytes / (2 * sizeof(uint32_t))) {  // 每筆至少有兩個長度前綴 - Every entry has at least two length prefixes
+        throw std::runtime_error("快照檔案損毀 / Corrupt snapshot file");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+SnapshotStats loadSnapshot(const std::string& path, Table& table) {  // Execute this statement as part of the data structure implementation.
+    using K = typename Table::KeyType;  // Execute this statement as part of the data structure implementation.
+    using V = typename Table::ValueType;  // Execute this statement as part of the data structure implementation.
+    constexpr size_t BUFFER_BYTES = size_t{1} << 20;  // 1 MiB 讀取緩衝區 - 1 MiB read buffer
+    if (!table.empty()) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::invalid_argument("載入目標必須是空表 / Snapshots load into an empty table");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);  // Execute this statement as part of the data structure implementation.
+    if (!in) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法開啟檔案 / Cannot open file: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    uint64_t fileBytes = static_cast<uint64_t>(in.tellg());  // Assign or update a variable that represents the current algorithm state.
+    if (fileBytes < sizeof(SnapshotHeader) + sizeof(SnapshotTrailer)) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("檔案過短 / File too short: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    uint64_t payloadBytes = fileBytes - sizeof(SnapshotHeader) - sizeof(SnapshotTrailer);  // Assign or update a variable that represents the current algorithm state.
+    SnapshotHeader header;  // Execute this statement as part of the data structure implementation.
+    in.seekg(0);  // Execute this statement as part of the data structure implementation.
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));  // Execute this statement as part of the data structure implementation.
+    validateSnapshotHeader<Table>(header, payloadBytes);  // Execute this statement as part of the data structure implementation.
+    table.reserve(static_cast<size_t>(header.count));  // 一次擴到位，載入期間不再 rehash - Grow once; no rehash while loading
+
+    // 緩衝區 [begin, end) 是已讀入、尚未解析的位元組；欄位跨越緩衝區邊界時把剩餘部分搬到開頭再補讀
+    // Buffer [begin, end) holds bytes read but not yet parsed; a field crossing the end is moved
+    // to the front before reading more
+    std::vector<unsigned char> buffer(BUFFER_BYTES);  // Execute this statement as part of the data structure implementation.
+    size_t begin = 0;  // Assign or update a variable that represents the current algorithm state.
+    size_t end = 0;  // Assign or update a variable that represents the current algorithm state.
+    uint64_t unread = payloadBytes;  // Assign or update a variable that represents the current algorithm state.
+    SnapshotChecksum checksum;  // Execute this statement as part of the data structure implementation.
+    auto take = [&](size_t length) -> const unsigned char* {  // 確保緩衝區內有 length 個位元組 - Ensure length bytes are buffered
+        if (end - begin < length) {  // Evaluate the condition and branch into the appropriate code path.
+            if (length - (end - begin) > unread) {  // Evaluate the condition and branch into the appropriate code path.
+                throw std::runtime_error("快照檔案損毀 / Corrupt snapshot file");  // Throw an exception to signal an invalid argument or operation.
+            }  // Close the current block scope.
+            std::memmove(buffer.data(), buffer.data() + begin, end - begin);  // Execute this statement as part of the data structure implementation.
+            end -= begin;  // Assign or update a variable that represents the current algorithm state.
+            begin = 0;  // Assign or update a variable that represents the current algorithm state.
+            if (buffer.size() < length) {  // 超大欄位：放大緩衝區 - Oversized field: grow the buffer
+                buffer.resize(length);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            size_t chunk = static_cast<size_t>(std::min<uint64_t>(unread, buffer.size() - end));  // Assign or update a variable that represents the current algorithm state.
+            in.read(reinterpret_cast<char*>(buffer.data() + end), static_cast<std::streamsize>(chunk));  // Execute this statement as part of the data structure implementation.
+            checksum.update(buffer.data() + end, chunk);  // Execute this statement as part of the data structure implementation.
+            end += chunk;  // Assign or update a variable that represents the current algorithm state.
+            unread -= chunk;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        const unsigned char* bytes = buffer.data() + begin;  // Assign or update a variable that represents the current algorithm state.
+        begin += length;  // Assign or update a variable that represents the current algorithm state.
+        return bytes;  // Return the computed result to the caller.
+    };  // Execute this statement as part of the data structure implementation.
+    auto takeLength = [&take](uint32_t fixedSize) {  // 讀長度前綴；固定大小欄位的長度必須相符 - Read a prefix; fixed-size fields must match
+        uint32_t length;  // Execute this statement as part of the data structure implementation.
+        std::memcpy(&length, take(sizeof(length)), sizeof(length));  // Execute this statement as part of the data structure implementation.
+        if (fixedSize != 0 && length != fixedSize) {  // Evaluate the condition and branch into the appropriate code path.
+            throw std::runtime_error("快照檔案損毀 / Corrupt snapshot file");  // Throw an exception to signal an invalid argument or operation.
+        }  // Close the current block scope.
+        return length;  // Return the computed result to the caller.
+    };  // Execute this statement as part of the data structure implementation.
+
+    try {  // Execute this statement as part of the data structure implementation.
+        for (uint64_t i = 0; i < header.count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            uint32_t keyLength = takeLength(SnapshotCodec<K>::FIXED_SIZE);  // Assign or update a variable that represents the current algorithm state.
+            K key = SnapshotCodec<K>::decode(take(keyLength), keyLength);  // Assign or update a variable that represents the current algorithm state.
+            uint32_t valueLength = takeLength(SnapshotCodec<V>::FIXED_SIZE);  // Assign or update a variable that represents the current algorithm state.
+            V value = SnapshotCodec<V>::decode(take(valueLength), valueLength);  // Assign or update a variable that represents the current algorithm state.
+            snapshotInsert(table, std::move(key), std::move(value));  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        SnapshotTrailer trailer;  // Execute this statement as part of the data structure implementation.
+        in.read(reinterpret_cast<char*>(&trailer), sizeof(trailer));  // Execute this statement as part of the data structure implementation.
+        if (!in || begin != end || unread != 0 || trailer.payloadBytes != payloadBytes ||  // Evaluate the condition and branch into the appropriate code path.
+            trailer.checksum != checksum.digest() || table.size() != header.count) {  // 重複的 key 也會讓筆數不符 - Duplicate keys also break the count
+            throw std::runtime_error("快照檔案損毀 / Corrupt snapshot file");  // Throw an exception to signal an invalid argument or operation.
+        }  // Close the current block scope.
+    } catch (...) {  // Execute this statement as part of the data structure implementation.
+        table.clear();  // 不留下部分內容 - Leave no partial contents behind
+        throw;  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    return SnapshotStats{static_cast<size_t>(header.count), fileBytes};  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+SnapshotStats loadSnapshotMapped(const std::string& path, Table& table) {  // Execute this statement as part of the data structure implementation.
+    using K = typename Table::KeyType;  // Execute this statement as part of the data structure implementation.
+    using V = typename Table::ValueType;  // Execute this statement as part of the data structure implementation.
+    static_assert(std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<V>,  // Execute this statement as part of the data structure implementation.
+                  "loadSnapshotMapped needs trivially copyable keys and values; use loadSnapshot");  // Execute this statement as part of the data structure implementation.
+    if (!table.empty()) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::invalid_argument("載入目標必須是空表 / Snapshots load into an empty table");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+
+    const unsigned char* base = nullptr;  // Assign or update a variable that represents the current algorithm state.
+    size_t length = 0;  // Assign or update a variable that represents the current algorithm state.
+#if SNAPSHOT_HAS_MMAP  // Evaluate the condition and branch into the appropriate code path.
+    int fd = ::open(path.c_str(), O_RDONLY);  // Assign or update a variable that represents the current algorithm state.
+    if (fd < 0) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法開啟檔案 / Cannot open file: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    struct stat info;  // Execute this statement as part of the data structure implementation.
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(SnapshotHeader) + sizeof(SnapshotTrailer))) {  // Evaluate the condition and branch into the appropriate code path.
+        ::close(fd);  // Execute this statement as part of the data structure implementation.
+        throw std::runtime_error("檔案過短 / File too short: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    length = static_cast<size_t>(info.st_size);  // Assign or update a variable that represents the current algorithm state.
+    void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);  // Assign or update a variable that represents the current algorithm state.
+    ::close(fd);  // 映射建立後即可關閉 - The mapping outlives the descriptor
+    if (mapped == MAP_FAILED) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("mmap 失敗 / mmap failed: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    ::madvise(mapped, length, MADV_SEQUENTIAL);  // 從頭讀到尾，請核心積極預讀 - Read front to back; ask for aggressive readahead
+    base = static_cast<const unsigned char*>(mapped);  // Assign or update a variable that represents the current algorithm state.
+    struct Unmap {  // 任何離開路徑都解除映射 - Unmap on every exit path
+        const unsigned char* base;  // Execute this statement as part of the data structure implementation.
+        size_t length;  // Execute this statement as part of the data structure implementation.
+        ~Unmap() { ::munmap(const_cast<unsigned char*>(base), length); }  // Execute this statement as part of the data structure implementation.
+    } unmap{base, length};  // Execute this statement as part of the data structure implementation.
+#else  // Handle the alternative branch when the condition is false.
+    std::ifstream in(path, std::ios::binary | std::ios::ate);  // Execute this statement as part of the data structure implementation.
+    if (!in) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("無法開啟檔案 / Cannot open file: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    length = static_cast<size_t>(in.tellg());  // Assign or update a variable that represents the current algorithm state.
+    if (length < sizeof(SnapshotHeader) + sizeof(SnapshotTrailer)) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("檔案過短 / File too short: " + path);  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    std::vector<unsigned char> contents(length);  // Execute this statement as part of the data structure implementation.
+    in.seekg(0);  // Execute this statement as part of the data structure implementation.
+    in.read(reinterpret_cast<char*>(contents.data()), static_cast<std::streamsize>(length));  // Execute this statement as part of the data structure implementation.
+    base = contents.data();  // Assign or update a variable that represents the current algorithm state.
+#endif  // Execute this statement as part of the data structure implementation.
+
+    SnapshotHeader header;  // Execute this statement as part of the data structure implementation.
+    SnapshotTrailer trailer;  // Execute this statement as part of the data structure implementation.
+    uint64_t payloadBytes = length - sizeof(SnapshotHeader) - sizeof(SnapshotTrailer);  // Assign or update a variable that represents the current algorithm state.
+    const unsigned char* payload = base + sizeof(SnapshotHeader);  // Assign or update a variable that represents the current algorithm state.
+    std::memcpy(&header, base, sizeof(header));  // Execute this statement as part of the data structure implementation.
+    std::memcpy(&trailer, payload + payloadBytes, sizeof(trailer));  // Execute this statement as part of the data structure implementation.
+    validateSnapshotHeader<Table>(header, payloadBytes);  // Execute this statement as part of the data structure implementation.
+
+    // 固定大小的 entry：長度前綴與資料區長度都可以先一次驗證完 - Fixed-size entries: prefixes and payload length can all be checked up front
+    constexpr size_t ENTRY_BYTES = 2 * sizeof(uint32_t) + sizeof(K) + sizeof(V);  // Execute this statement as part of the data structure implementation.
+    SnapshotChecksum checksum;  // Execute this statement as part of the data structure implementation.
+    checksum.update(payload, static_cast<size_t>(payloadBytes));  // Execute this statement as part of the data structure implementation.
+    bool ok = trailer.payloadBytes == payloadBytes && header.count * ENTRY_BYTES == payloadBytes &&  // Execute this statement as part of the data structure implementation.
+              trailer.checksum == checksum.digest();  // Execute this statement as part of the data structure implementation.
+    for (uint64_t i = 0; ok && i < header.count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        uint32_t prefixes[2];  // Execute this statement as part of the data structure implementation.
+        std::memcpy(&prefixes[0], payload + i * ENTRY_BYTES, sizeof(uint32_t));  // Execute this statement as part of the data structure implementation.
+        std::memcpy(&prefixes[1], payload + i * ENTRY_BYTES + sizeof(uint32_t) + sizeof(K), sizeof(uint32_t));  // Execute this statement as part of the data structure implementation.
+        ok = prefixes[0] == sizeof(K) && prefixes[1] == sizeof(V);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    if (!ok) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::runtime_error("快照檔案損毀 / Corrupt snapshot file");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+
+    table.reserve(static_cast<size_t>(header.count));  // 一次擴到位，載入期間不再 rehash - Grow once; no rehash while loading
+    for (uint64_t i = 0; i < header.count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        const unsigned char* entry = payload + i * ENTRY_BYTES;  // Assign or update a variable that represents the current algorithm state.
+        K key = SnapshotCodec<K>::decode(entry + sizeof(uint32_t), sizeof(K));  // Assign or update a variable that represents the current algorithm state.
+        V value = SnapshotCodec<V>::decode(entry + 2 * sizeof(uint32_t) + sizeof(K), sizeof(V));  // Assign or update a variable that represents the current algorithm state.
+        snapshotInsert(table, std::move(key), std::move(value));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    if (table.size() != header.count) {  // 資料區通過校驗卻有重複 key：寫入端不是 saveSnapshot - Valid checksum but duplicate keys: not written by saveSnapshot
+        table.clear();  // Execute this statement as part of the data structure implementation.
+        throw std::runtime_error("快照檔案損毀 / Corrupt snapshot file");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    return SnapshotStats{static_cast<size_t>(header.count), length};  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+#endif // SNAPSHOT_HPP
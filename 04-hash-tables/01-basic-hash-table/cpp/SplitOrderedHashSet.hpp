@@ -0,0 +1,386 @@
+/** Doc block start
+ * 無鎖分裂序雜湊集合（Lock-Free Split-Ordered Hash Set）- C++ 實作
+ * Shalev & Shavit 的 split-ordered list：所有元素串在「一條」依位元反轉排序的無鎖鏈結串列上，
+ * 桶只是指向串列中哨兵節點的捷徑，所以擴容時不需要搬移任何元素
+ *(blank line)
+ * Lock-free hash set based on Shalev & Shavit's split-ordered lists: every element lives on ONE
+ * lock-free linked list sorted by bit-reversed hash; buckets are shortcuts to sentinel nodes in
+ * that list, so growing the table never moves an element
+ */  // End of block comment
+
+#ifndef SPLIT_ORDERED_HASH_SET_HPP  // Execute this statement as part of the data structure implementation.
+#define SPLIT_ORDERED_HASH_SET_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <atomic>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <functional>  // Execute this statement as part of the data structure implementation.
+#include <stdexcept>  // Execute this statement as part of the data structure implementation.
+#include "EpochReclamation.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SeededHash.hpp"  // HashTableHasher 與每個集合各自的種子 - HashTableHasher and per-set seeds
+
+/** Doc block start
+ * 無鎖雜湊集合模板類別 / Lock-free hash set template class
+ *(blank line)
+ * 桶索引與 HashTable 相同：seededHash(HashTableHasher<K>, key, seed) % bucketCount（bucketCount 為 2 的冪次，所以等於取低位元），
+ * 種子預設每個集合各自隨機，所以無法事先算出一組全部落在同一段串列上的 key。
+ * 串列以 reverse(hash) 排序，桶 b 的元素恰好是串列上「哨兵 b」之後的一段；
+ * bucketCount 加倍時，新桶 b + n 的哨兵插在舊桶 b 那一段中間，元素本身不動。
+ * The bucket index matches HashTable: seededHash(HashTableHasher<K>, key, seed) % bucketCount (a power of
+ * two, i.e. the low bits). The seed is random per set by default, so a key set that piles onto one run
+ * of the list cannot be precomputed.
+ * The list is sorted by reverse(hash), so bucket b's elements form the run after sentinel b;
+ * when bucketCount doubles, new bucket b + n's sentinel is spliced into the middle of bucket b's run.
+ *(blank line)
+ * 桶陣列分段配置：第 s 段存放 [2^(s-1), 2^s) 的桶，需要時才以 CAS 配置，因此不會有全域 rehash。
+ * The bucket array is segmented: segment s holds buckets [2^(s-1), 2^s) and is allocated on demand
+ * with a CAS, so there is never a global rehash.
+ *(blank line)
+ * 刪除採 Harris-Michael 兩階段：先標記 next 指標的最低位元（邏輯刪除），再 CAS 摘除（實體刪除）；
+ * 成功摘除的執行緒把節點交給 EpochDomain 延後釋放。
+ * Removal is Harris-Michael two-phase: mark the low bit of next (logical), then CAS it out (physical);
+ * whichever thread unlinks the node hands it to the EpochDomain for deferred freeing.
+ *(blank line)
+ * @tparam K 鍵的型別（key type），需可比較相等且可複製
+ */  // End of block comment
+template <typename K>  // Execute this statement as part of the data structure implementation.
+class SplitOrderedHashSet {  // Execute this statement as part of the data structure implementation.
+public:  // Execute this statement as part of the data structure implementation.
+    /** Doc block start
+     * 建構子 / Constructor
+     *(blank line)
+     * @param initialBuckets 初始桶數（會向上取到 2 的冪次）/ initial bucket count (rounded up to a power of two)
+     * @param seed 雜湊種子，預設每個集合各自隨機（hash seed, random per set by default）
+     */  // End of block comment
+    explicit SplitOrderedHashSet(size_t initialBuckets = 16, HashSeed seed = HashSeed::random());  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 解構子：不可與其他操作並行 / Destructor: must not run concurrently with other operations
+     */  // End of block comment
+    ~SplitOrderedHashSet();  // Execute this statement as part of the data structure implementation.
+
+    SplitOrderedHashSet(const SplitOrderedHashSet&) = delete;  // Execute this statement as part of the data structure implementation.
+    SplitOrderedHashSet& operator=(const SplitOrderedHashSet&) = delete;  // Execute this statement as part of the data structure implementation.
+
+    // ========== 基本操作 Basic Operations（皆為 lock-free）==========
+
+    /** Doc block start
+     * 插入 key；已存在時回傳 false / Insert key; returns false if already present
+     */  // End of block comment
+    bool insert(const K& key);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 刪除 key；不存在時回傳 false / Remove key; returns false if absent
+     */  // End of block comment
+    bool remove(const K& key);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 查詢 key 是否存在（不做任何寫入，只協助摘除已標記節點時才寫）
+     * Check membership (writes only when helping unlink marked nodes)
+     */  // End of block comment
+    bool contains(const K& key);  // Execute this statement as part of the data structure implementation.
+
+    // ========== 容量 Capacity ==========
+
+    size_t size() const { return count_.load(std::memory_order_relaxed); }  // Return the computed result to the caller.
+    bool empty() const { return size() == 0; }  // Return the computed result to the caller.
+    size_t bucketCount() const { return bucketCount_.load(std::memory_order_acquire); }  // Return the computed result to the caller.
+    double loadFactor() const {  // Execute this statement as part of the data structure implementation.
+        return static_cast<double>(size()) / static_cast<double>(bucketCount());  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 回收網域（測試用，觀察待回收節點數）/ Reclamation domain (for tests that inspect pending nodes)
+     */  // End of block comment
+    EpochDomain& reclamation() { return epochs_; }  // Return the computed result to the caller.
+
+    /** Doc block start
+     * 回傳這個集合的雜湊種子 / Return this set's hash seed
+     */  // End of block comment
+    const HashSeed& hashSeed() const { return seed_; }  // Return the computed result to the caller.
+
+private:  // Execute this statement as part of the data structure implementation.
+    /** Doc block start
+     * 串列節點：soKey 是位元反轉後的排序鍵；一般節點最低位元為 1，哨兵為 0
+     * List node: soKey is the bit-reversed sort key; regular nodes have the low bit set, sentinels do not
+     */  // End of block comment
+    struct Node {  // Execute this statement as part of the data structure implementation.
+        uint64_t soKey;  // Execute this statement as part of the data structure implementation.
+        std::atomic<uintptr_t> next;  // 最低位元 = 已邏輯刪除 - Low bit = logically deleted
+
+        explicit Node(uint64_t so) : soKey(so), next(0) {}  // Execute this statement as part of the data structure implementation.
+        bool isSentinel() const { return (soKey & 1u) == 0; }  // Return the computed result to the caller.
+    };  // Execute this statement as part of the data structure implementation.
+
+    struct KeyNode : Node {  // Execute this statement as part of the data structure implementation.
+        K key;  // Execute this statement as part of the data structure implementation.
+        KeyNode(uint64_t so, const K& k) : Node(so), key(k) {}  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+
+    static constexpr size_t SEGMENTS = 48;  // 最多 2^47 個桶 - Up to 2^47 buckets
+    static constexpr size_t MAX_LOAD = 2;  // 平均每桶元素數超過此值時加倍 - Double past this many elements per bucket
+    static constexpr uintptr_t MARK = 1;  // Assign or update a variable that represents the current algorithm state.
+
+    std::atomic<std::atomic<Node*>*> segments_[SEGMENTS];  // Execute this statement as part of the data structure implementation.
+    std::atomic<size_t> bucketCount_;  // Execute this statement as part of the data structure implementation.
+    std::atomic<size_t> count_;  // Execute this statement as part of the data structure implementation.
+    Node* head_;  // 桶 0 的哨兵，也是整條串列的起點 - Bucket 0's sentinel and the start of the list
+    HashTableHasher<K> hasher_;  // Execute this statement as part of the data structure implementation.
+    HashSeed seed_;  // 節點的排序鍵依賴它，建構後不變 - Nodes' sort keys depend on it; fixed after construction
+    EpochDomain epochs_;  // Execute this statement as part of the data structure implementation.
+
+    static Node* pointerOf(uintptr_t word) { return reinterpret_cast<Node*>(word & ~MARK); }  // Return the computed result to the caller.
+    static bool isMarked(uintptr_t word) { return (word & MARK) != 0; }  // Return the computed result to the caller.
+    static uintptr_t wordOf(Node* node) { return reinterpret_cast<uintptr_t>(node); }  // Return the computed result to the caller.
+
+    static uint64_t reverseBits(uint64_t x);  // Execute this statement as part of the data structure implementation.
+    static uint64_t regularKey(uint64_t hash) { return reverseBits(hash | (1ULL << 63)); }  // Return the computed result to the caller.
+    static uint64_t sentinelKey(uint64_t bucket) { return reverseBits(bucket); }  // Return the computed result to the caller.
+    static void deleteNode(void* p);  // Execute this statement as part of the data structure implementation.
+
+    uint64_t hashOf(const K& key) const {  // Compute a hash-based index so keys map into the table's storage.
+        return static_cast<uint64_t>(seededHash(hasher_, key, seed_));  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    std::atomic<Node*>& bucketSlot(size_t bucket);  // Execute this statement as part of the data structure implementation.
+    Node* bucketSentinel(size_t bucket);  // Execute this statement as part of the data structure implementation.
+    void initializeBucket(size_t bucket);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * Harris-Michael 搜尋：從 start 開始找第一個 soKey > target（或相等且 key 相同）的節點，
+     * 途中協助摘除已標記節點。回傳是否找到相同元素，並透過 prev/curr 傳回插入位置。
+     * Harris-Michael search from start for the first node with soKey > target (or equal with the same key),
+     * helping unlink marked nodes on the way. Returns whether a match was found; prev/curr give the position.
+     */  // End of block comment
+    bool find(Node* start, uint64_t soKey, const K* key, EpochDomain::Guard& guard,  // Execute this statement as part of the data structure implementation.
+              std::atomic<uintptr_t>*& prev, Node*& curr);  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+// ============================================================
+// 實作部分 Implementation
+// ============================================================
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+SplitOrderedHashSet<K>::SplitOrderedHashSet(size_t initialBuckets, HashSeed seed)  // Execute this statement as part of the data structure implementation.
+    : bucketCount_(1), count_(0), head_(new Node(sentinelKey(0))), seed_(seed) {  // Execute this statement as part of the data structure implementation.
+    if (initialBuckets == 0) {  // Evaluate the condition and branch into the appropriate code path.
+        delete head_;  // Execute this statement as part of the data structure implementation.
+        throw std::invalid_argument(  // Throw an exception to signal an invalid operation or state.
+            "桶數必須為正整數 / Bucket count must be positive");  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    size_t buckets = 1;  // Assign or update a variable that represents the current algorithm state.
+    while (buckets < initialBuckets) {  // Repeat while the loop condition remains true.
+        buckets <<= 1;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    bucketCount_.store(buckets, std::memory_order_relaxed);  // Execute this statement as part of the data structure implementation.
+    for (size_t s = 0; s < SEGMENTS; ++s) {  // Iterate over a range/collection to process each item in sequence.
+        segments_[s].store(nullptr, std::memory_order_relaxed);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    bucketSlot(0).store(head_, std::memory_order_release);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+SplitOrderedHashSet<K>::~SplitOrderedHashSet() {  // Execute this statement as part of the data structure implementation.
+    // 串列上的節點（含哨兵）直接釋放；已摘除的節點由 epochs_ 的解構子釋放
+    // Free everything still on the list (sentinels included); unlinked nodes are freed by epochs_'s destructor
+    Node* node = head_;  // Assign or update a variable that represents the current algorithm state.
+    while (node != nullptr) {  // Repeat while the loop condition remains true.
+        Node* next = pointerOf(node->next.load(std::memory_order_relaxed));  // Assign or update a variable that represents the current algorithm state.
+        deleteNode(node);  // Execute this statement as part of the data structure implementation.
+        node = next;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    for (size_t s = 0; s < SEGMENTS; ++s) {  // Iterate over a range/collection to process each item in sequence.
+        delete[] segments_[s].load(std::memory_order_relaxed);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+uint64_t SplitOrderedHashSet<K>::reverseBits(uint64_t x) {  // Execute this statement as part of the data structure implementation.
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);  // Assign or update a variable that represents the current algorithm state.
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);  // Assign or update a variable that represents the current algorithm state.
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);  // Assign or update a variable that represents the current algorithm state.
+#if defined(__GNUC__) || defined(__clang__)  // Execute this statement as part of the data structure implementation.
+    return __builtin_bswap64(x);  // Return the computed result to the caller.
+#else  // Execute this statement as part of the data structure implementation.
+    x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);  // Assign or update a variable that represents the current algorithm state.
+    x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);  // Assign or update a variable that represents the current algorithm state.
+    return (x >> 32) | (x << 32);  // Return the computed result to the caller.
+#endif  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+void SplitOrderedHashSet<K>::deleteNode(void* p) {  // Execute this statement as part of the data structure implementation.
+    Node* node = static_cast<Node*>(p);  // Assign or update a variable that represents the current algorithm state.
+    if (node->isSentinel()) {  // Evaluate the condition and branch into the appropriate code path.
+        delete node;  // Execute this statement as part of the data structure implementation.
+    } else {  // Handle the alternative branch when the condition is false.
+        delete static_cast<KeyNode*>(node);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+std::atomic<typename SplitOrderedHashSet<K>::Node*>& SplitOrderedHashSet<K>::bucketSlot(size_t bucket) {  // Access or update the bucket storage used to hold entries or chains.
+    // 第 s 段存放位元寬度為 s 的桶：s = 0 → {0}，s ≥ 1 → [2^(s-1), 2^s)
+    // Segment s holds buckets whose bit width is s: s = 0 → {0}, s >= 1 → [2^(s-1), 2^s)
+    size_t segment = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t b = bucket; b != 0; b >>= 1) {  // Iterate over a range/collection to process each item in sequence.
+        ++segment;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    size_t segmentSize = segment == 0 ? 1 : (static_cast<size_t>(1) << (segment - 1));  // Assign or update a variable that represents the current algorithm state.
+    size_t offset = segment == 0 ? 0 : bucket - segmentSize;  // Assign or update a variable that represents the current algorithm state.
+
+    std::atomic<Node*>* table = segments_[segment].load(std::memory_order_acquire);  // Assign or update a variable that represents the current algorithm state.
+    if (table == nullptr) {  // 第一次用到這一段：配置後以 CAS 發布 - First use: allocate and publish with a CAS
+        std::atomic<Node*>* fresh = new std::atomic<Node*>[segmentSize];  // Assign or update a variable that represents the current algorithm state.
+        for (size_t i = 0; i < segmentSize; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            fresh[i].store(nullptr, std::memory_order_relaxed);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        if (segments_[segment].compare_exchange_strong(table, fresh, std::memory_order_acq_rel)) {  // Evaluate the condition and branch into the appropriate code path.
+            table = fresh;  // Assign or update a variable that represents the current algorithm state.
+        } else {  // 其他執行緒先配置好了 - Another thread won the race
+            delete[] fresh;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    return table[offset];  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+typename SplitOrderedHashSet<K>::Node* SplitOrderedHashSet<K>::bucketSentinel(size_t bucket) {  // Execute this statement as part of the data structure implementation.
+    Node* sentinel = bucketSlot(bucket).load(std::memory_order_acquire);  // Assign or update a variable that represents the current algorithm state.
+    if (sentinel == nullptr) {  // 延遲初始化 - Lazy initialization
+        initializeBucket(bucket);  // Execute this statement as part of the data structure implementation.
+        sentinel = bucketSlot(bucket).load(std::memory_order_acquire);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    return sentinel;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+void SplitOrderedHashSet<K>::initializeBucket(size_t bucket) {  // Execute this statement as part of the data structure implementation.
+    // 父桶 = 清掉最高位元；新哨兵插在父桶那一段中 - Parent = clear the top bit; the sentinel goes into the parent's run
+    size_t parent = bucket;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t bit = 1; bit <= bucket; bit <<= 1) {  // Iterate over a range/collection to process each item in sequence.
+        if (bucket & bit) {  // Evaluate the condition and branch into the appropriate code path.
+            parent = bucket & ~bit;  // 最後一次命中的是最高位元 - The last hit is the top bit
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    Node* start = bucketSentinel(parent);  // 遞迴確保父桶已初始化 - Recursively ensure the parent exists
+
+    Node* sentinel = new Node(sentinelKey(bucket));  // Assign or update a variable that represents the current algorithm state.
+    EpochDomain::Guard guard(epochs_);  // Execute this statement as part of the data structure implementation.
+    for (;;) {  // Execute this statement as part of the data structure implementation.
+        std::atomic<uintptr_t>* prev = nullptr;  // Assign or update a variable that represents the current algorithm state.
+        Node* curr = nullptr;  // Assign or update a variable that represents the current algorithm state.
+        if (find(start, sentinel->soKey, nullptr, guard, prev, curr)) {  // 其他執行緒已插入同一個哨兵 - Another thread inserted it
+            delete sentinel;  // Execute this statement as part of the data structure implementation.
+            sentinel = curr;  // Assign or update a variable that represents the current algorithm state.
+            break;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        sentinel->next.store(wordOf(curr), std::memory_order_relaxed);  // Assign or update a variable that represents the current algorithm state.
+        uintptr_t expected = wordOf(curr);  // Assign or update a variable that represents the current algorithm state.
+        if (prev->compare_exchange_strong(expected, wordOf(sentinel))) {  // Evaluate the condition and branch into the appropriate code path.
+            break;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    Node* expected = nullptr;  // Assign or update a variable that represents the current algorithm state.
+    bucketSlot(bucket).compare_exchange_strong(expected, sentinel, std::memory_order_acq_rel);  // 失敗代表別人已設好同一個哨兵 - Failure means the same sentinel is already set
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+bool SplitOrderedHashSet<K>::find(Node* start, uint64_t soKey, const K* key, EpochDomain::Guard& guard,  // Execute this statement as part of the data structure implementation.
+                                  std::atomic<uintptr_t>*& prev, Node*& curr) {  // Execute this statement as part of the data structure implementation.
+retry:  // Execute this statement as part of the data structure implementation.
+    prev = &start->next;  // 哨兵永不刪除，可安全作為起點 - Sentinels are never removed, so they are safe starting points
+    curr = pointerOf(prev->load(std::memory_order_acquire));  // Assign or update a variable that represents the current algorithm state.
+    while (curr != nullptr) {  // Repeat while the loop condition remains true.
+        uintptr_t nextWord = curr->next.load(std::memory_order_acquire);  // Assign or update a variable that represents the current algorithm state.
+        if (isMarked(nextWord)) {  // curr 已被邏輯刪除：協助摘除 - curr is logically deleted: help unlink it
+            uintptr_t expected = wordOf(curr);  // Assign or update a variable that represents the current algorithm state.
+            if (!prev->compare_exchange_strong(expected, nextWord & ~MARK)) {  // Evaluate the condition and branch into the appropriate code path.
+                goto retry;  // prev 已改變，從頭再找 - prev changed underneath us: restart
+            }  // Close the current block scope.
+            guard.retire(curr, &deleteNode);  // 摘除成功者負責回收 - The unlinking thread retires it
+            curr = pointerOf(nextWord);  // Assign or update a variable that represents the current algorithm state.
+            continue;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        if (curr->soKey > soKey) {  // 已超過目標位置 - Past the target position
+            return false;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        if (curr->soKey == soKey) {  // Evaluate the condition and branch into the appropriate code path.
+            if (key == nullptr || static_cast<KeyNode*>(curr)->key == *key) {  // 哨兵只比 soKey；一般節點再比 key - Sentinels match on soKey, regular nodes on key
+                return true;  // Return the computed result to the caller.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        prev = &curr->next;  // Assign or update a variable that represents the current algorithm state.
+        curr = pointerOf(nextWord);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    return false;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+bool SplitOrderedHashSet<K>::insert(const K& key) {  // Execute this statement as part of the data structure implementation.
+    uint64_t hash = hashOf(key);  // Compute a hash-based index so keys map into the table's storage.
+    size_t buckets = bucketCount_.load(std::memory_order_acquire);  // Assign or update a variable that represents the current algorithm state.
+    Node* start = bucketSentinel(static_cast<size_t>(hash % buckets));  // 與 HashTable 相同的桶索引 - Same bucket index as HashTable
+    KeyNode* node = new KeyNode(regularKey(hash), key);  // Assign or update a variable that represents the current algorithm state.
+    {  // Execute this statement as part of the data structure implementation.
+        EpochDomain::Guard guard(epochs_);  // Execute this statement as part of the data structure implementation.
+        for (;;) {  // Execute this statement as part of the data structure implementation.
+            std::atomic<uintptr_t>* prev = nullptr;  // Assign or update a variable that represents the current algorithm state.
+            Node* curr = nullptr;  // Assign or update a variable that represents the current algorithm state.
+            if (find(start, node->soKey, &key, guard, prev, curr)) {  // Evaluate the condition and branch into the appropriate code path.
+                delete node;  // 從未發布，可直接刪除 - Never published, safe to delete now
+                return false;  // Return the computed result to the caller.
+            }  // Close the current block scope.
+            node->next.store(wordOf(curr), std::memory_order_relaxed);  // Assign or update a variable that represents the current algorithm state.
+            uintptr_t expected = wordOf(curr);  // Assign or update a variable that represents the current algorithm state.
+            if (prev->compare_exchange_strong(expected, wordOf(node))) {  // 線性化點 - Linearization point
+                break;  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    size_t count = count_.fetch_add(1, std::memory_order_relaxed) + 1;  // Assign or update a variable that represents the current algorithm state.
+    if (count / buckets > MAX_LOAD && buckets < (static_cast<size_t>(1) << (SEGMENTS - 1))) {  // 只加倍計數，新桶延遲初始化 - Just double the count; new buckets initialize lazily
+        bucketCount_.compare_exchange_strong(buckets, buckets * 2, std::memory_order_acq_rel);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return true;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+bool SplitOrderedHashSet<K>::remove(const K& key) {  // Execute this statement as part of the data structure implementation.
+    uint64_t hash = hashOf(key);  // Compute a hash-based index so keys map into the table's storage.
+    Node* start = bucketSentinel(static_cast<size_t>(hash % bucketCount_.load(std::memory_order_acquire)));  // Access or update the bucket storage used to hold entries or chains.
+    uint64_t soKey = regularKey(hash);  // Assign or update a variable that represents the current algorithm state.
+    EpochDomain::Guard guard(epochs_);  // Execute this statement as part of the data structure implementation.
+    for (;;) {  // Execute this statement as part of the data structure implementation.
+        std::atomic<uintptr_t>* prev = nullptr;  // Assign or update a variable that represents the current algorithm state.
+        Node* curr = nullptr;  // Assign or update a variable that represents the current algorithm state.
+        if (!find(start, soKey, &key, guard, prev, curr)) {  // Evaluate the condition and branch into the appropriate code path.
+            return false;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        uintptr_t nextWord = curr->next.load(std::memory_order_acquire);  // Assign or update a variable that represents the current algorithm state.
+        if (isMarked(nextWord)) {  // 別的執行緒剛刪除它：重新搜尋 - Someone else just deleted it: search again
+            continue;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        if (!curr->next.compare_exchange_strong(nextWord, nextWord | MARK)) {  // 線性化點（邏輯刪除）- Linearization point (logical delete)
+            continue;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        count_.fetch_sub(1, std::memory_order_relaxed);  // Execute this statement as part of the data structure implementation.
+        uintptr_t expected = wordOf(curr);  // Assign or update a variable that represents the current algorithm state.
+        if (prev->compare_exchange_strong(expected, nextWord)) {  // 實體摘除；失敗時留給下一次 find 協助 - Physical unlink; a later find helps on failure
+            guard.retire(curr, &deleteNode);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        return true;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K>  // Execute this statement as part of the data structure implementation.
+bool SplitOrderedHashSet<K>::contains(const K& key) {  // Execute this statement as part of the data structure implementation.
+    uint64_t hash = hashOf(key);  // Compute a hash-based index so keys map into the table's storage.
+    Node* start = bucketSentinel(static_cast<size_t>(hash % bucketCount_.load(std::memory_order_acquire)));  // Access or update the bucket storage used to hold entries or chains.
+    EpochDomain::Guard guard(epochs_);  // Execute this statement as part of the data structure implementation.
+    std::atomic<uintptr_t>* prev = nullptr;  // Assign or update a variable that represents the current algorithm state.
+    Node* curr = nullptr;  // Assign or update a variable that represents the current algorithm state.
+    return find(start, regularKey(hash), &key, guard, prev, curr);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+#endif // SPLIT_ORDERED_HASH_SET_HPP
@@ -0,0 +1,181 @@
+/** Doc block start
+ * 批次雜湊 效能量測 / Batch hashing
+ *(blank line)
+ * 1. 純雜湊：同一批 key 以逐一 seededHash、hashBatchScalar、hashBatch（AVX2 時 4 條通道）計算，
+ *    比較每個 key 的奈秒數；整數 key 與 8 ~ 64 位元組的字串 key 各一列。
+ * 2. 查詢：放得進快取的 HashTable（雜湊佔查詢成本的大部分）上，逐一 search 與 searchBatch 的每次查詢奈秒數。
+ * 1. Hashing only: the same keys through per-key seededHash, hashBatchScalar and hashBatch (4 AVX2
+ *    lanes when available), in nanoseconds per key; one row for integer keys and one per string
+ *    length from 8 to 64 bytes.
+ * 2. Lookups: one-by-one search vs searchBatch per lookup on cache-resident HashTables, where
+ *    hashing is most of the cost.
+ *(blank line)
+ * 各設定交錯執行 rounds 輪並取最小值。Each configuration runs in `rounds` interleaved rounds; the minimum is reported.
+ *(blank line)
+ * 用法 Usage: ./batch_hash_benchmark [keys=4096] [repeats=500] [rounds=3]
+ */  // End of block comment
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <limits>  // Execute this statement as part of the data structure implementation.
+#include <optional>  // Execute this statement as part of the data structure implementation.
+#include <random>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <string_view>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "BatchHash.hpp"  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+uint64_t sink = 0;  // 累加結果，避免被最佳化掉 - Accumulates results so nothing is optimized away
+
+/** Doc block start
+ * 執行 work() rounds 次，回傳最短一次的每個項目奈秒數
+ * Run work() `rounds` times and return the fastest run's nanoseconds per item
+ */  // End of block comment
+template <typename Work>  // Execute this statement as part of the data structure implementation.
+double bestNsPerItem(int rounds, double items, Work work) {  // Execute this statement as part of the data structure implementation.
+    double best = std::numeric_limits<double>::max();  // Assign or update a variable that represents the current algorithm state.
+    for (int r = 0; r < rounds; ++r) {  // Iterate over a range/collection to process each item in sequence.
+        Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+        work();  // Execute this statement as part of the data structure implementation.
+        best = std::min(best, std::chrono::duration<double, std::nano>(Clock::now() - start).count() / items);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    return best;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+void printRow(const std::string& label, double perKey, double scalar, double batch) {  // Execute this statement as part of the data structure implementation.
+    std::cout << std::left << std::setw(16) << label << std::right << std::fixed << std::setprecision(2)  // Execute this statement as part of the data structure implementation.
+              << std::setw(12) << perKey << std::setw(12) << scalar << std::setw(12) << batch  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << perKey / batch << "x" << std::endl;  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 在表上比較逐一 search 與 searchBatch（每批 64 個 key）/ Compare one-by-one search with searchBatch (64 keys per batch)
+ */  // End of block comment
+template <typename K>  // Execute this statement as part of the data structure implementation.
+void runLookups(const std::string& label, const std::vector<K>& keys, int repeats, int rounds) {  // Execute this statement as part of the data structure implementation.
+    HashTable<K, int> table(16, HashSeed::fromValue(1));  // Execute this statement as part of the data structure implementation.
+    std::vector<int> values(keys.size(), 1);  // Execute this statement as part of the data structure implementation.
+    table.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+    const size_t batchSize = 64;  // Assign or update a variable that represents the current algorithm state.
+    std::vector<std::vector<K>> batches;  // Execute this statement as part of the data structure implementation.
+    for (size_t base = 0; base < keys.size(); base += batchSize) {  // Iterate over a range/collection to process each item in sequence.
+        batches.emplace_back(keys.begin() + base, keys.begin() + std::min(keys.size(), base + batchSize));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    double items = static_cast<double>(keys.size()) * repeats;  // Assign or update a variable that represents the current algorithm state.
+
+    double one = bestNsPerItem(rounds, items, [&] {  // Assign or update a variable that represents the current algorithm state.
+        for (int r = 0; r < repeats; ++r) {  // Iterate over a range/collection to process each item in sequence.
+            for (const K& key : keys) {  // Iterate over a range/collection to process each item in sequence.
+                sink += static_cast<uint64_t>(table.search(key).value_or(0));  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    });  // Execute this statement as part of the data structure implementation.
+    std::vector<std::optional<int>> out;  // Execute this statement as part of the data structure implementation.
+    double batched = bestNsPerItem(rounds, items, [&] {  // Assign or update a variable that represents the current algorithm state.
+        for (int r = 0; r < repeats; ++r) {  // Iterate over a range/collection to process each item in sequence.
+            for (const std::vector<K>& batch : batches) {  // Iterate over a range/collection to process each item in sequence.
+                table.searchBatch(batch, out);  // Execute this statement as part of the data structure implementation.
+                sink += static_cast<uint64_t>(out.back().value_or(0));  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    });  // Execute this statement as part of the data structure implementation.
+    std::cout << std::left << std::setw(16) << label << std::right << std::fixed << std::setprecision(2)  // Execute this statement as part of the data structure implementation.
+              << std::setw(12) << one << std::setw(12) << batched << std::setw(10) << one / batched << "x" << std::endl;  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    size_t count = (argc > 1) ? static_cast<size_t>(std::stoull(argv[1])) : 4096;  // Assign or update a variable that represents the current algorithm state.
+    int repeats = (argc > 2) ? std::stoi(argv[2]) : 500;  // Assign or update a variable that represents the current algorithm state.
+    int rounds = (argc > 3) ? std::stoi(argv[3]) : 3;  // Assign or update a variable that represents the current algorithm state.
+    if (count == 0 || repeats <= 0 || rounds <= 0) {  // Evaluate the condition and branch into the appropriate code path.
+        std::cerr << "keys, repeats and rounds must be positive" << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    std::cout << "keys=" << count << " repeats=" << repeats << " AVX2 " << (batchHashUsesAvx2() ? "yes" : "no") << std::endl << std::endl;  // Execute this statement as part of the data structure implementation.
+
+    std::mt19937_64 rng(2024);  // Assign or update a variable that represents the current algorithm state.
+    HashSeed seed = HashSeed::fromValue(9);  // Assign or update a variable that represents the current algorithm state.
+    std::vector<uint64_t> out(count);  // Assign or update a variable that represents the current algorithm state.
+    double items = static_cast<double>(count) * repeats;  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "hash only (ns/key)" << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::left << std::setw(16) << "keys" << std::right << std::setw(12) << "seededHash" << std::setw(12) << "scalar"  // Execute this statement as part of the data structure implementation.
+              << std::setw(12) << "hashBatch" << std::setw(11) << "speedup" << std::endl;  // Execute this statement as part of the data structure implementation.
+
+    std::vector<uint64_t> ints(count);  // Execute this statement as part of the data structure implementation.
+    for (uint64_t& key : ints) {  // Iterate over a range/collection to process each item in sequence.
+        key = rng();  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    HashTableHasher<uint64_t> intHasher;  // Compute a hash-based index so keys map into the table's storage.
+    double perKey = bestNsPerItem(rounds, items, [&] {  // Assign or update a variable that represents the current algorithm state.
+        for (int r = 0; r < repeats; ++r) {  // Iterate over a range/collection to process each item in sequence.
+            for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                out[i] = seededHash(intHasher, ints[i], seed);  // Compute a hash-based index so keys map into the table's storage.
+            }  // Close the current block scope.
+            sink += out[r % count];  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    });  // Execute this statement as part of the data structure implementation.
+    double scalar = bestNsPerItem(rounds, items, [&] {  // Assign or update a variable that represents the current algorithm state.
+        for (int r = 0; r < repeats; ++r) {  // Iterate over a range/collection to process each item in sequence.
+            hashBatchScalar(ints.data(), count, seed, out.data());  // Compute a hash-based index so keys map into the table's storage.
+            sink += out[r % count];  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    });  // Execute this statement as part of the data structure implementation.
+    double batch = bestNsPerItem(rounds, items, [&] {  // Assign or update a variable that represents the current algorithm state.
+        for (int r = 0; r < repeats; ++r) {  // Iterate over a range/collection to process each item in sequence.
+            hashBatch(ints.data(), count, seed, out.data());  // Compute a hash-based index so keys map into the table's storage.
+            sink += out[r % count];  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    });  // Execute this statement as part of the data structure implementation.
+    printRow("uint64", perKey, scalar, batch);  // Execute this statement as part of the data structure implementation.
+
+    std::vector<std::vector<std::string>> stringSets;  // 每種長度一組，查詢段落重用 - One set per length, reused for lookups
+    for (size_t length : {8, 16, 24, 32, 48, 64}) {  // Iterate over a range/collection to process each item in sequence.
+        std::vector<std::string> owned(count);  // Execute this statement as part of the data structure implementation.
+        for (std::string& key : owned) {  // Iterate over a range/collection to process each item in sequence.
+            key.resize(length);  // Execute this statement as part of the data structure implementation.
+            for (char& c : key) {  // Iterate over a range/collection to process each item in sequence.
+                c = static_cast<char>('a' + rng() % 26);  // Assign or update a variable that represents the current algorithm state.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        std::vector<std::string_view> views(owned.begin(), owned.end());  // Assign or update a variable that represents the current algorithm state.
+        HashTableHasher<std::string> stringHasher;  // Compute a hash-based index so keys map into the table's storage.
+        perKey = bestNsPerItem(rounds, items, [&] {  // Assign or update a variable that represents the current algorithm state.
+            for (int r = 0; r < repeats; ++r) {  // Iterate over a range/collection to process each item in sequence.
+                for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                    out[i] = seededHash(stringHasher, views[i], seed);  // Compute a hash-based index so keys map into the table's storage.
+                }  // Close the current block scope.
+                sink += out[r % count];  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        });  // Execute this statement as part of the data structure implementation.
+        scalar = bestNsPerItem(rounds, items, [&] {  // Assign or update a variable that represents the current algorithm state.
+            for (int r = 0; r < repeats; ++r) {  // Iterate over a range/collection to process each item in sequence.
+                hashBatchScalar(views.data(), count, seed, out.data());  // Compute a hash-based index so keys map into the table's storage.
+                sink += out[r % count];  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        });  // Execute this statement as part of the data structure implementation.
+        batch = bestNsPerItem(rounds, items, [&] {  // Assign or update a variable that represents the current algorithm state.
+            for (int r = 0; r < repeats; ++r) {  // Iterate over a range/collection to process each item in sequence.
+                hashBatch(views.data(), count, seed, out.data());  // Compute a hash-based index so keys map into the table's storage.
+                sink += out[r % count];  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        });  // Execute this statement as part of the data structure implementation.
+        printRow("string " + std::to_string(length) + "B", perKey, scalar, batch);  // Execute this statement as part of the data structure implementation.
+        stringSets.push_back(std::move(owned));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    std::cout << std::endl << "HashTable lookups, all hits (ns/lookup)" << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::left << std::setw(16) << "keys" << std::right << std::setw(12) << "search" << std::setw(12) << "searchBatch"  // Execute this statement as part of the data structure implementation.
+              << std::setw(11) << "speedup" << std::endl;  // Execute this statement as part of the data structure implementation.
+    runLookups("uint64", ints, repeats, rounds);  // Execute this statement as part of the data structure implementation.
+    runLookups("string 16B", stringSets[1], repeats, rounds);  // Execute this statement as part of the data structure implementation.
+    runLookups("string 32B", stringSets[3], repeats, rounds);  // Execute this statement as part of the data structure implementation.
+    std::cout << std::endl << "(checksum " << (sink & 0xffff) << ")" << std::endl;  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -0,0 +1,124 @@
+/** Doc block start
+ * 批次建表與批次查詢 效能量測 / Bulk build and batched lookup
+ *(blank line)
+ * 建立遠大於末級快取的 HashTable<int, int>，比較：
+ * 1. 逐一 insert 與 insertBatch（先一次擴容）的建表時間；
+ * 2. 逐一 search 與 searchBatch（先雜湊並預取整組的桶與節點）在批次大小 1 ~ 64 時的平均查詢耗時。
+ * Builds a HashTable<int, int> far larger than the last-level cache and compares:
+ * 1. build time with one-by-one insert vs insertBatch (which grows once up front);
+ * 2. average lookup cost of one-by-one search vs searchBatch (hash and prefetch the whole
+ *    group's buckets and nodes first) for batch sizes 1 to 64.
+ *(blank line)
+ * 各設定交錯執行 rounds 輪並取最小值。Each configuration runs in `rounds` interleaved rounds; the minimum is reported.
+ *(blank line)
+ * 用法 Usage: ./batch_lookup_benchmark [log2Entries=23] [lookups=4000000] [rounds=3]
+ */  // End of block comment
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <optional>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 32 位元雙射混合函數（murmur3 fmix32）：不重複且在桶間隨機分布的 key
+ * Bijective 32-bit mixer (murmur3 fmix32): unique keys spread randomly across buckets
+ */  // End of block comment
+int scrambleKey(uint32_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    x *= 0x85ebca6bu;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 13;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc2b2ae35u;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    return static_cast<int>(x);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    int log2Entries = (argc > 1) ? std::stoi(argv[1]) : 23;  // Assign or update a variable that represents the current algorithm state.
+    long long lookups = (argc > 2) ? std::stoll(argv[2]) : 4000000LL;  // Assign or update a variable that represents the current algorithm state.
+    int rounds = (argc > 3) ? std::stoi(argv[3]) : 3;  // Assign or update a variable that represents the current algorithm state.
+    if (log2Entries < 10 || log2Entries > 26 || lookups <= 0 || rounds <= 0) {  // Evaluate the condition and branch into the appropriate code path.
+        std::cerr << "log2Entries must be in [10, 26], lookups and rounds positive" << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    size_t entries = size_t{1} << log2Entries;  // Assign or update a variable that represents the current algorithm state.
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    std::vector<int> keys(entries);  // Execute this statement as part of the data structure implementation.
+    std::vector<int> values(entries);  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        keys[i] = scrambleKey(static_cast<uint32_t>(i));  // Assign or update a variable that represents the current algorithm state.
+        values[i] = static_cast<int>(i);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    std::cout << "HashTable<int, int>, entries=2^" << log2Entries << " lookups=" << lookups << std::endl << std::endl;  // Execute this statement as part of the data structure implementation.
+
+    // ---------- 建表 Build ----------
+    double oneByOneMs = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    {  // Execute this statement as part of the data structure implementation.
+        HashTable<int, int> table;  // Execute this statement as part of the data structure implementation.
+        Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+        for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            table.insert(keys[i], values[i]);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        oneByOneMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+        checksum += static_cast<long long>(table.size());  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    HashTable<int, int> table;  // Execute this statement as part of the data structure implementation.
+    Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    table.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+    double batchMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+    std::cout << std::fixed << std::setprecision(1) << "build: insert loop " << oneByOneMs << " ms, insertBatch "  // Execute this statement as part of the data structure implementation.
+              << batchMs << " ms" << std::endl << std::endl;  // Execute this statement as part of the data structure implementation.
+
+    // ---------- 查詢 Lookup ----------
+    std::vector<int> queries(static_cast<size_t>(lookups));  // Execute this statement as part of the data structure implementation.
+    uint64_t state = 0x9E3779B97F4A7C15ULL;  // Assign or update a variable that represents the current algorithm state.
+    for (int& query : queries) {  // Iterate over a range/collection to process each item in sequence.
+        state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+        query = keys[state % entries];  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    // 各設定交錯重複 rounds 輪、取最小值，降低共用主機上的雜訊 - Interleave rounds and keep the minimum to reduce noise on shared hosts
+    const size_t batchSizes[] = {0, 1, 2, 4, 8, 16, 32, 64};  // 0 = 逐一 search - 0 = one-by-one search
+    std::vector<double> best(sizeof(batchSizes) / sizeof(batchSizes[0]), 0.0);  // Execute this statement as part of the data structure implementation.
+    std::vector<int> batch;  // Execute this statement as part of the data structure implementation.
+    std::vector<std::optional<int>> out;  // Execute this statement as part of the data structure implementation.
+    for (int round = 0; round < rounds; ++round) {  // Iterate over a range/collection to process each item in sequence.
+        for (size_t config = 0; config < best.size(); ++config) {  // Iterate over a range/collection to process each item in sequence.
+            size_t batchSize = batchSizes[config];  // Assign or update a variable that represents the current algorithm state.
+            start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+            if (batchSize == 0) {  // Evaluate the condition and branch into the appropriate code path.
+                for (int query : queries) {  // Iterate over a range/collection to process each item in sequence.
+                    checksum += table.search(query).value_or(-1);  // Assign or update a variable that represents the current algorithm state.
+                }  // Close the current block scope.
+            } else {  // Handle the alternative branch when the condition is false.
+                for (size_t base = 0; base + batchSize <= queries.size(); base += batchSize) {  // Iterate over a range/collection to process each item in sequence.
+                    batch.assign(queries.begin() + base, queries.begin() + base + batchSize);  // Execute this statement as part of the data structure implementation.
+                    table.searchBatch(batch, out);  // Execute this statement as part of the data structure implementation.
+                    for (const std::optional<int>& found : out) {  // Iterate over a range/collection to process each item in sequence.
+                        checksum += found.value_or(-1);  // Assign or update a variable that represents the current algorithm state.
+                    }  // Close the current block scope.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+            double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / lookups;  // Assign or update a variable that represents the current algorithm state.
+            best[config] = (round == 0) ? ns : std::min(best[config], ns);  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    std::cout << std::setw(8) << "batch" << std::setw(14) << "ns/lookup" << std::setw(10) << "speedup" << std::endl;  // Execute this statement as part of the data structure implementation.
+    for (size_t config = 0; config < best.size(); ++config) {  // Iterate over a range/collection to process each item in sequence.
+        std::cout << std::setw(8) << (batchSizes[config] == 0 ? std::string("search") : std::to_string(batchSizes[config]))  // Execute this statement as part of the data structure implementation.
+                  << std::setw(14) << std::setprecision(1) << best[config]  // Execute this statement as part of the data structure implementation.
+                  << std::setw(10) << std::setprecision(2) << best[0] / best[config] << std::endl;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::cout << std::endl << "checksum=" << checksum << std::endl;  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -0,0 +1,147 @@
+/** Doc block start
+ * 異質查詢與移動插入 效能比較 / Heterogeneous lookup and move-aware insertion
+ *(blank line)
+ * 查詢：以 string_view 直接查詢，對照先建構 std::string 暫存物件再查詢。
+ * 插入：insert(const K&, const V&) 的複製，對照 try_emplace 搬入 key 與 value。
+ * key 與 value 都長於 SSO 緩衝區，因此每次複製都是一次堆積配置；配置次數以取代全域 operator new 的方式統計。
+ * Lookup: search by string_view directly vs building a std::string temporary first.
+ * Insert: copying insert(const K&, const V&) vs try_emplace moving the key and value in.
+ * Keys and values are longer than the SSO buffer, so every copy is a heap allocation;
+ * allocations are counted by replacing the global operator new.
+ *(blank line)
+ * 用法 Usage: ./heterogeneous_lookup_benchmark [entries=200000] [lookups=2000000] [keyLength=32]
+ */  // End of block comment
+
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <cstdlib>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <new>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <string_view>  // Execute this statement as part of the data structure implementation.
+#include <utility>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+// ========== 配置統計 Allocation Accounting ==========
+
+size_t g_allocations = 0;  // 累計配置次數 - Cumulative allocation count
+
+void* operator new(size_t n) {  // Execute this statement as part of the data structure implementation.
+    void* raw = std::malloc(n == 0 ? 1 : n);  // Assign or update a variable that represents the current algorithm state.
+    if (raw == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::bad_alloc();  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    ++g_allocations;  // Execute this statement as part of the data structure implementation.
+    return raw;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+void operator delete(void* p) noexcept {  // Execute this statement as part of the data structure implementation.
+    std::free(p);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+void operator delete(void* p, size_t) noexcept {  // Execute this statement as part of the data structure implementation.
+    std::free(p);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 產生固定長度、以編號結尾的 key / Build a fixed-length key that ends with its index
+ */  // End of block comment
+std::string makeKey(size_t index, size_t length) {  // Execute this statement as part of the data structure implementation.
+    std::string digits = std::to_string(index);  // Assign or update a variable that represents the current algorithm state.
+    std::string key(length > digits.size() ? length - digits.size() : 0, 'k');  // Assign or update a variable that represents the current algorithm state.
+    return key + digits;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 一列量測結果 / One row of results
+ */  // End of block comment
+struct Row {  // Execute this statement as part of the data structure implementation.
+    double ns;  // Execute this statement as part of the data structure implementation.
+    double allocsPerOp;  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+void printRow(const std::string& name, const Row& row) {  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(24) << name << std::fixed << std::setprecision(1) << std::setw(12) << row.ns  // Execute this statement as part of the data structure implementation.
+              << std::setprecision(2) << std::setw(14) << row.allocsPerOp << std::endl;  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    size_t entries = (argc > 1) ? std::stoul(argv[1]) : 200000;  // Assign or update a variable that represents the current algorithm state.
+    long long lookups = (argc > 2) ? std::stoll(argv[2]) : 2000000LL;  // Assign or update a variable that represents the current algorithm state.
+    size_t keyLength = (argc > 3) ? std::stoul(argv[3]) : 32;  // Assign or update a variable that represents the current algorithm state.
+    if (entries == 0 || lookups <= 0) {  // Evaluate the condition and branch into the appropriate code path.
+        std::cerr << "entries and lookups must be positive" << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+    const std::string valueTemplate(48, 'v');  // 超過 SSO 的值 - A value longer than SSO
+
+    // 兩份相同的輸入：一份給複製插入，一份讓 try_emplace 搬走 - Two identical inputs: one copied, one moved from
+    std::vector<std::string> keys;  // Execute this statement as part of the data structure implementation.
+    std::vector<std::string> values;  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        keys.push_back(makeKey(i, keyLength));  // Execute this statement as part of the data structure implementation.
+        values.push_back(valueTemplate);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::string> movableKeys = keys;  // Assign or update a variable that represents the current algorithm state.
+    std::vector<std::string> movableValues = values;  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "entries=" << entries << " lookups=" << lookups << " keyLength=" << keyLength  // Execute this statement as part of the data structure implementation.
+              << " valueLength=" << valueTemplate.size() << std::endl << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(24) << "operation" << std::setw(12) << "ns/op" << std::setw(14) << "allocs/op" << std::endl;  // Execute this statement as part of the data structure implementation.
+
+    // ---------- 插入 Insert ----------
+    HashTable<std::string, std::string> copied;  // Execute this statement as part of the data structure implementation.
+    size_t allocsBefore = g_allocations;  // Assign or update a variable that represents the current algorithm state.
+    Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        copied.insert(keys[i], values[i]);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / entries;  // Assign or update a variable that represents the current algorithm state.
+    printRow("insert (copy)", Row{ns, static_cast<double>(g_allocations - allocsBefore) / entries});  // Execute this statement as part of the data structure implementation.
+
+    HashTable<std::string, std::string> moved;  // Execute this statement as part of the data structure implementation.
+    allocsBefore = g_allocations;  // Assign or update a variable that represents the current algorithm state.
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        moved.try_emplace(std::move(movableKeys[i]), std::move(movableValues[i]));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / entries;  // Assign or update a variable that represents the current algorithm state.
+    printRow("try_emplace (move)", Row{ns, static_cast<double>(g_allocations - allocsBefore) / entries});  // Execute this statement as part of the data structure implementation.
+
+    // ---------- 查詢 Lookup ----------
+    // 呼叫端手上只有 string_view（例如切分後的輸入緩衝區）- The caller only holds string_views (e.g. slices of an input buffer)
+    std::vector<std::string_view> views(keys.begin(), keys.end());  // Execute this statement as part of the data structure implementation.
+    uint64_t state = 0x9E3779B97F4A7C15ULL;  // Assign or update a variable that represents the current algorithm state.
+    allocsBefore = g_allocations;  // Assign or update a variable that represents the current algorithm state.
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (long long i = 0; i < lookups; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+        std::string_view view = views[state % entries];  // Assign or update a variable that represents the current algorithm state.
+        checksum += copied.contains(std::string(view)) ? 1 : 0;  // 先建構暫存字串 - Temporary string first
+    }  // Close the current block scope.
+    ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / lookups;  // Assign or update a variable that represents the current algorithm state.
+    printRow("contains(std::string)", Row{ns, static_cast<double>(g_allocations - allocsBefore) / lookups});  // Execute this statement as part of the data structure implementation.
+
+    allocsBefore = g_allocations;  // Assign or update a variable that represents the current algorithm state.
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (long long i = 0; i < lookups; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+        std::string_view view = views[state % entries];  // Assign or update a variable that represents the current algorithm state.
+        checksum += copied.contains(view) ? 1 : 0;  // 異質查詢 - Heterogeneous lookup
+    }  // Close the current block scope.
+    ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / lookups;  // Assign or update a variable that represents the current algorithm state.
+    printRow("contains(string_view)", Row{ns, static_cast<double>(g_allocations - allocsBefore) / lookups});  // Execute this statement as part of the data structure implementation.
+
+    checksum += static_cast<long long>(copied.size() + moved.size());  // Assign or update a variable that represents the current algorithm state.
+    std::cout << std::endl << "checksum=" << checksum << std::endl;  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -0,0 +1,130 @@
+/** Doc block start
+ * 無鎖集合 vs 分片鎖 效能比較 / Lock-free set vs sharded locks throughput
+ *(blank line)
+ * 在 95% 讀取（2.5% 插入 / 2.5% 刪除）與 50% 讀取（25% / 25%）兩種混合下，
+ * 以 1 ~ maxThreads 個執行緒比較 SplitOrderedHashSet 與 ConcurrentHashMap 的吞吐量。
+ * Compares SplitOrderedHashSet with ConcurrentHashMap for 1 .. maxThreads threads under a
+ * 95%-read mix (2.5% insert / 2.5% remove) and a 50%-read mix (25% / 25%).
+ *(blank line)
+ * 用法 Usage: ./lockfree_set_benchmark [maxThreads=16] [totalOps=4000000] [keyRange=1048576]
+ */  // End of block comment
+
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <thread>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "ConcurrentHashMap.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SplitOrderedHashSet.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+// ========== 統一介面 Uniform Adapters ==========
+
+bool add(SplitOrderedHashSet<int>& s, int key) { return s.insert(key); }  // Return the computed result to the caller.
+bool drop(SplitOrderedHashSet<int>& s, int key) { return s.remove(key); }  // Return the computed result to the caller.
+bool has(SplitOrderedHashSet<int>& s, int key) { return s.contains(key); }  // Return the computed result to the caller.
+
+bool add(ConcurrentHashMap<int, bool>& m, int key) { m.insert(key, true); return true; }  // Return the computed result to the caller.
+bool drop(ConcurrentHashMap<int, bool>& m, int key) { return m.remove(key); }  // Return the computed result to the caller.
+bool has(ConcurrentHashMap<int, bool>& m, int key) { return m.contains(key); }  // Return the computed result to the caller.
+
+/** Doc block start
+ * 32 位元雙射混合函數（murmur3 fmix32）：std::hash<int> 是恆等映射，連續 key 會讓鏈結法的節點
+ * 恰好依記憶體順序排列而佔便宜；打散後兩種表面對相同的隨機存取
+ * Bijective 32-bit mixer (murmur3 fmix32): std::hash<int> is the identity, so sequential keys would
+ * hand the chained table memory-ordered nodes; scrambling gives both tables the same random access
+ */  // End of block comment
+int scrambleKey(uint32_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    x *= 0x85ebca6bu;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 13;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc2b2ae35u;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    return static_cast<int>(x);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * xorshift64：每個執行緒各自的便宜亂數 / xorshift64: a cheap per-thread random stream
+ */  // End of block comment
+uint64_t nextRandom(uint64_t& state) {  // Execute this statement as part of the data structure implementation.
+    state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+    state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+    state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+    return state;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 預先放入一半的 key，再以 threads 個執行緒平分 totalOps 次操作，回傳 Mops/s
+ * Prefill half the keys, split totalOps across threads, return Mops/s
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+double run(Table& table, int threads, long long totalOps, int keyRange, int readPercent, long long& checksum) {  // Execute this statement as part of the data structure implementation.
+    for (int key = 0; key < keyRange; key += 2) {  // Iterate over a range/collection to process each item in sequence.
+        add(table, scrambleKey(static_cast<uint32_t>(key)));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    long long perThread = totalOps / threads;  // Assign or update a variable that represents the current algorithm state.
+    std::vector<long long> hits(static_cast<size_t>(threads) * 8, 0);  // 間隔 8 個避免 false sharing - Stride 8 to avoid false sharing
+    Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    std::vector<std::thread> workers;  // Execute this statement as part of the data structure implementation.
+    for (int t = 0; t < threads; ++t) {  // Iterate over a range/collection to process each item in sequence.
+        workers.emplace_back([&table, &hits, t, perThread, keyRange, readPercent]() {  // Execute this statement as part of the data structure implementation.
+            uint64_t state = 0x9E3779B97F4A7C15ULL * static_cast<uint64_t>(t + 1);  // Assign or update a variable that represents the current algorithm state.
+            long long local = 0;  // Assign or update a variable that represents the current algorithm state.
+            for (long long i = 0; i < perThread; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                uint64_t r = nextRandom(state);  // Assign or update a variable that represents the current algorithm state.
+                int key = scrambleKey(static_cast<uint32_t>((r >> 8) % static_cast<uint64_t>(keyRange)));  // Assign or update a variable that represents the current algorithm state.
+                int dice = static_cast<int>(r % 200);  // 0.5% 的粒度 - 0.5% granularity
+                if (dice < readPercent * 2) {  // Evaluate the condition and branch into the appropriate code path.
+                    local += has(table, key);  // Execute this statement as part of the data structure implementation.
+                } else if ((dice & 1) == 0) {  // 其餘一半插入、一半刪除 - Remaining ops: half insert, half remove
+                    local += add(table, key);  // Execute this statement as part of the data structure implementation.
+                } else {  // Handle the alternative branch when the condition is false.
+                    local += drop(table, key);  // Execute this statement as part of the data structure implementation.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+            hits[static_cast<size_t>(t) * 8] = local;  // Assign or update a variable that represents the current algorithm state.
+        });  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (auto& worker : workers) {  // Iterate over a range/collection to process each item in sequence.
+        worker.join();  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+    for (long long h : hits) {  // Iterate over a range/collection to process each item in sequence.
+        checksum += h;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return static_cast<double>(perThread * threads) / seconds / 1e6;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    int maxThreads = (argc > 1) ? std::stoi(argv[1]) : 16;  // Assign or update a variable that represents the current algorithm state.
+    long long totalOps = (argc > 2) ? std::stoll(argv[2]) : 4000000LL;  // Assign or update a variable that represents the current algorithm state.
+    int keyRange = (argc > 3) ? std::stoi(argv[3]) : (1 << 20);  // Assign or update a variable that represents the current algorithm state.
+    const int readMixes[] = {95, 50};  // Assign or update a variable that represents the current algorithm state.
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "totalOps=" << totalOps << " keyRange=" << keyRange  // Execute this statement as part of the data structure implementation.
+              << " hardware_concurrency=" << std::thread::hardware_concurrency() << " (Mops/s)" << std::endl;  // Execute this statement as part of the data structure implementation.
+    for (int readPercent : readMixes) {  // Iterate over a range/collection to process each item in sequence.
+        std::cout << std::endl << readPercent << "% reads" << std::endl;  // Execute this statement as part of the data structure implementation.
+        std::cout << std::setw(8) << "threads" << std::setw(18) << "SplitOrdered" << std::setw(22) << "ConcurrentHashMap" << std::endl;  // Execute this statement as part of the data structure implementation.
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {  // Iterate over a range/collection to process each item in sequence.
+            double lockFree = 0.0;  // Assign or update a variable that represents the current algorithm state.
+            double sharded = 0.0;  // Assign or update a variable that represents the current algorithm state.
+            {  // Execute this statement as part of the data structure implementation.
+                SplitOrderedHashSet<int> set;  // Execute this statement as part of the data structure implementation.
+                lockFree = run(set, threads, totalOps, keyRange, readPercent, checksum);  // Assign or update a variable that represents the current algorithm state.
+            }  // Close the current block scope.
+            {  // Execute this statement as part of the data structure implementation.
+                ConcurrentHashMap<int, bool> map(64);  // Execute this statement as part of the data structure implementation.
+                sharded = run(map, threads, totalOps, keyRange, readPercent, checksum);  // Assign or update a variable that represents the current algorithm state.
+            }  // Close the current block scope.
+            std::cout << std::setw(8) << threads << std::fixed << std::setprecision(2)  // Execute this statement as part of the data structure implementation.
+                      << std::setw(18) << lockFree << std::setw(22) << sharded << std::endl;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    std::cout << std::endl << "checksum=" << checksum << std::endl;  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
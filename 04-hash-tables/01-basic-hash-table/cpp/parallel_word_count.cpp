@@ -0,0 +1,168 @@
+/** Doc block start
+ * 多執行緒單字計數（Parallel Word Count）
+ * Multi-threaded word counting with ConcurrentHashMap
+ *(blank line)
+ * 把輸入切成 T 段（切點對齊到空白字元），每個執行緒以 upsert 累加共用的 ConcurrentHashMap，
+ * 並與單執行緒 HashTable 比較吞吐量（1 ~ maxThreads 個執行緒）。
+ * Splits the input into T chunks (cut points aligned to whitespace); each thread upserts into a shared
+ * ConcurrentHashMap. Throughput for 1 .. maxThreads threads is compared with a single-threaded HashTable.
+ *(blank line)
+ * 用法 Usage: ./parallel_word_count [file|-] [maxThreads=64]
+ *   沒有檔案（或 "-"）時產生約 32 MB 的合成文字 / Without a file (or "-") about 32 MB of synthetic text is generated
+ */  // End of block comment
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <cctype>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cmath>  // Execute this statement as part of the data structure implementation.
+#include <fstream>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <random>  // Execute this statement as part of the data structure implementation.
+#include <sstream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <thread>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "ConcurrentHashMap.hpp"  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 逐一取出 [begin, end) 中以空白分隔的單字，只保留字母並轉小寫（與 example_word_count 的 cleanWord 相同）
+ * Walk whitespace-separated words in [begin, end), keeping lowercase letters only (same as cleanWord in example_word_count)
+ */  // End of block comment
+template <typename Fn>  // Execute this statement as part of the data structure implementation.
+void forEachWord(const char* begin, const char* end, Fn&& fn) {  // Execute this statement as part of the data structure implementation.
+    std::string word;  // 重複使用同一個緩衝區 - Reuse one buffer
+    for (const char* p = begin; p != end; ++p) {  // Iterate over a range/collection to process each item in sequence.
+        unsigned char c = static_cast<unsigned char>(*p);  // Assign or update a variable that represents the current algorithm state.
+        if (std::isspace(c)) {  // 單字結束 - End of a word
+            if (!word.empty()) {  // Evaluate the condition and branch into the appropriate code path.
+                fn(word);  // Execute this statement as part of the data structure implementation.
+                word.clear();  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        } else if (std::isalpha(c)) {  // Evaluate the condition and branch into the appropriate code path.
+            word += static_cast<char>(std::tolower(c));  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    if (!word.empty()) {  // Evaluate the condition and branch into the appropriate code path.
+        fn(word);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 產生合成文字：詞彙量 50000，單字排名呈對數均勻分佈（少數高頻字、長尾低頻字）
+ * Generate synthetic text: 50000-word vocabulary with log-uniform ranks (a few hot words, a long tail)
+ */  // End of block comment
+std::string makeSyntheticText(size_t bytes) {  // Execute this statement as part of the data structure implementation.
+    const int vocabulary = 50000;  // Assign or update a variable that represents the current algorithm state.
+    std::vector<std::string> words(vocabulary);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < vocabulary; ++i) {  // 以 26 進位把排名寫成字母 - Spell each rank in base 26
+        int n = i;  // Assign or update a variable that represents the current algorithm state.
+        do {  // Execute this statement as part of the data structure implementation.
+            words[i] += static_cast<char>('a' + n % 26);  // Assign or update a variable that represents the current algorithm state.
+            n /= 26;  // Assign or update a variable that represents the current algorithm state.
+        } while (n > 0);  // Repeat while the loop condition remains true.
+    }  // Close the current block scope.
+
+    std::mt19937 rng(12345u);  // Execute this statement as part of the data structure implementation.
+    std::uniform_real_distribution<double> u(0.0, 1.0);  // Execute this statement as part of the data structure implementation.
+    std::string text;  // Execute this statement as part of the data structure implementation.
+    text.reserve(bytes + 16);  // Execute this statement as part of the data structure implementation.
+    while (text.size() < bytes) {  // Repeat while the loop condition remains true.
+        int rank = static_cast<int>(std::pow(static_cast<double>(vocabulary), u(rng))) - 1;  // Assign or update a variable that represents the current algorithm state.
+        text += words[std::min(std::max(rank, 0), vocabulary - 1)];  // Execute this statement as part of the data structure implementation.
+        text += (text.size() % 80 < 8) ? '\n' : ' ';  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return text;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 把文字切成 parts 段，每個切點往後移到空白字元，確保單字不會被切斷
+ * Split text into parts chunks, moving each cut forward to whitespace so no word is split
+ */  // End of block comment
+std::vector<size_t> splitPoints(const std::string& text, size_t parts) {  // Execute this statement as part of the data structure implementation.
+    std::vector<size_t> cuts(parts + 1, text.size());  // Execute this statement as part of the data structure implementation.
+    cuts[0] = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 1; i < parts; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        size_t cut = std::max(cuts[i - 1], text.size() * i / parts);  // Assign or update a variable that represents the current algorithm state.
+        while (cut < text.size() && !std::isspace(static_cast<unsigned char>(text[cut]))) {  // Repeat while the loop condition remains true.
+            ++cut;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        cuts[i] = cut;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    return cuts;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    std::string path = (argc > 1) ? argv[1] : "-";  // Assign or update a variable that represents the current algorithm state.
+    int maxThreads = (argc > 2) ? std::stoi(argv[2]) : 64;  // Assign or update a variable that represents the current algorithm state.
+
+    std::string text;  // Execute this statement as part of the data structure implementation.
+    if (path == "-") {  // Evaluate the condition and branch into the appropriate code path.
+        text = makeSyntheticText(32u << 20);  // Assign or update a variable that represents the current algorithm state.
+    } else {  // Handle the alternative branch when the condition is false.
+        std::ifstream in(path, std::ios::binary);  // Execute this statement as part of the data structure implementation.
+        if (!in) {  // Evaluate the condition and branch into the appropriate code path.
+            std::cerr << "無法開啟檔案 Cannot open file: " << path << std::endl;  // Execute this statement as part of the data structure implementation.
+            return 1;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        std::ostringstream buffer;  // Execute this statement as part of the data structure implementation.
+        buffer << in.rdbuf();  // Execute this statement as part of the data structure implementation.
+        text = buffer.str();  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    // 基準：單執行緒 HashTable - Baseline: single-threaded HashTable
+    Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    HashTable<std::string, int> baseline;  // Execute this statement as part of the data structure implementation.
+    long long totalWords = 0;  // Assign or update a variable that represents the current algorithm state.
+    forEachWord(text.data(), text.data() + text.size(), [&](const std::string& word) {  // Execute this statement as part of the data structure implementation.
+        baseline[word]++;  // Execute this statement as part of the data structure implementation.
+        ++totalWords;  // Execute this statement as part of the data structure implementation.
+    });  // Execute this statement as part of the data structure implementation.
+    double baseSeconds = std::chrono::duration<double>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "=== 多執行緒單字計數 Parallel Word Count ===" << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << "bytes=" << text.size() << " words=" << totalWords << " distinct=" << baseline.size()  // Execute this statement as part of the data structure implementation.
+              << " hardware_concurrency=" << std::thread::hardware_concurrency() << std::endl << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::left << std::setw(32) << "table" << std::right << std::setw(10) << "seconds"  // Execute this statement as part of the data structure implementation.
+              << std::setw(12) << "Mwords/s" << std::setw(10) << "speedup" << std::setw(10) << "check" << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::left << std::setw(32) << "HashTable (1 thread)" << std::right << std::fixed << std::setprecision(3)  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << baseSeconds << std::setw(12) << totalWords / baseSeconds / 1e6  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << 1.0 << std::setw(10) << "-" << std::endl;  // Execute this statement as part of the data structure implementation.
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {  // Iterate over a range/collection to process each item in sequence.
+        ConcurrentHashMap<std::string, int> counter(256);  // 分片數遠多於執行緒數，降低同分片競爭 - Many more shards than threads
+        std::vector<size_t> cuts = splitPoints(text, static_cast<size_t>(threads));  // Assign or update a variable that represents the current algorithm state.
+        start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+        std::vector<std::thread> workers;  // Execute this statement as part of the data structure implementation.
+        for (int t = 0; t < threads; ++t) {  // Iterate over a range/collection to process each item in sequence.
+            workers.emplace_back([&text, &cuts, &counter, t]() {  // Execute this statement as part of the data structure implementation.
+                forEachWord(text.data() + cuts[t], text.data() + cuts[t + 1], [&counter](const std::string& word) {  // Execute this statement as part of the data structure implementation.
+                    counter.upsert(word, [](int& count) { ++count; });  // Execute this statement as part of the data structure implementation.
+                });  // Execute this statement as part of the data structure implementation.
+            });  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        for (auto& worker : workers) {  // Iterate over a range/collection to process each item in sequence.
+            worker.join();  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+
+        // 與基準逐一比對計數 - Compare every count with the baseline
+        bool ok = counter.size() == baseline.size();  // Assign or update a variable that represents the current algorithm state.
+        counter.forEach([&baseline, &ok](const std::string& word, int count) {  // Execute this statement as part of the data structure implementation.
+            ok = ok && baseline.contains(word) && baseline.at(word) == count;  // Assign or update a variable that represents the current algorithm state.
+        });  // Execute this statement as part of the data structure implementation.
+
+        std::string label = "ConcurrentHashMap (" + std::to_string(threads) + (threads == 1 ? " thread)" : " threads)");  // Assign or update a variable that represents the current algorithm state.
+        std::cout << std::left << std::setw(32) << label << std::right  // Execute this statement as part of the data structure implementation.
+                  << std::setw(10) << seconds << std::setw(12) << totalWords / seconds / 1e6  // Execute this statement as part of the data structure implementation.
+                  << std::setw(10) << baseSeconds / seconds << std::setw(10) << (ok ? "ok" : "MISMATCH") << std::endl;  // Execute this statement as part of the data structure implementation.
+        if (!ok) {  // Evaluate the condition and branch into the appropriate code path.
+            return 1;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -0,0 +1,169 @@
+/** Doc block start
+ * 完美雜湊檔案 vs 啟動時重建 HashTable 效能比較 / Perfect hash file vs rebuilding HashTable at startup
+ *(blank line)
+ * 模擬靜態符號表：先把 key 寫成文字檔（每行一個），比較兩種啟動方式：
+ * 1. 讀文字檔並逐一 HashTable::insert（目前每次啟動的做法）；
+ * 2. 開啟預先建好的完美雜湊檔（mmap + 驗證標頭）。
+ * 另外量測建置時間、每個 key 的檔案位元組數，以及隨機命中／未命中的查詢耗時。
+ * Simulates a static symbol table: the keys are first written to a text file (one per line), then
+ * two ways of starting up are compared:
+ * 1. read the text file and HashTable::insert each key (what every start does today);
+ * 2. open the prebuilt perfect hash file (mmap + header validation).
+ * Build time, file bytes per key, and random hit / miss lookup latency are reported as well.
+ *(blank line)
+ * 檔案都在頁面快取中（暖啟動）；冷啟動時 mmap 版本只會載入實際被查到的頁面。
+ * Files are in the page cache (warm start); on a cold start the mmap version only faults in the
+ * pages that lookups actually touch.
+ *(blank line)
+ * 用法 Usage: ./perfect_hash_benchmark [entries=1000000] [lookups=4000000] [rounds=3] [directory=.]
+ */  // End of block comment
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <cstdio>  // Execute this statement as part of the data structure implementation.
+#include <fstream>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <optional>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+#include "PerfectHash.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 32 位元雙射混合函數（murmur3 fmix32）：不重複的識別字編號
+ * Bijective 32-bit mixer (murmur3 fmix32): unique identifier numbers
+ */  // End of block comment
+uint32_t scrambleKey(uint32_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    x *= 0x85ebca6bu;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 13;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc2b2ae35u;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    return x;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+double elapsedMs(Clock::time_point start) {  // Execute this statement as part of the data structure implementation.
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 讀文字檔並逐一插入：目前每次啟動重建查詢表的方式
+ * Read the text file and insert line by line: how the lookup table is rebuilt at every start today
+ */  // End of block comment
+void rebuildFromText(const std::string& path, HashTable<std::string, uint32_t>& table) {  // Execute this statement as part of the data structure implementation.
+    std::ifstream in(path);  // Execute this statement as part of the data structure implementation.
+    std::string line;  // Execute this statement as part of the data structure implementation.
+    uint32_t lineNumber = 0;  // Assign or update a variable that represents the current algorithm state.
+    while (std::getline(in, line)) {  // Repeat while the loop condition remains true.
+        table.try_emplace(std::move(line), lineNumber++);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    size_t entries = (argc > 1) ? std::stoul(argv[1]) : 1000000;  // Assign or update a variable that represents the current algorithm state.
+    long long lookups = (argc > 2) ? std::stoll(argv[2]) : 4000000LL;  // Assign or update a variable that represents the current algorithm state.
+    int rounds = (argc > 3) ? std::stoi(argv[3]) : 3;  // Assign or update a variable that represents the current algorithm state.
+    std::string directory = (argc > 4) ? argv[4] : ".";  // Assign or update a variable that represents the current algorithm state.
+    if (entries == 0 || entries > 0xFFFFFFFFu || lookups <= 0 || rounds <= 0) {  // Evaluate the condition and branch into the appropriate code path.
+        std::cerr << "entries must be in [1, 2^32), lookups and rounds positive" << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    const std::string textPath = directory + "/perfect_hash_benchmark.txt";  // Assign or update a variable that represents the current algorithm state.
+    const std::string phfPath = directory + "/perfect_hash_benchmark.phf";  // Assign or update a variable that represents the current algorithm state.
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    // 識別字形式的 key（12 ~ 21 位元組）- Identifier-like keys (12 to 21 bytes)
+    std::vector<std::string> keys(entries);  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        keys[i] = "symbol_" + std::to_string(scrambleKey(static_cast<uint32_t>(i)));  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    {  // Execute this statement as part of the data structure implementation.
+        std::ofstream out(textPath);  // Execute this statement as part of the data structure implementation.
+        for (const std::string& key : keys) {  // Iterate over a range/collection to process each item in sequence.
+            out << key << '\n';  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    std::vector<std::string> hits(static_cast<size_t>(lookups));  // Execute this statement as part of the data structure implementation.
+    std::vector<std::string> misses(static_cast<size_t>(lookups));  // Execute this statement as part of the data structure implementation.
+    uint64_t state = 0x9E3779B97F4A7C15ULL;  // Assign or update a variable that represents the current algorithm state.
+    for (long long i = 0; i < lookups; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+        hits[i] = keys[state % entries];  // Assign or update a variable that represents the current algorithm state.
+        misses[i] = "symbol_x" + std::to_string(state % entries);  // 前綴相同但不在集合中 - Same prefix, never in the set
+    }  // Close the current block scope.
+
+    // ---------- 啟動：重建 HashTable Startup: rebuild HashTable ----------
+    double rebuildMs = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    HashTable<std::string, uint32_t> table;  // Execute this statement as part of the data structure implementation.
+    for (int round = 0; round < rounds; ++round) {  // Iterate over a range/collection to process each item in sequence.
+        HashTable<std::string, uint32_t> scratch;  // Execute this statement as part of the data structure implementation.
+        Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+        rebuildFromText(textPath, scratch);  // Execute this statement as part of the data structure implementation.
+        double ms = elapsedMs(start);  // Assign or update a variable that represents the current algorithm state.
+        rebuildMs = (round == 0) ? ms : std::min(rebuildMs, ms);  // Assign or update a variable that represents the current algorithm state.
+        if (round == rounds - 1) {  // Evaluate the condition and branch into the appropriate code path.
+            table = std::move(scratch);  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    // ---------- 建置完美雜湊檔 Build the perfect hash file ----------
+    Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    PerfectHashBuildStats stats = PerfectHashBuilder<std::string, uint32_t>::fromTable(table).writeFile(phfPath);  // Assign or update a variable that represents the current algorithm state.
+    double buildMs = elapsedMs(start);  // Assign or update a variable that represents the current algorithm state.
+
+    // ---------- 啟動：開啟映射 Startup: open the mapping ----------
+    double openUs = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    for (int round = 0; round < rounds; ++round) {  // Iterate over a range/collection to process each item in sequence.
+        start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+        MappedPerfectHashTable<std::string, uint32_t> probe(phfPath);  // Execute this statement as part of the data structure implementation.
+        checksum += probe.search(keys[0]).value_or(0);  // 含第一次查詢 - Includes the first lookup
+        double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+        openUs = (round == 0) ? us : std::min(openUs, us);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    MappedPerfectHashTable<std::string, uint32_t> mapped(phfPath);  // Execute this statement as part of the data structure implementation.
+
+    // ---------- 查詢 Lookup ----------
+    double tableHitNs = 0.0, mappedHitNs = 0.0, tableMissNs = 0.0, mappedMissNs = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    auto measure = [&](auto&& lookup, const std::vector<std::string>& queries, double& best, int round) {  // Execute this statement as part of the data structure implementation.
+        Clock::time_point begin = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+        for (const std::string& query : queries) {  // Iterate over a range/collection to process each item in sequence.
+            checksum += lookup(query);  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - begin).count() / queries.size();  // Assign or update a variable that represents the current algorithm state.
+        best = (round == 0) ? ns : std::min(best, ns);  // Assign or update a variable that represents the current algorithm state.
+    };  // Execute this statement as part of the data structure implementation.
+    auto viaTable = [&table](const std::string& key) { return table.search(key).value_or(0); };  // Return the computed result to the caller.
+    auto viaMapped = [&mapped](const std::string& key) { return mapped.search(key).value_or(0); };  // Return the computed result to the caller.
+    for (int round = 0; round < rounds; ++round) {  // 交錯執行、取最小值 - Interleaved, minimum kept
+        measure(viaTable, hits, tableHitNs, round);  // Execute this statement as part of the data structure implementation.
+        measure(viaMapped, hits, mappedHitNs, round);  // Execute this statement as part of the data structure implementation.
+        measure(viaTable, misses, tableMissNs, round);  // Execute this statement as part of the data structure implementation.
+        measure(viaMapped, misses, mappedMissNs, round);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    double keyBytes = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    for (const std::string& key : keys) {  // Iterate over a range/collection to process each item in sequence.
+        keyBytes += static_cast<double>(key.size());  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    std::cout << std::fixed << std::setprecision(1);  // Execute this statement as part of the data structure implementation.
+    std::cout << "entries=" << entries << " (avg key " << keyBytes / entries << " B, value 4 B) lookups=" << lookups << std::endl << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << "perfect hash build:  " << buildMs << " ms (" << stats.attempts << " seed(s), "  // Execute this statement as part of the data structure implementation.
+              << stats.buckets << " buckets, max displacement " << stats.maxDisplacement << ")" << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setprecision(2) << "file size:           " << static_cast<double>(stats.fileBytes) / entries << " B/key ("  // Execute this statement as part of the data structure implementation.
+              << 4.0 * stats.buckets / entries << " B/key displacement index)" << std::endl << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setprecision(1) << std::setw(22) << "" << std::setw(14) << "HashTable" << std::setw(14) << "mmap PHF" << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(22) << "startup (ms)" << std::setw(14) << rebuildMs << std::setw(14) << std::setprecision(3) << openUs / 1000.0 << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setprecision(1) << std::setw(22) << "hit lookup (ns)" << std::setw(14) << tableHitNs << std::setw(14) << mappedHitNs << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(22) << "miss lookup (ns)" << std::setw(14) << tableMissNs << std::setw(14) << mappedMissNs << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::endl << "checksum=" << checksum << std::endl;  // Execute this statement as part of the data structure implementation.
+
+    std::remove(textPath.c_str());  // Execute this statement as part of the data structure implementation.
+    std::remove(phfPath.c_str());  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -0,0 +1,120 @@
+/** Doc block start
+ * 漸進式擴容 vs 一次性擴容 尾端延遲比較 / Incremental vs stop-the-world rehash tail latency
+ *(blank line)
+ * 將 totalKeys 個打散的 key 插入從 16 個桶開始成長的 HashTable，每 batch 次插入計時一次
+ * （模擬一個請求），回報 p50 / p99 / p99.9 / p99.99 / max。
+ * 「一次性」模式在每次插入後若偵測到擴容開始，就在計時區間內以 rehashStep(SIZE_MAX) 立刻搬完，
+ * 重現舊版 rehash() 一口氣搬移所有元素的停頓。
+ * Inserts totalKeys scrambled keys into a HashTable that grows from 16 buckets, timing every
+ * `batch` inserts as one request, and reports p50 / p99 / p99.9 / p99.99 / max.
+ * The stop-the-world mode finishes any rehash that an insert started with rehashStep(SIZE_MAX)
+ * inside the timed region, reproducing the pause of moving every entry at once.
+ *(blank line)
+ * 一次性擴容在整段插入過程中只發生約 log2(n) 次，逐次計時時落在 p99.99 之外的區域；
+ * 請求越大（batch 越大），停頓越常落入 p99.9。預設依序量測 batch = 1、64、512。
+ * A stop-the-world rehash happens only about log2(n) times over the whole run, so per-insert timing
+ * pushes it beyond p99.99; the larger the request (batch), the more often a pause lands in p99.9.
+ * By default batch = 1, 64 and 512 are measured in turn.
+ *(blank line)
+ * 用法 Usage: ./rehash_latency_benchmark [totalKeys=4000000] [batch=1,64,512] [rounds=2]
+ */  // End of block comment
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 32 位元雙射混合函數（murmur3 fmix32）：讓 key 在桶間隨機分布
+ * Bijective 32-bit mixer (murmur3 fmix32): spreads keys randomly across buckets
+ */  // End of block comment
+int scrambleKey(uint32_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    x *= 0x85ebca6bu;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 13;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc2b2ae35u;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    return static_cast<int>(x);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 插入所有 key，回傳每個 batch 的耗時（奈秒）/ Insert every key, returning each batch's time in ns
+ */  // End of block comment
+std::vector<double> run(bool stopTheWorld, long long totalKeys, int batch, long long& checksum) {  // Execute this statement as part of the data structure implementation.
+    HashTable<int, int> table;  // Execute this statement as part of the data structure implementation.
+    std::vector<double> samples;  // Execute this statement as part of the data structure implementation.
+    samples.reserve(static_cast<size_t>(totalKeys / batch + 1));  // Execute this statement as part of the data structure implementation.
+    for (long long base = 0; base < totalKeys; base += batch) {  // Iterate over a range/collection to process each item in sequence.
+        long long limit = std::min(totalKeys, base + batch);  // Assign or update a variable that represents the current algorithm state.
+        Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+        for (long long i = base; i < limit; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            table.insert(scrambleKey(static_cast<uint32_t>(i)), static_cast<int>(i));  // Execute this statement as part of the data structure implementation.
+            if (stopTheWorld && table.isRehashing()) {  // Evaluate the condition and branch into the appropriate code path.
+                table.rehashStep(SIZE_MAX);  // 立刻搬完 - Migrate everything now
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        samples.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    checksum += static_cast<long long>(table.size()) + table.at(scrambleKey(0));  // Assign or update a variable that represents the current algorithm state.
+    return samples;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 排序後取百分位數 / Percentile of a sorted sample vector
+ */  // End of block comment
+double percentile(const std::vector<double>& sorted, double p) {  // Execute this statement as part of the data structure implementation.
+    size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));  // Assign or update a variable that represents the current algorithm state.
+    return sorted[index];  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    long long totalKeys = (argc > 1) ? std::stoll(argv[1]) : 4000000LL;  // Assign or update a variable that represents the current algorithm state.
+    std::vector<int> batches = {1, 64, 512};  // Assign or update a variable that represents the current algorithm state.
+    if (argc > 2) {  // Evaluate the condition and branch into the appropriate code path.
+        batches = {std::stoi(argv[2])};  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    int rounds = (argc > 3) ? std::stoi(argv[3]) : 2;  // Assign or update a variable that represents the current algorithm state.
+    if (totalKeys <= 0 || batches.front() <= 0 || rounds <= 0) {  // Evaluate the condition and branch into the appropriate code path.
+        std::cerr << "totalKeys, batch and rounds must be positive" << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "totalKeys=" << totalKeys << " rounds=" << rounds  // Execute this statement as part of the data structure implementation.
+              << " (microseconds per batch, pooled over rounds)" << std::endl;  // Execute this statement as part of the data structure implementation.
+    for (int batch : batches) {  // Iterate over a range/collection to process each item in sequence.
+        std::cout << std::endl << "batch=" << batch << std::endl;  // Execute this statement as part of the data structure implementation.
+        std::cout << std::setw(16) << "mode" << std::setw(10) << "p50" << std::setw(10) << "p99"  // Execute this statement as part of the data structure implementation.
+                  << std::setw(10) << "p99.9" << std::setw(10) << "p99.99" << std::setw(12) << "max"  // Execute this statement as part of the data structure implementation.
+                  << std::setw(12) << "total(ms)" << std::endl;  // Execute this statement as part of the data structure implementation.
+        for (int mode = 0; mode < 2; ++mode) {  // Iterate over a range/collection to process each item in sequence.
+            bool stopTheWorld = (mode == 1);  // Assign or update a variable that represents the current algorithm state.
+            std::vector<double> pooled;  // Execute this statement as part of the data structure implementation.
+            double totalNs = 0.0;  // Assign or update a variable that represents the current algorithm state.
+            for (int r = 0; r < rounds; ++r) {  // Iterate over a range/collection to process each item in sequence.
+                std::vector<double> samples = run(stopTheWorld, totalKeys, batch, checksum);  // Execute this statement as part of the data structure implementation.
+                for (double s : samples) {  // Iterate over a range/collection to process each item in sequence.
+                    totalNs += s;  // Assign or update a variable that represents the current algorithm state.
+                }  // Close the current block scope.
+                pooled.insert(pooled.end(), samples.begin(), samples.end());  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            std::sort(pooled.begin(), pooled.end());  // Execute this statement as part of the data structure implementation.
+            std::cout << std::setw(16) << (stopTheWorld ? "stop-the-world" : "incremental")  // Execute this statement as part of the data structure implementation.
+                      << std::fixed << std::setprecision(1)  // Execute this statement as part of the data structure implementation.
+                      << std::setw(10) << percentile(pooled, 0.50) / 1e3  // Execute this statement as part of the data structure implementation.
+                      << std::setw(10) << percentile(pooled, 0.99) / 1e3  // Execute this statement as part of the data structure implementation.
+                      << std::setw(10) << percentile(pooled, 0.999) / 1e3  // Execute this statement as part of the data structure implementation.
+                      << std::setw(10) << percentile(pooled, 0.9999) / 1e3  // Execute this statement as part of the data structure implementation.
+                      << std::setw(12) << pooled.back() / 1e3  // Execute this statement as part of the data structure implementation.
+                      << std::setw(12) << totalNs / rounds / 1e6 << std::endl;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    std::cout << std::endl << "checksum=" << checksum << std::endl;  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
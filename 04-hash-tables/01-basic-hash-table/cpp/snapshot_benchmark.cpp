@@ -0,0 +1,174 @@
+/** Doc block start
+ * 快照存檔／載入吞吐量 / Snapshot save and load throughput
+ *(blank line)
+ * 兩種表：HashTable<uint64_t, uint64_t>（固定大小，可用 mmap 載入）與
+ * HashTable<std::string, std::string>（變長）。量測：
+ * 1. saveSnapshot 串流存檔；
+ * 2. loadSnapshot 串流載入（預先擴容）；
+ * 3. loadSnapshotMapped（僅固定大小）；
+ * 4. 對照組：從記憶體中的陣列 reserve 後逐一插入，也就是載入成本中屬於「建表」的部分；
+ * 5. 只算校驗和。
+ * 吞吐量以檔案位元組數 / 秒計算（GB = 10^9 位元組）。檔案都在頁面快取中，量到的是 CPU 端成本而不是磁碟。
+ * Two tables: HashTable<uint64_t, uint64_t> (fixed size, eligible for the mmap loader) and
+ * HashTable<std::string, std::string> (variable length). Measured:
+ * 1. saveSnapshot streaming save;
+ * 2. loadSnapshot streaming load (presized);
+ * 3. loadSnapshotMapped (fixed size only);
+ * 4. baseline: reserve and insert from in-memory arrays, i.e. the table-building share of a load;
+ * 5. the checksum alone.
+ * Throughput is file bytes per second (GB = 10^9 bytes). Files sit in the page cache, so this is the
+ * CPU-side cost, not the disk.
+ *(blank line)
+ * 各設定交錯執行 rounds 輪並取最小值。Each configuration runs in `rounds` interleaved rounds; the minimum is reported.
+ *(blank line)
+ * 用法 Usage: ./snapshot_benchmark [entries=2000000] [rounds=3] [directory=.]
+ */  // End of block comment
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <cstdio>  // Execute this statement as part of the data structure implementation.
+#include <functional>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+#include "Snapshot.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 64 位元雙射混合函數（murmur3 fmix64）：不重複且隨機分布的 key
+ * Bijective 64-bit mixer (murmur3 fmix64): unique, randomly spread keys
+ */  // End of block comment
+uint64_t scrambleKey(uint64_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 33;  // Execute this statement as part of the data structure implementation.
+    x *= 0xff51afd7ed558ccdULL;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 33;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc4ceb9fe1a85ec53ULL;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 33;  // Execute this statement as part of the data structure implementation.
+    return x;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 一列量測：名稱與每輪的執行函式，回傳處理的位元組數
+ * One measured row: a name and a per-round function returning the bytes it processed
+ */  // End of block comment
+struct Row {  // Execute this statement as part of the data structure implementation.
+    std::string name;  // Execute this statement as part of the data structure implementation.
+    std::function<uint64_t()> run;  // Execute this statement as part of the data structure implementation.
+    double bestMs = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    uint64_t bytes = 0;  // Assign or update a variable that represents the current algorithm state.
+};  // Execute this statement as part of the data structure implementation.
+
+void runRows(std::vector<Row>& rows, int rounds) {  // Execute this statement as part of the data structure implementation.
+    for (int round = 0; round < rounds; ++round) {  // 交錯執行、取最小值 - Interleaved, minimum kept
+        for (Row& row : rows) {  // Iterate over a range/collection to process each item in sequence.
+            Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+            row.bytes = row.run();  // Assign or update a variable that represents the current algorithm state.
+            double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+            row.bestMs = (round == 0) ? ms : std::min(row.bestMs, ms);  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    for (const Row& row : rows) {  // Iterate over a range/collection to process each item in sequence.
+        std::cout << std::setw(28) << row.name << std::fixed << std::setprecision(1) << std::setw(12) << row.bestMs  // Execute this statement as part of the data structure implementation.
+                  << std::setprecision(2) << std::setw(10) << row.bytes / (row.bestMs * 1e6) << std::endl;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+void printHeader(const std::string& title, size_t entries, uint64_t fileBytes) {  // Execute this statement as part of the data structure implementation.
+    std::cout << std::endl << title << ", entries=" << entries << ", file " << std::fixed << std::setprecision(1)  // Execute this statement as part of the data structure implementation.
+              << fileBytes / 1e6 << " MB" << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(28) << "operation" << std::setw(12) << "ms" << std::setw(10) << "GB/s" << std::endl;  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    size_t entries = (argc > 1) ? std::stoul(argv[1]) : 2000000;  // Assign or update a variable that represents the current algorithm state.
+    int rounds = (argc > 2) ? std::stoi(argv[2]) : 3;  // Assign or update a variable that represents the current algorithm state.
+    std::string directory = (argc > 3) ? argv[3] : ".";  // Assign or update a variable that represents the current algorithm state.
+    if (entries == 0 || rounds <= 0) {  // Evaluate the condition and branch into the appropriate code path.
+        std::cerr << "entries and rounds must be positive" << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    const std::string path = directory + "/snapshot_benchmark.snap";  // Assign or update a variable that represents the current algorithm state.
+    uint64_t checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    // ---------- 固定大小 Fixed-size ----------
+    {  // Execute this statement as part of the data structure implementation.
+        std::vector<uint64_t> keys(entries);  // Execute this statement as part of the data structure implementation.
+        std::vector<uint64_t> values(entries);  // Execute this statement as part of the data structure implementation.
+        HashTable<uint64_t, uint64_t> table;  // Execute this statement as part of the data structure implementation.
+        for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            keys[i] = scrambleKey(i);  // Assign or update a variable that represents the current algorithm state.
+            values[i] = i;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        table.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+        uint64_t fileBytes = saveSnapshot(table, path).fileBytes;  // Assign or update a variable that represents the current algorithm state.
+        std::vector<unsigned char> raw(static_cast<size_t>(fileBytes), 0x5A);  // 只量校驗和用的緩衝區 - Buffer for the checksum-only row
+
+        std::vector<Row> rows;  // Execute this statement as part of the data structure implementation.
+        rows.push_back({"saveSnapshot", [&]() { return saveSnapshot(table, path).fileBytes; }});  // Execute this statement as part of the data structure implementation.
+        rows.push_back({"loadSnapshot (stream)", [&]() {  // Execute this statement as part of the data structure implementation.
+            HashTable<uint64_t, uint64_t> loaded;  // Execute this statement as part of the data structure implementation.
+            uint64_t bytes = loadSnapshot(path, loaded).fileBytes;  // Assign or update a variable that represents the current algorithm state.
+            checksum += loaded.size();  // Assign or update a variable that represents the current algorithm state.
+            return bytes;  // Return the computed result to the caller.
+        }});  // Execute this statement as part of the data structure implementation.
+        rows.push_back({"loadSnapshotMapped", [&]() {  // Execute this statement as part of the data structure implementation.
+            HashTable<uint64_t, uint64_t> loaded;  // Execute this statement as part of the data structure implementation.
+            uint64_t bytes = loadSnapshotMapped(path, loaded).fileBytes;  // Assign or update a variable that represents the current algorithm state.
+            checksum += loaded.size();  // Assign or update a variable that represents the current algorithm state.
+            return bytes;  // Return the computed result to the caller.
+        }});  // Execute this statement as part of the data structure implementation.
+        rows.push_back({"reserve + insert (baseline)", [&]() {  // Execute this statement as part of the data structure implementation.
+            HashTable<uint64_t, uint64_t> built;  // Execute this statement as part of the data structure implementation.
+            built.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+            checksum += built.size();  // Assign or update a variable that represents the current algorithm state.
+            return fileBytes;  // 以同樣的檔案大小換算 - Same file size for comparison
+        }});  // Execute this statement as part of the data structure implementation.
+        rows.push_back({"checksum only", [&]() {  // Execute this statement as part of the data structure implementation.
+            SnapshotChecksum sum;  // Execute this statement as part of the data structure implementation.
+            sum.update(raw.data(), raw.size());  // Execute this statement as part of the data structure implementation.
+            checksum += sum.digest();  // Assign or update a variable that represents the current algorithm state.
+            return static_cast<uint64_t>(raw.size());  // Return the computed result to the caller.
+        }});  // Execute this statement as part of the data structure implementation.
+        printHeader("HashTable<uint64_t, uint64_t>", entries, fileBytes);  // Execute this statement as part of the data structure implementation.
+        runRows(rows, rounds);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    // ---------- 變長字串 Variable-length strings ----------
+    {  // Execute this statement as part of the data structure implementation.
+        size_t stringEntries = entries / 2;  // Assign or update a variable that represents the current algorithm state.
+        std::vector<std::string> keys(stringEntries);  // Execute this statement as part of the data structure implementation.
+        std::vector<std::string> values(stringEntries);  // Execute this statement as part of the data structure implementation.
+        HashTable<std::string, std::string> table;  // Execute this statement as part of the data structure implementation.
+        for (size_t i = 0; i < stringEntries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            keys[i] = "user:" + std::to_string(scrambleKey(i));  // 約 20 ~ 25 位元組 - About 20 to 25 bytes
+            values[i] = std::string(16 + i % 48, static_cast<char>('a' + i % 26));  // 16 ~ 63 位元組 - 16 to 63 bytes
+        }  // Close the current block scope.
+        table.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+        uint64_t fileBytes = saveSnapshot(table, path).fileBytes;  // Assign or update a variable that represents the current algorithm state.
+
+        std::vector<Row> rows;  // Execute this statement as part of the data structure implementation.
+        rows.push_back({"saveSnapshot", [&]() { return saveSnapshot(table, path).fileBytes; }});  // Execute this statement as part of the data structure implementation.
+        rows.push_back({"loadSnapshot (stream)", [&]() {  // Execute this statement as part of the data structure implementation.
+            HashTable<std::string, std::string> loaded;  // Execute this statement as part of the data structure implementation.
+            uint64_t bytes = loadSnapshot(path, loaded).fileBytes;  // Assign or update a variable that represents the current algorithm state.
+            checksum += loaded.size();  // Assign or update a variable that represents the current algorithm state.
+            return bytes;  // Return the computed result to the caller.
+        }});  // Execute this statement as part of the data structure implementation.
+        rows.push_back({"reserve + insert (baseline)", [&]() {  // Execute this statement as part of the data structure implementation.
+            HashTable<std::string, std::string> built;  // Execute this statement as part of the data structure implementation.
+            built.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+            checksum += built.size();  // Assign or update a variable that represents the current algorithm state.
+            return fileBytes;  // Return the computed result to the caller.
+        }});  // Execute this statement as part of the data structure implementation.
+        printHeader("HashTable<std::string, std::string>", stringEntries, fileBytes);  // Execute this statement as part of the data structure implementation.
+        runRows(rows, rounds);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    std::remove(path.c_str());  // Execute this statement as part of the data structure implementation.
+    std::cout << std::endl << "checksum=" << checksum << std::endl;  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -0,0 +1,179 @@
+/** Doc block start
+ * 長字串 key 的擴容與查詢 效能量測 / Rehash and lookup cost with long string keys
+ *(blank line)
+ * 對長度 8 ~ 256 位元組的字串 key，量測 HashTable 每次擴容搬移一個元素的平均耗時，
+ * 以及隨機命中／未命中查詢的平均耗時，並以 std::unordered_map 作為參考。
+ * key 共享長前綴、只在尾端以編號區分（類似 URL 或路徑），因此逐字比較的成本隨長度增加。
+ * For string keys of 8 to 256 bytes, measures the average cost of migrating one entry during
+ * HashTable rehashes and of random hit / miss lookups, with std::unordered_map as a reference.
+ * Keys share a long prefix and differ only in a trailing index (like URLs or paths), so a
+ * byte-by-byte comparison gets more expensive as keys grow.
+ *(blank line)
+ * 每種長度重複 rounds 次，各欄位取最小值以降低雜訊。
+ * Each length is repeated `rounds` times and every column keeps its minimum to reduce noise.
+ *(blank line)
+ * 用法 Usage: ./string_key_benchmark [entries=200000] [lookups=2000000] [rounds=3]
+ */  // End of block comment
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <unordered_map>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 產生固定長度、以編號結尾的 key / Build a fixed-length key that ends with its index
+ */  // End of block comment
+std::string makeKey(size_t index, size_t length) {  // Execute this statement as part of the data structure implementation.
+    std::string digits = std::to_string(index);  // Assign or update a variable that represents the current algorithm state.
+    std::string key(length > digits.size() ? length - digits.size() : 0, 'k');  // Assign or update a variable that represents the current algorithm state.
+    return key + digits;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 一列量測結果 / One row of results
+ */  // End of block comment
+struct Row {  // Execute this statement as part of the data structure implementation.
+    double rehashNs;  // 每個搬移元素 - Per migrated entry
+    double hitNs;  // Execute this statement as part of the data structure implementation.
+    double missNs;  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 隨機命中與未命中查詢；Table 需提供 contains / Random hits and misses; Table must provide contains
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+void measureLookups(const Table& table, const std::vector<std::string>& hits, const std::vector<std::string>& misses,  // Execute this statement as part of the data structure implementation.
+                    long long lookups, Row& row, long long& checksum) {  // Execute this statement as part of the data structure implementation.
+    uint64_t state = 0x9E3779B97F4A7C15ULL;  // Assign or update a variable that represents the current algorithm state.
+    Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (long long i = 0; i < lookups; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+        checksum += table.count(hits[state % hits.size()]) ? 1 : 0;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    row.hitNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / lookups;  // Assign or update a variable that represents the current algorithm state.
+
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (long long i = 0; i < lookups; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+        checksum += table.count(misses[state % misses.size()]) ? 1 : 0;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    row.missNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / lookups;  // Assign or update a variable that represents the current algorithm state.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 讓 HashTable 與 std::unordered_map 共用 measureLookups 的轉接層
+ * Adapter so HashTable and std::unordered_map share measureLookups
+ */  // End of block comment
+struct HashTableView {  // Execute this statement as part of the data structure implementation.
+    const HashTable<std::string, int>& table;  // Execute this statement as part of the data structure implementation.
+    size_t count(const std::string& key) const { return table.contains(key) ? 1 : 0; }  // Return the computed result to the caller.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 逐一插入；每當開始擴容就立即以 rehashStep(SIZE_MAX) 搬完並計時
+ * Insert one by one; whenever a rehash starts, finish it at once with rehashStep(SIZE_MAX) and time it
+ */  // End of block comment
+Row measureHashTable(const std::vector<std::string>& keys, const std::vector<std::string>& misses,  // Execute this statement as part of the data structure implementation.
+                     long long lookups, long long& checksum) {  // Execute this statement as part of the data structure implementation.
+    Row row{};  // Execute this statement as part of the data structure implementation.
+    HashTable<std::string, int> table;  // Execute this statement as part of the data structure implementation.
+    double rehashNs = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    size_t migrated = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < keys.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        table.insert(keys[i], static_cast<int>(i));  // Execute this statement as part of the data structure implementation.
+        if (table.isRehashing()) {  // Evaluate the condition and branch into the appropriate code path.
+            Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+            table.rehashStep(SIZE_MAX);  // Rehash entries into a larger table to keep operations near O(1) on average.
+            rehashNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+            migrated += table.size();  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    row.rehashNs = rehashNs / migrated;  // Assign or update a variable that represents the current algorithm state.
+    measureLookups(HashTableView{table}, keys, misses, lookups, row, checksum);  // Execute this statement as part of the data structure implementation.
+    return row;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 參考：std::unordered_map 在相同時機以 rehash() 加倍桶數並計時
+ * Reference: std::unordered_map, doubling its buckets with rehash() at the same points and timing it
+ */  // End of block comment
+Row measureUnorderedMap(const std::vector<std::string>& keys, const std::vector<std::string>& misses,  // Execute this statement as part of the data structure implementation.
+                        long long lookups, long long& checksum) {  // Execute this statement as part of the data structure implementation.
+    Row row{};  // Execute this statement as part of the data structure implementation.
+    std::unordered_map<std::string, int> table;  // Execute this statement as part of the data structure implementation.
+    table.max_load_factor(1e9f);  // 只在下方手動擴容 - Grow only through the manual rehash below
+    table.rehash(16);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    double rehashNs = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    size_t migrated = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < keys.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        table.emplace(keys[i], static_cast<int>(i));  // Execute this statement as part of the data structure implementation.
+        if (table.size() > table.bucket_count() * 3 / 4) {  // Evaluate the condition and branch into the appropriate code path.
+            Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+            table.rehash(table.bucket_count() * 2);  // Rehash entries into a larger table to keep operations near O(1) on average.
+            rehashNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+            migrated += table.size();  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    row.rehashNs = rehashNs / migrated;  // Assign or update a variable that represents the current algorithm state.
+    measureLookups(table, keys, misses, lookups, row, checksum);  // Execute this statement as part of the data structure implementation.
+    return row;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 各欄位保留較小值 / Keep the smaller value in every column
+ */  // End of block comment
+void keepBest(Row& best, const Row& row, bool first) {  // Execute this statement as part of the data structure implementation.
+    best.rehashNs = first ? row.rehashNs : std::min(best.rehashNs, row.rehashNs);  // Assign or update a variable that represents the current algorithm state.
+    best.hitNs = first ? row.hitNs : std::min(best.hitNs, row.hitNs);  // Assign or update a variable that represents the current algorithm state.
+    best.missNs = first ? row.missNs : std::min(best.missNs, row.missNs);  // Assign or update a variable that represents the current algorithm state.
+}  // Close the current block scope.
+
+void printRow(const std::string& name, size_t length, const Row& row) {  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(8) << length << std::setw(16) << name << std::fixed << std::setprecision(1)  // Execute this statement as part of the data structure implementation.
+              << std::setw(14) << row.rehashNs << std::setw(10) << row.hitNs << std::setw(10) << row.missNs << std::endl;  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    size_t entries = (argc > 1) ? std::stoul(argv[1]) : 200000;  // Assign or update a variable that represents the current algorithm state.
+    long long lookups = (argc > 2) ? std::stoll(argv[2]) : 2000000LL;  // Assign or update a variable that represents the current algorithm state.
+    int rounds = (argc > 3) ? std::stoi(argv[3]) : 3;  // Assign or update a variable that represents the current algorithm state.
+    if (entries < 16 || lookups <= 0 || rounds <= 0) {  // Evaluate the condition and branch into the appropriate code path.
+        std::cerr << "entries must be at least 16, lookups and rounds positive" << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    const size_t lengths[] = {8, 16, 32, 64, 128, 256};  // Assign or update a variable that represents the current algorithm state.
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "entries=" << entries << " lookups=" << lookups << " rounds=" << rounds << " (ns, best of rounds)" << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(8) << "keyLen" << std::setw(16) << "table" << std::setw(14) << "rehash/entry"  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << "hit" << std::setw(10) << "miss" << std::endl;  // Execute this statement as part of the data structure implementation.
+    for (size_t length : lengths) {  // Iterate over a range/collection to process each item in sequence.
+        std::vector<std::string> keys;  // Execute this statement as part of the data structure implementation.
+        std::vector<std::string> misses;  // Execute this statement as part of the data structure implementation.
+        for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            keys.push_back(makeKey(i, length));  // Execute this statement as part of the data structure implementation.
+            misses.push_back(makeKey(entries + i, length));  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        Row ours{};  // Execute this statement as part of the data structure implementation.
+        Row reference{};  // Execute this statement as part of the data structure implementation.
+        for (int round = 0; round < rounds; ++round) {  // Iterate over a range/collection to process each item in sequence.
+            keepBest(ours, measureHashTable(keys, misses, lookups, checksum), round == 0);  // Execute this statement as part of the data structure implementation.
+            keepBest(reference, measureUnorderedMap(keys, misses, lookups, checksum), round == 0);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        printRow("HashTable", length, ours);  // Execute this statement as part of the data structure implementation.
+        printRow("unordered_map", length, reference);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::cout << std::endl << "checksum=" << checksum << std::endl;  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -6,9 +6,30 @@
 
 #include <iostream>  // Execute this statement as part of the data structure implementation.
 #include <string>  // Execute this statement as part of the data structure implementation.
+#include <string_view>  // Execute this statement as part of the data structure implementation.
+#include <tuple>  // Execute this statement as part of the data structure implementation.
 #include <cassert>  // Execute this statement as part of the data structure implementation.
 #include <stdexcept>  // Execute this statement as part of the data structure implementation.
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <atomic>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <cstdio>  // Execute this statement as part of the data structure implementation.
+#include <cstring>  // Execute this statement as part of the data structure implementation.
+#include <fstream>  // Execute this statement as part of the data structure implementation.
+#include <iterator>  // Execute this statement as part of the data structure implementation.
+#include <random>  // Execute this statement as part of the data structure implementation.
+#include <set>  // Execute this statement as part of the data structure implementation.
+#include <thread>  // Execute this statement as part of the data structure implementation.
+#include <unordered_map>  // Execute this statement as part of the data structure implementation.
+#include <utility>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
 #include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+#include "ConcurrentHashMap.hpp"  // Execute this statement as part of the data structure implementation.
+#include "EpochReclamation.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SplitOrderedHashSet.hpp"  // Execute this statement as part of the data structure implementation.
+#include "PerfectHash.hpp"  // Execute this statement as part of the data structure implementation.
+#include "Snapshot.hpp"  // Execute this statement as part of the data structure implementation.
+#include "BatchHash.hpp"  // Execute this statement as part of the data structure implementation.
 
 // 簡單的測試框架 - Simple testing framework
 #define TEST(name) void name()  // Execute this statement as part of the data structure implementation.
@@ -115,7 +136,8 @@ TEST(test_load_factor) {  // Execute this statement as part of the data structur
     ht.insert("b", 2);  // Execute this statement as part of the data structure implementation.
     ht.insert("c", 3);  // Execute this statement as part of the data structure implementation.
 
-    assert(ht.loadFactor() == 0.3);  // Execute this statement as part of the data structure implementation.
+    assert(ht.capacity() == 16);  // 10 向上取到 2 的冪次 - 10 rounded up to a power of two
+    assert(ht.loadFactor() == 3.0 / 16);  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
 // ========== 擴容測試 Rehashing Tests ==========
@@ -139,6 +161,80 @@ TEST(test_rehash_on_load_factor) {  // Rehash entries into a larger table to kee
     }  // Close the current block scope.
 }  // Close the current block scope.
 
+TEST(test_incremental_rehash_mid_migration) {  // Rehash entries into a larger table to keep operations near O(1) on average.
+    // 觸發擴容後立即停住，新舊桶並存 / Stop right after a rehash starts so both arrays coexist
+    HashTable<int, int> ht(64);  // Execute this statement as part of the data structure implementation.
+    int n = 0;  // Assign or update a variable that represents the current algorithm state.
+    while (!ht.isRehashing()) {  // Repeat while the loop condition remains true.
+        ht.insert(n, n * 10);  // Execute this statement as part of the data structure implementation.
+        ++n;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.capacity() == 128);  // Execute this statement as part of the data structure implementation.
+
+    // 查詢、更新、刪除都要同時看到兩個陣列 / Lookups, updates and removes must see both arrays
+    for (int i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(ht.at(i) == i * 10);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.isRehashing());  // 唯讀操作不推進搬移 - Read-only operations do not advance migration
+    ht[n - 1] += 1;  // Assign or update a variable that represents the current algorithm state.
+    assert(ht.search(n - 1).value() == (n - 1) * 10 + 1);  // Execute this statement as part of the data structure implementation.
+    assert(ht.remove(n - 2));  // Execute this statement as part of the data structure implementation.
+    assert(!ht.contains(n - 2));  // Execute this statement as part of the data structure implementation.
+    assert(!ht.remove(n - 2));  // Execute this statement as part of the data structure implementation.
+    assert(ht.size() == static_cast<size_t>(n - 1));  // Execute this statement as part of the data structure implementation.
+
+    // 迭代在搬移途中仍然恰好走訪每個元素一次 / Iteration visits each element exactly once mid-migration
+    assert(ht.isRehashing());  // Execute this statement as part of the data structure implementation.
+    std::vector<int> seen(static_cast<size_t>(n), 0);  // Execute this statement as part of the data structure implementation.
+    for (auto& pair : ht) {  // Iterate over a range/collection to process each item in sequence.
+        seen[static_cast<size_t>(pair.first)]++;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (int i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(seen[static_cast<size_t>(i)] == (i == n - 2 ? 0 : 1));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    // 手動完成搬移 / Finish the migration explicitly
+    assert(!ht.rehashStep(SIZE_MAX));  // Rehash entries into a larger table to keep operations near O(1) on average.
+    assert(!ht.isRehashing());  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(ht.contains(i) == (i != n - 2));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_incremental_rehash_matches_reference) {  // Rehash entries into a larger table to keep operations near O(1) on average.
+    // 與 std::unordered_map 做差異比對，涵蓋多輪擴容 / Differential check against std::unordered_map across many rehashes
+    HashTable<int, int> ht(2);  // Execute this statement as part of the data structure implementation.
+    std::unordered_map<int, int> reference;  // Execute this statement as part of the data structure implementation.
+    unsigned int state = 12345u;  // Assign or update a variable that represents the current algorithm state.
+    bool sawRehash = false;  // Assign or update a variable that represents the current algorithm state.
+    for (int step = 0; step < 20000; ++step) {  // Iterate over a range/collection to process each item in sequence.
+        state = state * 1103515245u + 12345u;  // Assign or update a variable that represents the current algorithm state.
+        int key = static_cast<int>((state >> 8) % 4096u);  // Assign or update a variable that represents the current algorithm state.
+        int op = static_cast<int>((state >> 4) % 4u);  // Assign or update a variable that represents the current algorithm state.
+        if (op == 0) {  // Evaluate the condition and branch into the appropriate code path.
+            assert(ht.remove(key) == (reference.erase(key) == 1));  // Execute this statement as part of the data structure implementation.
+        } else if (op == 1) {  // Evaluate the condition and branch into the appropriate code path.
+            ht[key] += 1;  // Assign or update a variable that represents the current algorithm state.
+            reference[key] += 1;  // Assign or update a variable that represents the current algorithm state.
+        } else {  // Handle the alternative branch when the condition is false.
+            ht.insert(key, step);  // Execute this statement as part of the data structure implementation.
+            reference[key] = step;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        sawRehash = sawRehash || ht.isRehashing();  // Assign or update a variable that represents the current algorithm state.
+        assert(ht.size() == reference.size());  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(sawRehash);  // Execute this statement as part of the data structure implementation.
+    for (const auto& entry : reference) {  // Iterate over a range/collection to process each item in sequence.
+        assert(ht.at(entry.first) == entry.second);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    size_t visited = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (auto& pair : ht) {  // Iterate over a range/collection to process each item in sequence.
+        assert(reference.at(pair.first) == pair.second);  // Execute this statement as part of the data structure implementation.
+        ++visited;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(visited == reference.size());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
 // ========== 運算子測試 Operator Tests ==========
 
 TEST(test_bracket_operator_access) {  // Execute this statement as part of the data structure implementation.
@@ -178,6 +274,154 @@ TEST(test_at_method) {  // Execute this statement as part of the data structure
     assert(threw);  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
+// ========== 異質查詢與就地建構測試 Heterogeneous Lookup & Emplace Tests ==========
+
+/** Doc block start
+ * 只能移動、並計算移動次數的值型別 / Move-only value that counts how often it was moved
+ */  // End of block comment
+struct MoveOnlyValue {  // Execute this statement as part of the data structure implementation.
+    static int moves;  // Execute this statement as part of the data structure implementation.
+    int payload;  // Execute this statement as part of the data structure implementation.
+    explicit MoveOnlyValue(int p = 0) : payload(p) {}  // Execute this statement as part of the data structure implementation.
+    MoveOnlyValue(const MoveOnlyValue&) = delete;  // Execute this statement as part of the data structure implementation.
+    MoveOnlyValue& operator=(const MoveOnlyValue&) = delete;  // Execute this statement as part of the data structure implementation.
+    MoveOnlyValue(MoveOnlyValue&& other) noexcept : payload(other.payload) { ++moves; }  // Execute this statement as part of the data structure implementation.
+    MoveOnlyValue& operator=(MoveOnlyValue&& other) noexcept {  // Execute this statement as part of the data structure implementation.
+        payload = other.payload;  // Assign or update a variable that represents the current algorithm state.
+        ++moves;  // Execute this statement as part of the data structure implementation.
+        return *this;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+int MoveOnlyValue::moves = 0;  // Assign or update a variable that represents the current algorithm state.
+
+TEST(test_heterogeneous_lookup) {  // Execute this statement as part of the data structure implementation.
+    HashTable<std::string, int> ht(4);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 100; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert("key-" + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    // string_view 與字串常值不需先建構 std::string - string_view and literals need no std::string temporary
+    std::string_view view("key-42");  // Assign or update a variable that represents the current algorithm state.
+    assert(ht.search(view).value() == 42);  // Execute this statement as part of the data structure implementation.
+    assert(ht.contains(view));  // Execute this statement as part of the data structure implementation.
+    assert(ht.at(std::string_view("key-7")) == 7);  // Execute this statement as part of the data structure implementation.
+    assert(!ht.contains(std::string_view("key-100")));  // Execute this statement as part of the data structure implementation.
+    assert(!ht.search(std::string_view("missing")).has_value());  // Execute this statement as part of the data structure implementation.
+
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        ht.at(std::string_view("missing"));  // Execute this statement as part of the data structure implementation.
+    } catch (const std::out_of_range&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+
+    assert(ht.remove(std::string_view("key-42")));  // Execute this statement as part of the data structure implementation.
+    assert(!ht.remove(std::string_view("key-42")));  // Execute this statement as part of the data structure implementation.
+    assert(!ht.contains("key-42"));  // Execute this statement as part of the data structure implementation.
+    assert(ht.size() == 99);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_emplace_family_return_values) {  // Execute this statement as part of the data structure implementation.
+    HashTable<std::string, std::string> ht;  // Execute this statement as part of the data structure implementation.
+    assert(ht.emplace("a", "first"));  // Execute this statement as part of the data structure implementation.
+    assert(!ht.emplace("a", "ignored"));  // 已存在不覆寫 - Existing value is kept
+    assert(ht.at("a") == "first");  // Execute this statement as part of the data structure implementation.
+
+    assert(ht.try_emplace("b", 3, 'x'));  // 直接以 (count, char) 建構值 - Value built in place from (count, char)
+    assert(ht.at("b") == "xxx");  // Execute this statement as part of the data structure implementation.
+    assert(!ht.try_emplace("b", 5, 'y'));  // Execute this statement as part of the data structure implementation.
+    assert(ht.at("b") == "xxx");  // Execute this statement as part of the data structure implementation.
+
+    assert(ht.insert_or_assign("c", "one"));  // Execute this statement as part of the data structure implementation.
+    assert(!ht.insert_or_assign("c", "two"));  // Execute this statement as part of the data structure implementation.
+    assert(ht.at("c") == "two");  // Execute this statement as part of the data structure implementation.
+
+    // 右值 key 只在真正插入時才被搬走 - An rvalue key is only consumed when it is actually inserted
+    std::string longKey(64, 'k');  // Assign or update a variable that represents the current algorithm state.
+    assert(ht.try_emplace(std::move(longKey), "v"));  // Execute this statement as part of the data structure implementation.
+    std::string again(64, 'k');  // Assign or update a variable that represents the current algorithm state.
+    assert(!ht.try_emplace(std::move(again), "w"));  // Execute this statement as part of the data structure implementation.
+    assert(again.size() == 64);  // 未被搬走 - Not moved from
+    ht[std::string(3, 'z')] = "bracket";  // Execute this statement as part of the data structure implementation.
+    assert(ht.at("zzz") == "bracket");  // Execute this statement as part of the data structure implementation.
+    assert(ht.size() == 5);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_move_only_values) {  // Execute this statement as part of the data structure implementation.
+    HashTable<int, MoveOnlyValue> ht(2);  // Execute this statement as part of the data structure implementation.
+    MoveOnlyValue::moves = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (int i = 0; i < 64; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(ht.try_emplace(i, i * 10));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    // 就地建構且擴容只搬節點，值從未被移動 - Built in place and rehash splices nodes: values never move
+    assert(MoveOnlyValue::moves == 0);  // Execute this statement as part of the data structure implementation.
+    assert(ht.at(7).payload == 70);  // Execute this statement as part of the data structure implementation.
+
+    assert(!ht.insert_or_assign(7, MoveOnlyValue(1)));  // Execute this statement as part of the data structure implementation.
+    assert(ht.at(7).payload == 1);  // Execute this statement as part of the data structure implementation.
+    assert(MoveOnlyValue::moves == 1);  // Execute this statement as part of the data structure implementation.
+    assert(ht.emplace(std::piecewise_construct, std::forward_as_tuple(100), std::forward_as_tuple(5)));  // Execute this statement as part of the data structure implementation.
+    assert(ht.at(100).payload == 5);  // Execute this statement as part of the data structure implementation.
+    assert(MoveOnlyValue::moves == 1);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+// ========== 批次操作測試 Batch Operation Tests ==========
+
+TEST(test_batch_insert_and_search) {  // Execute this statement as part of the data structure implementation.
+    HashTable<int, int> ht;  // Execute this statement as part of the data structure implementation.
+    std::vector<int> keys;  // Execute this statement as part of the data structure implementation.
+    std::vector<int> values;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 1000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        keys.push_back(i * 7);  // Execute this statement as part of the data structure implementation.
+        values.push_back(i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    ht.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+    assert(ht.size() == 1000);  // Execute this statement as part of the data structure implementation.
+    assert(ht.capacity() == 2048);  // 一次擴容到 1000 / 0.75 以上的 2 的冪次 - One growth to the power of two above 1000 / 0.75
+    assert(!ht.isRehashing());  // Execute this statement as part of the data structure implementation.
+
+    // 查詢數量不是分組大小的倍數，且混入未命中 - Query count is not a multiple of the group size and includes misses
+    std::vector<int> queries;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 101; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        queries.push_back(i * 7 + (i % 3 == 0 ? 1 : 0));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::optional<int>> out;  // Execute this statement as part of the data structure implementation.
+    ht.searchBatch(queries, out);  // Execute this statement as part of the data structure implementation.
+    assert(out.size() == queries.size());  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < queries.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(out[i] == ht.search(queries[i]));  // Execute this statement as part of the data structure implementation.
+        assert(out[i].has_value() == (i % 3 != 0));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    // 批次更新既有 key；長度不符時拋出例外 - Batch updates existing keys; mismatched lengths throw
+    ht.insertBatch({7, 14}, {-1, -2});  // Execute this statement as part of the data structure implementation.
+    assert(ht.at(7) == -1 && ht.at(14) == -2 && ht.size() == 1000);  // Execute this statement as part of the data structure implementation.
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        ht.insertBatch({1, 2}, {1});  // Execute this statement as part of the data structure implementation.
+    } catch (const std::invalid_argument&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+
+    // 擴容進行中也要查到舊桶裡的元素 - Lookups must still find entries in old buckets mid-rehash
+    HashTable<int, int> growing(64);  // Execute this statement as part of the data structure implementation.
+    int n = 0;  // Assign or update a variable that represents the current algorithm state.
+    while (!growing.isRehashing()) {  // Repeat while the loop condition remains true.
+        growing.insert(n, n);  // Execute this statement as part of the data structure implementation.
+        ++n;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<int> all;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        all.push_back(i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    growing.searchBatch(all, out);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(out[i].value() == i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
 // ========== 迭代器測試 Iterator Tests ==========
 
 TEST(test_iterator) {  // Execute this statement as part of the data structure implementation.
@@ -217,6 +461,121 @@ TEST(test_multiple_items_same_bucket) {  // Access or update the bucket storage
     assert(ht.search("c").value() == 3);  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
+// ========== 種子雜湊測試 Seeded Hash Tests ==========
+
+TEST(test_siphash_reference_vectors) {  // Compute a hash-based index so keys map into the table's storage.
+    // SipHash 論文附錄的測試向量：key = 00..0f，訊息 = 00..(n-1) / Reference vectors from the SipHash paper
+    HashSeed seed{0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL};  // Assign or update a variable that represents the current algorithm state.
+    unsigned char message[15];  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 15; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        message[i] = static_cast<unsigned char>(i);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert((sipHash<2, 4>(message, 0, seed) == 0x726fdb47dd0e0e31ULL));  // Compute a hash-based index so keys map into the table's storage.
+    assert((sipHash<2, 4>(message, 15, seed) == 0xa129ca6149be45e5ULL));  // Compute a hash-based index so keys map into the table's storage.
+    assert(sipHash13(message, 15, seed) != sipHash13(message, 15, HashSeed{}));  // 換種子就換雜湊 - A new seed gives a new hash
+}  // Close the current block scope.
+
+TEST(test_seeded_hash_per_table) {  // Compute a hash-based index so keys map into the table's storage.
+    HashTable<std::string, int> a;  // Execute this statement as part of the data structure implementation.
+    HashTable<std::string, int> b;  // Execute this statement as part of the data structure implementation.
+    assert(a.hashSeed() != b.hashSeed());  // 每個表各自的隨機種子 - Each table has its own random seed
+
+    // 零種子下非字串 key 仍是 std::hash 再混合 / With a zero seed non-string keys are still std::hash, then mixed
+    HashTableHasher<int> intHasher;  // Compute a hash-based index so keys map into the table's storage.
+    assert(seededHash(intHasher, 12345, HashSeed{}) == fmix64(std::hash<int>{}(12345)));  // Compute a hash-based index so keys map into the table's storage.
+    HashTableHasher<std::string> stringHasher;  // Compute a hash-based index so keys map into the table's storage.
+    assert(seededHash(stringHasher, std::string_view("abc"), HashSeed::fromValue(1)) !=  // Compute a hash-based index so keys map into the table's storage.
+           seededHash(stringHasher, std::string_view("abc"), HashSeed::fromValue(2)));  // Compute a hash-based index so keys map into the table's storage.
+
+    // 相同種子 → 相同走訪順序（可重現）/ Same seed, same iteration order (reproducible)
+    HashTable<std::string, int> c(16, HashSeed::fromValue(99));  // Execute this statement as part of the data structure implementation.
+    HashTable<std::string, int> d(16, HashSeed::fromValue(99));  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 200; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        c.insert("key" + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+        d.insert("key" + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    auto itC = c.begin();  // Assign or update a variable that represents the current algorithm state.
+    for (auto itD = d.begin(); itD != d.end(); ++itD, ++itC) {  // Iterate over a range/collection to process each item in sequence.
+        assert(itC->first == itD->first);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(c.search("key150").value() == 150);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+// ========== 批次雜湊測試 Batch Hash Tests ==========
+
+TEST(test_hash_batch_integer_keys) {  // Compute a hash-based index so keys map into the table's storage.
+    std::mt19937_64 rng(11);  // Assign or update a variable that represents the current algorithm state.
+    std::vector<uint64_t> keys = {0, 1, ~0ULL, 0x8000000000000000ULL};  // Assign or update a variable that represents the current algorithm state.
+    while (keys.size() < 37) {  // 不是通道數的倍數，尾端走純量 - Not a multiple of the lane count, so the tail goes scalar
+        keys.push_back(rng());  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    HashTableHasher<uint64_t> hasher;  // Compute a hash-based index so keys map into the table's storage.
+    for (const HashSeed& seed : {HashSeed{}, HashSeed::fromValue(7)}) {  // Iterate over a range/collection to process each item in sequence.
+        std::vector<uint64_t> batch(keys.size());  // Assign or update a variable that represents the current algorithm state.
+        std::vector<uint64_t> scalar(keys.size());  // Assign or update a variable that represents the current algorithm state.
+        hashBatch(keys.data(), keys.size(), seed, batch.data());  // Compute a hash-based index so keys map into the table's storage.
+        hashBatchScalar(keys.data(), keys.size(), seed, scalar.data());  // Compute a hash-based index so keys map into the table's storage.
+        for (size_t i = 0; i < keys.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+            assert(batch[i] == scalar[i]);  // Execute this statement as part of the data structure implementation.
+            assert(batch[i] == seededHash(hasher, keys[i], seed));  // Compute a hash-based index so keys map into the table's storage.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    // 有號 key 先符號擴展，與 std::hash<int> 相同 - Signed keys sign-extend, as std::hash<int> does
+    std::vector<int> signedKeys = {-1, -2, 0, 1, 2147483647, -2147483647 - 1, 42};  // Assign or update a variable that represents the current algorithm state.
+    std::vector<size_t> codes(signedKeys.size());  // Compute a hash-based index so keys map into the table's storage.
+    HashSeed seed = HashSeed::fromValue(3);  // Assign or update a variable that represents the current algorithm state.
+    HashTableHasher<int> intHasher;  // Compute a hash-based index so keys map into the table's storage.
+    seededHashBatch(intHasher, signedKeys.data(), signedKeys.size(), seed, codes.data());  // Compute a hash-based index so keys map into the table's storage.
+    for (size_t i = 0; i < signedKeys.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(codes[i] == seededHash(intHasher, signedKeys[i], seed));  // Compute a hash-based index so keys map into the table's storage.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_hash_batch_string_keys) {  // Compute a hash-based index so keys map into the table's storage.
+    // 長度 0..80 交錯排列：同一組長度不同，也涵蓋超過 SIMD 上限的組 - Lengths 0..80 interleaved: groups mix lengths, some exceed the SIMD limit
+    std::vector<std::string> owned;  // Execute this statement as part of the data structure implementation.
+    for (size_t n = 0; n <= 80; ++n) {  // Iterate over a range/collection to process each item in sequence.
+        size_t length = (n * 37) % 81;  // Assign or update a variable that represents the current algorithm state.
+        std::string key;  // Execute this statement as part of the data structure implementation.
+        for (size_t b = 0; b < length; ++b) {  // Iterate over a range/collection to process each item in sequence.
+            key.push_back(static_cast<char>((b * 73 + n * 29) & 0xff));  // 含高位元組 - Includes high bytes
+        }  // Close the current block scope.
+        owned.push_back(key);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (int i = 0; i < 8; ++i) {  // 一組全是短 key 且長度各異 - One group of short keys with mixed lengths
+        owned.push_back(std::string(static_cast<size_t>(i * 5), 'k'));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::string_view> views(owned.begin(), owned.end());  // Assign or update a variable that represents the current algorithm state.
+    HashSeed seed = HashSeed::fromValue(5);  // Assign or update a variable that represents the current algorithm state.
+    std::vector<uint64_t> batch(views.size());  // Assign or update a variable that represents the current algorithm state.
+    hashBatch(views.data(), views.size(), seed, batch.data());  // Compute a hash-based index so keys map into the table's storage.
+    std::vector<size_t> codes(owned.size());  // Compute a hash-based index so keys map into the table's storage.
+    HashTableHasher<std::string> hasher;  // Compute a hash-based index so keys map into the table's storage.
+    seededHashBatch(hasher, owned.data(), owned.size(), seed, codes.data());  // Compute a hash-based index so keys map into the table's storage.
+    for (size_t i = 0; i < views.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(batch[i] == sipHash13(views[i].data(), views[i].size(), seed));  // Compute a hash-based index so keys map into the table's storage.
+        assert(codes[i] == seededHash(hasher, views[i], seed));  // Compute a hash-based index so keys map into the table's storage.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_search_batch_string_keys) {  // Execute this statement as part of the data structure implementation.
+    HashTable<std::string, int> ht;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 300; ++i) {  // 擴容途中也要正確 - Must also be right mid-rehash
+        ht.insert("user:" + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::string> queries;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 350; i += 3) {  // 混入未命中 - Includes misses
+        queries.push_back("user:" + std::to_string(i));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::optional<int>> out;  // Execute this statement as part of the data structure implementation.
+    ht.searchBatch(queries, out);  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < queries.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(out[i] == ht.search(queries[i]));  // Execute this statement as part of the data structure implementation.
+        assert(out[i].has_value() == (static_cast<int>(i) * 3 < 300));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
 // ========== 不同鍵類型測試 Different Key Types Tests ==========
 
 TEST(test_int_key) {  // Execute this statement as part of the data structure implementation.
@@ -230,6 +589,560 @@ TEST(test_int_key) {  // Execute this statement as part of the data structure im
     assert(ht.search(3).value() == "three");  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
+// ========== 並行雜湊表測試 Concurrent Hash Map Tests ==========
+
+TEST(test_concurrent_basic_operations) {  // Execute this statement as part of the data structure implementation.
+    ConcurrentHashMap<std::string, int> map(5);  // Execute this statement as part of the data structure implementation.
+    assert(map.shardCount() == 8);  // 向上取到 2 的冪次 - Rounded up to a power of two
+    assert(map.empty());  // Execute this statement as part of the data structure implementation.
+
+    map.insert("apple", 1);  // Execute this statement as part of the data structure implementation.
+    map.insert("banana", 2);  // Execute this statement as part of the data structure implementation.
+    map.insert("apple", 10);  // Execute this statement as part of the data structure implementation.
+    assert(map.size() == 2);  // Execute this statement as part of the data structure implementation.
+    assert(map.search("apple").value() == 10);  // Execute this statement as part of the data structure implementation.
+    assert(map.contains("banana"));  // Execute this statement as part of the data structure implementation.
+    assert(!map.search("cherry").has_value());  // Execute this statement as part of the data structure implementation.
+
+    map.upsert("cherry", [](int& v) { v += 5; });  // 不存在時從 V{} 開始 - Starts from V{} when absent
+    map.upsert("apple", [](int& v) { v *= 3; });  // Execute this statement as part of the data structure implementation.
+    assert(map.search("cherry").value() == 5);  // Execute this statement as part of the data structure implementation.
+    assert(map.search("apple").value() == 30);  // Execute this statement as part of the data structure implementation.
+
+    assert(map.remove("banana"));  // Execute this statement as part of the data structure implementation.
+    assert(!map.remove("banana"));  // Execute this statement as part of the data structure implementation.
+    int sum = 0;  // Assign or update a variable that represents the current algorithm state.
+    map.forEach([&sum](const std::string&, int v) { sum += v; });  // Execute this statement as part of the data structure implementation.
+    assert(sum == 35);  // Execute this statement as part of the data structure implementation.
+
+    map.clear();  // Execute this statement as part of the data structure implementation.
+    assert(map.size() == 0);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_concurrent_invalid_arguments) {  // Execute this statement as part of the data structure implementation.
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        ConcurrentHashMap<int, int> map(0);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::invalid_argument&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_concurrent_seeded_shards) {  // Compute a hash-based index so keys map into the table's storage.
+    // 預先雜湊的操作與一般操作看到同一份資料 - Prehashed operations see the same data as the plain ones
+    HashTable<std::string, int> table(16, HashSeed::fromValue(11));  // Execute this statement as part of the data structure implementation.
+    size_t code = seededHash(HashTableHasher<std::string>{}, std::string("kiwi"), table.hashSeed());  // Compute a hash-based index so keys map into the table's storage.
+    table.insertHashed(code, "kiwi", 4);  // Execute this statement as part of the data structure implementation.
+    assert(table.search("kiwi").value() == 4);  // Execute this statement as part of the data structure implementation.
+    assert(table.containsHashed(code, "kiwi"));  // Execute this statement as part of the data structure implementation.
+    table.findOrInsertHashed(code, "kiwi") += 1;  // Execute this statement as part of the data structure implementation.
+    assert(table.searchHashed(code, "kiwi").value() == 5);  // Execute this statement as part of the data structure implementation.
+    assert(table.removeHashed(code, "kiwi") && !table.contains("kiwi"));  // Execute this statement as part of the data structure implementation.
+
+    // 分片索引來自帶種子的雜湊值；一個分片（位移為 0）與多個分片都要正確
+    // The shard index comes from the seeded hash; one shard (shift 0) and many shards must both work
+    for (size_t shards : {size_t{1}, size_t{16}}) {  // Iterate over a range/collection to process each item in sequence.
+        ConcurrentHashMap<int, int> map(shards, 4, HashSeed::fromValue(42));  // Execute this statement as part of the data structure implementation.
+        assert(map.hashSeed() == HashSeed::fromValue(42));  // Execute this statement as part of the data structure implementation.
+        for (int k = 0; k < 1000; ++k) {  // Iterate over a range/collection to process each item in sequence.
+            map.insert(k, k * 2);  // Execute this statement as part of the data structure implementation.
+            map.upsert(k, [](int& v) { ++v; });  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        assert(map.size() == 1000);  // Execute this statement as part of the data structure implementation.
+        for (int k = 0; k < 1000; ++k) {  // Iterate over a range/collection to process each item in sequence.
+            assert(map.search(k).value() == k * 2 + 1);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        for (int k = 0; k < 1000; k += 2) {  // Iterate over a range/collection to process each item in sequence.
+            assert(map.remove(k));  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        assert(map.size() == 500 && !map.contains(0) && map.contains(1));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    ConcurrentHashMap<int, int> first;  // Execute this statement as part of the data structure implementation.
+    ConcurrentHashMap<int, int> second;  // Execute this statement as part of the data structure implementation.
+    assert(first.hashSeed() != second.hashSeed());  // 預設種子每張表不同 - Default seeds differ per map
+}  // Close the current block scope.
+
+TEST(test_concurrent_upsert_from_many_threads) {  // Execute this statement as part of the data structure implementation.
+    ConcurrentHashMap<int, int> map(4);  // 少量分片以製造同分片競爭 - Few shards to force same-shard contention
+    const int threads = 8;  // Assign or update a variable that represents the current algorithm state.
+    const int keys = 500;  // Assign or update a variable that represents the current algorithm state.
+    const int rounds = 20;  // Assign or update a variable that represents the current algorithm state.
+    std::vector<std::thread> workers;  // Execute this statement as part of the data structure implementation.
+    for (int t = 0; t < threads; ++t) {  // Iterate over a range/collection to process each item in sequence.
+        workers.emplace_back([&map, t]() {  // Execute this statement as part of the data structure implementation.
+            for (int r = 0; r < rounds; ++r) {  // Iterate over a range/collection to process each item in sequence.
+                for (int k = 0; k < keys; ++k) {  // Iterate over a range/collection to process each item in sequence.
+                    map.upsert(k, [](int& v) { ++v; });  // 每次 +1 不可遺失 - No increment may be lost
+                    map.search((k + t) % keys);  // 讀者與寫者交錯 - Interleave readers with writers
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+        });  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (auto& worker : workers) {  // Iterate over a range/collection to process each item in sequence.
+        worker.join();  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    assert(map.size() == static_cast<size_t>(keys));  // Execute this statement as part of the data structure implementation.
+    for (int k = 0; k < keys; ++k) {  // Iterate over a range/collection to process each item in sequence.
+        assert(map.search(k).value() == threads * rounds);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+// ========== 無鎖分裂序集合測試 Lock-Free Split-Ordered Set Tests ==========
+
+TEST(test_split_ordered_basic_operations) {  // Execute this statement as part of the data structure implementation.
+    SplitOrderedHashSet<std::string> set(3);  // Execute this statement as part of the data structure implementation.
+    assert(set.bucketCount() == 4);  // 向上取到 2 的冪次 - Rounded up to a power of two
+    assert(set.empty());  // Execute this statement as part of the data structure implementation.
+
+    assert(set.insert("apple"));  // Execute this statement as part of the data structure implementation.
+    assert(set.insert("banana"));  // Execute this statement as part of the data structure implementation.
+    assert(!set.insert("apple"));  // 重複插入回傳 false - Duplicate insert returns false
+    assert(set.size() == 2);  // Execute this statement as part of the data structure implementation.
+    assert(set.contains("apple"));  // Execute this statement as part of the data structure implementation.
+    assert(!set.contains("cherry"));  // Execute this statement as part of the data structure implementation.
+
+    assert(set.remove("apple"));  // Execute this statement as part of the data structure implementation.
+    assert(!set.remove("apple"));  // Execute this statement as part of the data structure implementation.
+    assert(!set.contains("apple"));  // Execute this statement as part of the data structure implementation.
+    assert(set.size() == 1);  // Execute this statement as part of the data structure implementation.
+
+    SplitOrderedHashSet<std::string> other(4);  // Execute this statement as part of the data structure implementation.
+    assert(other.hashSeed() != set.hashSeed());  // 每個集合各自的種子 - Each set draws its own seed
+    SplitOrderedHashSet<int> fixed(4, HashSeed::fromValue(7));  // Execute this statement as part of the data structure implementation.
+    assert(fixed.hashSeed() == HashSeed::fromValue(7));  // Execute this statement as part of the data structure implementation.
+    assert(fixed.insert(42) && fixed.contains(42));  // Execute this statement as part of the data structure implementation.
+
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        SplitOrderedHashSet<int> bad(0);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::invalid_argument&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_split_ordered_incremental_growth) {  // Execute this statement as part of the data structure implementation.
+    SplitOrderedHashSet<int> set(1);  // 從單一桶開始 - Start from a single bucket
+    for (int i = 0; i < 10000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(set.insert(i * 7));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(set.size() == 10000);  // Execute this statement as part of the data structure implementation.
+    assert(set.bucketCount() >= 4096);  // 平均每桶不超過 MAX_LOAD 附近 - Load stays near MAX_LOAD per bucket
+    for (int i = 0; i < 10000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(set.contains(i * 7));  // Execute this statement as part of the data structure implementation.
+        assert(!set.contains(i * 7 + 1));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (int i = 0; i < 10000; i += 2) {  // Iterate over a range/collection to process each item in sequence.
+        assert(set.remove(i * 7));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(set.size() == 5000);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 10000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(set.contains(i * 7) == (i % 2 == 1));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+static std::atomic<int> freedCount{0};  // Assign or update a variable that represents the current algorithm state.
+static void countingDelete(void* p) {  // Execute this statement as part of the data structure implementation.
+    delete static_cast<int*>(p);  // Execute this statement as part of the data structure implementation.
+    freedCount.fetch_add(1);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_epoch_reclamation_defers_free) {  // Execute this statement as part of the data structure implementation.
+    freedCount.store(0);  // Execute this statement as part of the data structure implementation.
+    {  // Execute this statement as part of the data structure implementation.
+        EpochDomain domain;  // Execute this statement as part of the data structure implementation.
+        size_t reader = domain.pin();  // 模擬一個停在舊世代的讀者 - A reader parked in the old epoch
+        {  // Execute this statement as part of the data structure implementation.
+            EpochDomain::Guard writer(domain);  // Execute this statement as part of the data structure implementation.
+            for (size_t i = 0; i < EpochDomain::RETIRE_THRESHOLD * 2; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                writer.retire(new int(static_cast<int>(i)), &countingDelete);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        assert(freedCount.load() == 0);  // 讀者仍 pin 住，不可釋放 - Reader still pinned: nothing may be freed
+        domain.unpin(reader);  // Execute this statement as part of the data structure implementation.
+
+        assert(domain.tryAdvance());  // Execute this statement as part of the data structure implementation.
+        assert(domain.tryAdvance());  // Execute this statement as part of the data structure implementation.
+        {  // 下一次達到門檻的 retire 會收集已過兩個世代的節點 - The next threshold-crossing retire collects
+            EpochDomain::Guard writer(domain);  // Execute this statement as part of the data structure implementation.
+            for (size_t i = 0; i < EpochDomain::RETIRE_THRESHOLD; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                writer.retire(new int(0), &countingDelete);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        assert(freedCount.load() >= static_cast<int>(EpochDomain::RETIRE_THRESHOLD * 2));  // Execute this statement as part of the data structure implementation.
+    }  // 解構子釋放剩下的 - The destructor frees the rest
+    assert(freedCount.load() == static_cast<int>(EpochDomain::RETIRE_THRESHOLD * 3));  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 一筆操作紀錄：呼叫前後各取一個全域時間戳 / One operation record: global timestamps taken before and after the call
+ */  // End of block comment
+struct SetOp {  // Execute this statement as part of the data structure implementation.
+    int type;  // 0 = insert, 1 = remove, 2 = contains
+    bool result;  // Execute this statement as part of the data structure implementation.
+    uint64_t start;  // Execute this statement as part of the data structure implementation.
+    uint64_t end;  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * Wing & Gong 式線性化檢查（單一 key 的歷史；集合對不同 key 的操作互相獨立，可逐 key 檢查）
+ * Wing & Gong style linearizability check for one key's history (set operations on different keys
+ * are independent, so linearizability can be checked per key)
+ *(blank line)
+ * 每一步只能選「開始時間早於所有未完成操作最早結束時間」的操作，並以 (已完成集合, 是否存在) 記憶失敗狀態。
+ * Each step may only pick an op that started before the earliest end among remaining ops; failed
+ * (done-set, present) states are memoized.
+ */  // End of block comment
+bool linearizable(const std::vector<SetOp>& ops, std::vector<uint64_t>& done, bool present,  // Execute this statement as part of the data structure implementation.
+                  size_t remaining, std::set<std::pair<std::vector<uint64_t>, bool>>& failed) {  // Execute this statement as part of the data structure implementation.
+    if (remaining == 0) {  // Evaluate the condition and branch into the appropriate code path.
+        return true;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    if (failed.count({done, present})) {  // Evaluate the condition and branch into the appropriate code path.
+        return false;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    uint64_t minEnd = UINT64_MAX;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < ops.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        if (!((done[i / 64] >> (i % 64)) & 1u)) {  // Evaluate the condition and branch into the appropriate code path.
+            minEnd = std::min(minEnd, ops[i].end);  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    for (size_t i = 0; i < ops.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        if (((done[i / 64] >> (i % 64)) & 1u) || ops[i].start > minEnd) {  // Evaluate the condition and branch into the appropriate code path.
+            continue;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        const SetOp& op = ops[i];  // Assign or update a variable that represents the current algorithm state.
+        bool expected = (op.type == 0) ? !present : present;  // insert 成功 ⇔ 原本不存在 - insert succeeds iff absent
+        if (op.result != expected) {  // Evaluate the condition and branch into the appropriate code path.
+            continue;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        bool next = (op.type == 0) ? true : (op.type == 1 ? false : present);  // Assign or update a variable that represents the current algorithm state.
+        done[i / 64] |= (1ULL << (i % 64));  // Assign or update a variable that represents the current algorithm state.
+        bool ok = linearizable(ops, done, next, remaining - 1, failed);  // Assign or update a variable that represents the current algorithm state.
+        done[i / 64] &= ~(1ULL << (i % 64));  // Assign or update a variable that represents the current algorithm state.
+        if (ok) {  // Evaluate the condition and branch into the appropriate code path.
+            return true;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    failed.insert({done, present});  // Execute this statement as part of the data structure implementation.
+    return false;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+bool historyLinearizable(const std::vector<SetOp>& ops) {  // Execute this statement as part of the data structure implementation.
+    std::vector<uint64_t> done((ops.size() + 63) / 64, 0);  // Execute this statement as part of the data structure implementation.
+    std::set<std::pair<std::vector<uint64_t>, bool>> failed;  // Execute this statement as part of the data structure implementation.
+    return linearizable(ops, done, false, ops.size(), failed);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+TEST(test_split_ordered_linearizability_stress) {  // Execute this statement as part of the data structure implementation.
+    // 檢查器本身的健全性：循序執行中「刪除成功後又查到」必須被拒絕
+    // Sanity-check the checker: "found again after a successful remove" must be rejected
+    std::vector<SetOp> bad = {{0, true, 0, 1}, {1, true, 2, 3}, {2, true, 4, 5}};  // Assign or update a variable that represents the current algorithm state.
+    assert(!historyLinearizable(bad));  // Execute this statement as part of the data structure implementation.
+    std::vector<SetOp> overlapping = {{0, true, 0, 5}, {2, false, 1, 2}, {2, true, 3, 4}};  // Assign or update a variable that represents the current algorithm state.
+    assert(historyLinearizable(overlapping));  // Execute this statement as part of the data structure implementation.
+
+    const int threads = 4;  // Assign or update a variable that represents the current algorithm state.
+    const int keys = 16;  // 少量 key 以製造同 key 競爭 - Few keys to force same-key contention
+    const int opsPerThread = 3000;  // Assign or update a variable that represents the current algorithm state.
+    SplitOrderedHashSet<int> set(1);  // 從單一桶開始，讓擴容與操作交錯 - Start at one bucket so growth interleaves
+    std::atomic<uint64_t> clock{0};  // Assign or update a variable that represents the current algorithm state.
+    std::vector<std::vector<std::vector<SetOp>>> logs(threads, std::vector<std::vector<SetOp>>(keys));  // Execute this statement as part of the data structure implementation.
+
+    std::vector<std::thread> workers;  // Execute this statement as part of the data structure implementation.
+    for (int t = 0; t < threads; ++t) {  // Iterate over a range/collection to process each item in sequence.
+        workers.emplace_back([&, t]() {  // Execute this statement as part of the data structure implementation.
+            std::mt19937 rng(static_cast<unsigned>(t) * 7919u + 1u);  // Execute this statement as part of the data structure implementation.
+            for (int i = 0; i < opsPerThread; ++i) {  // Iterate over a range/collection to process each item in sequence.
+                int key = static_cast<int>(rng() % keys);  // Assign or update a variable that represents the current algorithm state.
+                int type = static_cast<int>(rng() % 3);  // Assign or update a variable that represents the current algorithm state.
+                SetOp op{type, false, clock.fetch_add(1), 0};  // Assign or update a variable that represents the current algorithm state.
+                op.result = (type == 0) ? set.insert(key) : (type == 1 ? set.remove(key) : set.contains(key));  // Assign or update a variable that represents the current algorithm state.
+                op.end = clock.fetch_add(1);  // Assign or update a variable that represents the current algorithm state.
+                logs[t][key].push_back(op);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        });  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (auto& worker : workers) {  // Iterate over a range/collection to process each item in sequence.
+        worker.join();  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    size_t finalSize = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (int key = 0; key < keys; ++key) {  // Iterate over a range/collection to process each item in sequence.
+        std::vector<SetOp> history;  // Execute this statement as part of the data structure implementation.
+        for (int t = 0; t < threads; ++t) {  // Iterate over a range/collection to process each item in sequence.
+            history.insert(history.end(), logs[t][key].begin(), logs[t][key].end());  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        std::sort(history.begin(), history.end(), [](const SetOp& a, const SetOp& b) { return a.start < b.start; });  // Execute this statement as part of the data structure implementation.
+        assert(historyLinearizable(history));  // Execute this statement as part of the data structure implementation.
+        finalSize += set.contains(key) ? 1 : 0;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(set.size() == finalSize);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+// ========== 完美雜湊測試 Perfect Hash Tests ==========
+
+TEST(test_perfect_hash_from_hash_table) {  // Execute this statement as part of the data structure implementation.
+    const std::string path = "test_perfect_hash_strings.phf";  // Assign or update a variable that represents the current algorithm state.
+    HashTable<std::string, int> words;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 3000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        words.insert("word" + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    words.insert("", -1);  // 空字串也是合法的 key - The empty string is a valid key too
+    PerfectHashBuildStats stats = PerfectHashBuilder<std::string, int>::fromTable(words).writeFile(path);  // Assign or update a variable that represents the current algorithm state.
+    assert(stats.keys == 3001);  // Execute this statement as part of the data structure implementation.
+    assert(stats.buckets == 751);  // ⌈3001 / 4⌉
+    assert(stats.attempts >= 1);  // Execute this statement as part of the data structure implementation.
+
+    {  // Execute this statement as part of the data structure implementation.
+        MappedPerfectHashTable<std::string, int> mapped(path);  // Execute this statement as part of the data structure implementation.
+        assert(mapped.size() == 3001);  // Execute this statement as part of the data structure implementation.
+        assert(mapped.fileBytes() == stats.fileBytes);  // Execute this statement as part of the data structure implementation.
+        words.forEach([&mapped](const std::string& key, int value) {  // Iterate over a range/collection to process each item in sequence.
+            assert(mapped.search(key).value() == value);  // 每個 key 都落在自己的槽位 - Every key lands on its own slot
+        });  // Execute this statement as part of the data structure implementation.
+        for (int i = 0; i < 3000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            assert(!mapped.contains("miss" + std::to_string(i)));  // 不在集合中的 key 由 key 比對擋下 - Outsiders are rejected by the key compare
+        }  // Close the current block scope.
+        assert(mapped.search(std::string_view("word42")).value() == 42);  // Execute this statement as part of the data structure implementation.
+        assert(!mapped.contains("word42x"));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::remove(path.c_str());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_perfect_hash_integer_keys_from_concurrent_map) {  // Execute this statement as part of the data structure implementation.
+    const std::string path = "test_perfect_hash_ints.phf";  // Assign or update a variable that represents the current algorithm state.
+    ConcurrentHashMap<uint64_t, uint32_t> symbols(4);  // Execute this statement as part of the data structure implementation.
+    for (uint32_t i = 0; i < 5000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        symbols.insert(static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ULL, i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    PerfectHashBuilder<uint64_t, uint32_t>::fromTable(symbols).writeFile(path);  // Execute this statement as part of the data structure implementation.
+
+    MappedPerfectHashTable<uint64_t, uint32_t> mapped(path);  // Execute this statement as part of the data structure implementation.
+    assert(mapped.size() == 5000);  // Execute this statement as part of the data structure implementation.
+    std::vector<bool> seen(5000, false);  // Execute this statement as part of the data structure implementation.
+    for (uint32_t i = 0; i < 5000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        std::optional<uint32_t> found = mapped.search(static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ULL);  // Assign or update a variable that represents the current algorithm state.
+        assert(found.has_value() && found.value() == i);  // Execute this statement as part of the data structure implementation.
+        seen[found.value()] = true;  // Assign or update a variable that represents the current algorithm state.
+        assert(!mapped.contains(static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ULL + 1));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(std::count(seen.begin(), seen.end(), true) == 5000);  // Execute this statement as part of the data structure implementation.
+    std::remove(path.c_str());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_perfect_hash_empty_and_invalid_files) {  // Execute this statement as part of the data structure implementation.
+    const std::string path = "test_perfect_hash_invalid.phf";  // Assign or update a variable that represents the current algorithm state.
+    PerfectHashBuilder<int, int> empty;  // Execute this statement as part of the data structure implementation.
+    empty.writeFile(path);  // Execute this statement as part of the data structure implementation.
+    {  // Execute this statement as part of the data structure implementation.
+        MappedPerfectHashTable<int, int> mapped(path);  // Execute this statement as part of the data structure implementation.
+        assert(mapped.empty());  // Execute this statement as part of the data structure implementation.
+        assert(!mapped.contains(0));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    // key 型別不符 - Key type mismatch
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        MappedPerfectHashTable<std::string, int> wrongKey(path);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::runtime_error&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+
+    // 重複的 key - Duplicate keys
+    PerfectHashBuilder<int, int> duplicates;  // Execute this statement as part of the data structure implementation.
+    duplicates.add(7, 1);  // Execute this statement as part of the data structure implementation.
+    duplicates.add(7, 2);  // Execute this statement as part of the data structure implementation.
+    threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        duplicates.writeFile(path);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::invalid_argument&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+
+    // 截斷的檔案與不存在的檔案 - Truncated and missing files
+    PerfectHashBuilder<int, int> builder;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 100; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        builder.add(i, i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    PerfectHashBuildStats stats = builder.writeFile(path);  // Assign or update a variable that represents the current algorithm state.
+    std::string bytes(stats.fileBytes, '\0');  // Assign or update a variable that represents the current algorithm state.
+    {  // Execute this statement as part of the data structure implementation.
+        std::ifstream in(path, std::ios::binary);  // Execute this statement as part of the data structure implementation.
+        in.read(&bytes[0], static_cast<std::streamsize>(bytes.size()));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    {  // Execute this statement as part of the data structure implementation.
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);  // Execute this statement as part of the data structure implementation.
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 8));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        MappedPerfectHashTable<int, int> truncated(path);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::runtime_error&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+
+    // 位移表位移接近 2^64：與桶數相加會繞回，必須在相加前就擋下
+    // Displacement offset near 2^64: adding the bucket bytes wraps around, so it must be rejected before the sum
+    PerfectHashFileHeader header;  // Execute this statement as part of the data structure implementation.
+    std::memcpy(&header, bytes.data(), sizeof(header));  // Execute this statement as part of the data structure implementation.
+    header.displacementOffset = sizeof(PerfectHashFileHeader) - header.bucketCount * sizeof(uint32_t);  // 無號數繞回 - Wraps as unsigned
+    std::string wrapped = bytes;  // Assign or update a variable that represents the current algorithm state.
+    std::memcpy(&wrapped[0], &header, sizeof(header));  // Execute this statement as part of the data structure implementation.
+    {  // Execute this statement as part of the data structure implementation.
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);  // Execute this statement as part of the data structure implementation.
+        out.write(wrapped.data(), static_cast<std::streamsize>(wrapped.size()));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        MappedPerfectHashTable<int, int> corrupt(path);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::runtime_error&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+    std::remove(path.c_str());  // Execute this statement as part of the data structure implementation.
+
+    threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        MappedPerfectHashTable<int, int> missing(path);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::runtime_error&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+// ========== 快照測試 Snapshot Tests ==========
+
+/** Doc block start
+ * 讀出整個檔案 / Read a whole file
+ */  // End of block comment
+std::string readFileBytes(const std::string& path) {  // Execute this statement as part of the data structure implementation.
+    std::ifstream in(path, std::ios::binary);  // Execute this statement as part of the data structure implementation.
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 以指定內容覆寫檔案 / Overwrite a file with the given bytes
+ */  // End of block comment
+void writeFileBytes(const std::string& path, const std::string& bytes) {  // Execute this statement as part of the data structure implementation.
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);  // Execute this statement as part of the data structure implementation.
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_snapshot_round_trip_string_keys) {  // Execute this statement as part of the data structure implementation.
+    const std::string path = "test_snapshot_strings.snap";  // Assign or update a variable that represents the current algorithm state.
+    HashTable<std::string, std::string> table;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 5000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        table.insert("key" + std::to_string(i), std::string(static_cast<size_t>(i % 40), 'v'));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    table.insert("", "empty key");  // Execute this statement as part of the data structure implementation.
+    table.insert("big", std::string(3 << 20, 'b'));  // 比 1 MiB 緩衝區大的欄位 - A field larger than the 1 MiB buffer
+    SnapshotStats saved = saveSnapshot(table, path);  // Assign or update a variable that represents the current algorithm state.
+    assert(saved.entries == table.size());  // Execute this statement as part of the data structure implementation.
+
+    HashTable<std::string, std::string> loaded(4);  // Execute this statement as part of the data structure implementation.
+    SnapshotStats stats = loadSnapshot(path, loaded);  // Assign or update a variable that represents the current algorithm state.
+    assert(stats.entries == table.size() && stats.fileBytes == saved.fileBytes);  // Execute this statement as part of the data structure implementation.
+    HashTable<std::string, std::string> presized(4);  // Execute this statement as part of the data structure implementation.
+    presized.reserve(table.size());  // Execute this statement as part of the data structure implementation.
+    assert(loaded.capacity() == presized.capacity());  // 只擴容一次 - Grown exactly once
+    assert(loaded.size() == table.size());  // Execute this statement as part of the data structure implementation.
+    table.forEach([&loaded](const std::string& key, const std::string& value) {  // Iterate over a range/collection to process each item in sequence.
+        assert(loaded.search(key) == value);  // Execute this statement as part of the data structure implementation.
+    });  // Execute this statement as part of the data structure implementation.
+    std::remove(path.c_str());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_snapshot_mapped_integer_keys) {  // Execute this statement as part of the data structure implementation.
+    const std::string path = "test_snapshot_integers.snap";  // Assign or update a variable that represents the current algorithm state.
+    HashTable<int, double> table;  // Execute this statement as part of the data structure implementation.
+    for (int i = -2000; i < 2000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        table.insert(i * 7, i * 0.5);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    saveSnapshot(table, path);  // Execute this statement as part of the data structure implementation.
+
+    HashTable<int, double> mapped;  // Execute this statement as part of the data structure implementation.
+    assert(loadSnapshotMapped(path, mapped).entries == 4000);  // Execute this statement as part of the data structure implementation.
+    HashTable<int, double> streamed;  // Execute this statement as part of the data structure implementation.
+    loadSnapshot(path, streamed);  // Execute this statement as part of the data structure implementation.
+    for (int i = -2000; i < 2000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(mapped.search(i * 7) == i * 0.5);  // Execute this statement as part of the data structure implementation.
+        assert(streamed.search(i * 7) == i * 0.5);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(!mapped.contains(1) && mapped.size() == 4000);  // Execute this statement as part of the data structure implementation.
+
+    HashTable<int, double> empty;  // Execute this statement as part of the data structure implementation.
+    saveSnapshot(empty, path);  // Execute this statement as part of the data structure implementation.
+    HashTable<int, double> reloaded;  // Execute this statement as part of the data structure implementation.
+    assert(loadSnapshotMapped(path, reloaded).entries == 0 && reloaded.empty());  // Execute this statement as part of the data structure implementation.
+    std::remove(path.c_str());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_snapshot_corrupt_and_mismatched_files) {  // Execute this statement as part of the data structure implementation.
+    const std::string path = "test_snapshot_invalid.snap";  // Assign or update a variable that represents the current algorithm state.
+    HashTable<int, int> table;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 1000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        table.insert(i, -i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    saveSnapshot(table, path);  // Execute this statement as part of the data structure implementation.
+    const std::string original = readFileBytes(path);  // Assign or update a variable that represents the current algorithm state.
+
+    // 每種錯誤都必須丟出例外，而且不留下部分內容 - Every failure must throw and leave nothing behind
+    auto expectRejected = [&path](bool mapped) {  // Execute this statement as part of the data structure implementation.
+        HashTable<int, int> target;  // Execute this statement as part of the data structure implementation.
+        bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+        try {  // Execute this statement as part of the data structure implementation.
+            if (mapped) {  // Execute this statement as part of the data structure implementation.
+                loadSnapshotMapped(path, target);  // Execute this statement as part of the data structure implementation.
+            } else {  // Execute this statement as part of the data structure implementation.
+                loadSnapshot(path, target);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        } catch (const std::runtime_error&) {  // Execute this statement as part of the data structure implementation.
+            threw = true;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        assert(threw && target.empty());  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+
+    std::string flipped = original;  // Assign or update a variable that represents the current algorithm state.
+    flipped[flipped.size() / 2] ^= 0x40;  // 資料區中間翻轉一個位元 - Flip one bit mid-payload
+    writeFileBytes(path, flipped);  // Execute this statement as part of the data structure implementation.
+    expectRejected(false);  // Execute this statement as part of the data structure implementation.
+    expectRejected(true);  // Execute this statement as part of the data structure implementation.
+
+    writeFileBytes(path, original.substr(0, original.size() - 8));  // 截斷 - Truncated
+    expectRejected(false);  // Execute this statement as part of the data structure implementation.
+    expectRejected(true);  // Execute this statement as part of the data structure implementation.
+
+    writeFileBytes(path, original);  // Execute this statement as part of the data structure implementation.
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        HashTable<int, std::string> wrongValue;  // Execute this statement as part of the data structure implementation.
+        loadSnapshot(path, wrongValue);  // value 型別不符 - Value type mismatch
+    } catch (const std::runtime_error&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+
+    threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        HashTable<int, int> notEmpty;  // Execute this statement as part of the data structure implementation.
+        notEmpty.insert(1, 1);  // Execute this statement as part of the data structure implementation.
+        loadSnapshot(path, notEmpty);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::invalid_argument&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+    std::remove(path.c_str());  // Execute this statement as part of the data structure implementation.
+
+    expectRejected(false);  // 檔案不存在 - Missing file
+    expectRejected(true);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
 // ========== 主函式 Main Function ==========
 
 int main() {  // Execute this statement as part of the data structure implementation.
@@ -252,6 +1165,8 @@ int main() {  // Execute this statement as part of the data structure implementa
 
     // 擴容測試 - Rehashing tests
     RUN_TEST(test_rehash_on_load_factor);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    RUN_TEST(test_incremental_rehash_mid_migration);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    RUN_TEST(test_incremental_rehash_matches_reference);  // Rehash entries into a larger table to keep operations near O(1) on average.
 
     // 運算子測試 - Operator tests
     RUN_TEST(test_bracket_operator_access);  // Execute this statement as part of the data structure implementation.
@@ -259,15 +1174,54 @@ int main() {  // Execute this statement as part of the data structure implementa
     RUN_TEST(test_bracket_operator_default_value);  // Execute this statement as part of the data structure implementation.
     RUN_TEST(test_at_method);  // Execute this statement as part of the data structure implementation.
 
+    // 異質查詢與就地建構測試 - Heterogeneous lookup & emplace tests
+    RUN_TEST(test_heterogeneous_lookup);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_emplace_family_return_values);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_move_only_values);  // Execute this statement as part of the data structure implementation.
+
+    // 批次操作測試 - Batch operation tests
+    RUN_TEST(test_batch_insert_and_search);  // Execute this statement as part of the data structure implementation.
+
     // 迭代器測試 - Iterator tests
     RUN_TEST(test_iterator);  // Execute this statement as part of the data structure implementation.
 
     // 碰撞測試 - Collision tests
     RUN_TEST(test_multiple_items_same_bucket);  // Access or update the bucket storage used to hold entries or chains.
 
+    // 種子雜湊測試 - Seeded hash tests
+    RUN_TEST(test_siphash_reference_vectors);  // Compute a hash-based index so keys map into the table's storage.
+    RUN_TEST(test_seeded_hash_per_table);  // Compute a hash-based index so keys map into the table's storage.
+
+    // 批次雜湊測試 - Batch hash tests
+    RUN_TEST(test_hash_batch_integer_keys);  // Compute a hash-based index so keys map into the table's storage.
+    RUN_TEST(test_hash_batch_string_keys);  // Compute a hash-based index so keys map into the table's storage.
+    RUN_TEST(test_search_batch_string_keys);  // Execute this statement as part of the data structure implementation.
+
     // 不同鍵類型測試 - Different key types tests
     RUN_TEST(test_int_key);  // Execute this statement as part of the data structure implementation.
 
+    // 並行雜湊表測試 - Concurrent hash map tests
+    RUN_TEST(test_concurrent_basic_operations);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_concurrent_invalid_arguments);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_concurrent_seeded_shards);  // Compute a hash-based index so keys map into the table's storage.
+    RUN_TEST(test_concurrent_upsert_from_many_threads);  // Execute this statement as part of the data structure implementation.
+
+    // 無鎖分裂序集合測試 - Lock-free split-ordered set tests
+    RUN_TEST(test_split_ordered_basic_operations);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_split_ordered_incremental_growth);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_epoch_reclamation_defers_free);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_split_ordered_linearizability_stress);  // Execute this statement as part of the data structure implementation.
+
+    // 完美雜湊測試 - Perfect hash tests
+    RUN_TEST(test_perfect_hash_from_hash_table);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_perfect_hash_integer_keys_from_concurrent_map);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_perfect_hash_empty_and_invalid_files);  // Execute this statement as part of the data structure implementation.
+
+    // 快照測試 - Snapshot tests
+    RUN_TEST(test_snapshot_round_trip_string_keys);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_snapshot_mapped_integer_keys);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_snapshot_corrupt_and_mismatched_files);  // Execute this statement as part of the data structure implementation.
+
     // 結果摘要 - Results summary
     std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
     std::cout << "========================================" << std::endl;  // Execute this statement as part of the data structure implementation.
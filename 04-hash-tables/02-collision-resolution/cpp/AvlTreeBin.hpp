@@ -0,0 +1,294 @@
+/** Doc block start
+ * 樹化的桶（AVL 樹）- C++ 實作
+ * Treeified bucket (AVL tree) - C++ Implementation
+ *(blank line)
+ * 鏈太長時，ChainedHashTable 把該桶的串列換成這棵以 key 排序的 AVL 樹（Java HashMap 的 TreeNode 作法），
+ * 即使所有 key 落在同一桶，查詢、插入、刪除也只要 O(log n)。旋轉與再平衡的邏輯移植自
+ * 06-balanced-trees/01-avl-tree 的 AvlTree，改為存放鍵值對、接受任意可用 < 比較的 key。
+ * When a chain grows too long, ChainedHashTable swaps that bucket's list for this AVL tree ordered
+ * by key (the TreeNode approach of Java's HashMap), so lookups, inserts and removals stay O(log n)
+ * even if every key lands in one bucket. Rotation and rebalancing are ported from AvlTree in
+ * 06-balanced-trees/01-avl-tree, generalized to key-value pairs and any key ordered by <.
+ */  // End of block comment
+
+#ifndef AVL_TREE_BIN_HPP  // Execute this statement as part of the data structure implementation.
+#define AVL_TREE_BIN_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <cstdlib>  // Execute this statement as part of the data structure implementation.
+#include <list>  // Execute this statement as part of the data structure implementation.
+#include <memory>  // Execute this statement as part of the data structure implementation.
+#include <type_traits>  // Execute this statement as part of the data structure implementation.
+#include <utility>  // Execute this statement as part of the data structure implementation.
+
+// key 是否能以 < 排序（不能排序的 key 不樹化）- Whether keys can be ordered by < (unordered keys are never treeified)
+template <typename K, typename = void>  // Execute this statement as part of the data structure implementation.
+struct IsLessComparable : std::false_type {};  // Execute this statement as part of the data structure implementation.
+template <typename K>  // Execute this statement as part of the data structure implementation.
+struct IsLessComparable<K, std::void_t<decltype(std::declval<const K&>() < std::declval<const K&>())>> : std::true_type {};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 以 key 排序的 AVL 樹，存放鍵值對 / AVL tree of key-value pairs ordered by key
+ *(blank line)
+ * @tparam K 鍵的型別，需支援 <（key type, must support <）
+ * @tparam V 值的型別（value type）
+ */  // End of block comment
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+class AvlTreeBin {  // Execute this statement as part of the data structure implementation.
+public:  // Execute this statement as part of the data structure implementation.
+    using PairType = std::pair<K, V>;  // Assign or update a variable that represents the current algorithm state.
+
+    AvlTreeBin() = default;  // Assign or update a variable that represents the current algorithm state.
+
+    // 深拷貝，讓 ChainedHashTable 保持可複製 - Deep copy so ChainedHashTable stays copyable
+    AvlTreeBin(const AvlTreeBin& other) : root_(clone(other.root_.get())), size_(other.size_) {}  // Assign or update a variable that represents the current algorithm state.
+    AvlTreeBin& operator=(const AvlTreeBin&) = delete;  // Assign or update a variable that represents the current algorithm state.
+
+    /** Doc block start
+     * 由串列建樹：節點的鍵值對被搬進樹中，串列清空
+     * Build from a list: the pairs are moved into the tree and the list is emptied
+     */  // End of block comment
+    explicit AvlTreeBin(std::list<PairType>& chain) {  // Execute this statement as part of the data structure implementation.
+        for (PairType& pair : chain) {  // Iterate over a range/collection to process each item in sequence.
+            insert(std::move(pair));  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        chain.clear();  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    size_t size() const { return size_; }  // Execute this statement as part of the data structure implementation.
+
+    // 高度以邊數計（空樹 -1、單一節點 0），與 06 的 AvlTree 相同 - Height in edges (empty -1, leaf 0), as in chapter 06
+    int height() const { return h(root_.get()); }  // Execute this statement as part of the data structure implementation.
+
+    // 根節點位址，供批次查詢預取 - Root address, prefetched by searchBatch
+    const void* rootAddress() const { return root_.get(); }  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 查詢 key；probes 累加比對過的節點數 / Find key; probes accumulates the nodes compared
+     */  // End of block comment
+    const PairType* find(const K& key, size_t& probes) const {  // Execute this statement as part of the data structure implementation.
+        const Node* node = root_.get();  // Assign or update a variable that represents the current algorithm state.
+        while (node != nullptr) {  // Repeat while the loop condition remains true.
+            ++probes;  // Advance or track the probing sequence used by open addressing.
+            if (key < node->pair.first) {  // Evaluate the condition and branch into the appropriate code path.
+                node = node->left.get();  // Assign or update a variable that represents the current algorithm state.
+            } else if (node->pair.first < key) {  // Evaluate the condition and branch into the appropriate code path.
+                node = node->right.get();  // Assign or update a variable that represents the current algorithm state.
+            } else {  // Handle the alternative branch when the condition is false.
+                return &node->pair;  // Return the computed result to the caller.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        return nullptr;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 插入新的鍵值對（呼叫端保證 key 不存在）/ Insert a new pair (the caller guarantees the key is absent)
+     */  // End of block comment
+    void insert(PairType&& pair) {  // Execute this statement as part of the data structure implementation.
+        root_ = insertSubtree(std::move(root_), std::move(pair));  // Execute this statement as part of the data structure implementation.
+        ++size_;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 刪除 key；probes 累加比對過的節點數 / Remove key; probes accumulates the nodes compared
+     *(blank line)
+     * @return 是否刪除 / true if removed
+     */  // End of block comment
+    bool remove(const K& key, size_t& probes) {  // Execute this statement as part of the data structure implementation.
+        bool removed = false;  // Assign or update a variable that represents the current algorithm state.
+        root_ = removeSubtree(std::move(root_), key, removed, probes);  // Execute this statement as part of the data structure implementation.
+        if (removed) {  // Evaluate the condition and branch into the appropriate code path.
+            --size_;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        return removed;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 依 key 順序對每一對呼叫 fn(key, value) / Call fn(key, value) for every pair in key order
+     */  // End of block comment
+    template <typename Fn>  // Execute this statement as part of the data structure implementation.
+    void forEach(Fn&& fn) const {  // Execute this statement as part of the data structure implementation.
+        inorderWalk(root_.get(), fn);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 把所有鍵值對依 key 順序搬到 chain 尾端，樹變成空的（退化回串列時使用）
+     * Move every pair, in key order, to the tail of chain and leave the tree empty (used to untreeify)
+     */  // End of block comment
+    void moveTo(std::list<PairType>& chain) {  // Execute this statement as part of the data structure implementation.
+        auto append = [&chain](K& key, V& value) {  // Execute this statement as part of the data structure implementation.
+            chain.emplace_back(std::move(key), std::move(value));  // Execute this statement as part of the data structure implementation.
+        };  // Execute this statement as part of the data structure implementation.
+        inorderWalk(root_.get(), append);  // Execute this statement as part of the data structure implementation.
+        root_.reset();  // Execute this statement as part of the data structure implementation.
+        size_ = 0;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 驗證 BST 順序、AVL 平衡與快取的高度（測試用）/ Validate BST order, AVL balance and cached heights (for tests)
+     */  // End of block comment
+    bool validate() const {  // Execute this statement as part of the data structure implementation.
+        int computedHeight = 0;  // Assign or update a variable that represents the current algorithm state.
+        size_t count = 0;  // Assign or update a variable that represents the current algorithm state.
+        return validateSubtree(root_.get(), nullptr, nullptr, computedHeight, count) && count == size_;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+private:  // Execute this statement as part of the data structure implementation.
+    struct Node {  // Execute this statement as part of the data structure implementation.
+        PairType pair;  // Execute this statement as part of the data structure implementation.
+        int height;  // 以邊數計的高度（葉節點為 0）- Height in edges (leaf = 0)
+        std::unique_ptr<Node> left;  // Execute this statement as part of the data structure implementation.
+        std::unique_ptr<Node> right;  // Execute this statement as part of the data structure implementation.
+
+        explicit Node(PairType&& p) : pair(std::move(p)), height(0) {}  // Assign or update a variable that represents the current algorithm state.
+    };  // Execute this statement as part of the data structure implementation.
+
+    std::unique_ptr<Node> root_;  // Execute this statement as part of the data structure implementation.
+    size_t size_ = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    static int h(const Node* node) {  // Execute this statement as part of the data structure implementation.
+        return node == nullptr ? -1 : node->height;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    static void updateHeight(Node* node) {  // Execute this statement as part of the data structure implementation.
+        node->height = 1 + std::max(h(node->left.get()), h(node->right.get()));  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    static int balanceFactor(const Node* node) {  // Execute this statement as part of the data structure implementation.
+        return h(node->left.get()) - h(node->right.get());  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    static std::unique_ptr<Node> rotateRight(std::unique_ptr<Node> y) {  // 修正左重 - Fix a left-heavy imbalance
+        std::unique_ptr<Node> x = std::move(y->left);  // Assign or update a variable that represents the current algorithm state.
+        y->left = std::move(x->right);  // Assign or update a variable that represents the current algorithm state.
+        updateHeight(y.get());  // Execute this statement as part of the data structure implementation.
+        x->right = std::move(y);  // Assign or update a variable that represents the current algorithm state.
+        updateHeight(x.get());  // Execute this statement as part of the data structure implementation.
+        return x;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    static std::unique_ptr<Node> rotateLeft(std::unique_ptr<Node> x) {  // 修正右重 - Fix a right-heavy imbalance
+        std::unique_ptr<Node> y = std::move(x->right);  // Assign or update a variable that represents the current algorithm state.
+        x->right = std::move(y->left);  // Assign or update a variable that represents the current algorithm state.
+        updateHeight(x.get());  // Execute this statement as part of the data structure implementation.
+        y->left = std::move(x);  // Assign or update a variable that represents the current algorithm state.
+        updateHeight(y.get());  // Execute this statement as part of the data structure implementation.
+        return y;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    static std::unique_ptr<Node> rebalance(std::unique_ptr<Node> node) {  // Execute this statement as part of the data structure implementation.
+        updateHeight(node.get());  // Execute this statement as part of the data structure implementation.
+        int balance = balanceFactor(node.get());  // Assign or update a variable that represents the current algorithm state.
+        if (balance > 1) {  // LL / LR
+            if (balanceFactor(node->left.get()) < 0) {  // Evaluate the condition and branch into the appropriate code path.
+                node->left = rotateLeft(std::move(node->left));  // Assign or update a variable that represents the current algorithm state.
+            }  // Close the current block scope.
+            return rotateRight(std::move(node));  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        if (balance < -1) {  // RR / RL
+            if (balanceFactor(node->right.get()) > 0) {  // Evaluate the condition and branch into the appropriate code path.
+                node->right = rotateRight(std::move(node->right));  // Assign or update a variable that represents the current algorithm state.
+            }  // Close the current block scope.
+            return rotateLeft(std::move(node));  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        return node;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    static std::unique_ptr<Node> insertSubtree(std::unique_ptr<Node> node, PairType&& pair) {  // Execute this statement as part of the data structure implementation.
+        if (node == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+            return std::make_unique<Node>(std::move(pair));  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        if (pair.first < node->pair.first) {  // Evaluate the condition and branch into the appropriate code path.
+            node->left = insertSubtree(std::move(node->left), std::move(pair));  // Assign or update a variable that represents the current algorithm state.
+        } else {  // 呼叫端保證不重複 - The caller guarantees no duplicate
+            node->right = insertSubtree(std::move(node->right), std::move(pair));  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        return rebalance(std::move(node));  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 摘下子樹中最小的節點交給 minNode，回傳再平衡後的子樹。06 的 AvlTree 把後繼的 key 複製過來；
+     * 這裡改為整個節點接上去，鍵值對不必可指派。
+     * Detach the smallest node of the subtree into minNode and return the rebalanced subtree.
+     * Chapter 06's AvlTree copies the successor's key instead; relinking the node means pairs need
+     * not be assignable.
+     */  // End of block comment
+    static std::unique_ptr<Node> detachMin(std::unique_ptr<Node> node, std::unique_ptr<Node>& minNode) {  // Execute this statement as part of the data structure implementation.
+        if (node->left == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+            std::unique_ptr<Node> right = std::move(node->right);  // Assign or update a variable that represents the current algorithm state.
+            minNode = std::move(node);  // Assign or update a variable that represents the current algorithm state.
+            return right;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        node->left = detachMin(std::move(node->left), minNode);  // Assign or update a variable that represents the current algorithm state.
+        return rebalance(std::move(node));  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    static std::unique_ptr<Node> removeSubtree(std::unique_ptr<Node> node, const K& key, bool& removed, size_t& probes) {  // Execute this statement as part of the data structure implementation.
+        if (node == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+            return nullptr;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        ++probes;  // Advance or track the probing sequence used by open addressing.
+        if (key < node->pair.first) {  // Evaluate the condition and branch into the appropriate code path.
+            node->left = removeSubtree(std::move(node->left), key, removed, probes);  // Assign or update a variable that represents the current algorithm state.
+        } else if (node->pair.first < key) {  // Evaluate the condition and branch into the appropriate code path.
+            node->right = removeSubtree(std::move(node->right), key, removed, probes);  // Assign or update a variable that represents the current algorithm state.
+        } else {  // Handle the alternative branch when the condition is false.
+            removed = true;  // Assign or update a variable that represents the current algorithm state.
+            if (node->left == nullptr) {  // 0 或 1 個子節點 - Zero or one child
+                return std::move(node->right);  // Return the computed result to the caller.
+            }  // Close the current block scope.
+            if (node->right == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+                return std::move(node->left);  // Return the computed result to the caller.
+            }  // Close the current block scope.
+            // 兩個子節點：右子樹的最小節點（中序後繼）接替 - Two children: the in-order successor takes its place
+            std::unique_ptr<Node> successor;  // Assign or update a variable that represents the current algorithm state.
+            std::unique_ptr<Node> right = detachMin(std::move(node->right), successor);  // Assign or update a variable that represents the current algorithm state.
+            successor->left = std::move(node->left);  // Assign or update a variable that represents the current algorithm state.
+            successor->right = std::move(right);  // Assign or update a variable that represents the current algorithm state.
+            node = std::move(successor);  // 原節點在此釋放 - The removed node is freed here
+        }  // Close the current block scope.
+        return rebalance(std::move(node));  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    static std::unique_ptr<Node> clone(const Node* node) {  // Execute this statement as part of the data structure implementation.
+        if (node == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+            return nullptr;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        auto copy = std::make_unique<Node>(PairType(node->pair));  // Assign or update a variable that represents the current algorithm state.
+        copy->height = node->height;  // Assign or update a variable that represents the current algorithm state.
+        copy->left = clone(node->left.get());  // Assign or update a variable that represents the current algorithm state.
+        copy->right = clone(node->right.get());  // Assign or update a variable that represents the current algorithm state.
+        return copy;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    template <typename NodePtr, typename Fn>  // Execute this statement as part of the data structure implementation.
+    static void inorderWalk(NodePtr node, Fn& fn) {  // Execute this statement as part of the data structure implementation.
+        if (node == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+            return;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        inorderWalk(node->left.get(), fn);  // Execute this statement as part of the data structure implementation.
+        fn(node->pair.first, node->pair.second);  // Execute this statement as part of the data structure implementation.
+        inorderWalk(node->right.get(), fn);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    static bool validateSubtree(const Node* node, const K* low, const K* high, int& outHeight, size_t& count) {  // Execute this statement as part of the data structure implementation.
+        if (node == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+            outHeight = -1;  // Assign or update a variable that represents the current algorithm state.
+            return true;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        if ((low != nullptr && !(*low < node->pair.first)) || (high != nullptr && !(node->pair.first < *high))) {  // Evaluate the condition and branch into the appropriate code path.
+            return false;  // 違反嚴格的 BST 順序 - Strict BST order violated
+        }  // Close the current block scope.
+        int leftH = 0;  // Assign or update a variable that represents the current algorithm state.
+        int rightH = 0;  // Assign or update a variable that represents the current algorithm state.
+        if (!validateSubtree(node->left.get(), low, &node->pair.first, leftH, count) ||  // Evaluate the condition and branch into the appropriate code path.
+            !validateSubtree(node->right.get(), &node->pair.first, high, rightH, count)) {  // Execute this statement as part of the data structure implementation.
+            return false;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        ++count;  // Execute this statement as part of the data structure implementation.
+        outHeight = 1 + std::max(leftH, rightH);  // Assign or update a variable that represents the current algorithm state.
+        return node->height == outHeight && std::abs(leftH - rightH) <= 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+
+#endif // AVL_TREE_BIN_HPP
@@ -3,11 +3,18 @@
  * Hash Table with Chaining for Collision Resolution - C++ Implementation
  *(blank line)
  * 使用鏈結串列處理碰撞，追蹤探測次數統計 / Uses linked lists for collision handling with probe count tracking
+ *(blank line)
+ * 防禦雜湊洪水攻擊：每個表有自己的隨機種子（SeededHash.hpp），而任何一條鏈超過 TREEIFY_THRESHOLD
+ * 個元素就改成 AVL 樹（AvlTreeBin.hpp），縮到 UNTREEIFY_THRESHOLD 以下再退回串列。
+ * Hash-flooding defense: every table has its own random seed (SeededHash.hpp), and any chain that
+ * grows past TREEIFY_THRESHOLD entries becomes an AVL tree (AvlTreeBin.hpp), turning back into a
+ * list once it shrinks to UNTREEIFY_THRESHOLD.
  */  // End of block comment
 
 #ifndef CHAINING_HPP  // Execute this statement as part of the data structure implementation.
 #define CHAINING_HPP  // Execute this statement as part of the data structure implementation.
 
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
 #include <vector>  // Execute this statement as part of the data structure implementation.
 #include <list>  // Execute this statement as part of the data structure implementation.
 #include <utility>  // Execute this statement as part of the data structure implementation.
@@ -15,6 +22,11 @@
 #include <optional>  // Execute this statement as part of the data structure implementation.
 #include <stdexcept>  // Execute this statement as part of the data structure implementation.
 #include <string>  // Execute this statement as part of the data structure implementation.
+#include <memory>  // Execute this statement as part of the data structure implementation.
+#include "AvlTreeBin.hpp"  // Execute this statement as part of the data structure implementation.
+#include "HashTableStats.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SeededHash.hpp"  // Execute this statement as part of the data structure implementation.
+#include "BatchHash.hpp"  // 批次查詢一次雜湊整組 key - Batched lookups hash a whole group per call
 
 /** Doc block start
  * 鏈結雜湊表模板類別 / Chained Hash Table template class
@@ -34,8 +46,9 @@ public:  // Execute this statement as part of the data structure implementation.
      * 建構子：初始化雜湊表 / Constructor: Initialize hash table
      *(blank line)
      * @param capacity 桶的數量（number of buckets）
+     * @param seed 雜湊種子，預設每個表各自隨機（hash seed, random per table by default）
      */  // End of block comment
-    explicit ChainedHashTable(size_t capacity = DEFAULT_CAPACITY);  // Assign or update a variable that represents the current algorithm state.
+    explicit ChainedHashTable(size_t capacity = DEFAULT_CAPACITY, HashSeed seed = HashSeed::random());  // Assign or update a variable that represents the current algorithm state.
 
     /** Doc block start
      * 解構子 / Destructor
@@ -93,6 +106,43 @@ public:  // Execute this statement as part of the data structure implementation.
      */  // End of block comment
     bool contains(const K& key) const;  // Execute this statement as part of the data structure implementation.
 
+    // ========== 批次操作 Batch Operations ==========
+
+    /** Doc block start
+     * 批次插入（若 key 已存在則更新）：先以 reserve 把桶數加大到至少全部元素數，再逐一插入
+     * Batch insert (updates existing keys): reserve buckets for every element first, then insert
+     *(blank line)
+     * @throws std::invalid_argument 若 keys 與 values 長度不同
+     */  // End of block comment
+    void insertBatch(const std::vector<K>& keys, const std::vector<V>& values);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 批次查詢：每 BATCH_GROUP 個 key 一組，先以 seededHashBatch 算好索引並預取桶，再預取各鏈第一個節點，最後才比對
+     * Batch lookup: per group of BATCH_GROUP keys, compute indices with seededHashBatch and prefetch
+     * the buckets, then prefetch each chain's first node, and only then compare
+     */  // End of block comment
+    void searchBatch(const std::vector<K>& keys, std::vector<std::optional<V>>& out) const;  // Execute this statement as part of the data structure implementation.
+
+    // ========== 走訪 Traversal ==========
+
+    /** Doc block start
+     * 對每一對呼叫 fn(key, value)（唯讀，順序不固定）；可供 PerfectHashBuilder::fromTable 等工具匯出內容
+     * Call fn(key, value) for every pair (read-only, unspecified order); lets tools such as
+     * PerfectHashBuilder::fromTable export the contents
+     */  // End of block comment
+    template <typename Fn>  // Execute this statement as part of the data structure implementation.
+    void forEach(Fn&& fn) const {  // Execute this statement as part of the data structure implementation.
+        for (const Bucket& bucket : buckets_) {  // Iterate over a range/collection to process each item in sequence.
+            if (bucket.tree) {  // 樹化的桶依 key 順序走訪 - Treeified buckets are walked in key order
+                bucket.tree->forEach(fn);  // Execute this statement as part of the data structure implementation.
+                continue;  // Skip to the next loop iteration.
+            }  // Close the current block scope.
+            for (const auto& pair : bucket.chain) {  // Iterate over a range/collection to process each item in sequence.
+                fn(pair.first, pair.second);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
     // ========== 容量操作 Capacity Operations ==========
 
     /** Doc block start
@@ -120,6 +170,13 @@ public:  // Execute this statement as part of the data structure implementation.
         return static_cast<double>(size_) / capacity_;  // Return the computed result to the caller.
     }  // Close the current block scope.
 
+    /** Doc block start
+     * 鏈結版本不會自動擴容；reserve 把桶數加大到至少 n（負載因子 ≤ 1），節點以 splice 搬移
+     * This table never grows on its own; reserve raises the bucket count to at least n
+     * (load factor ≤ 1), moving nodes with splice
+     */  // End of block comment
+    void reserve(size_t n);  // Execute this statement as part of the data structure implementation.
+
     /** Doc block start
      * 清空雜湊表 / Clear all elements
      */  // End of block comment
@@ -147,19 +204,79 @@ public:  // Execute this statement as part of the data structure implementation.
      */  // End of block comment
     void resetProbeCount() { total_probes_ = 0; }  // Advance or track the probing sequence used by open addressing.
 
+    /** Doc block start
+     * 目前樹化的桶數（key 不能以 < 排序時恆為 0）/ Number of treeified buckets (always 0 if keys cannot be ordered by <)
+     */  // End of block comment
+    size_t getTreeBinCount() const { return tree_bins_; }  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 回傳這個表的雜湊種子 / Return this table's hash seed
+     */  // End of block comment
+    const HashSeed& hashSeed() const { return seed_; }  // Execute this statement as part of the data structure implementation.
+
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    /** Doc block start
+     * 統計快照（需以 HASH_TABLE_STATS=1 編譯）：鏈長分布即時維護，不必像 getMaxChainLength 走訪所有桶
+     * Statistics snapshot (requires HASH_TABLE_STATS=1): the chain distribution is maintained live,
+     * so unlike getMaxChainLength no bucket scan is needed
+     */  // End of block comment
+    HashTableStats stats() const {  // Execute this statement as part of the data structure implementation.
+        HashTableStats result;  // Assign or update a variable that represents the current algorithm state.
+        result.size = size_;  // Assign or update a variable that represents the current algorithm state.
+        result.capacity = capacity_;  // Assign or update a variable that represents the current algorithm state.
+        stats_.fill(result, capacity_);  // Execute this statement as part of the data structure implementation.
+        result.bytesAllocated = buckets_.capacity() * sizeof(Bucket) + size_ * listNodeBytes<PairType>() +  // Access or update the bucket storage used to hold entries or chains.
+                                tree_bins_ * sizeof(TreeBin);  // 樹節點以串列節點估計 - Tree nodes are estimated as list nodes
+        return result;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 歸零探測與重建計數器 / Zero the probe and rebuild counters
+     */  // End of block comment
+    void resetStats() { stats_.resetCounters(); }  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
 private:  // Execute this statement as part of the data structure implementation.
-    // 桶的型別：每個桶是一個鏈結串列 / Bucket type: each bucket is a linked list
-    using Bucket = std::list<PairType>;  // Assign or update a variable that represents the current algorithm state.
+    using TreeBin = AvlTreeBin<K, V>;  // Assign or update a variable that represents the current algorithm state.
+
+    /** Doc block start
+     * 桶：平常是一個鏈結串列；樹化後元素全部移到 tree，chain 為空
+     * Bucket: normally a linked list; once treeified every entry lives in tree and chain is empty
+     */  // End of block comment
+    struct Bucket {  // Access or update the bucket storage used to hold entries or chains.
+        std::list<PairType> chain;  // Access or update the bucket storage used to hold entries or chains.
+        std::unique_ptr<TreeBin> tree;  // Execute this statement as part of the data structure implementation.
+
+        Bucket() = default;  // Assign or update a variable that represents the current algorithm state.
+        Bucket(const Bucket& other) : chain(other.chain), tree(other.tree ? std::make_unique<TreeBin>(*other.tree) : nullptr) {}  // Access or update the bucket storage used to hold entries or chains.
+        Bucket(Bucket&&) noexcept = default;  // Access or update the bucket storage used to hold entries or chains.
+        Bucket& operator=(Bucket other) noexcept {  // 複製並交換 - Copy and swap
+            chain.swap(other.chain);  // Access or update the bucket storage used to hold entries or chains.
+            tree.swap(other.tree);  // Execute this statement as part of the data structure implementation.
+            return *this;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+
+        size_t size() const { return tree ? tree->size() : chain.size(); }  // Access or update the bucket storage used to hold entries or chains.
+    };  // Execute this statement as part of the data structure implementation.
 
     // ========== 私有成員 Private Members ==========
     std::vector<Bucket> buckets_;  // 桶陣列 - Array of buckets
     size_t capacity_;               // 桶的數量 - Number of buckets
     size_t size_;                   // 元素數量 - Number of elements
     size_t total_probes_;          // 總探測次數 - Total probe count
-    std::hash<K> hasher_;          // 雜湊函數 - Hash function
+    size_t tree_bins_;             // 樹化的桶數 - Treeified buckets
+    HashTableHasher<K> hasher_;    // 雜湊函數 - Hash function
+    HashSeed seed_;                 // 雜湊種子 - Hash seed
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    mutable HashTableStatsRecorder stats_;  // 即時統計（查詢是 const）- Live statistics (lookups are const)
+#endif  // Execute this statement as part of the data structure implementation.
 
     // ========== 常數 Constants ==========
     static constexpr size_t DEFAULT_CAPACITY = 16;  // Assign or update a variable that represents the current algorithm state.
+    static constexpr size_t BATCH_GROUP = 16;  // 批次查詢同時預取的 key 數 - Keys prefetched together by searchBatch
+    static constexpr size_t TREEIFY_THRESHOLD = 8;  // 鏈超過此長度就樹化 - Chains longer than this become trees
+    static constexpr size_t UNTREEIFY_THRESHOLD = 6;  // 樹縮到此大小就退回串列 - Trees this small turn back into lists
+    static constexpr bool TREEIFY_ENABLED = IsLessComparable<K>::value;  // Execute this statement as part of the data structure implementation.
 
     // ========== 私有方法 Private Methods ==========
 
@@ -170,7 +287,44 @@ private:  // Execute this statement as part of the data structure implementation
      * @return 桶的索引
      */  // End of block comment
     size_t hash(const K& key) const {  // Compute a hash-based index so keys map into the table's storage.
-        return hasher_(key) % capacity_;  // Return the computed result to the caller.
+        return seededHash(hasher_, key, seed_) % capacity_;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 在桶中尋找 key（串列或樹），probes 累加比對過的節點數
+     * Find key in a bucket (list or tree); probes accumulates the nodes compared
+     */  // End of block comment
+    const PairType* findInBucket(const Bucket& bucket, const K& key, size_t& probes) const;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 在桶尾端加入新元素；鏈超過 TREEIFY_THRESHOLD 時樹化
+     * Append a new entry to a bucket; treeify once the chain exceeds TREEIFY_THRESHOLD
+     */  // End of block comment
+    void appendToBucket(Bucket& bucket, const K& key, const V& value);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 從桶中刪除 key；樹縮到 UNTREEIFY_THRESHOLD 時退回串列
+     * Remove key from a bucket; a tree that shrinks to UNTREEIFY_THRESHOLD turns back into a list
+     */  // End of block comment
+    bool eraseFromBucket(Bucket& bucket, const K& key, size_t& probes);  // Execute this statement as part of the data structure implementation.
+
+    // 把樹化的桶退回串列（reserve 重新分配前也會用到）- Turn a treeified bucket back into a list (also used before reserve redistributes)
+    void untreeify(Bucket& bucket) {  // Execute this statement as part of the data structure implementation.
+        bucket.tree->moveTo(bucket.chain);  // Execute this statement as part of the data structure implementation.
+        bucket.tree.reset();  // Execute this statement as part of the data structure implementation.
+        --tree_bins_;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 預取一個快取行供讀取（非 GCC/Clang 編譯器上不做任何事）
+     * Prefetch one cache line for reading (a no-op on compilers other than GCC/Clang)
+     */  // End of block comment
+    static void prefetch(const void* address) {  // Execute this statement as part of the data structure implementation.
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);  // Execute this statement as part of the data structure implementation.
+#else
+        (void)address;  // Execute this statement as part of the data structure implementation.
+#endif
     }  // Close the current block scope.
 };  // Execute this statement as part of the data structure implementation.
 
@@ -179,8 +333,8 @@ private:  // Execute this statement as part of the data structure implementation
 // ============================================================
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
-ChainedHashTable<K, V>::ChainedHashTable(size_t capacity)  // Execute this statement as part of the data structure implementation.
-    : capacity_(capacity), size_(0), total_probes_(0) {  // Advance or track the probing sequence used by open addressing.
+ChainedHashTable<K, V>::ChainedHashTable(size_t capacity, HashSeed seed)  // Execute this statement as part of the data structure implementation.
+    : capacity_(capacity), size_(0), total_probes_(0), tree_bins_(0), seed_(seed) {  // Advance or track the probing sequence used by open addressing.
     if (capacity == 0) {  // Evaluate the condition and branch into the appropriate code path.
         throw std::invalid_argument(  // Throw an exception to signal an invalid argument or operation.
             "容量必須為正整數 / Capacity must be positive");  // Execute this statement as part of the data structure implementation.
@@ -196,20 +350,20 @@ size_t ChainedHashTable<K, V>::insert(const K& key, const V& value) {  // Execut
     size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
 
     // 檢查 key 是否已存在 - Check if key exists
-    for (auto& pair : bucket) {  // Iterate over a range/collection to process each item in sequence.
-        ++probes;  // Advance or track the probing sequence used by open addressing.
-        if (pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
-            pair.second = value;  // 更新 - Update existing
-            total_probes_ += probes;  // Advance or track the probing sequence used by open addressing.
-            return probes;  // Return the computed result to the caller.
-        }  // Close the current block scope.
+    if (const PairType* found = findInBucket(bucket, key, probes)) {  // Evaluate the condition and branch into the appropriate code path.
+        const_cast<PairType*>(found)->second = value;  // 更新 - Update existing
+        total_probes_ += probes;  // Advance or track the probing sequence used by open addressing.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+        return probes;  // Return the computed result to the caller.
     }  // Close the current block scope.
 
     // 新增鍵值對 - Add new key-value pair
-    bucket.emplace_back(key, value);  // Access or update the bucket storage used to hold entries or chains.
+    appendToBucket(bucket, key, value);  // Access or update the bucket storage used to hold entries or chains.
     ++size_;  // Execute this statement as part of the data structure implementation.
     ++probes;  // 插入操作算一次探測 - Insertion counts as one probe
     total_probes_ += probes;  // Advance or track the probing sequence used by open addressing.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+    HASH_TABLE_STATS_ONLY(stats_.chainResized(bucket.size() - 1, bucket.size()));  // Access or update the bucket storage used to hold entries or chains.
 
     return probes;  // Return the computed result to the caller.
 }  // Close the current block scope.
@@ -228,11 +382,10 @@ std::optional<V> ChainedHashTable<K, V>::search(const K& key, size_t& probes) co
     probes = 0;  // Advance or track the probing sequence used by open addressing.
 
     // 在桶中搜尋 - Search in bucket
-    for (const auto& pair : bucket) {  // Iterate over a range/collection to process each item in sequence.
-        ++probes;  // Advance or track the probing sequence used by open addressing.
-        if (pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
-            return pair.second;  // Return the computed result to the caller.
-        }  // Close the current block scope.
+    const PairType* found = findInBucket(bucket, key, probes);  // Assign or update a variable that represents the current algorithm state.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+    if (found != nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+        return found->second;  // Return the computed result to the caller.
     }  // Close the current block scope.
     return std::nullopt;  // Return the computed result to the caller.
 }  // Close the current block scope.
@@ -244,14 +397,14 @@ bool ChainedHashTable<K, V>::remove(const K& key) {  // Execute this statement a
     Bucket& bucket = buckets_[index];  // Access or update the bucket storage used to hold entries or chains.
 
     // 在桶中尋找並刪除 - Find and delete from bucket
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {  // Iterate over a range/collection to process each item in sequence.
-        if (it->first == key) {  // Evaluate the condition and branch into the appropriate code path.
-            bucket.erase(it);  // Access or update the bucket storage used to hold entries or chains.
-            --size_;  // Execute this statement as part of the data structure implementation.
-            return true;  // Return the computed result to the caller.
-        }  // Close the current block scope.
+    size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+    bool removed = eraseFromBucket(bucket, key, probes);  // Access or update the bucket storage used to hold entries or chains.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+    if (removed) {  // Evaluate the condition and branch into the appropriate code path.
+        --size_;  // Execute this statement as part of the data structure implementation.
+        HASH_TABLE_STATS_ONLY(stats_.chainResized(bucket.size() + 1, bucket.size()));  // Access or update the bucket storage used to hold entries or chains.
     }  // Close the current block scope.
-    return false;  // Return the computed result to the caller.
+    return removed;  // Return the computed result to the caller.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
@@ -259,13 +412,92 @@ bool ChainedHashTable<K, V>::contains(const K& key) const {  // Execute this sta
     return search(key).has_value();  // Return the computed result to the caller.
 }  // Close the current block scope.
 
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void ChainedHashTable<K, V>::insertBatch(const std::vector<K>& keys, const std::vector<V>& values) {  // Execute this statement as part of the data structure implementation.
+    if (keys.size() != values.size()) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::invalid_argument("keys 與 values 長度必須相同 / keys and values must have the same length");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    reserve(size_ + keys.size());  // 只調整一次桶數 - Resize the bucket array once
+    for (size_t i = 0; i < keys.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        insert(keys[i], values[i]);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void ChainedHashTable<K, V>::searchBatch(const std::vector<K>& keys, std::vector<std::optional<V>>& out) const {  // Execute this statement as part of the data structure implementation.
+    out.resize(keys.size());  // Execute this statement as part of the data structure implementation.
+    size_t indices[BATCH_GROUP];  // Compute a hash-based index so keys map into the table's storage.
+    for (size_t base = 0; base < keys.size(); base += BATCH_GROUP) {  // Iterate over a range/collection to process each item in sequence.
+        size_t count = std::min(BATCH_GROUP, keys.size() - base);  // Assign or update a variable that represents the current algorithm state.
+
+        // 第一輪：整組一次算雜湊值，取餘數得索引並預取桶（串列標頭）- Pass 1: hash the group in one call, reduce to indices and prefetch the buckets (list headers)
+        seededHashBatch(hasher_, keys.data() + base, count, seed_, indices);  // Compute a hash-based index so keys map into the table's storage.
+        for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            indices[i] %= capacity_;  // 與 hash() 相同的桶索引 - Same bucket index as hash()
+            prefetch(&buckets_[indices[i]]);  // Access or update the bucket storage used to hold entries or chains.
+        }  // Close the current block scope.
+
+        // 第二輪：預取各鏈第一個節點 - Pass 2: prefetch each chain's first node
+        for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            const Bucket& bucket = buckets_[indices[i]];  // Access or update the bucket storage used to hold entries or chains.
+            if (bucket.tree) {  // 樹化的桶預取根節點 - Treeified buckets prefetch the root
+                prefetch(bucket.tree->rootAddress());  // Execute this statement as part of the data structure implementation.
+            } else if (!bucket.chain.empty()) {  // Evaluate the condition and branch into the appropriate code path.
+                prefetch(&bucket.chain.front());  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+
+        // 第三輪：比對 - Pass 3: compare
+        for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+            const PairType* found = findInBucket(buckets_[indices[i]], keys[base + i], probes);  // Access or update the bucket storage used to hold entries or chains.
+            out[base + i] = found != nullptr ? std::optional<V>(found->second) : std::nullopt;  // Assign or update a variable that represents the current algorithm state.
+            HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void ChainedHashTable<K, V>::reserve(size_t n) {  // Execute this statement as part of the data structure implementation.
+    if (n <= capacity_) {  // Evaluate the condition and branch into the appropriate code path.
+        return;  // 已足夠 - Already large enough
+    }  // Close the current block scope.
+    HASH_TABLE_STATS_ONLY(stats_.countRehash());  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HASH_TABLE_STATS_ONLY(HashTableStatsRecorder::RehashScope rehashScope(stats_);)  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HASH_TABLE_STATS_ONLY(stats_.resetChains());  // 所有鏈重新分配 - Every chain is redistributed
+    std::vector<Bucket> oldBuckets(n);  // Access or update the bucket storage used to hold entries or chains.
+    buckets_.swap(oldBuckets);  // 新陣列全空，舊鏈移到 oldBuckets - New array is empty; old chains move to oldBuckets
+    capacity_ = n;  // Assign or update a variable that represents the current algorithm state.
+    for (Bucket& bucket : oldBuckets) {  // Iterate over a range/collection to process each item in sequence.
+        if (bucket.tree) {  // 樹先攤平成串列再分配 - Flatten trees into lists before redistributing
+            untreeify(bucket);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        while (!bucket.chain.empty()) {  // Repeat while the loop condition remains true.
+            std::list<PairType>& target = buckets_[hash(bucket.chain.front().first)].chain;  // Access or update the bucket storage used to hold entries or chains.
+            target.splice(target.end(), bucket.chain, bucket.chain.begin());  // 只搬節點，不重新配置 - Moves the node without reallocating
+            HASH_TABLE_STATS_ONLY(stats_.chainResized(target.size() - 1, target.size()));  // Access or update the bucket storage used to hold entries or chains.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    if constexpr (TREEIFY_ENABLED) {  // 重新分配後仍然過長的鏈再樹化 - Chains still too long after redistribution are treeified again
+        for (Bucket& bucket : buckets_) {  // Iterate over a range/collection to process each item in sequence.
+            if (bucket.chain.size() > TREEIFY_THRESHOLD) {  // Evaluate the condition and branch into the appropriate code path.
+                bucket.tree = std::make_unique<TreeBin>(bucket.chain);  // Execute this statement as part of the data structure implementation.
+                ++tree_bins_;  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 void ChainedHashTable<K, V>::clear() {  // Execute this statement as part of the data structure implementation.
     for (auto& bucket : buckets_) {  // Iterate over a range/collection to process each item in sequence.
-        bucket.clear();  // Access or update the bucket storage used to hold entries or chains.
+        bucket.chain.clear();  // Access or update the bucket storage used to hold entries or chains.
+        bucket.tree.reset();  // Execute this statement as part of the data structure implementation.
     }  // Close the current block scope.
     size_ = 0;  // Assign or update a variable that represents the current algorithm state.
     total_probes_ = 0;  // Advance or track the probing sequence used by open addressing.
+    tree_bins_ = 0;  // Execute this statement as part of the data structure implementation.
+    HASH_TABLE_STATS_ONLY(stats_.resetChains());  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
@@ -287,7 +519,7 @@ double ChainedHashTable<K, V>::getAverageChainLength() const {  // Execute this
 
     // 計算非空桶的總長度 - Calculate total length of non-empty buckets
     for (const auto& bucket : buckets_) {  // Iterate over a range/collection to process each item in sequence.
-        if (!bucket.empty()) {  // Evaluate the condition and branch into the appropriate code path.
+        if (bucket.size() != 0) {  // Evaluate the condition and branch into the appropriate code path.
             total_length += bucket.size();  // Access or update the bucket storage used to hold entries or chains.
             ++non_empty_buckets;  // Access or update the bucket storage used to hold entries or chains.
         }  // Close the current block scope.
@@ -297,4 +529,59 @@ double ChainedHashTable<K, V>::getAverageChainLength() const {  // Execute this
     return static_cast<double>(total_length) / non_empty_buckets;  // Return the computed result to the caller.
 }  // Close the current block scope.
 
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+const typename ChainedHashTable<K, V>::PairType* ChainedHashTable<K, V>::findInBucket(  // Execute this statement as part of the data structure implementation.
+    const Bucket& bucket, const K& key, size_t& probes) const {  // Access or update the bucket storage used to hold entries or chains.
+    if constexpr (TREEIFY_ENABLED) {  // Evaluate the condition and branch into the appropriate code path.
+        if (bucket.tree) {  // Evaluate the condition and branch into the appropriate code path.
+            return bucket.tree->find(key, probes);  // O(log n) 比對 - O(log n) comparisons
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    for (const auto& pair : bucket.chain) {  // Iterate over a range/collection to process each item in sequence.
+        ++probes;  // Advance or track the probing sequence used by open addressing.
+        if (pair.first == key) {  // Evaluate the condition and branch into the appropriate code path.
+            return &pair;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    return nullptr;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void ChainedHashTable<K, V>::appendToBucket(Bucket& bucket, const K& key, const V& value) {  // Access or update the bucket storage used to hold entries or chains.
+    if constexpr (TREEIFY_ENABLED) {  // Evaluate the condition and branch into the appropriate code path.
+        if (bucket.tree) {  // Evaluate the condition and branch into the appropriate code path.
+            bucket.tree->insert(PairType(key, value));  // Execute this statement as part of the data structure implementation.
+            return;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        bucket.chain.emplace_back(key, value);  // Access or update the bucket storage used to hold entries or chains.
+        if (bucket.chain.size() > TREEIFY_THRESHOLD) {  // 鏈太長：改成 AVL 樹 - Chain too long: switch to an AVL tree
+            bucket.tree = std::make_unique<TreeBin>(bucket.chain);  // Execute this statement as part of the data structure implementation.
+            ++tree_bins_;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    } else {  // Handle the alternative branch when the condition is false.
+        bucket.chain.emplace_back(key, value);  // Access or update the bucket storage used to hold entries or chains.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool ChainedHashTable<K, V>::eraseFromBucket(Bucket& bucket, const K& key, size_t& probes) {  // Access or update the bucket storage used to hold entries or chains.
+    if constexpr (TREEIFY_ENABLED) {  // Evaluate the condition and branch into the appropriate code path.
+        if (bucket.tree) {  // Evaluate the condition and branch into the appropriate code path.
+            bool removed = bucket.tree->remove(key, probes);  // Assign or update a variable that represents the current algorithm state.
+            if (removed && bucket.tree->size() <= UNTREEIFY_THRESHOLD) {  // 樹夠小了：退回串列 - Small enough: back to a list
+                untreeify(bucket);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            return removed;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    for (auto it = bucket.chain.begin(); it != bucket.chain.end(); ++it) {  // Iterate over a range/collection to process each item in sequence.
+        ++probes;  // Advance or track the probing sequence used by open addressing.
+        if (it->first == key) {  // Evaluate the condition and branch into the appropriate code path.
+            bucket.chain.erase(it);  // Access or update the bucket storage used to hold entries or chains.
+            return true;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    return false;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
 #endif // CHAINING_HPP
@@ -0,0 +1,425 @@
+/** Doc block start
+ * 扁平節點鏈結法（Flat Chaining）- C++ 實作
+ * Hash Table with Flat-Node Chaining - C++ Implementation
+ *(blank line)
+ * 所有節點放在同一個連續陣列中，以 int32 索引串成鏈；桶陣列只存每條鏈的頭索引，
+ * 刪除的節點放進空閒串列（free list）供之後的插入重用。
+ * All nodes live in one contiguous array and are chained by int32 indices; the bucket array only
+ * stores each chain's head index, and removed nodes go onto a free list for later inserts to reuse.
+ *(blank line)
+ * 與 ChainedHashTable 介面相同（含探測次數統計），可以直接替換比較。
+ * Same interface as ChainedHashTable (including probe counting), so the two can be swapped directly.
+ */  // End of block comment
+
+#ifndef FLAT_CHAINING_HPP  // Execute this statement as part of the data structure implementation.
+#define FLAT_CHAINING_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <utility>  // Execute this statement as part of the data structure implementation.
+#include <functional>  // Execute this statement as part of the data structure implementation.
+#include <optional>  // Execute this statement as part of the data structure implementation.
+#include <stdexcept>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include "HashTableStats.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SeededHash.hpp"  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 扁平節點鏈結雜湊表模板類別 / Flat-node chained hash table template class
+ *(blank line)
+ * @tparam K 鍵的型別（key type）
+ * @tparam V 值的型別（value type）
+ */  // End of block comment
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+class FlatChainedHashTable {  // Execute this statement as part of the data structure implementation.
+public:  // Execute this statement as part of the data structure implementation.
+    // 型別別名 - Type aliases
+    using KeyType = K;  // Assign or update a variable that represents the current algorithm state.
+    using ValueType = V;  // Assign or update a variable that represents the current algorithm state.
+
+    /** Doc block start
+     * 節點：鍵、值與同一條鏈上下一個節點的索引
+     * Node: key, value and the index of the next node on the same chain
+     */  // End of block comment
+    struct Entry {  // Execute this statement as part of the data structure implementation.
+        K key;  // Execute this statement as part of the data structure implementation.
+        V value;  // Execute this statement as part of the data structure implementation.
+        int32_t next;  // 下一個節點索引，NIL 代表鏈尾 - Next node index, NIL ends the chain
+    };  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 建構子：初始化雜湊表 / Constructor: Initialize hash table
+     *(blank line)
+     * @param capacity 桶的數量（number of buckets）
+     * @param seed 雜湊種子，預設每個表各自隨機（hash seed, random per table by default）
+     */  // End of block comment
+    explicit FlatChainedHashTable(size_t capacity = DEFAULT_CAPACITY, HashSeed seed = HashSeed::random());  // Assign or update a variable that represents the current algorithm state.
+
+    /** Doc block start
+     * 解構子 / Destructor
+     */  // End of block comment
+    ~FlatChainedHashTable() = default;  // Assign or update a variable that represents the current algorithm state.
+
+    // ========== 基本操作 Basic Operations ==========
+
+    /** Doc block start
+     * 插入鍵值對（若 key 已存在則更新）
+     * Insert key-value pair (update if key exists)
+     *(blank line)
+     * 時間複雜度 Time Complexity: 平均 O(1), 最差 O(n)
+     *(blank line)
+     * @param key 鍵
+     * @param value 值
+     * @return 探測次數 - Number of probes performed
+     * @throws std::length_error 節點數超過 int32 索引範圍 - Node count exceeds the int32 index range
+     */  // End of block comment
+    size_t insert(const K& key, const V& value);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 搜尋給定 key 的 value
+     * Search for value associated with key
+     *(blank line)
+     * @param key 要搜尋的鍵
+     * @return 找到則回傳 value，否則回傳 std::nullopt
+     *         Value if found, std::nullopt otherwise
+     */  // End of block comment
+    std::optional<V> search(const K& key) const;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 搜尋並回傳探測次數 / Search and return probe count
+     *(blank line)
+     * @param key 要搜尋的鍵
+     * @param probes 輸出參數：探測次數
+     * @return 找到則回傳 value，否則回傳 std::nullopt
+     */  // End of block comment
+    std::optional<V> search(const K& key, size_t& probes) const;  // Advance or track the probing sequence used by open addressing.
+
+    /** Doc block start
+     * 刪除指定的鍵值對；節點放入空閒串列，其鍵值物件保留到被重用或 clear()
+     * Delete key-value pair; the node goes onto the free list and keeps its key/value objects
+     * until it is reused or clear() is called
+     *(blank line)
+     * @param key 要刪除的鍵
+     * @return 刪除成功回傳 true，key 不存在回傳 false
+     *         true if deleted, false if key not found
+     */  // End of block comment
+    bool remove(const K& key);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 檢查 key 是否存在
+     * Check if key exists
+     *(blank line)
+     * @param key 要檢查的鍵
+     * @return 存在回傳 true，否則回傳 false
+     */  // End of block comment
+    bool contains(const K& key) const;  // Execute this statement as part of the data structure implementation.
+
+    // ========== 走訪 Traversal ==========
+
+    /** Doc block start
+     * 對每一對呼叫 fn(key, value)（唯讀，順序不固定）；可供 PerfectHashBuilder::fromTable 等工具匯出內容
+     * Call fn(key, value) for every pair (read-only, unspecified order); lets tools such as
+     * PerfectHashBuilder::fromTable export the contents
+     */  // End of block comment
+    template <typename Fn>  // Execute this statement as part of the data structure implementation.
+    void forEach(Fn&& fn) const {  // Execute this statement as part of the data structure implementation.
+        for (int32_t head : heads_) {  // 沿鏈走訪，空閒串列上的節點不會被碰到 - Walk the chains; free-list nodes are never visited
+            for (int32_t i = head; i != NIL; i = entries_[i].next) {  // Iterate over a range/collection to process each item in sequence.
+                fn(entries_[i].key, entries_[i].value);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    // ========== 容量操作 Capacity Operations ==========
+
+    /** Doc block start
+     * 回傳元素數量 / Return number of elements
+     */  // End of block comment
+    size_t size() const { return size_; }  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 回傳桶的數量 / Return number of buckets
+     */  // End of block comment
+    size_t capacity() const { return capacity_; }  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 檢查是否為空 / Check if empty
+     */  // End of block comment
+    bool empty() const { return size_ == 0; }  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 計算負載因子 α = n / m
+     * Calculate load factor (α = n / m)
+     *(blank line)
+     * @return 負載因子
+     */  // End of block comment
+    double loadFactor() const {  // Execute this statement as part of the data structure implementation.
+        return static_cast<double>(size_) / capacity_;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 預留 n 個節點的空間，插入 n 個元素前不再重新配置
+     * Reserve room for n nodes so the next n inserts never reallocate
+     */  // End of block comment
+    void reserve(size_t n) { entries_.reserve(n); }  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 清空雜湊表：一次釋放節點陣列，不必逐一釋放節點
+     * Clear all elements: the node array is released at once instead of node by node
+     */  // End of block comment
+    void clear();  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 節點陣列長度（含空閒串列中的節點）/ Length of the node array (free-list nodes included)
+     */  // End of block comment
+    size_t nodeCount() const { return entries_.size(); }  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 節點陣列與桶陣列實際配置的位元組數 / Bytes allocated for the node and bucket arrays
+     */  // End of block comment
+    size_t memoryBytes() const {  // Execute this statement as part of the data structure implementation.
+        return entries_.capacity() * sizeof(Entry) + heads_.capacity() * sizeof(int32_t);  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    // ========== 統計資訊 Statistics ==========
+
+    /** Doc block start
+     * 取得最長鏈結長度 / Get maximum chain length
+     */  // End of block comment
+    size_t getMaxChainLength() const;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 取得平均鏈結長度 / Get average chain length
+     */  // End of block comment
+    double getAverageChainLength() const;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 取得總探測次數 / Get total probe count
+     */  // End of block comment
+    size_t getTotalProbes() const { return total_probes_; }  // Advance or track the probing sequence used by open addressing.
+
+    /** Doc block start
+     * 重設探測計數器 / Reset probe counter
+     */  // End of block comment
+    void resetProbeCount() { total_probes_ = 0; }  // Advance or track the probing sequence used by open addressing.
+
+    /** Doc block start
+     * 回傳這個表的雜湊種子 / Return this table's hash seed
+     */  // End of block comment
+    const HashSeed& hashSeed() const { return seed_; }  // Execute this statement as part of the data structure implementation.
+
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    /** Doc block start
+     * 統計快照（需以 HASH_TABLE_STATS=1 編譯）；bytesAllocated 即 memoryBytes()
+     * Statistics snapshot (requires HASH_TABLE_STATS=1); bytesAllocated is memoryBytes()
+     */  // End of block comment
+    HashTableStats stats() const {  // Execute this statement as part of the data structure implementation.
+        HashTableStats result;  // Assign or update a variable that represents the current algorithm state.
+        result.size = size_;  // Assign or update a variable that represents the current algorithm state.
+        result.capacity = capacity_;  // Assign or update a variable that represents the current algorithm state.
+        stats_.fill(result, capacity_);  // Execute this statement as part of the data structure implementation.
+        result.bytesAllocated = memoryBytes();  // Assign or update a variable that represents the current algorithm state.
+        return result;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 歸零探測與重建計數器 / Zero the probe and rebuild counters
+     */  // End of block comment
+    void resetStats() { stats_.resetCounters(); }  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
+private:  // Execute this statement as part of the data structure implementation.
+    // ========== 私有成員 Private Members ==========
+    std::vector<int32_t> heads_;   // 每個桶的鏈頭索引 - Chain head index per bucket
+    std::vector<Entry> entries_;   // 所有節點 - Every node
+    int32_t free_head_;            // 空閒串列頭 - Free list head
+    size_t capacity_;              // 桶的數量 - Number of buckets
+    size_t size_;                  // 元素數量 - Number of elements
+    size_t total_probes_;          // 總探測次數 - Total probe count
+    HashTableHasher<K> hasher_;    // 雜湊函數 - Hash function
+    HashSeed seed_;                 // 雜湊種子 - Hash seed
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    mutable HashTableStatsRecorder stats_;  // 即時統計（查詢是 const）- Live statistics (lookups are const)
+#endif  // Execute this statement as part of the data structure implementation.
+
+    // ========== 常數 Constants ==========
+    static constexpr size_t DEFAULT_CAPACITY = 16;  // Assign or update a variable that represents the current algorithm state.
+    static constexpr int32_t NIL = -1;  // 空鏈／鏈尾 - Empty chain / end of chain
+    static constexpr size_t MAX_NODES = static_cast<size_t>(INT32_MAX);  // Assign or update a variable that represents the current algorithm state.
+
+    // ========== 私有方法 Private Methods ==========
+
+    /** Doc block start
+     * 計算雜湊索引 / Compute hash index
+     *(blank line)
+     * @param key 要雜湊的鍵
+     * @return 桶的索引
+     */  // End of block comment
+    size_t hash(const K& key) const {  // Compute a hash-based index so keys map into the table's storage.
+        return seededHash(hasher_, key, seed_) % capacity_;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+
+// ============================================================
+// 實作部分 Implementation
+// ============================================================
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+FlatChainedHashTable<K, V>::FlatChainedHashTable(size_t capacity, HashSeed seed)  // Execute this statement as part of the data structure implementation.
+    : free_head_(NIL), capacity_(capacity), size_(0), total_probes_(0), seed_(seed) {  // Advance or track the probing sequence used by open addressing.
+    if (capacity == 0) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::invalid_argument(  // Throw an exception to signal an invalid argument or operation.
+            "容量必須為正整數 / Capacity must be positive");  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    heads_.assign(capacity_, NIL);  // Access or update the bucket storage used to hold entries or chains.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+size_t FlatChainedHashTable<K, V>::insert(const K& key, const V& value) {  // Execute this statement as part of the data structure implementation.
+    // 計算雜湊索引 - Compute hash index
+    size_t index = hash(key);  // Compute a hash-based index so keys map into the table's storage.
+    size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+
+    // 檢查 key 是否已存在 - Check if key exists
+    for (int32_t i = heads_[index]; i != NIL; i = entries_[i].next) {  // Iterate over a range/collection to process each item in sequence.
+        ++probes;  // Advance or track the probing sequence used by open addressing.
+        if (entries_[i].key == key) {  // Evaluate the condition and branch into the appropriate code path.
+            entries_[i].value = value;  // 更新 - Update existing
+            total_probes_ += probes;  // Advance or track the probing sequence used by open addressing.
+            HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+            return probes;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    // 優先重用空閒節點，否則附加到陣列尾端 - Reuse a free node first, otherwise append to the array
+    int32_t slot;  // Assign or update a variable that represents the current algorithm state.
+    if (free_head_ != NIL) {  // Evaluate the condition and branch into the appropriate code path.
+        slot = free_head_;  // Assign or update a variable that represents the current algorithm state.
+        Entry& entry = entries_[slot];  // Execute this statement as part of the data structure implementation.
+        entry.key = key;  // Assign or update a variable that represents the current algorithm state.
+        entry.value = value;  // Assign or update a variable that represents the current algorithm state.
+        free_head_ = entry.next;  // Assign or update a variable that represents the current algorithm state.
+    } else {  // Handle the alternative branch when the condition is false.
+        if (entries_.size() >= MAX_NODES) {  // Evaluate the condition and branch into the appropriate code path.
+            throw std::length_error(  // Throw an exception to signal an invalid argument or operation.
+                "節點數超過 int32 索引範圍 / Node count exceeds the int32 index range");  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        slot = static_cast<int32_t>(entries_.size());  // Assign or update a variable that represents the current algorithm state.
+        entries_.push_back(Entry{key, value, NIL});  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    // 新節點接在鏈頭 - New node becomes the chain head
+    entries_[slot].next = heads_[index];  // Access or update the bucket storage used to hold entries or chains.
+    heads_[index] = slot;  // Access or update the bucket storage used to hold entries or chains.
+    ++size_;  // Execute this statement as part of the data structure implementation.
+    HASH_TABLE_STATS_ONLY(stats_.chainResized(probes, probes + 1));  // 未命中時走過整條鏈，probes 即原本的鏈長 - A miss walked the whole chain, so probes is its old length
+    ++probes;  // 插入操作算一次探測 - Insertion counts as one probe
+    total_probes_ += probes;  // Advance or track the probing sequence used by open addressing.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+
+    return probes;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+std::optional<V> FlatChainedHashTable<K, V>::search(const K& key) const {  // Execute this statement as part of the data structure implementation.
+    size_t probes;  // Advance or track the probing sequence used by open addressing.
+    return search(key, probes);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+std::optional<V> FlatChainedHashTable<K, V>::search(const K& key, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
+    // 計算雜湊索引 - Compute hash index
+    size_t index = hash(key);  // Compute a hash-based index so keys map into the table's storage.
+    probes = 0;  // Advance or track the probing sequence used by open addressing.
+
+    // 沿著索引鏈搜尋 - Follow the index chain
+    for (int32_t i = heads_[index]; i != NIL; i = entries_[i].next) {  // Iterate over a range/collection to process each item in sequence.
+        ++probes;  // Advance or track the probing sequence used by open addressing.
+        if (entries_[i].key == key) {  // Evaluate the condition and branch into the appropriate code path.
+            HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+            return entries_[i].value;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+    return std::nullopt;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool FlatChainedHashTable<K, V>::remove(const K& key) {  // Execute this statement as part of the data structure implementation.
+    // 計算雜湊索引 - Compute hash index
+    size_t index = hash(key);  // Compute a hash-based index so keys map into the table's storage.
+
+    // link 指向「指到目前節點的那個索引」- link points at the index that refers to the current node
+    int32_t* link = &heads_[index];  // Access or update the bucket storage used to hold entries or chains.
+    HASH_TABLE_STATS_ONLY(size_t probes = 0;)  // Advance or track the probing sequence used by open addressing.
+    while (*link != NIL) {  // Repeat while the loop condition remains true.
+        int32_t i = *link;  // Assign or update a variable that represents the current algorithm state.
+        HASH_TABLE_STATS_ONLY(++probes);  // Advance or track the probing sequence used by open addressing.
+        if (entries_[i].key == key) {  // Evaluate the condition and branch into the appropriate code path.
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+            // 鏈長 = 已走過的節點 + 後面剩下的節點 - Chain length = nodes walked so far + the rest of the chain
+            size_t length = probes;  // Assign or update a variable that represents the current algorithm state.
+            for (int32_t j = entries_[i].next; j != NIL; j = entries_[j].next) {  // Iterate over a range/collection to process each item in sequence.
+                ++length;  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            stats_.recordProbes(probes);  // Advance or track the probing sequence used by open addressing.
+            stats_.chainResized(length, length - 1);  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+            *link = entries_[i].next;  // 從鏈上摘除 - Unlink from the chain
+            entries_[i].next = free_head_;  // 放入空閒串列 - Push onto the free list
+            free_head_ = i;  // Assign or update a variable that represents the current algorithm state.
+            --size_;  // Execute this statement as part of the data structure implementation.
+            return true;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+        link = &entries_[i].next;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+    return false;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool FlatChainedHashTable<K, V>::contains(const K& key) const {  // Execute this statement as part of the data structure implementation.
+    return search(key).has_value();  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void FlatChainedHashTable<K, V>::clear() {  // Execute this statement as part of the data structure implementation.
+    std::fill(heads_.begin(), heads_.end(), NIL);  // Access or update the bucket storage used to hold entries or chains.
+    entries_.clear();  // 保留容量供之後插入 - Keeps the capacity for later inserts
+    free_head_ = NIL;  // Assign or update a variable that represents the current algorithm state.
+    size_ = 0;  // Assign or update a variable that represents the current algorithm state.
+    total_probes_ = 0;  // Advance or track the probing sequence used by open addressing.
+    HASH_TABLE_STATS_ONLY(stats_.resetChains());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+size_t FlatChainedHashTable<K, V>::getMaxChainLength() const {  // Execute this statement as part of the data structure implementation.
+    size_t max_length = 0;  // Assign or update a variable that represents the current algorithm state.
+    // 遍歷所有桶找最長鏈結 - Traverse all buckets to find longest chain
+    for (int32_t head : heads_) {  // Iterate over a range/collection to process each item in sequence.
+        size_t length = 0;  // Assign or update a variable that represents the current algorithm state.
+        for (int32_t i = head; i != NIL; i = entries_[i].next) {  // Iterate over a range/collection to process each item in sequence.
+            ++length;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        max_length = std::max(max_length, length);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    return max_length;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+double FlatChainedHashTable<K, V>::getAverageChainLength() const {  // Execute this statement as part of the data structure implementation.
+    size_t non_empty_buckets = 0;  // Access or update the bucket storage used to hold entries or chains.
+
+    // 所有存活節點都在某條鏈上，只需數非空桶 - Every live node is on some chain, so only count non-empty buckets
+    for (int32_t head : heads_) {  // Iterate over a range/collection to process each item in sequence.
+        if (head != NIL) {  // Evaluate the condition and branch into the appropriate code path.
+            ++non_empty_buckets;  // Access or update the bucket storage used to hold entries or chains.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    if (non_empty_buckets == 0) return 0.0;  // Evaluate the condition and branch into the appropriate code path.
+    return static_cast<double>(size_) / non_empty_buckets;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+#endif // FLAT_CHAINING_HPP
@@ -2,25 +2,30 @@
  * 雜湊表開放定址法（Open Addressing）- C++ 實作
  * Hash Table with Open Addressing for Collision Resolution - C++ Implementation
  *(blank line)
- * 支援三種探測方法：線性探測、二次探測、雙重雜湊 / Supports three probing methods: Linear, Quadratic, Double Hashing
+ * 支援四種探測方法：線性探測、二次探測、雙重雜湊、Robin Hood
+ * Supports four probing methods: Linear, Quadratic, Double Hashing, Robin Hood
  */  // End of block comment
 
 #ifndef OPEN_ADDRESSING_HPP  // Execute this statement as part of the data structure implementation.
 #define OPEN_ADDRESSING_HPP  // Execute this statement as part of the data structure implementation.
 
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
 #include <vector>  // Execute this statement as part of the data structure implementation.
 #include <optional>  // Execute this statement as part of the data structure implementation.
 #include <functional>  // Execute this statement as part of the data structure implementation.
 #include <stdexcept>  // Execute this statement as part of the data structure implementation.
 #include <string>  // Execute this statement as part of the data structure implementation.
+#include <utility>  // Execute this statement as part of the data structure implementation.
+#include "HashTableStats.hpp"  // Execute this statement as part of the data structure implementation.
 
 /** Doc block start
  * 探測方法列舉 / Probing method enumeration
  */  // End of block comment
 enum class ProbeMethod {  // Execute this statement as part of the data structure implementation.
     LINEAR,       // 線性探測 - Linear probing: h(k, i) = (h(k) + i) % m
-    QUADRATIC,    // 二次探測 - Quadratic probing: h(k, i) = (h(k) + c1*i + c2*i²) % m
-    DOUBLE_HASH   // 雙重雜湊 - Double hashing: h(k, i) = (h1(k) + i*h2(k)) % m
+    QUADRATIC,    // 二次探測（三角數位移）- Quadratic probing with triangular offsets: h(k, i) = (h(k) + (i + i²)/2) % m
+    DOUBLE_HASH,  // 雙重雜湊 - Double hashing: h(k, i) = (h1(k) + i*h2(k)) % m
+    ROBIN_HOOD    // Robin Hood：線性序列 + 依探測距離交換，刪除時往回平移 - Linear sequence, swap by probe distance, backward-shift delete
 };  // Execute this statement as part of the data structure implementation.
 
 /** Doc block start
@@ -58,10 +63,16 @@ public:  // Execute this statement as part of the data structure implementation.
      *(blank line)
      * 時間複雜度 Time Complexity: 平均 O(1), 最差 O(n)
      *(blank line)
+     * 負載（含墓碑）將超過 0.7 時自動重建：墓碑佔多數時以相同容量清除墓碑，否則容量加倍。
+     * 探測序列在上限以下仍找不到空位（非 2 的冪次容量上的二次探測或雙重雜湊）時，也會擴容後重試。
+     * Rebuilds automatically before occupancy (tombstones included) would exceed 0.7:
+     * purges tombstones at the same capacity when they dominate, otherwise doubles capacity.
+     * If the probe sequence still finds no free slot below the limit (quadratic or double hashing
+     * on a capacity that is not a power of two), the table grows and the insert retries.
+     *(blank line)
      * @param key 鍵
      * @param value 值
      * @return 探測次數 - Number of probes performed
-     * @throws std::runtime_error 若表已滿
      */  // End of block comment
     size_t insert(const K& key, const V& value);  // Execute this statement as part of the data structure implementation.
 
@@ -85,7 +96,8 @@ public:  // Execute this statement as part of the data structure implementation.
     std::optional<V> search(const K& key, size_t& probes) const;  // Advance or track the probing sequence used by open addressing.
 
     /** Doc block start
-     * 刪除指定的鍵值對（使用墓碑標記） / Delete key-value pair (using tombstone marker)
+     * 刪除指定的鍵值對（使用墓碑標記；ROBIN_HOOD 改用往回平移，不留墓碑）
+     * Delete key-value pair (tombstone marker; ROBIN_HOOD uses backward shift instead, no tombstones)
      *(blank line)
      * @param key 要刪除的鍵
      * @return 刪除成功回傳 true，key 不存在回傳 false
@@ -102,6 +114,42 @@ public:  // Execute this statement as part of the data structure implementation.
      */  // End of block comment
     bool contains(const K& key) const;  // Execute this statement as part of the data structure implementation.
 
+    // ========== 批次操作 Batch Operations ==========
+
+    /** Doc block start
+     * 批次插入（若 key 已存在則更新）：先以 reserve 一次重建到足夠的容量，插入過程中不再重建
+     * Batch insert (updates existing keys): reserve rebuilds once to a large enough capacity,
+     * so nothing is rebuilt while inserting
+     *(blank line)
+     * @throws std::invalid_argument 若 keys 與 values 長度不同
+     */  // End of block comment
+    void insertBatch(const std::vector<K>& keys, const std::vector<V>& values);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 批次查詢：每 BATCH_GROUP 個 key 一組，先算好雜湊值與起始槽位並全部預取，再沿用同一個雜湊值逐一探測。
+     * 線性探測與 Robin Hood 的後續探測多半落在同一或相鄰快取行；二次探測與雙重雜湊只預取第一次探測。
+     * Batch lookup: per group of BATCH_GROUP keys, hash every key and prefetch its home slot, then
+     * probe one by one from the same hashes. Later linear / Robin Hood probes mostly hit the same
+     * or the next cache line; quadratic and double hashing only get their first probe prefetched.
+     */  // End of block comment
+    void searchBatch(const std::vector<K>& keys, std::vector<std::optional<V>>& out) const;  // Execute this statement as part of the data structure implementation.
+
+    // ========== 走訪 Traversal ==========
+
+    /** Doc block start
+     * 對每一對呼叫 fn(key, value)（唯讀，順序不固定）；可供 PerfectHashBuilder::fromTable 等工具匯出內容
+     * Call fn(key, value) for every pair (read-only, unspecified order); lets tools such as
+     * PerfectHashBuilder::fromTable export the contents
+     */  // End of block comment
+    template <typename Fn>  // Execute this statement as part of the data structure implementation.
+    void forEach(Fn&& fn) const {  // Execute this statement as part of the data structure implementation.
+        for (const Slot& slot : table_) {  // Iterate over a range/collection to process each item in sequence.
+            if (slot.state == SlotState::OCCUPIED) {  // 略過空槽位與墓碑 - Skip empty slots and tombstones
+                fn(slot.key, slot.value);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
     // ========== 容量操作 Capacity Operations ==========
 
     /** Doc block start
@@ -129,6 +177,13 @@ public:  // Execute this statement as part of the data structure implementation.
         return static_cast<double>(size_ + deleted_count_) / capacity_;  // Return the computed result to the caller.
     }  // Close the current block scope.
 
+    /** Doc block start
+     * 預先重建（容量加倍直到足夠），讓 n 個元素不超過負載上限；墓碑會一併清除
+     * Rebuild ahead of time (doubling until large enough) so n elements stay under the load
+     * limit; tombstones are purged along the way
+     */  // End of block comment
+    void reserve(size_t n);  // Execute this statement as part of the data structure implementation.
+
     /** Doc block start
      * 清空雜湊表 / Clear all elements
      */  // End of block comment
@@ -147,15 +202,74 @@ public:  // Execute this statement as part of the data structure implementation.
     size_t getTotalProbes() const { return total_probes_; }  // Advance or track the probing sequence used by open addressing.
 
     /** Doc block start
-     * 重設探測計數器 / Reset probe counter
+     * 重設探測計數器（含分佈） / Reset probe counter (and distribution)
+     */  // End of block comment
+    void resetProbeCount() {  // Advance or track the probing sequence used by open addressing.
+        total_probes_ = 0;  // Advance or track the probing sequence used by open addressing.
+        probe_histogram_.clear();  // Advance or track the probing sequence used by open addressing.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 取得插入探測次數分佈：histogram[p] = 花了 p 次探測的插入數，與 getTotalProbes() 同步累計
+     * Get the insert probe-length distribution: histogram[p] = inserts that took p probes,
+     * accumulated alongside getTotalProbes()
+     */  // End of block comment
+    const std::vector<size_t>& getProbeHistogram() const { return probe_histogram_; }  // Advance or track the probing sequence used by open addressing.
+
+    /** Doc block start
+     * 設定觸發重建的負載上限（預設 0.7；Robin Hood 通常可以放寬到 0.9）
+     * Set the load limit that triggers a rebuild (default 0.7; Robin Hood usually tolerates 0.9)
+     *(blank line)
+     * @throws std::invalid_argument 若不在 (0, 1) 之間
      */  // End of block comment
-    void resetProbeCount() { total_probes_ = 0; }  // Advance or track the probing sequence used by open addressing.
+    void setMaxLoadFactor(double maxLoad) {  // Execute this statement as part of the data structure implementation.
+        if (!(maxLoad > 0.0 && maxLoad < 1.0)) {  // Evaluate the condition and branch into the appropriate code path.
+            throw std::invalid_argument("負載上限必須介於 0 與 1 之間 / Max load factor must be in (0, 1)");  // Throw an exception to signal an invalid argument or operation.
+        }  // Close the current block scope.
+        max_load_factor_ = maxLoad;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    double getMaxLoadFactor() const { return max_load_factor_; }  // Execute this statement as part of the data structure implementation.
 
     /** Doc block start
      * 取得當前探測方法 / Get current probing method
      */  // End of block comment
     ProbeMethod getProbeMethod() const { return method_; }  // Execute this statement as part of the data structure implementation.
 
+    /** Doc block start
+     * 取得重建次數（擴容 + 清除墓碑） / Get number of rebuilds (growth + tombstone purges)
+     */  // End of block comment
+    size_t getRehashCount() const { return rehash_count_; }  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+    /** Doc block start
+     * 取得以相同容量清除墓碑的次數 / Get number of same-capacity tombstone purges
+     */  // End of block comment
+    size_t getPurgeCount() const { return purge_count_; }  // Handle tombstones so deletions do not break the probing/search sequence.
+
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    /** Doc block start
+     * 統計快照（需以 HASH_TABLE_STATS=1 編譯）：插入、查詢與刪除的探測長度直方圖，加上墓碑比例；
+     * 開放定址法沒有鏈，chainLengths 為空
+     * Statistics snapshot (requires HASH_TABLE_STATS=1): probe-length histogram over inserts,
+     * lookups and removals, plus the tombstone ratio; open addressing has no chains, so
+     * chainLengths stays empty
+     */  // End of block comment
+    HashTableStats stats() const {  // Execute this statement as part of the data structure implementation.
+        HashTableStats result;  // Assign or update a variable that represents the current algorithm state.
+        result.size = size_;  // Assign or update a variable that represents the current algorithm state.
+        result.capacity = capacity_;  // Assign or update a variable that represents the current algorithm state.
+        stats_.fill(result, 0);  // Execute this statement as part of the data structure implementation.
+        result.tombstones = deleted_count_;  // Handle tombstones so deletions do not break the probing/search sequence.
+        result.bytesAllocated = table_.capacity() * sizeof(Slot);  // Assign or update a variable that represents the current algorithm state.
+        return result;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 歸零探測與重建計數器 / Zero the probe and rebuild counters
+     */  // End of block comment
+    void resetStats() { stats_.resetCounters(); }  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
 private:  // Execute this statement as part of the data structure implementation.
     // ========== 槽位狀態 Slot State ==========
     enum class SlotState {  // Execute this statement as part of the data structure implementation.
@@ -171,8 +285,9 @@ private:  // Execute this statement as part of the data structure implementation
         K key;  // Execute this statement as part of the data structure implementation.
         V value;  // Execute this statement as part of the data structure implementation.
         SlotState state;  // Execute this statement as part of the data structure implementation.
+        size_t dist;  // 與起始位置的距離（僅 ROBIN_HOOD 使用）- Distance from home slot (ROBIN_HOOD only)
 
-        Slot() : state(SlotState::EMPTY) {}  // Execute this statement as part of the data structure implementation.
+        Slot() : state(SlotState::EMPTY), dist(0) {}  // Execute this statement as part of the data structure implementation.
     };  // Execute this statement as part of the data structure implementation.
 
     // ========== 私有成員 Private Members ==========
@@ -181,16 +296,22 @@ private:  // Execute this statement as part of the data structure implementation
     size_t size_;                   // 元素數量 - Number of elements
     size_t deleted_count_;          // 墓碑數量 - Number of tombstones
     size_t total_probes_;          // 總探測次數 - Total probe count
+    size_t rehash_count_;          // 重建次數 - Number of rebuilds
+    size_t purge_count_;           // 清除墓碑次數 - Number of tombstone purges
+    std::vector<size_t> probe_histogram_;  // 插入探測次數分佈 - Insert probe-length distribution
+    double max_load_factor_;       // 觸發重建的負載上限 - Load limit that triggers a rebuild
     ProbeMethod method_;            // 探測方法 - Probing method
     std::hash<K> hasher_;          // 雜湊函數 - Hash function
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    mutable HashTableStatsRecorder stats_;  // 即時統計（查詢是 const）- Live statistics (lookups are const)
+#endif  // Execute this statement as part of the data structure implementation.
 
     // ========== 常數 Constants ==========
     static constexpr size_t DEFAULT_CAPACITY = 16;  // Assign or update a variable that represents the current algorithm state.
     static constexpr double MAX_LOAD_FACTOR = 0.7;  // 開放定址法建議較低的負載因子
+    static constexpr size_t BATCH_GROUP = 16;  // 批次查詢同時預取的 key 數 - Keys prefetched together by searchBatch
 
-    // 二次探測係數 - Quadratic probing coefficients
-    static constexpr size_t C1 = 1;  // Assign or update a variable that represents the current algorithm state.
-    static constexpr size_t C2 = 3;  // Assign or update a variable that represents the current algorithm state.
+    static constexpr size_t NO_ENTRY = static_cast<size_t>(-1);  // rebuild 排版中的空槽位 - Empty slot in rebuild's layout
 
     // ========== 私有方法 Private Methods ==========
 
@@ -206,15 +327,16 @@ private:  // Execute this statement as part of the data structure implementation
     }  // Close the current block scope.
 
     /** Doc block start
-     * 次雜湊函數 h2(k)（用於雙重雜湊）
-     * Secondary hash function (for double hashing)
+     * 次雜湊函數 h2(k)（用於雙重雜湊），由完整雜湊值 hasher_(key) 推出，不必再雜湊一次 key
+     * Secondary hash function (for double hashing), derived from the full hash hasher_(key)
+     * so the key is not hashed again
      *(blank line)
-     * @param key 要雜湊的鍵
+     * @param code 完整雜湊值 / Full hash value
+     * @param capacity 探測的表容量 / Capacity of the table being probed
      * @return 雜湊值（保證為奇數）
      */  // End of block comment
-    size_t hash2(const K& key) const {  // Compute a hash-based index so keys map into the table's storage.
-        // 使用不同的質數以獲得不同的雜湊值 / Use different prime to get different hash value
-        size_t h = hasher_(key) % (capacity_ - 1) + 1;  // Compute a hash-based index so keys map into the table's storage.
+    static size_t hash2(size_t code, size_t capacity) {  // Compute a hash-based index so keys map into the table's storage.
+        size_t h = capacity > 1 ? code % (capacity - 1) + 1 : 1;  // 容量 1 時不可除以 0 - Capacity 1 must not divide by zero
         // 確保回傳奇數以避免與偶數表大小產生共因數 / Ensure odd number to avoid common factors with even table sizes
         return (h % 2 == 0) ? h + 1 : h;  // Return the computed result to the caller.
     }  // Close the current block scope.
@@ -223,25 +345,37 @@ private:  // Execute this statement as part of the data structure implementation
      * 探測函數：根據探測方法計算第 i 次探測的索引
      * Probe function: compute i-th probe index based on probing method
      *(blank line)
-     * @param key 鍵
+     * @param code 完整雜湊值 hasher_(key)，整個探測序列只算一次 / Full hash hasher_(key), computed once per probe sequence
      * @param i 探測次數（0, 1, 2, ...）
      * @return 探測索引
      */  // End of block comment
-    size_t probe(const K& key, size_t i) const {  // Advance or track the probing sequence used by open addressing.
-        size_t h = hash1(key);  // Compute a hash-based index so keys map into the table's storage.
+    size_t probe(size_t code, size_t i) const {  // Advance or track the probing sequence used by open addressing.
+        return probe(code, i, capacity_);  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 在指定容量上探測（rebuild 排版新陣列時使用）。容量為 2 的冪次時，二次探測的三角數位移與
+     * 雙重雜湊的奇數步長都會走遍每個槽位。
+     * Probe over an explicit capacity (used by rebuild to lay out the new array). On a power-of-two
+     * capacity both the triangular offsets of quadratic probing and the odd stride of double
+     * hashing visit every slot.
+     */  // End of block comment
+    size_t probe(size_t code, size_t i, size_t capacity) const {  // Advance or track the probing sequence used by open addressing.
+        size_t h = code % capacity;  // h1(k)
 
         switch (method_) {  // Execute this statement as part of the data structure implementation.
             case ProbeMethod::LINEAR:  // Execute this statement as part of the data structure implementation.
+            case ProbeMethod::ROBIN_HOOD:  // Robin Hood 沿用線性序列 - Robin Hood walks the linear sequence
                 // 線性探測 - Linear probing: h(k, i) = (h(k) + i) % m
-                return (h + i) % capacity_;  // Return the computed result to the caller.
+                return (h + i) % capacity;  // Return the computed result to the caller.
 
             case ProbeMethod::QUADRATIC:  // Execute this statement as part of the data structure implementation.
-                // 二次探測 - Quadratic probing: h(k, i) = (h(k) + c1*i + c2*i²) % m
-                return (h + C1 * i + C2 * i * i) % capacity_;  // Return the computed result to the caller.
+                // 二次探測 - Quadratic probing: h(k, i) = (h(k) + (i + i²)/2) % m，在 2 的冪次上是排列 - a permutation over powers of two
+                return (h + (i + i * i) / 2) % capacity;  // Return the computed result to the caller.
 
             case ProbeMethod::DOUBLE_HASH:  // Execute this statement as part of the data structure implementation.
                 // 雙重雜湊 - Double hashing: h(k, i) = (h1(k) + i*h2(k)) % m
-                return (h + i * hash2(key)) % capacity_;  // Return the computed result to the caller.
+                return (h + i * hash2(code, capacity)) % capacity;  // Return the computed result to the caller.
 
             default:  // Execute this statement as part of the data structure implementation.
                 return h;  // Return the computed result to the caller.
@@ -252,15 +386,19 @@ private:  // Execute this statement as part of the data structure implementation
      * 尋找鍵的位置 / Find position of key
      *(blank line)
      * @param key 要尋找的鍵
+     * @param code 已算好的完整雜湊值 hasher_(key) / Precomputed full hash hasher_(key)
      * @param probes 輸出參數：探測次數
      * @return 若找到回傳索引，否則回傳 std::nullopt
      */  // End of block comment
-    std::optional<size_t> findSlot(const K& key, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
+    std::optional<size_t> findSlot(const K& key, size_t code, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
+        if (method_ == ProbeMethod::ROBIN_HOOD) {  // Evaluate the condition and branch into the appropriate code path.
+            return findSlotRobinHood(key, code, probes);  // Return the computed result to the caller.
+        }  // Close the current block scope.
         probes = 0;  // Advance or track the probing sequence used by open addressing.
 
         // 探測直到找到或遇到空槽位 - Probe until found or empty slot
         for (size_t i = 0; i < capacity_; ++i) {  // Iterate over a range/collection to process each item in sequence.
-            size_t index = probe(key, i);  // Advance or track the probing sequence used by open addressing.
+            size_t index = probe(code, i);  // Advance or track the probing sequence used by open addressing.
             ++probes;  // Advance or track the probing sequence used by open addressing.
 
             const Slot& slot = table_[index];  // Assign or update a variable that represents the current algorithm state.
@@ -282,6 +420,114 @@ private:  // Execute this statement as part of the data structure implementation
         return std::nullopt;  // Return the computed result to the caller.
     }  // Close the current block scope.
 
+    /** Doc block start
+     * 以已算好的完整雜湊值查詢（search 與 searchBatch 共用），並記錄探測數
+     * Look up with a precomputed full hash (shared by search and searchBatch) and record the probe count
+     */  // End of block comment
+    std::optional<V> searchHashed(const K& key, size_t code, size_t& probes) const;  // Advance or track the probing sequence used by open addressing.
+
+    /** Doc block start
+     * Robin Hood 查詢：若目前距離已超過該槽位元素的距離，key 不可能在更後面，提早結束
+     * Robin Hood lookup: once our distance exceeds the resident's, the key cannot be further along
+     */  // End of block comment
+    std::optional<size_t> findSlotRobinHood(const K& key, size_t code, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
+        probes = 0;  // Advance or track the probing sequence used by open addressing.
+        size_t index = code % capacity_;  // Compute a hash-based index so keys map into the table's storage.
+        for (size_t dist = 0; dist < capacity_; ++dist) {  // Iterate over a range/collection to process each item in sequence.
+            ++probes;  // Advance or track the probing sequence used by open addressing.
+            const Slot& slot = table_[index];  // Assign or update a variable that represents the current algorithm state.
+            if (slot.state != SlotState::OCCUPIED || slot.dist < dist) {  // 空槽位或較「富有」的元素：提早結束 - Empty or a richer resident: stop early
+                return std::nullopt;  // Return the computed result to the caller.
+            }  // Close the current block scope.
+            if (slot.key == key) {  // Evaluate the condition and branch into the appropriate code path.
+                return index;  // Return the computed result to the caller.
+            }  // Close the current block scope.
+            index = (index + 1) % capacity_;  // Advance or track the probing sequence used by open addressing.
+        }  // Close the current block scope.
+        return std::nullopt;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * Robin Hood 放置新元素：遇到距離比自己短（較富有）的元素就交換，繼續替被換出的元素找位置
+     * Robin Hood placement: swap with any resident closer to home (richer), then keep placing the evicted one
+     *(blank line)
+     * 線性序列走遍所有槽位，所以只要還有空位就一定放得下；insert 的負載上限小於 1，呼叫時必有空位。
+     * The linear sequence visits every slot, so placement succeeds whenever a slot is free; insert's
+     * load limit is below 1, so one always is.
+     *(blank line)
+     * @return 探測次數 - Number of probes performed
+     */  // End of block comment
+    size_t placeRobinHood(K key, V value) {  // Advance or track the probing sequence used by open addressing.
+        size_t index = hash1(key);  // Compute a hash-based index so keys map into the table's storage.
+        size_t dist = 0;  // Assign or update a variable that represents the current algorithm state.
+        for (size_t probes = 1; probes <= capacity_; ++probes) {  // Iterate over a range/collection to process each item in sequence.
+            Slot& slot = table_[index];  // Assign or update a variable that represents the current algorithm state.
+            if (slot.state != SlotState::OCCUPIED) {  // Evaluate the condition and branch into the appropriate code path.
+                slot.key = std::move(key);  // Assign or update a variable that represents the current algorithm state.
+                slot.value = std::move(value);  // Assign or update a variable that represents the current algorithm state.
+                slot.dist = dist;  // Assign or update a variable that represents the current algorithm state.
+                slot.state = SlotState::OCCUPIED;  // Assign or update a variable that represents the current algorithm state.
+                return probes;  // Return the computed result to the caller.
+            }  // Close the current block scope.
+            if (slot.dist < dist) {  // 劫富濟貧 - Take from the rich
+                std::swap(slot.key, key);  // Execute this statement as part of the data structure implementation.
+                std::swap(slot.value, value);  // Execute this statement as part of the data structure implementation.
+                std::swap(slot.dist, dist);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            index = (index + 1) % capacity_;  // Advance or track the probing sequence used by open addressing.
+            ++dist;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        throw std::runtime_error("雜湊表已滿 / Hash table is full");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 累計一次插入的探測次數（總數與分佈） / Record one insert's probe count (total and distribution)
+     */  // End of block comment
+    void recordProbes(size_t probes) {  // Advance or track the probing sequence used by open addressing.
+        total_probes_ += probes;  // Advance or track the probing sequence used by open addressing.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+        if (probe_histogram_.size() <= probes) {  // Evaluate the condition and branch into the appropriate code path.
+            probe_histogram_.resize(probes + 1, 0);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        ++probe_histogram_[probes];  // Advance or track the probing sequence used by open addressing.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 重建表格：存活元素不到上限一半時墓碑才是主因，以相同容量重建（清除墓碑）；否則容量加倍
+     * Rebuild the table: when live entries are under half the limit, tombstones are the problem,
+     * so rebuild at the same capacity (purge); otherwise double the capacity
+     */  // End of block comment
+    void rehash();  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+    /** Doc block start
+     * 以指定容量重建表格，重新放置所有存活元素。先只排版（每個元素落在哪個槽位），排不下就以
+     * growthCapacity 重排；全部排好後才搬移元素並換上新陣列，舊表在那之前完全不動。
+     * Rebuild at the given capacity, re-placing every live entry. The entries are laid out first
+     * (which slot each one lands in); if one does not fit, the layout is redone at growthCapacity.
+     * Entries are moved and the new array swapped in only once all of them are placed, so the old
+     * table is untouched until then.
+     */  // End of block comment
+    void rebuild(size_t newCapacity);  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+    /** Doc block start
+     * 排版：slotOf[s] = 落在槽位 s 的元素在 codes 中的索引（NO_ENTRY 為空）；有元素排不下時回傳 false
+     * Layout: slotOf[s] = index into codes of the entry in slot s (NO_ENTRY when empty); false if an entry does not fit
+     */  // End of block comment
+    bool layoutSlots(const std::vector<size_t>& codes, size_t capacity, std::vector<size_t>& slotOf) const;  // Advance or track the probing sequence used by open addressing.
+
+    /** Doc block start
+     * 探測序列找不到空位時的新容量：至少加倍、且為 2 的冪次，讓每種探測序列都走遍所有槽位
+     * Capacity to grow to when a probe sequence finds no free slot: at least double, and a power of
+     * two so every probe sequence visits every slot
+     */  // End of block comment
+    static size_t growthCapacity(size_t capacity) {  // Execute this statement as part of the data structure implementation.
+        size_t grown = 1;  // Assign or update a variable that represents the current algorithm state.
+        while (grown < capacity * 2) {  // Repeat while the loop condition remains true.
+            grown <<= 1;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        return grown;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
     /** Doc block start
      * 尋找插入位置 / Find position for insertion
      *(blank line)
@@ -291,11 +537,12 @@ private:  // Execute this statement as part of the data structure implementation
      */  // End of block comment
     std::optional<size_t> findInsertSlot(const K& key, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
         probes = 0;  // Advance or track the probing sequence used by open addressing.
+        size_t code = hasher_(key);  // 整個探測序列只雜湊一次 - Hash once for the whole probe sequence
         std::optional<size_t> first_deleted;  // Handle tombstones so deletions do not break the probing/search sequence.
 
         // 探測尋找空槽位或現有鍵 - Probe to find empty slot or existing key
         for (size_t i = 0; i < capacity_; ++i) {  // Iterate over a range/collection to process each item in sequence.
-            size_t index = probe(key, i);  // Advance or track the probing sequence used by open addressing.
+            size_t index = probe(code, i);  // Advance or track the probing sequence used by open addressing.
             ++probes;  // Advance or track the probing sequence used by open addressing.
 
             const Slot& slot = table_[index];  // Assign or update a variable that represents the current algorithm state.
@@ -320,6 +567,18 @@ private:  // Execute this statement as part of the data structure implementation
         // 表已滿 - Table full
         return first_deleted;  // Return the computed result to the caller.
     }  // Close the current block scope.
+
+    /** Doc block start
+     * 預取一個快取行供讀取（非 GCC/Clang 編譯器上不做任何事）
+     * Prefetch one cache line for reading (a no-op on compilers other than GCC/Clang)
+     */  // End of block comment
+    static void prefetch(const void* address) {  // Execute this statement as part of the data structure implementation.
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);  // Execute this statement as part of the data structure implementation.
+#else
+        (void)address;  // Execute this statement as part of the data structure implementation.
+#endif
+    }  // Close the current block scope.
 };  // Execute this statement as part of the data structure implementation.
 
 // ============================================================
@@ -328,7 +587,7 @@ private:  // Execute this statement as part of the data structure implementation
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 OpenAddressingHashTable<K, V>::OpenAddressingHashTable(size_t capacity, ProbeMethod method)  // Execute this statement as part of the data structure implementation.
-    : capacity_(capacity), size_(0), deleted_count_(0), total_probes_(0), method_(method) {  // Handle tombstones so deletions do not break the probing/search sequence.
+    : capacity_(capacity), size_(0), deleted_count_(0), total_probes_(0), rehash_count_(0), purge_count_(0), max_load_factor_(MAX_LOAD_FACTOR), method_(method) {  // Handle tombstones so deletions do not break the probing/search sequence.
     if (capacity == 0) {  // Evaluate the condition and branch into the appropriate code path.
         throw std::invalid_argument(  // Throw an exception to signal an invalid argument or operation.
             "容量必須為正整數 / Capacity must be positive");  // Execute this statement as part of the data structure implementation.
@@ -338,17 +597,41 @@ OpenAddressingHashTable<K, V>::OpenAddressingHashTable(size_t capacity, ProbeMet
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 size_t OpenAddressingHashTable<K, V>::insert(const K& key, const V& value) {  // Execute this statement as part of the data structure implementation.
-    // 檢查負載因子 - Check load factor
-    if (loadFactor() >= MAX_LOAD_FACTOR) {  // Evaluate the condition and branch into the appropriate code path.
-        throw std::runtime_error(  // Throw an exception to signal an invalid argument or operation.
-            "雜湊表負載過高 / Hash table load factor too high");  // Execute this statement as part of the data structure implementation.
+    if (method_ == ProbeMethod::ROBIN_HOOD) {  // Robin Hood 有自己的插入路徑 - Robin Hood has its own insert path
+        size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+        auto existing = findSlotRobinHood(key, hasher_(key), probes);  // Advance or track the probing sequence used by open addressing.
+        if (existing.has_value()) {  // Evaluate the condition and branch into the appropriate code path.
+            table_[existing.value()].value = value;  // 更新現有鍵 - Update existing key
+        } else {  // Handle the alternative branch when the condition is false.
+            if (static_cast<double>(size_ + 1) > max_load_factor_ * capacity_) {  // Evaluate the condition and branch into the appropriate code path.
+                rehash();  // Rehash entries into a larger table to keep operations near O(1) on average.
+            }  // Close the current block scope.
+            probes = placeRobinHood(key, value);  // Advance or track the probing sequence used by open addressing.
+            ++size_;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        recordProbes(probes);  // Advance or track the probing sequence used by open addressing.
+        return probes;  // Return the computed result to the caller.
     }  // Close the current block scope.
 
     size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
     auto slot_index = findInsertSlot(key, probes);  // Advance or track the probing sequence used by open addressing.
 
-    if (!slot_index.has_value()) {  // Evaluate the condition and branch into the appropriate code path.
-        throw std::runtime_error("雜湊表已滿 / Hash table is full");  // Throw an exception to signal an invalid argument or operation.
+    // 新 key 佔用 EMPTY 槽位會提高負載；超過上限前先重建 - A new key in an EMPTY slot raises occupancy; rebuild before exceeding the limit
+    bool consumesEmpty = !slot_index.has_value() || table_[slot_index.value()].state == SlotState::EMPTY;  // Assign or update a variable that represents the current algorithm state.
+    if (consumesEmpty && static_cast<double>(size_ + deleted_count_ + 1) > max_load_factor_ * capacity_) {  // Evaluate the condition and branch into the appropriate code path.
+        rehash();  // Rehash entries into a larger table to keep operations near O(1) on average.
+        size_t extra = 0;  // Advance or track the probing sequence used by open addressing.
+        slot_index = findInsertSlot(key, extra);  // Advance or track the probing sequence used by open addressing.
+        probes += extra;  // Advance or track the probing sequence used by open addressing.
+    }  // Close the current block scope.
+
+    // 負載未達上限，探測序列卻沒經過空位：擴容到 2 的冪次後重試（此時序列走遍所有槽位，必定成功）
+    // Below the limit but the probe sequence met no free slot: grow to a power of two and retry (the sequence then visits every slot, so this succeeds)
+    while (!slot_index.has_value()) {  // Repeat while the loop condition remains true.
+        rebuild(growthCapacity(capacity_));  // Rehash entries into a larger table to keep operations near O(1) on average.
+        size_t extra = 0;  // Advance or track the probing sequence used by open addressing.
+        slot_index = findInsertSlot(key, extra);  // Advance or track the probing sequence used by open addressing.
+        probes += extra;  // Advance or track the probing sequence used by open addressing.
     }  // Close the current block scope.
 
     Slot& slot = table_[slot_index.value()];  // Assign or update a variable that represents the current algorithm state.
@@ -367,7 +650,7 @@ size_t OpenAddressingHashTable<K, V>::insert(const K& key, const V& value) {  //
         ++size_;  // Execute this statement as part of the data structure implementation.
     }  // Close the current block scope.
 
-    total_probes_ += probes;  // Advance or track the probing sequence used by open addressing.
+    recordProbes(probes);  // Advance or track the probing sequence used by open addressing.
     return probes;  // Return the computed result to the caller.
 }  // Close the current block scope.
 
@@ -379,7 +662,13 @@ std::optional<V> OpenAddressingHashTable<K, V>::search(const K& key) const {  //
 
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 std::optional<V> OpenAddressingHashTable<K, V>::search(const K& key, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
-    auto slot_index = findSlot(key, probes);  // Advance or track the probing sequence used by open addressing.
+    return searchHashed(key, hasher_(key), probes);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+std::optional<V> OpenAddressingHashTable<K, V>::searchHashed(const K& key, size_t code, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
+    auto slot_index = findSlot(key, code, probes);  // Advance or track the probing sequence used by open addressing.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
 
     if (slot_index.has_value()) {  // Evaluate the condition and branch into the appropriate code path.
         return table_[slot_index.value()].value;  // Return the computed result to the caller.
@@ -391,12 +680,31 @@ std::optional<V> OpenAddressingHashTable<K, V>::search(const K& key, size_t& pro
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 bool OpenAddressingHashTable<K, V>::remove(const K& key) {  // Execute this statement as part of the data structure implementation.
     size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
-    auto slot_index = findSlot(key, probes);  // Advance or track the probing sequence used by open addressing.
+    auto slot_index = findSlot(key, hasher_(key), probes);  // Advance or track the probing sequence used by open addressing.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
 
     if (!slot_index.has_value()) {  // Evaluate the condition and branch into the appropriate code path.
         return false;  // Return the computed result to the caller.
     }  // Close the current block scope.
 
+    if (method_ == ProbeMethod::ROBIN_HOOD) {  // Evaluate the condition and branch into the appropriate code path.
+        // 往回平移：後面距離 > 0 的元素各往前一格，直到遇到空槽位或已在起始位置的元素
+        // Backward shift: pull following entries with dist > 0 back one slot until an empty slot or a home-slot entry
+        size_t hole = slot_index.value();  // Assign or update a variable that represents the current algorithm state.
+        size_t next = (hole + 1) % capacity_;  // Assign or update a variable that represents the current algorithm state.
+        while (table_[next].state == SlotState::OCCUPIED && table_[next].dist > 0) {  // Repeat while the loop condition remains true.
+            table_[hole].key = std::move(table_[next].key);  // Assign or update a variable that represents the current algorithm state.
+            table_[hole].value = std::move(table_[next].value);  // Assign or update a variable that represents the current algorithm state.
+            table_[hole].dist = table_[next].dist - 1;  // Assign or update a variable that represents the current algorithm state.
+            hole = next;  // Assign or update a variable that represents the current algorithm state.
+            next = (next + 1) % capacity_;  // Advance or track the probing sequence used by open addressing.
+        }  // Close the current block scope.
+        table_[hole].state = SlotState::EMPTY;  // 不留墓碑 - No tombstone
+        table_[hole].dist = 0;  // Assign or update a variable that represents the current algorithm state.
+        --size_;  // Execute this statement as part of the data structure implementation.
+        return true;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
     // 使用墓碑標記刪除 - Delete using tombstone marker
     Slot& slot = table_[slot_index.value()];  // Assign or update a variable that represents the current algorithm state.
     slot.state = SlotState::DELETED;  // Handle tombstones so deletions do not break the probing/search sequence.
@@ -411,14 +719,152 @@ bool OpenAddressingHashTable<K, V>::contains(const K& key) const {  // Execute t
     return search(key).has_value();  // Return the computed result to the caller.
 }  // Close the current block scope.
 
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void OpenAddressingHashTable<K, V>::rehash() {  // Rehash entries into a larger table to keep operations near O(1) on average.
+    bool purgeOnly = static_cast<double>(size_ + 1) * 2 <= max_load_factor_ * capacity_;  // Handle tombstones so deletions do not break the probing/search sequence.
+    if (purgeOnly) {  // Evaluate the condition and branch into the appropriate code path.
+        ++purge_count_;  // Handle tombstones so deletions do not break the probing/search sequence.
+    }  // Close the current block scope.
+    rebuild(purgeOnly ? capacity_ : capacity_ * 2);  // Rehash entries into a larger table to keep operations near O(1) on average.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void OpenAddressingHashTable<K, V>::rebuild(size_t newCapacity) {  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HASH_TABLE_STATS_ONLY(stats_.countRehash());  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HASH_TABLE_STATS_ONLY(HashTableStatsRecorder::RehashScope rehashScope(stats_);)  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+    // 每個存活元素只雜湊一次，排版重試時沿用 - Hash every live entry once; layout retries reuse it
+    std::vector<size_t> live;  // 存活元素在舊表中的槽位 - Old-table slots of the live entries
+    std::vector<size_t> codes;  // 對應的完整雜湊值 - Their full hashes
+    live.reserve(size_);  // Execute this statement as part of the data structure implementation.
+    codes.reserve(size_);  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < capacity_; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        if (table_[i].state == SlotState::OCCUPIED) {  // 略過 EMPTY 與墓碑 - Skip EMPTY slots and tombstones
+            live.push_back(i);  // Execute this statement as part of the data structure implementation.
+            codes.push_back(hasher_(table_[i].key));  // Compute a hash-based index so keys map into the table's storage.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    std::vector<size_t> slotOf;  // Assign or update a variable that represents the current algorithm state.
+    while (!layoutSlots(codes, newCapacity, slotOf)) {  // 排不下就擴容重排，不丟任何元素 - Grow and lay out again; nothing is dropped
+        newCapacity = growthCapacity(newCapacity);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    std::vector<Slot> fresh(newCapacity);  // Access or update the bucket storage used to hold entries or chains.
+    for (size_t s = 0; s < newCapacity; ++s) {  // Iterate over a range/collection to process each item in sequence.
+        if (slotOf[s] == NO_ENTRY) {  // Evaluate the condition and branch into the appropriate code path.
+            continue;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        Slot& old = table_[live[slotOf[s]]];  // Assign or update a variable that represents the current algorithm state.
+        fresh[s].key = std::move(old.key);  // Assign or update a variable that represents the current algorithm state.
+        fresh[s].value = std::move(old.value);  // Assign or update a variable that represents the current algorithm state.
+        fresh[s].dist = (s + newCapacity - codes[slotOf[s]] % newCapacity) % newCapacity;  // 與起始位置的距離（Robin Hood 用）- Distance from home (for Robin Hood)
+        fresh[s].state = SlotState::OCCUPIED;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    table_.swap(fresh);  // 全部放好後才換上 - Swapped in only once every entry is placed
+    capacity_ = newCapacity;  // Assign or update a variable that represents the current algorithm state.
+    size_ = live.size();  // Assign or update a variable that represents the current algorithm state.
+    deleted_count_ = 0;  // 墓碑不會被搬移 - Tombstones are not carried over
+    ++rehash_count_;  // Rehash entries into a larger table to keep operations near O(1) on average.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool OpenAddressingHashTable<K, V>::layoutSlots(const std::vector<size_t>& codes, size_t capacity, std::vector<size_t>& slotOf) const {  // Advance or track the probing sequence used by open addressing.
+    slotOf.assign(capacity, NO_ENTRY);  // Assign or update a variable that represents the current algorithm state.
+    if (codes.size() > capacity) {  // Evaluate the condition and branch into the appropriate code path.
+        return false;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    if (method_ == ProbeMethod::ROBIN_HOOD) {  // 與 placeRobinHood 相同的交換規則，只是搬的是索引 - placeRobinHood's swap rule, applied to indices
+        for (size_t j = 0; j < codes.size(); ++j) {  // Iterate over a range/collection to process each item in sequence.
+            size_t carry = j;  // Assign or update a variable that represents the current algorithm state.
+            size_t index = codes[carry] % capacity;  // Compute a hash-based index so keys map into the table's storage.
+            size_t dist = 0;  // Assign or update a variable that represents the current algorithm state.
+            while (slotOf[index] != NO_ENTRY) {  // 元素數不超過容量，一定會遇到空位 - No more entries than slots, so a free slot exists
+                size_t residentDist = (index + capacity - codes[slotOf[index]] % capacity) % capacity;  // Assign or update a variable that represents the current algorithm state.
+                if (residentDist < dist) {  // 劫富濟貧 - Take from the rich
+                    std::swap(slotOf[index], carry);  // Execute this statement as part of the data structure implementation.
+                    dist = residentDist;  // Assign or update a variable that represents the current algorithm state.
+                }  // Close the current block scope.
+                index = (index + 1) % capacity;  // Advance or track the probing sequence used by open addressing.
+                ++dist;  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            slotOf[index] = carry;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        return true;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    for (size_t j = 0; j < codes.size(); ++j) {  // 新陣列沒有墓碑也沒有重複 key，第一個空位就是答案 - No tombstones or duplicates: the first free slot wins
+        bool placed = false;  // Assign or update a variable that represents the current algorithm state.
+        for (size_t i = 0; i < capacity && !placed; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            size_t index = probe(codes[j], i, capacity);  // Advance or track the probing sequence used by open addressing.
+            if (slotOf[index] == NO_ENTRY) {  // Evaluate the condition and branch into the appropriate code path.
+                slotOf[index] = j;  // Assign or update a variable that represents the current algorithm state.
+                placed = true;  // Assign or update a variable that represents the current algorithm state.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        if (!placed) {  // Evaluate the condition and branch into the appropriate code path.
+            return false;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    return true;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void OpenAddressingHashTable<K, V>::insertBatch(const std::vector<K>& keys, const std::vector<V>& values) {  // Execute this statement as part of the data structure implementation.
+    if (keys.size() != values.size()) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::invalid_argument("keys 與 values 長度必須相同 / keys and values must have the same length");  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    reserve(size_ + keys.size());  // 只重建一次 - Rebuild once
+    for (size_t i = 0; i < keys.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        insert(keys[i], values[i]);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void OpenAddressingHashTable<K, V>::searchBatch(const std::vector<K>& keys, std::vector<std::optional<V>>& out) const {  // Execute this statement as part of the data structure implementation.
+    out.resize(keys.size());  // Execute this statement as part of the data structure implementation.
+    size_t codes[BATCH_GROUP];  // 整組的完整雜湊值 - Full hashes of the group
+    for (size_t base = 0; base < keys.size(); base += BATCH_GROUP) {  // Iterate over a range/collection to process each item in sequence.
+        size_t count = std::min(BATCH_GROUP, keys.size() - base);  // Assign or update a variable that represents the current algorithm state.
+
+        // 第一輪：雜湊並預取每個 key 的起始槽位 - Pass 1: hash every key and prefetch its home slot
+        for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            codes[i] = hasher_(keys[base + i]);  // Compute a hash-based index so keys map into the table's storage.
+            prefetch(&table_[codes[i] % capacity_]);  // Compute a hash-based index so keys map into the table's storage.
+        }  // Close the current block scope.
+
+        // 第二輪：沿用第一輪的雜湊值探測（起始槽位已在路上）- Pass 2: probe from pass 1's hashes (home slots are already on their way)
+        for (size_t i = 0; i < count; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+            out[base + i] = searchHashed(keys[base + i], codes[i], probes);  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void OpenAddressingHashTable<K, V>::reserve(size_t n) {  // Execute this statement as part of the data structure implementation.
+    size_t needed = capacity_;  // Assign or update a variable that represents the current algorithm state.
+    while (static_cast<double>(n) > max_load_factor_ * needed) {  // Repeat while the loop condition remains true.
+        needed *= 2;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    if (needed == capacity_ && static_cast<double>(n + deleted_count_) <= max_load_factor_ * capacity_) {  // Evaluate the condition and branch into the appropriate code path.
+        return;  // 容量足夠且墓碑不會觸發清除 - Large enough, and tombstones will not force a purge
+    }  // Close the current block scope.
+    rebuild(needed);  // Rehash entries into a larger table to keep operations near O(1) on average.
+}  // Close the current block scope.
+
 template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
 void OpenAddressingHashTable<K, V>::clear() {  // Execute this statement as part of the data structure implementation.
     for (auto& slot : table_) {  // Iterate over a range/collection to process each item in sequence.
         slot.state = SlotState::EMPTY;  // Assign or update a variable that represents the current algorithm state.
+        slot.dist = 0;  // Assign or update a variable that represents the current algorithm state.
     }  // Close the current block scope.
     size_ = 0;  // Assign or update a variable that represents the current algorithm state.
     deleted_count_ = 0;  // Handle tombstones so deletions do not break the probing/search sequence.
     total_probes_ = 0;  // Advance or track the probing sequence used by open addressing.
+    probe_histogram_.clear();  // Advance or track the probing sequence used by open addressing.
 }  // Close the current block scope.
 
 #endif // OPEN_ADDRESSING_HPP
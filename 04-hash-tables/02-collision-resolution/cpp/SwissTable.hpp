@@ -0,0 +1,482 @@
+/** Doc block start
+ * Swiss Table 風格開放定址雜湊表 - C++ 實作
+ * Swiss-table style open addressing hash map - C++ Implementation
+ *(blank line)
+ * 控制位元組陣列（7-bit 雜湊標籤）+ 16 格群組比對（SSE2）+ 扁平的 key/value 陣列
+ * Control-byte array (7-bit hash tags) + 16-wide group matching (SSE2) + flat key/value arrays
+ */  // End of block comment
+
+#ifndef SWISS_TABLE_HPP  // Execute this statement as part of the data structure implementation.
+#define SWISS_TABLE_HPP  // Execute this statement as part of the data structure implementation.
+
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <cstring>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include <optional>  // Execute this statement as part of the data structure implementation.
+#include <functional>  // Execute this statement as part of the data structure implementation.
+#include <stdexcept>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <utility>  // Execute this statement as part of the data structure implementation.
+#include "HashTableStats.hpp"  // Execute this statement as part of the data structure implementation.
+
+#ifdef __SSE2__  // 有 SSE2 時使用 16 位元組向量比對 - Use 16-byte vector compares when SSE2 is available
+#include <emmintrin.h>  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * Swiss Table 雜湊表模板類別 / Swiss Table hash map template class
+ *(blank line)
+ * 每個槽位有一個控制位元組（control byte）：
+ * Each slot owns one control byte:
+ *   0x80 (-128) = EMPTY，0xFE (-2) = DELETED（墓碑 tombstone），0..127 = FULL（存放 h2 = 雜湊低 7 位元）
+ * 槽位以 16 個為一組（group）；查詢時一次比對整組的 16 個控制位元組，
+ * 只有標籤相同的槽位才需要比對 key。
+ * Slots are grouped 16 at a time; a lookup compares all 16 control bytes of a group at once,
+ * and only slots whose tag matches need a key comparison.
+ *(blank line)
+ * @tparam K 鍵的型別（key type）
+ * @tparam V 值的型別（value type）
+ */  // End of block comment
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+class SwissTable {  // Execute this statement as part of the data structure implementation.
+public:  // Execute this statement as part of the data structure implementation.
+    // 型別別名 - Type aliases
+    using KeyType = K;  // Assign or update a variable that represents the current algorithm state.
+    using ValueType = V;  // Assign or update a variable that represents the current algorithm state.
+
+    /** Doc block start
+     * 建構子：初始化雜湊表 / Constructor: Initialize hash table
+     *(blank line)
+     * @param capacity 槽位數量，會向上取整為 16 的 2 的冪次倍
+     *                 Number of slots, rounded up to a power of two (at least one group of 16)
+     */  // End of block comment
+    explicit SwissTable(size_t capacity = DEFAULT_CAPACITY);  // Assign or update a variable that represents the current algorithm state.
+
+    /** Doc block start
+     * 解構子 / Destructor
+     */  // End of block comment
+    ~SwissTable() = default;  // Assign or update a variable that represents the current algorithm state.
+
+    // ========== 基本操作 Basic Operations ==========
+
+    /** Doc block start
+     * 插入鍵值對（若 key 已存在則更新）
+     * Insert key-value pair (update if key exists)
+     *(blank line)
+     * 負載達 7/8 時自動擴容（或原地清除墓碑）
+     * Grows (or purges tombstones in place) when the table reaches 7/8 full
+     *(blank line)
+     * @param key 鍵
+     * @param value 值
+     * @return 探測的群組數 - Number of groups probed
+     */  // End of block comment
+    size_t insert(const K& key, const V& value);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 搜尋給定 key 的 value
+     * Search for value associated with key
+     *(blank line)
+     * @param key 要搜尋的鍵
+     * @return 找到則回傳 value，否則回傳 std::nullopt
+     */  // End of block comment
+    std::optional<V> search(const K& key) const;  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 搜尋並回傳探測的群組數 / Search and return number of groups probed
+     */  // End of block comment
+    std::optional<V> search(const K& key, size_t& probes) const;  // Advance or track the probing sequence used by open addressing.
+
+    /** Doc block start
+     * 刪除指定的鍵值對 / Delete key-value pair
+     *(blank line)
+     * 若該群組仍有 EMPTY 槽位，查詢本來就會停在此群組，直接標記為 EMPTY；
+     * 否則需留下墓碑以保留探測路徑。
+     * If the slot's group still has an EMPTY slot, every probe already stops in this group,
+     * so the slot can become EMPTY again; otherwise a tombstone keeps probe chains intact.
+     *(blank line)
+     * @return 刪除成功回傳 true，key 不存在回傳 false
+     */  // End of block comment
+    bool remove(const K& key);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 檢查 key 是否存在 / Check if key exists
+     */  // End of block comment
+    bool contains(const K& key) const;  // Execute this statement as part of the data structure implementation.
+
+    // ========== 走訪 Traversal ==========
+
+    /** Doc block start
+     * 對每一對呼叫 fn(key, value)（唯讀，順序不固定）；可供 PerfectHashBuilder::fromTable 等工具匯出內容
+     * Call fn(key, value) for every pair (read-only, unspecified order); lets tools such as
+     * PerfectHashBuilder::fromTable export the contents
+     */  // End of block comment
+    template <typename Fn>  // Execute this statement as part of the data structure implementation.
+    void forEach(Fn&& fn) const {  // Execute this statement as part of the data structure implementation.
+        for (size_t i = 0; i < capacity_; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            if (groups_[i / GROUP_WIDTH].ctrl[i % GROUP_WIDTH] >= 0) {  // 只有 FULL 槽位 - FULL slots only
+                fn(keys_[i], values_[i]);  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    // ========== 容量操作 Capacity Operations ==========
+
+    size_t size() const { return size_; }  // Execute this statement as part of the data structure implementation.
+
+    size_t capacity() const { return capacity_; }  // Execute this statement as part of the data structure implementation.
+
+    bool empty() const { return size_ == 0; }  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 計算負載因子 α = n / m（不含墓碑）
+     * Calculate load factor (α = n / m, tombstones excluded)
+     */  // End of block comment
+    double loadFactor() const {  // Execute this statement as part of the data structure implementation.
+        return static_cast<double>(size_) / capacity_;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 清空雜湊表（保留容量）/ Clear all entries (capacity is kept)
+     */  // End of block comment
+    void clear();  // Execute this statement as part of the data structure implementation.
+
+    // ========== 統計資訊 Statistics ==========
+
+    size_t getDeletedCount() const { return deleted_count_; }  // Handle tombstones so deletions do not break the probing/search sequence.
+
+    size_t getTotalProbes() const { return total_probes_; }  // Advance or track the probing sequence used by open addressing.
+
+    void resetProbeCount() { total_probes_ = 0; }  // Advance or track the probing sequence used by open addressing.
+
+    size_t getRehashCount() const { return rehash_count_; }  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+    /** Doc block start
+     * 在不觸發擴容的前提下還能插入多少個新 key
+     * How many new keys fit before the next grow/purge
+     */  // End of block comment
+    size_t growthLeft() const { return growth_left_; }  // Execute this statement as part of the data structure implementation.
+
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    /** Doc block start
+     * 統計快照（需以 HASH_TABLE_STATS=1 編譯）：插入、查詢與刪除的探測長度（群組數）直方圖，加上墓碑比例；
+     * 開放定址法沒有鏈，chainLengths 為空
+     * Statistics snapshot (requires HASH_TABLE_STATS=1): probe-length (groups) histogram over
+     * inserts, lookups and removals, plus the tombstone ratio; open addressing has no chains, so
+     * chainLengths stays empty
+     */  // End of block comment
+    HashTableStats stats() const {  // Execute this statement as part of the data structure implementation.
+        HashTableStats result;  // Assign or update a variable that represents the current algorithm state.
+        result.size = size_;  // Assign or update a variable that represents the current algorithm state.
+        result.capacity = capacity_;  // Assign or update a variable that represents the current algorithm state.
+        stats_.fill(result, 0);  // Execute this statement as part of the data structure implementation.
+        result.tombstones = deleted_count_;  // Handle tombstones so deletions do not break the probing/search sequence.
+        result.bytesAllocated = groups_.capacity() * sizeof(Group) + keys_.capacity() * sizeof(K) + values_.capacity() * sizeof(V);  // Assign or update a variable that represents the current algorithm state.
+        return result;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 歸零探測與重建計數器 / Zero the probe and rebuild counters
+     */  // End of block comment
+    void resetStats() { stats_.resetCounters(); }  // Execute this statement as part of the data structure implementation.
+#endif  // Execute this statement as part of the data structure implementation.
+
+    static constexpr size_t GROUP_WIDTH = 16;  // 每組槽位數（一個 SSE2 暫存器）- Slots per group (one SSE2 register)
+
+private:  // Execute this statement as part of the data structure implementation.
+    // ========== 控制位元組 Control Bytes ==========
+    static constexpr int8_t CTRL_EMPTY = -128;   // 0x80：從未使用 - Never used
+    static constexpr int8_t CTRL_DELETED = -2;   // 0xFE：墓碑 - Tombstone
+
+    /** Doc block start
+     * 16 位元組對齊的控制位元組群組 / 16-byte aligned group of control bytes
+     */  // End of block comment
+    struct alignas(GROUP_WIDTH) Group {  // Execute this statement as part of the data structure implementation.
+        int8_t ctrl[GROUP_WIDTH];  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+
+    // ========== 私有成員 Private Members ==========
+    std::vector<Group> groups_;     // 控制位元組陣列 - Control-byte array
+    std::vector<K> keys_;           // 扁平 key 陣列 - Flat key array
+    std::vector<V> values_;         // 扁平 value 陣列 - Flat value array
+    size_t capacity_;               // 槽位總數（2 的冪次）- Slot count (power of two)
+    size_t group_mask_;             // 群組數 - 1 - Group count minus one
+    size_t size_;                   // 元素數量 - Number of elements
+    size_t deleted_count_;          // 墓碑數量 - Number of tombstones
+    size_t growth_left_;            // 剩餘可用 EMPTY 額度 - Remaining EMPTY budget before growth
+    size_t total_probes_;           // 總探測群組數 - Total groups probed
+    size_t rehash_count_;           // 重建次數 - Number of rebuilds
+    std::hash<K> hasher_;           // 雜湊函數 - Hash function
+#if HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+    mutable HashTableStatsRecorder stats_;  // 即時統計（查詢是 const）- Live statistics (lookups are const)
+#endif  // Execute this statement as part of the data structure implementation.
+
+    // ========== 常數 Constants ==========
+    static constexpr size_t DEFAULT_CAPACITY = 16;  // Assign or update a variable that represents the current algorithm state.
+
+    // ========== 私有方法 Private Methods ==========
+
+    /** Doc block start
+     * 混合 std::hash 的結果（整數的 std::hash 常是恆等函數，低位元不夠亂）
+     * Mix std::hash output (std::hash for integers is often the identity, so low bits are poor)
+     */  // End of block comment
+    uint64_t fullHash(const K& key) const {  // Compute a hash-based index so keys map into the table's storage.
+        uint64_t h = static_cast<uint64_t>(hasher_(key));  // Compute a hash-based index so keys map into the table's storage.
+        h ^= h >> 33;  // Execute this statement as part of the data structure implementation.
+        h *= 0xff51afd7ed558ccdULL;  // Execute this statement as part of the data structure implementation.
+        h ^= h >> 33;  // Execute this statement as part of the data structure implementation.
+        return h;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    static size_t h1(uint64_t hash) { return static_cast<size_t>(hash >> 7); }  // 群組選擇 - Group selector
+    static int8_t h2(uint64_t hash) { return static_cast<int8_t>(hash & 0x7F); }  // 7-bit 標籤 - 7-bit tag
+
+    /** Doc block start
+     * 回傳群組中控制位元組等於 tag 的槽位 bitmask（第 i 位 = 第 i 格）
+     * Bitmask of slots in the group whose control byte equals tag (bit i = slot i)
+     */  // End of block comment
+    static uint32_t matchTag(const Group& g, int8_t tag) {  // Execute this statement as part of the data structure implementation.
+#ifdef __SSE2__  // Execute this statement as part of the data structure implementation.
+        __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(g.ctrl));  // 一次載入 16 個控制位元組 - Load 16 control bytes
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(tag))));  // Return the computed result to the caller.
+#else  // 純量後備 - Scalar fallback
+        uint32_t mask = 0;  // Assign or update a variable that represents the current algorithm state.
+        for (size_t i = 0; i < GROUP_WIDTH; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            mask |= static_cast<uint32_t>(g.ctrl[i] == tag) << i;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        return mask;  // Return the computed result to the caller.
+#endif  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * EMPTY 或 DELETED 的槽位 bitmask（兩者最高位元皆為 1）
+     * Bitmask of EMPTY or DELETED slots (both have the sign bit set)
+     */  // End of block comment
+    static uint32_t matchEmptyOrDeleted(const Group& g) {  // Handle tombstones so deletions do not break the probing/search sequence.
+#ifdef __SSE2__  // Execute this statement as part of the data structure implementation.
+        __m128i ctrl = _mm_load_si128(reinterpret_cast<const __m128i*>(g.ctrl));  // Execute this statement as part of the data structure implementation.
+        return static_cast<uint32_t>(_mm_movemask_epi8(ctrl));  // movemask 直接取符號位 - movemask takes sign bits
+#else  // 純量後備 - Scalar fallback
+        uint32_t mask = 0;  // Assign or update a variable that represents the current algorithm state.
+        for (size_t i = 0; i < GROUP_WIDTH; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            mask |= static_cast<uint32_t>(g.ctrl[i] < 0) << i;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        return mask;  // Return the computed result to the caller.
+#endif  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    static int lowestBit(uint32_t mask) {  // 最低位 1 的位置 - Index of the lowest set bit
+#if defined(__GNUC__) || defined(__clang__)  // Execute this statement as part of the data structure implementation.
+        return __builtin_ctz(mask);  // Return the computed result to the caller.
+#else  // Execute this statement as part of the data structure implementation.
+        int i = 0;  // Assign or update a variable that represents the current algorithm state.
+        while ((mask & 1u) == 0u) { mask >>= 1; ++i; }  // Repeat while the loop condition remains true.
+        return i;  // Return the computed result to the caller.
+#endif  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 尋找 key 所在的槽位；三角數群組探測（g, g+1, g+3, g+6, ...）在 2 的冪次群組數下會走遍所有群組
+     * Locate key's slot; triangular group probing (g, g+1, g+3, g+6, ...) visits every group
+     * when the group count is a power of two
+     */  // End of block comment
+    std::optional<size_t> findSlot(const K& key, uint64_t hash, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
+        probes = 0;  // Advance or track the probing sequence used by open addressing.
+        int8_t tag = h2(hash);  // Assign or update a variable that represents the current algorithm state.
+        size_t g = h1(hash) & group_mask_;  // Advance or track the probing sequence used by open addressing.
+        for (size_t step = 1; step <= group_mask_ + 1; ++step) {  // Iterate over a range/collection to process each item in sequence.
+            ++probes;  // Advance or track the probing sequence used by open addressing.
+            const Group& group = groups_[g];  // Assign or update a variable that represents the current algorithm state.
+            for (uint32_t m = matchTag(group, tag); m != 0; m &= m - 1) {  // 只比對標籤相符的槽位 - Compare keys only where tags match
+                size_t index = g * GROUP_WIDTH + static_cast<size_t>(lowestBit(m));  // Assign or update a variable that represents the current algorithm state.
+                if (keys_[index] == key) {  // Evaluate the condition and branch into the appropriate code path.
+                    return index;  // Return the computed result to the caller.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+            if (matchTag(group, CTRL_EMPTY) != 0) {  // 群組內有 EMPTY：key 不可能在更後面 - An EMPTY ends the probe chain
+                return std::nullopt;  // Return the computed result to the caller.
+            }  // Close the current block scope.
+            g = (g + step) & group_mask_;  // Advance or track the probing sequence used by open addressing.
+        }  // Close the current block scope.
+        return std::nullopt;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    /** Doc block start
+     * 沿探測序列尋找第一個 EMPTY 或 DELETED 槽位（插入新 key 用）
+     * First EMPTY or DELETED slot along the probe sequence (for inserting a new key)
+     */  // End of block comment
+    size_t findFirstNonFull(uint64_t hash, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
+        size_t g = h1(hash) & group_mask_;  // Advance or track the probing sequence used by open addressing.
+        for (size_t step = 1;; ++step) {  // 負載上限 7/8 保證一定找得到 - The 7/8 cap guarantees a free slot exists
+            ++probes;  // Advance or track the probing sequence used by open addressing.
+            uint32_t m = matchEmptyOrDeleted(groups_[g]);  // Handle tombstones so deletions do not break the probing/search sequence.
+            if (m != 0) {  // Evaluate the condition and branch into the appropriate code path.
+                return g * GROUP_WIDTH + static_cast<size_t>(lowestBit(m));  // Return the computed result to the caller.
+            }  // Close the current block scope.
+            g = (g + step) & group_mask_;  // Advance or track the probing sequence used by open addressing.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    int8_t& ctrlAt(size_t index) {  // Execute this statement as part of the data structure implementation.
+        return groups_[index / GROUP_WIDTH].ctrl[index % GROUP_WIDTH];  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    static size_t maxLoad(size_t capacity) { return capacity - capacity / 8; }  // 7/8 負載上限 - 7/8 load cap
+
+    void resetStorage(size_t capacity);  // Execute this statement as part of the data structure implementation.
+
+    /** Doc block start
+     * 重建表格：墓碑很多時以相同容量重建（清除墓碑），否則容量加倍
+     * Rebuild: same capacity when tombstones dominate (purge), otherwise double
+     */  // End of block comment
+    void rehash();  // Rehash entries into a larger table to keep operations near O(1) on average.
+};  // Execute this statement as part of the data structure implementation.
+
+// ============================================================
+// 實作部分 Implementation
+// ============================================================
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+SwissTable<K, V>::SwissTable(size_t capacity)  // Execute this statement as part of the data structure implementation.
+    : capacity_(0), group_mask_(0), size_(0), deleted_count_(0), growth_left_(0), total_probes_(0), rehash_count_(0) {  // Handle tombstones so deletions do not break the probing/search sequence.
+    if (capacity == 0) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::invalid_argument(  // Throw an exception to signal an invalid argument or operation.
+            "容量必須為正整數 / Capacity must be positive");  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    size_t rounded = GROUP_WIDTH;  // Assign or update a variable that represents the current algorithm state.
+    while (rounded < capacity) {  // 向上取整為 2 的冪次 - Round up to a power of two
+        rounded *= 2;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    resetStorage(rounded);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void SwissTable<K, V>::resetStorage(size_t capacity) {  // Execute this statement as part of the data structure implementation.
+    capacity_ = capacity;  // Assign or update a variable that represents the current algorithm state.
+    group_mask_ = capacity / GROUP_WIDTH - 1;  // Assign or update a variable that represents the current algorithm state.
+    groups_.assign(capacity / GROUP_WIDTH, Group{});  // Access or update the bucket storage used to hold entries or chains.
+    for (Group& g : groups_) {  // Iterate over a range/collection to process each item in sequence.
+        std::memset(g.ctrl, static_cast<unsigned char>(CTRL_EMPTY), GROUP_WIDTH);  // 全部設為 EMPTY - Mark every slot EMPTY
+    }  // Close the current block scope.
+    keys_.assign(capacity, K{});  // Execute this statement as part of the data structure implementation.
+    values_.assign(capacity, V{});  // Execute this statement as part of the data structure implementation.
+    size_ = 0;  // Assign or update a variable that represents the current algorithm state.
+    deleted_count_ = 0;  // Handle tombstones so deletions do not break the probing/search sequence.
+    growth_left_ = maxLoad(capacity);  // Assign or update a variable that represents the current algorithm state.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+size_t SwissTable<K, V>::insert(const K& key, const V& value) {  // Execute this statement as part of the data structure implementation.
+    uint64_t hash = fullHash(key);  // Compute a hash-based index so keys map into the table's storage.
+    size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+    auto existing = findSlot(key, hash, probes);  // Advance or track the probing sequence used by open addressing.
+    if (existing.has_value()) {  // Evaluate the condition and branch into the appropriate code path.
+        // 更新現有鍵 - Update existing key
+        values_[existing.value()] = value;  // Assign or update a variable that represents the current algorithm state.
+        total_probes_ += probes;  // Advance or track the probing sequence used by open addressing.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+        return probes;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    size_t extra = 0;  // Advance or track the probing sequence used by open addressing.
+    size_t index = findFirstNonFull(hash, extra);  // Advance or track the probing sequence used by open addressing.
+    if (ctrlAt(index) == CTRL_EMPTY && growth_left_ == 0) {  // 需要消耗 EMPTY 額度但已用完 - Would consume an EMPTY with no budget left
+        rehash();  // Rehash entries into a larger table to keep operations near O(1) on average.
+        extra = 0;  // Advance or track the probing sequence used by open addressing.
+        index = findFirstNonFull(hash, extra);  // Advance or track the probing sequence used by open addressing.
+    }  // Close the current block scope.
+
+    // 插入新鍵：重用墓碑不會消耗成長額度 - Insert new key: reusing a tombstone does not consume growth budget
+    if (ctrlAt(index) == CTRL_DELETED) {  // Handle tombstones so deletions do not break the probing/search sequence.
+        --deleted_count_;  // Handle tombstones so deletions do not break the probing/search sequence.
+    } else {  // Handle the alternative branch when the condition is false.
+        --growth_left_;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    ctrlAt(index) = h2(hash);  // Assign or update a variable that represents the current algorithm state.
+    keys_[index] = key;  // Assign or update a variable that represents the current algorithm state.
+    values_[index] = value;  // Assign or update a variable that represents the current algorithm state.
+    ++size_;  // Execute this statement as part of the data structure implementation.
+
+    total_probes_ += probes + extra;  // Advance or track the probing sequence used by open addressing.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes + extra));  // Advance or track the probing sequence used by open addressing.
+    return probes + extra;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+std::optional<V> SwissTable<K, V>::search(const K& key) const {  // Execute this statement as part of the data structure implementation.
+    size_t probes;  // Advance or track the probing sequence used by open addressing.
+    return search(key, probes);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+std::optional<V> SwissTable<K, V>::search(const K& key, size_t& probes) const {  // Advance or track the probing sequence used by open addressing.
+    auto index = findSlot(key, fullHash(key), probes);  // Advance or track the probing sequence used by open addressing.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+    if (index.has_value()) {  // Evaluate the condition and branch into the appropriate code path.
+        return values_[index.value()];  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    return std::nullopt;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool SwissTable<K, V>::remove(const K& key) {  // Execute this statement as part of the data structure implementation.
+    size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+    auto index = findSlot(key, fullHash(key), probes);  // Advance or track the probing sequence used by open addressing.
+    HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Advance or track the probing sequence used by open addressing.
+    if (!index.has_value()) {  // Evaluate the condition and branch into the appropriate code path.
+        return false;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    size_t i = index.value();  // Assign or update a variable that represents the current algorithm state.
+    if (matchTag(groups_[i / GROUP_WIDTH], CTRL_EMPTY) != 0) {  // 群組仍有 EMPTY：不需要墓碑 - Group still has an EMPTY: no tombstone needed
+        ctrlAt(i) = CTRL_EMPTY;  // Assign or update a variable that represents the current algorithm state.
+        ++growth_left_;  // Assign or update a variable that represents the current algorithm state.
+    } else {  // Handle the alternative branch when the condition is false.
+        ctrlAt(i) = CTRL_DELETED;  // 群組已滿：留下墓碑 - Full group: leave a tombstone
+        ++deleted_count_;  // Handle tombstones so deletions do not break the probing/search sequence.
+    }  // Close the current block scope.
+    keys_[i] = K{};  // 釋放 key 持有的資源 - Release resources held by the key
+    values_[i] = V{};  // 釋放 value 持有的資源 - Release resources held by the value
+    --size_;  // Execute this statement as part of the data structure implementation.
+    return true;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+bool SwissTable<K, V>::contains(const K& key) const {  // Execute this statement as part of the data structure implementation.
+    return search(key).has_value();  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void SwissTable<K, V>::clear() {  // Execute this statement as part of the data structure implementation.
+    resetStorage(capacity_);  // Execute this statement as part of the data structure implementation.
+    total_probes_ = 0;  // Advance or track the probing sequence used by open addressing.
+}  // Close the current block scope.
+
+template <typename K, typename V>  // Execute this statement as part of the data structure implementation.
+void SwissTable<K, V>::rehash() {  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HASH_TABLE_STATS_ONLY(stats_.countRehash());  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HASH_TABLE_STATS_ONLY(HashTableStatsRecorder::RehashScope rehashScope(stats_);)  // Rehash entries into a larger table to keep operations near O(1) on average.
+    std::vector<Group> oldGroups = std::move(groups_);  // Access or update the bucket storage used to hold entries or chains.
+    std::vector<K> oldKeys = std::move(keys_);  // Execute this statement as part of the data structure implementation.
+    std::vector<V> oldValues = std::move(values_);  // Execute this statement as part of the data structure implementation.
+    size_t oldCapacity = capacity_;  // Assign or update a variable that represents the current algorithm state.
+
+    // 存活元素不到上限一半時，墓碑才是主因：原地大小重建即可 - If live entries are under half the cap, tombstones are the problem: rebuild at the same size
+    size_t newCapacity = (size_ * 2 <= maxLoad(oldCapacity)) ? oldCapacity : oldCapacity * 2;  // Assign or update a variable that represents the current algorithm state.
+    resetStorage(newCapacity);  // Execute this statement as part of the data structure implementation.
+    ++rehash_count_;  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+    for (size_t i = 0; i < oldCapacity; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        if (oldGroups[i / GROUP_WIDTH].ctrl[i % GROUP_WIDTH] >= 0) {  // 只搬移 FULL 槽位 - Move FULL slots only
+            uint64_t hash = fullHash(oldKeys[i]);  // Compute a hash-based index so keys map into the table's storage.
+            size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+            size_t index = findFirstNonFull(hash, probes);  // 新表沒有重複 key，不必先查詢 - No duplicates in the new table, skip lookup
+            ctrlAt(index) = h2(hash);  // Assign or update a variable that represents the current algorithm state.
+            keys_[index] = std::move(oldKeys[i]);  // Execute this statement as part of the data structure implementation.
+            values_[index] = std::move(oldValues[i]);  // Execute this statement as part of the data structure implementation.
+            --growth_left_;  // Assign or update a variable that represents the current algorithm state.
+            ++size_;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+#endif // SWISS_TABLE_HPP
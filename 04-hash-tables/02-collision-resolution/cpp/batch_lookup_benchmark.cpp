@@ -0,0 +1,134 @@
+/** Doc block start
+ * 鏈結法與開放定址法的批次查詢 效能量測 / Batched lookup for chaining and open addressing
+ *(blank line)
+ * 以 insertBatch 建立遠大於末級快取的 ChainedHashTable 與 OpenAddressingHashTable（線性探測、Robin Hood），
+ * 比較逐一 search 與 searchBatch（先算好整組的索引並預取）在批次大小 1 ~ 64 時的平均查詢耗時。
+ * Builds a ChainedHashTable and OpenAddressingHashTables (linear probing, Robin Hood) far larger
+ * than the last-level cache with insertBatch, then compares one-by-one search with searchBatch
+ * (compute and prefetch a whole group's indices first) for batch sizes 1 to 64.
+ *(blank line)
+ * 各設定交錯執行 rounds 輪並取最小值。Each configuration runs in `rounds` interleaved rounds; the minimum is reported.
+ *(blank line)
+ * 用法 Usage: ./batch_lookup_benchmark [log2Entries=22] [lookups=4000000] [rounds=3]
+ */  // End of block comment
+
+#include <algorithm>  // Execute this statement as part of the data structure implementation.
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <optional>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "Chaining.hpp"  // Execute this statement as part of the data structure implementation.
+#include "OpenAddressing.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 32 位元雙射混合函數（murmur3 fmix32）：不重複且在桶間隨機分布的 key
+ * Bijective 32-bit mixer (murmur3 fmix32): unique keys spread randomly across buckets
+ */  // End of block comment
+int scrambleKey(uint32_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    x *= 0x85ebca6bu;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 13;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc2b2ae35u;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    return static_cast<int>(x);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+const size_t kBatchSizes[] = {0, 1, 4, 16, 64};  // 0 = 逐一 search - 0 = one-by-one search
+const size_t kConfigs = sizeof(kBatchSizes) / sizeof(kBatchSizes[0]);  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 對一張表量測每種批次大小，交錯 rounds 輪並取最小值，再印出一列
+ * Measure every batch size on one table, interleaving rounds and keeping the minimum, then print one row
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+void measure(const std::string& name, const Table& table, const std::vector<int>& queries,  // Execute this statement as part of the data structure implementation.
+             int rounds, long long& checksum) {  // Execute this statement as part of the data structure implementation.
+    std::vector<double> best(kConfigs, 0.0);  // Execute this statement as part of the data structure implementation.
+    std::vector<int> batch;  // Execute this statement as part of the data structure implementation.
+    std::vector<std::optional<int>> out;  // Execute this statement as part of the data structure implementation.
+    for (int round = 0; round < rounds; ++round) {  // Iterate over a range/collection to process each item in sequence.
+        for (size_t config = 0; config < kConfigs; ++config) {  // Iterate over a range/collection to process each item in sequence.
+            size_t batchSize = kBatchSizes[config];  // Assign or update a variable that represents the current algorithm state.
+            Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+            if (batchSize == 0) {  // Evaluate the condition and branch into the appropriate code path.
+                for (int query : queries) {  // Iterate over a range/collection to process each item in sequence.
+                    checksum += table.search(query).value_or(-1);  // Assign or update a variable that represents the current algorithm state.
+                }  // Close the current block scope.
+            } else {  // Handle the alternative branch when the condition is false.
+                for (size_t base = 0; base + batchSize <= queries.size(); base += batchSize) {  // Iterate over a range/collection to process each item in sequence.
+                    batch.assign(queries.begin() + base, queries.begin() + base + batchSize);  // Execute this statement as part of the data structure implementation.
+                    table.searchBatch(batch, out);  // Execute this statement as part of the data structure implementation.
+                    for (const std::optional<int>& found : out) {  // Iterate over a range/collection to process each item in sequence.
+                        checksum += found.value_or(-1);  // Assign or update a variable that represents the current algorithm state.
+                    }  // Close the current block scope.
+                }  // Close the current block scope.
+            }  // Close the current block scope.
+            double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / queries.size();  // Assign or update a variable that represents the current algorithm state.
+            best[config] = (round == 0) ? ns : std::min(best[config], ns);  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    std::cout << std::setw(12) << name << std::fixed;  // Execute this statement as part of the data structure implementation.
+    for (size_t config = 0; config < kConfigs; ++config) {  // Iterate over a range/collection to process each item in sequence.
+        std::cout << std::setprecision(1) << std::setw(10) << best[config];  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::cout << std::setprecision(2) << std::setw(10) << best[0] / best[kConfigs - 1] << "x" << std::endl;  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    int log2Entries = (argc > 1) ? std::stoi(argv[1]) : 22;  // Assign or update a variable that represents the current algorithm state.
+    long long lookups = (argc > 2) ? std::stoll(argv[2]) : 4000000LL;  // Assign or update a variable that represents the current algorithm state.
+    int rounds = (argc > 3) ? std::stoi(argv[3]) : 3;  // Assign or update a variable that represents the current algorithm state.
+    if (log2Entries < 10 || log2Entries > 25 || lookups <= 0 || rounds <= 0) {  // Evaluate the condition and branch into the appropriate code path.
+        std::cerr << "log2Entries must be in [10, 25], lookups and rounds positive" << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    size_t entries = size_t{1} << log2Entries;  // Assign or update a variable that represents the current algorithm state.
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    std::vector<int> keys(entries);  // Execute this statement as part of the data structure implementation.
+    std::vector<int> values(entries);  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        keys[i] = scrambleKey(static_cast<uint32_t>(i));  // Assign or update a variable that represents the current algorithm state.
+        values[i] = static_cast<int>(i);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    std::vector<int> queries(static_cast<size_t>(lookups));  // Execute this statement as part of the data structure implementation.
+    uint64_t state = 0x9E3779B97F4A7C15ULL;  // Assign or update a variable that represents the current algorithm state.
+    for (int& query : queries) {  // Iterate over a range/collection to process each item in sequence.
+        state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+        query = keys[state % entries];  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+
+    std::cout << "int -> int, entries=2^" << log2Entries << " lookups=" << lookups << ", ns/lookup" << std::endl << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(12) << "table";  // Execute this statement as part of the data structure implementation.
+    for (size_t config = 0; config < kConfigs; ++config) {  // Iterate over a range/collection to process each item in sequence.
+        std::cout << std::setw(10) << (kBatchSizes[config] == 0 ? std::string("search") : "batch " + std::to_string(kBatchSizes[config]));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::cout << std::setw(11) << "speedup" << std::endl;  // Execute this statement as part of the data structure implementation.
+
+    // 一次只保留一張表，避免記憶體用量加總 - Keep one table alive at a time so memory use does not add up
+    {  // Execute this statement as part of the data structure implementation.
+        ChainedHashTable<int, int> table;  // Execute this statement as part of the data structure implementation.
+        table.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+        measure("chaining", table, queries, rounds, checksum);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    {  // Execute this statement as part of the data structure implementation.
+        OpenAddressingHashTable<int, int> table(16, ProbeMethod::LINEAR);  // Execute this statement as part of the data structure implementation.
+        table.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+        measure("linear", table, queries, rounds, checksum);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    {  // Execute this statement as part of the data structure implementation.
+        OpenAddressingHashTable<int, int> table(16, ProbeMethod::ROBIN_HOOD);  // Execute this statement as part of the data structure implementation.
+        table.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+        measure("robin hood", table, queries, rounds, checksum);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::cout << std::endl << "speedup = search / batch " << kBatchSizes[kConfigs - 1] << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << "checksum=" << checksum << std::endl;  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
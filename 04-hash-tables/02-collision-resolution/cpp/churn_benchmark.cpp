@@ -0,0 +1,78 @@
+/** Doc block start
+ * 開放定址法長時間 churn 量測 / Long-running churn benchmark for open addressing
+ *(blank line)
+ * 維持固定大小的滑動視窗：每步插入一個新 key 並刪除最舊的 key。
+ * 墓碑會持續累積；此程式逐段輸出平均探測次數、容量與重建次數，
+ * 用來確認自動清除墓碑後探測長度保持穩定、容量不會無限成長。
+ * Keeps a steady-size sliding window: every step inserts a fresh key and erases the oldest one.
+ * Tombstones keep accumulating; each window prints average probes, capacity and rebuild counts
+ * to show probe lengths stay flat and capacity stays bounded once tombstones are purged.
+ *(blank line)
+ * 用法 Usage: ./churn_benchmark [operations=100000000] [steadySize=100000]
+ */  // End of block comment
+
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include "OpenAddressing.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 32 位元雙射混合函數：連續整數對應到不重複且分散的 key
+ * Bijective 32-bit mixer: consecutive integers map to unique, well-spread keys
+ */  // End of block comment
+int scrambleKey(uint32_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    x *= 0x85ebca6bu;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 13;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc2b2ae35u;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    return static_cast<int>(x);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+void runChurn(const std::string& name, ProbeMethod method, long long operations, long long steadySize) {  // Execute this statement as part of the data structure implementation.
+    OpenAddressingHashTable<int, int> ht(16, method);  // 從小容量開始，讓表自行成長 - Start small and let the table grow
+    const long long windows = 10;  // 輸出段數 - Number of report windows
+    long long perWindow = operations / windows;  // Assign or update a variable that represents the current algorithm state.
+    long long next = 0;  // 下一個要插入的序號 - Next sequence number to insert
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "\n" << name << "\n";  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(14) << "operations" << std::setw(14) << "insert probes" << std::setw(14) << "search probes"  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << "capacity" << std::setw(10) << "rehashes" << std::setw(10) << "purges" << std::setw(10) << "Mops/s" << "\n";  // Execute this statement as part of the data structure implementation.
+    for (long long w = 0; w < windows; ++w) {  // Iterate over a range/collection to process each item in sequence.
+        ht.resetProbeCount();  // Advance or track the probing sequence used by open addressing.
+        size_t searchProbes = 0;  // Advance or track the probing sequence used by open addressing.
+        Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+        for (long long op = 0; op < perWindow; ++op, ++next) {  // 每步一次插入 + 一次查詢 + 一次刪除 - One insert + one search + one erase per step
+            ht.insert(scrambleKey(static_cast<uint32_t>(next)), static_cast<int>(next));  // Execute this statement as part of the data structure implementation.
+            if (next >= steadySize) {  // Evaluate the condition and branch into the appropriate code path.
+                size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+                int oldest = scrambleKey(static_cast<uint32_t>(next - steadySize));  // Assign or update a variable that represents the current algorithm state.
+                checksum += ht.search(oldest, probes).value_or(0);  // Execute this statement as part of the data structure implementation.
+                searchProbes += probes;  // Advance or track the probing sequence used by open addressing.
+                ht.remove(oldest);  // Handle tombstones so deletions do not break the probing/search sequence.
+            }  // Close the current block scope.
+        }  // Close the current block scope.
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+        std::cout << std::setw(14) << next << std::fixed << std::setprecision(2)  // Execute this statement as part of the data structure implementation.
+                  << std::setw(14) << static_cast<double>(ht.getTotalProbes()) / static_cast<double>(perWindow)  // Advance or track the probing sequence used by open addressing.
+                  << std::setw(14) << static_cast<double>(searchProbes) / static_cast<double>(perWindow)  // Advance or track the probing sequence used by open addressing.
+                  << std::setw(10) << ht.capacity() << std::setw(10) << ht.getRehashCount() << std::setw(10) << ht.getPurgeCount()  // Rehash entries into a larger table to keep operations near O(1) on average.
+                  << std::setw(10) << static_cast<double>(perWindow) / seconds / 1e6 << "\n";  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::cout << "size=" << ht.size() << " tombstones=" << ht.getDeletedCount() << " checksum=" << checksum << "\n";  // Handle tombstones so deletions do not break the probing/search sequence.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    long long operations = (argc > 1) ? std::stoll(argv[1]) : 100000000LL;  // 預設 10^8 次插入/刪除 - Default 10^8 insert/erase steps
+    long long steadySize = (argc > 2) ? std::stoll(argv[2]) : 100000LL;  // 穩定狀態的元素數 - Steady-state element count
+
+    std::cout << "operations=" << operations << " steadySize=" << steadySize << "\n";  // Execute this statement as part of the data structure implementation.
+    runChurn("LINEAR", ProbeMethod::LINEAR, operations, steadySize);  // Advance or track the probing sequence used by open addressing.
+    runChurn("DOUBLE_HASH", ProbeMethod::DOUBLE_HASH, operations, steadySize);  // Compute a hash-based index so keys map into the table's storage.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -0,0 +1,146 @@
+/** Doc block start
+ * 雜湊洪水攻擊量測 / Hash-flooding attack benchmark
+ *(blank line)
+ * 攻擊者若知道雜湊函數（這裡模擬成種子為 0），就能挑出全部落在同一個桶的 key，
+ * 讓鏈結法退化成 O(n) 串列、整體插入 O(n²)。此程式用同一批 key 比較：
+ * 已知種子（HashSeed{}）與每個表各自的隨機種子，以及串列鏈（FlatChainedHashTable、
+ * HashTable）與會樹化的鏈（ChainedHashTable）。
+ * An attacker who knows the hash function (simulated here as the zero seed) can pick keys that
+ * all land in one bucket, turning chaining into an O(n) list and the whole insert phase into O(n²).
+ * The same key set is run against a known seed (HashSeed{}) versus a random per-table seed, and
+ * against plain list chains (FlatChainedHashTable, HashTable) versus treeified chains (ChainedHashTable).
+ *(blank line)
+ * 用法 Usage: ./collision_attack_benchmark [keys=16384]
+ */  // End of block comment
+
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "Chaining.hpp"  // Execute this statement as part of the data structure implementation.
+#include "FlatChaining.hpp"  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // 01-basic-hash-table 的漸進式擴容雜湊表 - Incrementally rehashing table from 01-basic-hash-table
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+/** Doc block start
+ * 奇數的 2^64 模反元素（牛頓法）/ Inverse of an odd number modulo 2^64 (Newton's method)
+ */  // End of block comment
+uint64_t inverseOdd(uint64_t a) {  // Execute this statement as part of the data structure implementation.
+    uint64_t x = a;  // 對 3 個位元正確 - Correct to 3 bits
+    for (int i = 0; i < 5; ++i) {  // 每輪正確位數加倍 - Each round doubles the correct bits
+        x *= 2 - a * x;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    return x;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * fmix64 的反函數：攻擊者用它從想要的雜湊值倒推出 key
+ * Inverse of fmix64: the attacker uses it to work back from a wanted hash value to a key
+ */  // End of block comment
+uint64_t unmix64(uint64_t h) {  // Compute a hash-based index so keys map into the table's storage.
+    h ^= h >> 33;  // 右移 ≥ 32 的 xorshift 是自己的反函數 - An xorshift by ≥ 32 is its own inverse
+    h *= inverseOdd(0xc4ceb9fe1a85ec53ULL);  // Assign or update a variable that represents the current algorithm state.
+    h ^= h >> 33;  // Assign or update a variable that represents the current algorithm state.
+    h *= inverseOdd(0xff51afd7ed558ccdULL);  // Assign or update a variable that represents the current algorithm state.
+    h ^= h >> 33;  // Assign or update a variable that represents the current algorithm state.
+    return h;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 攻擊 key：在零種子下雜湊值都是 2^20 的倍數，所以對任何 ≤ 2^20 的 2 的冪桶數都落在桶 0
+ * Attack keys: under the zero seed every hash is a multiple of 2^20, so they all land in bucket 0
+ * for any power-of-two bucket count up to 2^20
+ */  // End of block comment
+std::vector<uint64_t> attackKeys(size_t n) {  // Execute this statement as part of the data structure implementation.
+    std::vector<uint64_t> keys;  // Execute this statement as part of the data structure implementation.
+    keys.reserve(n);  // Execute this statement as part of the data structure implementation.
+    for (uint64_t i = 1; keys.size() < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        keys.push_back(unmix64(i << 20));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return keys;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+std::vector<uint64_t> randomKeys(size_t n) {  // Execute this statement as part of the data structure implementation.
+    std::vector<uint64_t> keys;  // Execute this statement as part of the data structure implementation.
+    keys.reserve(n);  // Execute this statement as part of the data structure implementation.
+    uint64_t state = 0x9e3779b97f4a7c15ULL;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;  // Assign or update a variable that represents the current algorithm state.
+        keys.push_back(state ^ (state >> 29));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return keys;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 插入全部 key 再全部查一次，輸出每次操作的奈秒數；maxChain / treeBins 由呼叫端提供
+ * Insert every key and look each one up once, printing nanoseconds per operation;
+ * the caller supplies maxChain / treeBins
+ */  // End of block comment
+template <typename Table, typename Shape>  // Execute this statement as part of the data structure implementation.
+void run(const std::string& name, Table& table, const std::vector<uint64_t>& keys, Shape shape) {  // Execute this statement as part of the data structure implementation.
+    Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (uint64_t key : keys) {  // Iterate over a range/collection to process each item in sequence.
+        table.insert(key, key);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    double insertNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(keys.size());  // Assign or update a variable that represents the current algorithm state.
+
+    uint64_t checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (uint64_t key : keys) {  // Iterate over a range/collection to process each item in sequence.
+        checksum += table.search(key).value_or(0);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    double lookupNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(keys.size());  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(1)  // Execute this statement as part of the data structure implementation.
+              << std::setw(12) << insertNs << std::setw(12) << lookupNs;  // Execute this statement as part of the data structure implementation.
+    shape(table);  // Execute this statement as part of the data structure implementation.
+    std::cout << "   (checksum " << (checksum & 0xffff) << ")\n";  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+void runAll(const std::string& workload, const std::vector<uint64_t>& keys) {  // Execute this statement as part of the data structure implementation.
+    // 鏈結法固定桶數（不自動擴容），給到 ≥ key 數的 2 的冪 - Chaining tables never grow, so give them a power of two ≥ the key count
+    size_t buckets = 1;  // Access or update the bucket storage used to hold entries or chains.
+    while (buckets < keys.size()) {  // Repeat while the loop condition remains true.
+        buckets <<= 1;  // Access or update the bucket storage used to hold entries or chains.
+    }  // Close the current block scope.
+    auto chainShape = [](const auto& table) {  // Execute this statement as part of the data structure implementation.
+        std::cout << std::setw(10) << table.getMaxChainLength();  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+    auto treeShape = [](const ChainedHashTable<uint64_t, uint64_t>& table) {  // Execute this statement as part of the data structure implementation.
+        std::cout << std::setw(10) << table.getMaxChainLength() << std::setw(10) << table.getTreeBinCount();  // Execute this statement as part of the data structure implementation.
+    };  // Execute this statement as part of the data structure implementation.
+    auto noShape = [](const HashTable<uint64_t, uint64_t>&) { std::cout << std::setw(10) << "-"; };  // Execute this statement as part of the data structure implementation.
+
+    std::cout << "\n" << workload << " (" << keys.size() << " keys)\n";  // Execute this statement as part of the data structure implementation.
+    std::cout << std::left << std::setw(34) << "table / seed" << std::right << std::setw(12) << "ns/insert" << std::setw(12) << "ns/lookup"  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << "maxChain" << std::setw(10) << "treeBins" << "\n";  // Execute this statement as part of the data structure implementation.
+    for (bool known : {true, false}) {  // Iterate over a range/collection to process each item in sequence.
+        const char* seedName = known ? " / known seed" : " / random seed";  // Assign or update a variable that represents the current algorithm state.
+        HashSeed seed = known ? HashSeed{} : HashSeed::random();  // Assign or update a variable that represents the current algorithm state.
+
+        FlatChainedHashTable<uint64_t, uint64_t> flat(buckets, seed);  // Access or update the bucket storage used to hold entries or chains.
+        flat.reserve(keys.size());  // Execute this statement as part of the data structure implementation.
+        run(std::string("FlatChained (list)") + seedName, flat, keys, chainShape);  // Execute this statement as part of the data structure implementation.
+
+        ChainedHashTable<uint64_t, uint64_t> chained(buckets, seed);  // Access or update the bucket storage used to hold entries or chains.
+        run(std::string("Chained (treeify)") + seedName, chained, keys, treeShape);  // Execute this statement as part of the data structure implementation.
+
+        HashTable<uint64_t, uint64_t> table(16, seed);  // 從小容量開始自動擴容 - Starts small and grows on its own
+        run(std::string("HashTable (list)") + seedName, table, keys, noShape);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    size_t n = (argc > 1) ? static_cast<size_t>(std::stoull(argv[1])) : 16384;  // Assign or update a variable that represents the current algorithm state.
+    if (n == 0 || n > (size_t(1) << 20)) {  // 攻擊 key 只對 ≤ 2^20 的桶數有效 - Attack keys only target bucket counts up to 2^20
+        std::cerr << "keys must be in [1, 2^20]\n";  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    std::cout << "collision attack benchmark, keys=" << n << "\n";  // Execute this statement as part of the data structure implementation.
+    runAll("random keys", randomKeys(n));  // Execute this statement as part of the data structure implementation.
+    runAll("attack keys (collide under the zero seed)", attackKeys(n));  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
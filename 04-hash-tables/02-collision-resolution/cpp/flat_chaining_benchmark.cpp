@@ -0,0 +1,163 @@
+/** Doc block start
+ * 扁平節點鏈結 vs std::list 鏈結 效能比較 / Flat-node chaining vs std::list chaining
+ *(blank line)
+ * 以負載因子 1.0（桶數 = 元素數）比較 FlatChainedHashTable 與 ChainedHashTable：
+ * 每個元素配置的位元組數與配置次數、插入、命中／未命中查詢的平均耗時，以及 clear() 的耗時。
+ * 位元組數以取代全域 operator new 的方式統計（malloc_usable_size：含 malloc 的大小進位，不含它自身的標頭）。
+ * Compares FlatChainedHashTable with ChainedHashTable at load factor 1.0 (buckets = entries):
+ * bytes and allocations per entry, average insert / hit / miss cost, and the time taken by clear().
+ * Bytes are counted by replacing the global operator new (malloc_usable_size: malloc's size rounding
+ * included, its own headers excluded).
+ *(blank line)
+ * 用法 Usage: ./flat_chaining_benchmark [maxLog2Entries=22] [lookups=4000000]
+ */  // End of block comment
+
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <cstdlib>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <malloc.h>  // malloc_usable_size（glibc）- malloc_usable_size (glibc)
+#include <new>  // Execute this statement as part of the data structure implementation.
+#include <optional>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include "Chaining.hpp"  // Execute this statement as part of the data structure implementation.
+#include "FlatChaining.hpp"  // Execute this statement as part of the data structure implementation.
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+// ========== 配置統計 Allocation Accounting ==========
+
+size_t g_liveBytes = 0;  // 目前存活區塊的可用位元組 - Usable bytes of live blocks
+size_t g_allocations = 0;  // 累計配置次數 - Cumulative allocation count
+
+// 區塊直接交給 malloc，大小以 malloc_usable_size 在配置與釋放時各查一次，不在區塊前面藏標頭；
+// 不內聯，否則 GCC 在呼叫端看到 new 出來的指標被 free 會發出 -Wmismatched-new-delete
+// Blocks go straight to malloc; malloc_usable_size is asked for the size on allocation and on
+// release, so no header is hidden in front of the block. Kept out of line: once inlined, GCC sees
+// a pointer from new reach free() at the call site and reports -Wmismatched-new-delete
+[[gnu::noinline]] void* operator new(size_t n) {  // Execute this statement as part of the data structure implementation.
+    void* p = std::malloc(n == 0 ? 1 : n);  // malloc(0) 可能回傳 nullptr - malloc(0) may return nullptr
+    if (p == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+        throw std::bad_alloc();  // Throw an exception to signal an invalid argument or operation.
+    }  // Close the current block scope.
+    g_liveBytes += malloc_usable_size(p);  // Assign or update a variable that represents the current algorithm state.
+    ++g_allocations;  // Execute this statement as part of the data structure implementation.
+    return p;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+[[gnu::noinline]] void operator delete(void* p) noexcept {  // Execute this statement as part of the data structure implementation.
+    if (p == nullptr) {  // Evaluate the condition and branch into the appropriate code path.
+        return;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    g_liveBytes -= malloc_usable_size(p);  // Assign or update a variable that represents the current algorithm state.
+    std::free(p);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+void operator delete(void* p, size_t) noexcept {  // Execute this statement as part of the data structure implementation.
+    operator delete(p);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 32 位元雙射混合函數（murmur3 fmix32）：不重複且在桶間隨機分布的 key
+ * Bijective 32-bit mixer (murmur3 fmix32): unique keys spread randomly across buckets
+ */  // End of block comment
+int scrambleKey(uint32_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    x *= 0x85ebca6bu;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 13;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc2b2ae35u;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    return static_cast<int>(x);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 一列量測結果 / One row of results
+ */  // End of block comment
+struct Row {  // Execute this statement as part of the data structure implementation.
+    double bytesPerEntry;  // Execute this statement as part of the data structure implementation.
+    double allocsPerEntry;  // Execute this statement as part of the data structure implementation.
+    double insertNs;  // Execute this statement as part of the data structure implementation.
+    double hitNs;  // Execute this statement as part of the data structure implementation.
+    double missNs;  // Execute this statement as part of the data structure implementation.
+    double clearMs;  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 建表、量測、清空 / Build, measure and clear one table
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+Row measure(size_t entries, long long lookups, long long& checksum) {  // Execute this statement as part of the data structure implementation.
+    Row row{};  // Execute this statement as part of the data structure implementation.
+    size_t bytesBefore = g_liveBytes;  // Assign or update a variable that represents the current algorithm state.
+    size_t allocsBefore = g_allocations;  // Assign or update a variable that represents the current algorithm state.
+    Table* table = new Table(entries);  // 桶數 = 元素數 - Buckets = entries
+
+    Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < entries; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        table->insert(scrambleKey(static_cast<uint32_t>(i)), static_cast<int>(i));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    row.insertNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / entries;  // Assign or update a variable that represents the current algorithm state.
+    row.bytesPerEntry = static_cast<double>(g_liveBytes - bytesBefore - sizeof(Table)) / entries;  // Assign or update a variable that represents the current algorithm state.
+    row.allocsPerEntry = static_cast<double>(g_allocations - allocsBefore - 1) / entries;  // Assign or update a variable that represents the current algorithm state.
+
+    // 命中：隨機順序查詢已插入的 key - Hits: inserted keys in random order
+    uint64_t state = 0x9E3779B97F4A7C15ULL;  // Assign or update a variable that represents the current algorithm state.
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (long long i = 0; i < lookups; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+        std::optional<int> found = table->search(scrambleKey(static_cast<uint32_t>(state % entries)));  // Assign or update a variable that represents the current algorithm state.
+        checksum += found.value_or(-1);  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    row.hitNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / lookups;  // Assign or update a variable that represents the current algorithm state.
+
+    // 未命中：從未插入的 key - Misses: keys that were never inserted
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (long long i = 0; i < lookups; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        state ^= state << 13;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state >> 7;  // Assign or update a variable that represents the current algorithm state.
+        state ^= state << 17;  // Assign or update a variable that represents the current algorithm state.
+        uint32_t missIndex = static_cast<uint32_t>(entries + state % entries);  // Assign or update a variable that represents the current algorithm state.
+        checksum += table->contains(scrambleKey(missIndex)) ? 1 : 0;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    row.missNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / lookups;  // Assign or update a variable that represents the current algorithm state.
+
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    table->clear();  // Execute this statement as part of the data structure implementation.
+    row.clearMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();  // Assign or update a variable that represents the current algorithm state.
+    checksum += static_cast<long long>(table->size());  // Assign or update a variable that represents the current algorithm state.
+    delete table;  // Execute this statement as part of the data structure implementation.
+    return row;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+void printRow(const std::string& name, const Row& row) {  // Execute this statement as part of the data structure implementation.
+    std::cout << std::setw(10) << name << std::fixed << std::setprecision(2)  // Execute this statement as part of the data structure implementation.
+              << std::setw(12) << row.bytesPerEntry << std::setw(12) << row.allocsPerEntry  // Execute this statement as part of the data structure implementation.
+              << std::setprecision(1) << std::setw(12) << row.insertNs << std::setw(10) << row.hitNs  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << row.missNs << std::setprecision(2) << std::setw(12) << row.clearMs << std::endl;  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    int maxLog2 = (argc > 1) ? std::stoi(argv[1]) : 22;  // Assign or update a variable that represents the current algorithm state.
+    long long lookups = (argc > 2) ? std::stoll(argv[2]) : 4000000LL;  // Assign or update a variable that represents the current algorithm state.
+    if (maxLog2 < 12 || maxLog2 > 28 || lookups <= 0) {  // Evaluate the condition and branch into the appropriate code path.
+        std::cerr << "maxLog2Entries must be in [12, 28] and lookups positive" << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "int -> int, load factor 1.0, lookups=" << lookups << std::endl;  // Execute this statement as part of the data structure implementation.
+    for (int log2 = 12; log2 <= maxLog2; log2 += 2) {  // Iterate over a range/collection to process each item in sequence.
+        size_t entries = size_t{1} << log2;  // Assign or update a variable that represents the current algorithm state.
+        std::cout << std::endl << "entries=2^" << log2 << std::endl;  // Execute this statement as part of the data structure implementation.
+        std::cout << std::setw(10) << "table" << std::setw(12) << "bytes/entry" << std::setw(12) << "allocs/entry"  // Execute this statement as part of the data structure implementation.
+                  << std::setw(12) << "insert(ns)" << std::setw(10) << "hit(ns)" << std::setw(10) << "miss(ns)"  // Execute this statement as part of the data structure implementation.
+                  << std::setw(12) << "clear(ms)" << std::endl;  // Execute this statement as part of the data structure implementation.
+        printRow("list", measure<ChainedHashTable<int, int>>(entries, lookups, checksum));  // Execute this statement as part of the data structure implementation.
+        printRow("flat", measure<FlatChainedHashTable<int, int>>(entries, lookups, checksum));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::cout << std::endl << "checksum=" << checksum << std::endl;  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
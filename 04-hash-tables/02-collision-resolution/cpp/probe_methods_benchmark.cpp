@@ -0,0 +1,109 @@
+/** Doc block start
+ * 探測方法比較（高負載） / Probe method comparison at high load
+ *(blank line)
+ * 對 LINEAR、QUADRATIC、DOUBLE_HASH、ROBIN_HOOD 在負載 0.5 ~ 0.9 下量測探測長度分佈：
+ * 插入探測（來自 getProbeHistogram()）、成功查詢的平均/變異數/最大值、失敗查詢的平均值。
+ * Measures probe-length distributions for LINEAR, QUADRATIC, DOUBLE_HASH and ROBIN_HOOD at loads 0.5 .. 0.9:
+ * insert probes (from getProbeHistogram()), successful-lookup mean/variance/max, and unsuccessful-lookup mean.
+ *(blank line)
+ * 用法 Usage: ./probe_methods_benchmark [capacity=131071]
+ */  // End of block comment
+
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "OpenAddressing.hpp"  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 32 位元雙射混合函數：連續整數對應到不重複且分散的 key
+ * Bijective 32-bit mixer: consecutive integers map to unique, well-spread keys
+ */  // End of block comment
+int scrambleKey(uint32_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    x *= 0x85ebca6bu;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 13;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc2b2ae35u;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    return static_cast<int>(x);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 從分佈 histogram[p] 取出第 q 分位數 / q-th percentile from a histogram[p] distribution
+ */  // End of block comment
+size_t percentile(const std::vector<size_t>& histogram, double q) {  // Execute this statement as part of the data structure implementation.
+    size_t total = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t count : histogram) {  // Iterate over a range/collection to process each item in sequence.
+        total += count;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    size_t seen = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t p = 0; p < histogram.size(); ++p) {  // Iterate over a range/collection to process each item in sequence.
+        seen += histogram[p];  // Execute this statement as part of the data structure implementation.
+        if (static_cast<double>(seen) >= q * static_cast<double>(total)) {  // Evaluate the condition and branch into the appropriate code path.
+            return p;  // Return the computed result to the caller.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    return histogram.empty() ? 0 : histogram.size() - 1;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+void runRow(const std::string& name, ProbeMethod method, size_t capacity, double load) {  // Advance or track the probing sequence used by open addressing.
+    size_t n = static_cast<size_t>(load * static_cast<double>(capacity));  // Assign or update a variable that represents the current algorithm state.
+    OpenAddressingHashTable<int, int> ht(capacity, method);  // Execute this statement as part of the data structure implementation.
+    ht.setMaxLoadFactor(0.95);  // 固定容量，不讓表自行擴容 - Keep capacity fixed: no automatic growth
+    std::cout << "  " << std::left << std::setw(12) << name << std::right;  // Execute this statement as part of the data structure implementation.
+    for (size_t i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(scrambleKey(static_cast<uint32_t>(i)), static_cast<int>(i));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    if (ht.capacity() != capacity) {  // 非 2 的冪次容量上序列未必走遍所有槽位，表會擴容 - Off powers of two a sequence may miss slots, so the table grows
+        std::cout << "  (grew: probe sequence found no free slot)\n";  // Execute this statement as part of the data structure implementation.
+        return;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    double insertMean = static_cast<double>(ht.getTotalProbes()) / static_cast<double>(n);  // Advance or track the probing sequence used by open addressing.
+    size_t insertP99 = percentile(ht.getProbeHistogram(), 0.99);  // Advance or track the probing sequence used by open addressing.
+
+    double sum = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    double sumSq = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    size_t maxHit = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+        ht.search(scrambleKey(static_cast<uint32_t>(i)), probes);  // Advance or track the probing sequence used by open addressing.
+        sum += static_cast<double>(probes);  // Execute this statement as part of the data structure implementation.
+        sumSq += static_cast<double>(probes) * static_cast<double>(probes);  // Execute this statement as part of the data structure implementation.
+        maxHit = probes > maxHit ? probes : maxHit;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    double hitMean = sum / static_cast<double>(n);  // Assign or update a variable that represents the current algorithm state.
+    double hitVar = sumSq / static_cast<double>(n) - hitMean * hitMean;  // Assign or update a variable that represents the current algorithm state.
+
+    double missSum = 0.0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < n; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+        ht.search(scrambleKey(static_cast<uint32_t>(i + n)), probes);  // 不存在的 key - Absent keys
+        missSum += static_cast<double>(probes);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    std::cout << std::fixed << std::setprecision(2)  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << insertMean << std::setw(8) << insertP99  // Advance or track the probing sequence used by open addressing.
+              << std::setw(10) << hitMean << std::setw(10) << hitVar << std::setw(8) << maxHit  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << missSum / static_cast<double>(n) << "\n";  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    size_t capacity = (argc > 1) ? static_cast<size_t>(std::stoull(argv[1])) : 131071;  // 質數容量（2^17 - 1）- Prime capacity
+    const double loads[] = {0.5, 0.7, 0.8, 0.9};  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "capacity=" << capacity << " (probes per operation)\n";  // Execute this statement as part of the data structure implementation.
+    for (double load : loads) {  // Iterate over a range/collection to process each item in sequence.
+        std::cout << "\nload=" << std::setprecision(2) << load << "\n";  // Execute this statement as part of the data structure implementation.
+        std::cout << "  " << std::left << std::setw(12) << "method" << std::right  // Execute this statement as part of the data structure implementation.
+                  << std::setw(10) << "ins mean" << std::setw(8) << "ins p99"  // Execute this statement as part of the data structure implementation.
+                  << std::setw(10) << "hit mean" << std::setw(10) << "hit var" << std::setw(8) << "hit max"  // Execute this statement as part of the data structure implementation.
+                  << std::setw(10) << "miss mean" << "\n";  // Execute this statement as part of the data structure implementation.
+        runRow("LINEAR", ProbeMethod::LINEAR, capacity, load);  // Advance or track the probing sequence used by open addressing.
+        runRow("QUADRATIC", ProbeMethod::QUADRATIC, capacity, load);  // Advance or track the probing sequence used by open addressing.
+        runRow("DOUBLE_HASH", ProbeMethod::DOUBLE_HASH, capacity, load);  // Compute a hash-based index so keys map into the table's storage.
+        runRow("ROBIN_HOOD", ProbeMethod::ROBIN_HOOD, capacity, load);  // Advance or track the probing sequence used by open addressing.
+    }  // Close the current block scope.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
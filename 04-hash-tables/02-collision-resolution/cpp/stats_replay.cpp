@@ -0,0 +1,190 @@
+/** Doc block start
+ * 工作負載重播與統計輸出 / Workload replay with JSON statistics
+ *(blank line)
+ * 讀入一份操作紀錄，依序在每一種雜湊表上重播，最後以 JSON 輸出各表的
+ * 探測長度直方圖、鏈長分布、墓碑數、重建次數與耗時、配置的位元組數。
+ * 每行一個操作：「insert k v」、「search k」或「remove k」（k、v 為整數，# 開頭為註解）。
+ * 路徑為 "-" 時改用固定種子產生的合成負載（插入 50%、查詢 35%、刪除 15%）。
+ * Reads an operation log, replays it on every hash table and prints, as JSON, each table's
+ * probe-length histogram, chain-length distribution, tombstones, rehash count and time, and bytes allocated.
+ * One operation per line: "insert k v", "search k" or "remove k" (integer k and v, '#' starts a comment).
+ * With path "-" a fixed-seed synthetic workload is generated instead (50% insert, 35% search, 15% remove).
+ *(blank line)
+ * 用法 Usage: ./stats_replay [workload=-] [operations=200000] [keySpace=50000]
+ */  // End of block comment
+
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <fstream>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <random>  // Execute this statement as part of the data structure implementation.
+#include <sstream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "Chaining.hpp"  // Execute this statement as part of the data structure implementation.
+#include "FlatChaining.hpp"  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // Execute this statement as part of the data structure implementation.
+#include "OpenAddressing.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SwissTable.hpp"  // Execute this statement as part of the data structure implementation.
+#include "UniversalHashing.hpp"  // 03-hash-functions 的全域雜湊表 - Universal hash table from 03-hash-functions
+#include "CuckooHashing.hpp"  // 03-hash-functions 的布穀鳥雜湊表 - Cuckoo hash table from 03-hash-functions
+
+#if !HASH_TABLE_STATS  // Evaluate the condition and branch into the appropriate code path.
+#error "stats_replay 需要 HASH_TABLE_STATS=1 - stats_replay must be built with HASH_TABLE_STATS=1"
+#endif  // Execute this statement as part of the data structure implementation.
+
+enum class OpKind { INSERT, SEARCH, REMOVE };  // Execute this statement as part of the data structure implementation.
+
+struct Op {  // Execute this statement as part of the data structure implementation.
+    OpKind kind;  // Execute this statement as part of the data structure implementation.
+    int key;  // Execute this statement as part of the data structure implementation.
+    int value;  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 解析操作紀錄；格式錯誤時拋出例外並指出行號
+ * Parse an operation log; malformed lines throw with the line number
+ */  // End of block comment
+std::vector<Op> parseWorkload(std::istream& in) {  // Execute this statement as part of the data structure implementation.
+    std::vector<Op> ops;  // Execute this statement as part of the data structure implementation.
+    std::string line;  // Assign or update a variable that represents the current algorithm state.
+    size_t lineNumber = 0;  // Assign or update a variable that represents the current algorithm state.
+    while (std::getline(in, line)) {  // Repeat while the loop condition remains true.
+        ++lineNumber;  // Execute this statement as part of the data structure implementation.
+        size_t comment = line.find('#');  // Assign or update a variable that represents the current algorithm state.
+        std::istringstream fields(line.substr(0, comment));  // Execute this statement as part of the data structure implementation.
+        std::string verb;  // Assign or update a variable that represents the current algorithm state.
+        if (!(fields >> verb)) {  // 空行或純註解 - Blank or comment-only line
+            continue;  // Skip to the next loop iteration.
+        }  // Close the current block scope.
+        Op op{OpKind::SEARCH, 0, 0};  // Assign or update a variable that represents the current algorithm state.
+        bool ok = static_cast<bool>(fields >> op.key);  // Assign or update a variable that represents the current algorithm state.
+        if (verb == "insert") {  // Evaluate the condition and branch into the appropriate code path.
+            op.kind = OpKind::INSERT;  // Assign or update a variable that represents the current algorithm state.
+            ok = ok && static_cast<bool>(fields >> op.value);  // Assign or update a variable that represents the current algorithm state.
+        } else if (verb == "remove") {  // Evaluate the condition and branch into the appropriate code path.
+            op.kind = OpKind::REMOVE;  // Assign or update a variable that represents the current algorithm state.
+        } else if (verb != "search") {  // Evaluate the condition and branch into the appropriate code path.
+            ok = false;  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+        std::string extra;  // Assign or update a variable that represents the current algorithm state.
+        if (!ok || (fields >> extra)) {  // Evaluate the condition and branch into the appropriate code path.
+            throw std::invalid_argument("無法解析第 " + std::to_string(lineNumber) + " 行 Cannot parse line " +  // Throw an exception to signal an invalid argument or operation.
+                                        std::to_string(lineNumber) + ": " + line);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        ops.push_back(op);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return ops;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 固定種子的合成負載：key 取自 [0, keySpace)，讓查詢與刪除有命中也有未命中
+ * Fixed-seed synthetic workload: keys come from [0, keySpace) so searches and removals both hit and miss
+ */  // End of block comment
+std::vector<Op> makeSyntheticWorkload(long long operations, int keySpace) {  // Execute this statement as part of the data structure implementation.
+    std::mt19937 rng(12345u);  // Execute this statement as part of the data structure implementation.
+    std::uniform_int_distribution<int> keyDist(0, keySpace - 1);  // Execute this statement as part of the data structure implementation.
+    std::uniform_int_distribution<int> kindDist(0, 99);  // Execute this statement as part of the data structure implementation.
+    std::vector<Op> ops;  // Execute this statement as part of the data structure implementation.
+    ops.reserve(static_cast<size_t>(operations));  // Execute this statement as part of the data structure implementation.
+    for (long long i = 0; i < operations; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        int roll = kindDist(rng);  // Assign or update a variable that represents the current algorithm state.
+        OpKind kind = (roll < 50) ? OpKind::INSERT : (roll < 85) ? OpKind::SEARCH : OpKind::REMOVE;  // Assign or update a variable that represents the current algorithm state.
+        ops.push_back({kind, keyDist(rng), static_cast<int>(i)});  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return ops;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+// 共用介面 insert/search/remove 的表 - Tables sharing the insert/search/remove interface
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+void applyOp(Table& table, const Op& op) {  // Execute this statement as part of the data structure implementation.
+    switch (op.kind) {  // Execute this statement as part of the data structure implementation.
+        case OpKind::INSERT: table.insert(op.key, op.value); break;  // Execute this statement as part of the data structure implementation.
+        case OpKind::SEARCH: (void)table.search(op.key); break;  // Execute this statement as part of the data structure implementation.
+        case OpKind::REMOVE: table.remove(op.key); break;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+// UniversalHashTable 存字串值並以 erase 刪除 - UniversalHashTable stores string values and deletes via erase
+void applyOp(hashfunctionsunit::UniversalHashTable<>& table, const Op& op) {  // Execute this statement as part of the data structure implementation.
+    switch (op.kind) {  // Execute this statement as part of the data structure implementation.
+        case OpKind::INSERT: table.insert(op.key, std::to_string(op.value)); break;  // Execute this statement as part of the data structure implementation.
+        case OpKind::SEARCH: (void)table.search(op.key); break;  // Execute this statement as part of the data structure implementation.
+        case OpKind::REMOVE: table.erase(op.key); break;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+// CuckooHashTable 以 erase 刪除 - CuckooHashTable deletes via erase
+void applyOp(hashfunctionsunit::CuckooHashTable& table, const Op& op) {  // Execute this statement as part of the data structure implementation.
+    switch (op.kind) {  // Execute this statement as part of the data structure implementation.
+        case OpKind::INSERT: table.insert(op.key, op.value); break;  // Execute this statement as part of the data structure implementation.
+        case OpKind::SEARCH: (void)table.search(op.key); break;  // Execute this statement as part of the data structure implementation.
+        case OpKind::REMOVE: table.erase(op.key); break;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+HashTableStats replay(Table& table, const std::vector<Op>& ops) {  // Execute this statement as part of the data structure implementation.
+    for (const Op& op : ops) {  // Iterate over a range/collection to process each item in sequence.
+        applyOp(table, op);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    return table.stats();  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    std::string path = (argc > 1) ? argv[1] : "-";  // Assign or update a variable that represents the current algorithm state.
+    long long operations = (argc > 2) ? std::stoll(argv[2]) : 200000LL;  // Assign or update a variable that represents the current algorithm state.
+    int keySpace = (argc > 3) ? std::stoi(argv[3]) : 50000;  // Assign or update a variable that represents the current algorithm state.
+
+    std::vector<Op> ops;  // Execute this statement as part of the data structure implementation.
+    try {  // Execute this statement as part of the data structure implementation.
+        if (path == "-") {  // Evaluate the condition and branch into the appropriate code path.
+            ops = makeSyntheticWorkload(operations, keySpace);  // Assign or update a variable that represents the current algorithm state.
+        } else {  // Handle the alternative branch when the condition is false.
+            std::ifstream in(path);  // Execute this statement as part of the data structure implementation.
+            if (!in) {  // Evaluate the condition and branch into the appropriate code path.
+                std::cerr << "無法開啟檔案 Cannot open file: " << path << std::endl;  // Execute this statement as part of the data structure implementation.
+                return 1;  // Return the computed result to the caller.
+            }  // Close the current block scope.
+            ops = parseWorkload(in);  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+    } catch (const std::exception& e) {  // Execute this statement as part of the data structure implementation.
+        std::cerr << e.what() << std::endl;  // Execute this statement as part of the data structure implementation.
+        return 1;  // Return the computed result to the caller.
+    }  // Close the current block scope.
+
+    size_t counts[3] = {0, 0, 0};  // Assign or update a variable that represents the current algorithm state.
+    for (const Op& op : ops) {  // Iterate over a range/collection to process each item in sequence.
+        ++counts[static_cast<int>(op.kind)];  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    // 每張表都從預設的小容量開始，讓重建行為也被記錄 - Every table starts at its small default capacity so rebuilds are recorded too
+    HashTable<int, int> hashTable;  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<int, int> chained;  // Execute this statement as part of the data structure implementation.
+    FlatChainedHashTable<int, int> flat;  // Execute this statement as part of the data structure implementation.
+    OpenAddressingHashTable<int, int> linear(16, ProbeMethod::LINEAR);  // Advance or track the probing sequence used by open addressing.
+    SwissTable<int, int> swiss;  // Execute this statement as part of the data structure implementation.
+    hashfunctionsunit::UniversalHashTable universal(16, 12345u);  // Execute this statement as part of the data structure implementation.
+    hashfunctionsunit::CuckooHashTable cuckoo(16, 12345u);  // 探測 = 檢查過的桶與 stash 項目 - Probes = buckets and stash entries inspected
+
+    std::ostream& out = std::cout;  // Execute this statement as part of the data structure implementation.
+    out << "{\n";  // Execute this statement as part of the data structure implementation.
+    out << "  \"workload\": \"" << (path == "-" ? "synthetic" : path) << "\",\n";  // Execute this statement as part of the data structure implementation.
+    out << "  \"operations\": {\"insert\": " << counts[0] << ", \"search\": " << counts[1]  // Execute this statement as part of the data structure implementation.
+        << ", \"remove\": " << counts[2] << "},\n";  // Execute this statement as part of the data structure implementation.
+    out << "  \"tables\": [\n";  // Execute this statement as part of the data structure implementation.
+    writeStatsJson(out, "HashTable", replay(hashTable, ops), "    ");  // Execute this statement as part of the data structure implementation.
+    out << ",\n";  // Execute this statement as part of the data structure implementation.
+    writeStatsJson(out, "ChainedHashTable", replay(chained, ops), "    ");  // Execute this statement as part of the data structure implementation.
+    out << ",\n";  // Execute this statement as part of the data structure implementation.
+    writeStatsJson(out, "FlatChainedHashTable", replay(flat, ops), "    ");  // Execute this statement as part of the data structure implementation.
+    out << ",\n";  // Execute this statement as part of the data structure implementation.
+    writeStatsJson(out, "OpenAddressingHashTable(linear)", replay(linear, ops), "    ");  // Advance or track the probing sequence used by open addressing.
+    out << ",\n";  // Execute this statement as part of the data structure implementation.
+    writeStatsJson(out, "SwissTable", replay(swiss, ops), "    ");  // Execute this statement as part of the data structure implementation.
+    out << ",\n";  // Execute this statement as part of the data structure implementation.
+    writeStatsJson(out, "UniversalHashTable", replay(universal, ops), "    ");  // Execute this statement as part of the data structure implementation.
+    out << ",\n";  // Execute this statement as part of the data structure implementation.
+    writeStatsJson(out, "CuckooHashTable", replay(cuckoo, ops), "    ");  // Execute this statement as part of the data structure implementation.
+    out << "\n  ]\n}\n";  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -0,0 +1,153 @@
+/** Doc block start
+ * Swiss Table 效能比較 / Swiss table throughput comparison
+ *(blank line)
+ * 在固定容量下以不同負載因子（0.5 ~ 0.875）量測命中、未命中、插入、刪除的平均耗時，
+ * 對照 OpenAddressingHashTable、ChainedHashTable、HashTable 與 std::unordered_map。
+ * Measures hit, miss, insert and erase cost at load factors 0.5 .. 0.875 for a fixed capacity,
+ * comparing against OpenAddressingHashTable, ChainedHashTable, HashTable and std::unordered_map.
+ *(blank line)
+ * 用法 Usage: ./swiss_table_benchmark [log2(capacity)=20]
+ */  // End of block comment
+
+#include <chrono>  // Execute this statement as part of the data structure implementation.
+#include <cstdint>  // Execute this statement as part of the data structure implementation.
+#include <iomanip>  // Execute this statement as part of the data structure implementation.
+#include <iostream>  // Execute this statement as part of the data structure implementation.
+#include <string>  // Execute this statement as part of the data structure implementation.
+#include <unordered_map>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
+#include "Chaining.hpp"  // Execute this statement as part of the data structure implementation.
+#include "OpenAddressing.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SwissTable.hpp"  // Execute this statement as part of the data structure implementation.
+#include "HashTable.hpp"  // 來自 01-basic-hash-table - From 01-basic-hash-table
+
+using Clock = std::chrono::steady_clock;  // Assign or update a variable that represents the current algorithm state.
+
+// ========== 統一介面 Uniform Adapters ==========
+
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+void put(Table& t, int key, int value) { t.insert(key, value); }  // Execute this statement as part of the data structure implementation.
+
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+bool has(const Table& t, int key) { return t.search(key).has_value(); }  // Return the computed result to the caller.
+
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+bool erase(Table& t, int key) { return t.remove(key); }  // Return the computed result to the caller.
+
+void put(std::unordered_map<int, int>& t, int key, int value) { t[key] = value; }  // Execute this statement as part of the data structure implementation.
+bool has(const std::unordered_map<int, int>& t, int key) { return t.find(key) != t.end(); }  // Return the computed result to the caller.
+bool erase(std::unordered_map<int, int>& t, int key) { return t.erase(key) == 1; }  // Return the computed result to the caller.
+
+/** Doc block start
+ * 一列量測結果（每項操作的平均奈秒數）/ One row of results (average nanoseconds per operation)
+ */  // End of block comment
+struct Row {  // Execute this statement as part of the data structure implementation.
+    double insertNs;  // Execute this statement as part of the data structure implementation.
+    double hitNs;  // Execute this statement as part of the data structure implementation.
+    double missNs;  // Execute this statement as part of the data structure implementation.
+    double eraseNs;  // Execute this statement as part of the data structure implementation.
+};  // Execute this statement as part of the data structure implementation.
+
+/** Doc block start
+ * 32 位元雙射混合函數（murmur3 fmix32）：產生不重複且低位元均勻的 key
+ * Bijective 32-bit mixer (murmur3 fmix32): unique keys with well-spread low bits
+ */  // End of block comment
+uint32_t scrambleKey(uint32_t x) {  // Compute a hash-based index so keys map into the table's storage.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    x *= 0x85ebca6bu;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 13;  // Execute this statement as part of the data structure implementation.
+    x *= 0xc2b2ae35u;  // Execute this statement as part of the data structure implementation.
+    x ^= x >> 16;  // Execute this statement as part of the data structure implementation.
+    return x;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+double nsPerOp(Clock::time_point start, size_t ops) {  // Execute this statement as part of the data structure implementation.
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(ops);  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 對一個已建立好的空表執行四種量測 / Run the four measurements on a freshly built empty table
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+Row measure(Table& table, const std::vector<int>& keys, const std::vector<int>& misses, long long& checksum) {  // Execute this statement as part of the data structure implementation.
+    Row row{};  // Assign or update a variable that represents the current algorithm state.
+    Clock::time_point start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (size_t i = 0; i < keys.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        put(table, keys[i], static_cast<int>(i));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    row.insertNs = nsPerOp(start, keys.size());  // Assign or update a variable that represents the current algorithm state.
+
+    start = Clock::now();  // 命中查詢以不同順序進行，避免沿用插入時的快取 - Hits in a different order than inserts
+    for (size_t i = keys.size(); i-- > 0;) {  // Iterate over a range/collection to process each item in sequence.
+        checksum += has(table, keys[i]);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    row.hitNs = nsPerOp(start, keys.size());  // Assign or update a variable that represents the current algorithm state.
+
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (int key : misses) {  // Iterate over a range/collection to process each item in sequence.
+        checksum += has(table, key);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    row.missNs = nsPerOp(start, misses.size());  // Assign or update a variable that represents the current algorithm state.
+
+    start = Clock::now();  // Assign or update a variable that represents the current algorithm state.
+    for (int key : keys) {  // Iterate over a range/collection to process each item in sequence.
+        checksum += erase(table, key);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    row.eraseNs = nsPerOp(start, keys.size());  // Assign or update a variable that represents the current algorithm state.
+    return row;  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+void printRow(const std::string& name, const Row& row) {  // Execute this statement as part of the data structure implementation.
+    std::cout << "  " << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(1)  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << row.insertNs << std::setw(10) << row.hitNs  // Execute this statement as part of the data structure implementation.
+              << std::setw(10) << row.missNs << std::setw(10) << row.eraseNs << "\n";  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+int main(int argc, char** argv) {  // Execute this statement as part of the data structure implementation.
+    int logCapacity = (argc > 1) ? std::stoi(argv[1]) : 20;  // 預設 2^20 個槽位 - Default 2^20 slots
+    size_t capacity = static_cast<size_t>(1) << logCapacity;  // Assign or update a variable that represents the current algorithm state.
+    const double loads[] = {0.5, 0.625, 0.75, 0.875};  // Assign or update a variable that represents the current algorithm state.
+    long long checksum = 0;  // Assign or update a variable that represents the current algorithm state.
+
+    std::cout << "capacity=" << capacity << " (ns/op)\n";  // Execute this statement as part of the data structure implementation.
+    for (double load : loads) {  // Iterate over a range/collection to process each item in sequence.
+        size_t n = static_cast<size_t>(load * static_cast<double>(capacity));  // Assign or update a variable that represents the current algorithm state.
+        std::vector<int> keys(n);  // Assign or update a variable that represents the current algorithm state.
+        std::vector<int> misses(n);  // Assign or update a variable that represents the current algorithm state.
+        for (size_t i = 0; i < n; ++i) {  // 命中與未命中的 key 來自不相交的輸入範圍 - Hits and misses come from disjoint input ranges
+            keys[i] = static_cast<int>(scrambleKey(static_cast<uint32_t>(i)));  // Assign or update a variable that represents the current algorithm state.
+            misses[i] = static_cast<int>(scrambleKey(static_cast<uint32_t>(i + n)));  // Assign or update a variable that represents the current algorithm state.
+        }  // Close the current block scope.
+
+        std::cout << "\nload=" << std::setprecision(3) << load << " n=" << n << "\n";  // Execute this statement as part of the data structure implementation.
+        std::cout << "  " << std::left << std::setw(26) << "table" << std::right  // Execute this statement as part of the data structure implementation.
+                  << std::setw(10) << "insert" << std::setw(10) << "hit" << std::setw(10) << "miss" << std::setw(10) << "erase" << "\n";  // Execute this statement as part of the data structure implementation.
+        {  // Execute this statement as part of the data structure implementation.
+            SwissTable<int, int> t(capacity);  // Execute this statement as part of the data structure implementation.
+            printRow("SwissTable", measure(t, keys, misses, checksum));  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        if (load < 0.7) {  // OpenAddressingHashTable 在 0.7 會自行擴容，無法維持更高負載 - Grows itself at 0.7, so higher loads are not reachable
+            OpenAddressingHashTable<int, int> t(capacity, ProbeMethod::LINEAR);  // Advance or track the probing sequence used by open addressing.
+            printRow("OpenAddressing(linear)", measure(t, keys, misses, checksum));  // Execute this statement as part of the data structure implementation.
+        } else {  // Handle the alternative branch when the condition is false.
+            std::cout << "  " << std::left << std::setw(26) << "OpenAddressing(linear)" << "  (n/a: grows at 0.7)\n" << std::right;  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        {  // Execute this statement as part of the data structure implementation.
+            ChainedHashTable<int, int> t(capacity);  // Execute this statement as part of the data structure implementation.
+            printRow("ChainedHashTable", measure(t, keys, misses, checksum));  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        {  // HashTable 超過 0.75 會自行擴容 - HashTable grows itself past 0.75
+            HashTable<int, int> t(capacity);  // Execute this statement as part of the data structure implementation.
+            printRow("HashTable", measure(t, keys, misses, checksum));  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        {  // Execute this statement as part of the data structure implementation.
+            std::unordered_map<int, int> t;  // Execute this statement as part of the data structure implementation.
+            t.max_load_factor(1.0f);  // Execute this statement as part of the data structure implementation.
+            t.rehash(capacity);  // 與其他表相同的桶數 - Same bucket count as the other tables
+            printRow("std::unordered_map", measure(t, keys, misses, checksum));  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+
+    std::cout << "\nchecksum=" << checksum << "\n";  // Execute this statement as part of the data structure implementation.
+    return 0;  // Return the computed result to the caller.
+}  // Close the current block scope.
@@ -7,9 +7,17 @@
 #include <iostream>  // Execute this statement as part of the data structure implementation.
 #include <string>  // Execute this statement as part of the data structure implementation.
 #include <cassert>  // Execute this statement as part of the data structure implementation.
+#include <cstdio>  // Execute this statement as part of the data structure implementation.
 #include <stdexcept>  // Execute this statement as part of the data structure implementation.
+#include <sstream>  // Execute this statement as part of the data structure implementation.
 #include "Chaining.hpp"  // Execute this statement as part of the data structure implementation.
+#include "FlatChaining.hpp"  // Execute this statement as part of the data structure implementation.
 #include "OpenAddressing.hpp"  // Execute this statement as part of the data structure implementation.
+#include "SwissTable.hpp"  // Execute this statement as part of the data structure implementation.
+#include "Snapshot.hpp"  // 01-basic-hash-table 的快照格式 - Snapshot format from 01-basic-hash-table
+#include "HashTable.hpp"  // 01-basic-hash-table 的漸進式擴容雜湊表 - Incrementally rehashing table from 01-basic-hash-table
+#include <unordered_map>  // Execute this statement as part of the data structure implementation.
+#include <vector>  // Execute this statement as part of the data structure implementation.
 
 // 簡單的測試框架 - Simple testing framework
 #define TEST(name) void name()  // Execute this statement as part of the data structure implementation.
@@ -28,6 +36,24 @@
 int passed = 0;  // Assign or update a variable that represents the current algorithm state.
 int failed = 0;  // Assign or update a variable that represents the current algorithm state.
 
+// 計數雜湊呼叫次數的 key，用來確認每次查詢只雜湊一次 - Key that counts hash calls, to check each lookup hashes once
+struct CountedKey {  // Execute this statement as part of the data structure implementation.
+    int value = 0;  // Assign or update a variable that represents the current algorithm state.
+    bool operator==(const CountedKey& other) const { return value == other.value; }  // Return the computed result to the caller.
+};  // Execute this statement as part of the data structure implementation.
+
+size_t g_countedKeyHashes = 0;  // CountedKey 被雜湊的次數 - Times a CountedKey was hashed
+
+namespace std {  // Execute this statement as part of the data structure implementation.
+template <>  // Execute this statement as part of the data structure implementation.
+struct hash<CountedKey> {  // Execute this statement as part of the data structure implementation.
+    size_t operator()(const CountedKey& key) const {  // Compute a hash-based index so keys map into the table's storage.
+        ++g_countedKeyHashes;  // Execute this statement as part of the data structure implementation.
+        return std::hash<int>{}(key.value);  // Return the computed result to the caller.
+    }  // Close the current block scope.
+};  // Execute this statement as part of the data structure implementation.
+}  // namespace std
+
 // ========== 鏈結法測試 Chaining Tests ==========
 
 TEST(test_chaining_create_empty) {  // Execute this statement as part of the data structure implementation.
@@ -122,6 +148,96 @@ TEST(test_chaining_clear) {  // Execute this statement as part of the data struc
     assert(ht.getTotalProbes() == 0);  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
+// ========== 扁平節點鏈結法測試 Flat Chaining Tests ==========
+
+TEST(test_flat_chaining_insert_search_update) {  // Execute this statement as part of the data structure implementation.
+    FlatChainedHashTable<std::string, int> ht;  // Execute this statement as part of the data structure implementation.
+    assert(ht.empty());  // Execute this statement as part of the data structure implementation.
+    assert(ht.capacity() == 16);  // Execute this statement as part of the data structure implementation.
+    ht.insert("apple", 100);  // Execute this statement as part of the data structure implementation.
+    ht.insert("banana", 200);  // Execute this statement as part of the data structure implementation.
+    ht.insert("apple", 150);  // 更新現有鍵 - Update existing key
+
+    assert(ht.size() == 2);  // Execute this statement as part of the data structure implementation.
+    assert(ht.nodeCount() == 2);  // 更新不配置新節點 - Updates do not take a new node
+    assert(ht.search("apple").value() == 150);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search("banana").value() == 200);  // Execute this statement as part of the data structure implementation.
+    assert(!ht.contains("cherry"));  // Execute this statement as part of the data structure implementation.
+
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        FlatChainedHashTable<std::string, int> bad(0);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::invalid_argument&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_flat_chaining_remove_reuses_free_list) {  // Execute this statement as part of the data structure implementation.
+    FlatChainedHashTable<int, int> ht(1);  // 單一桶：所有節點在同一條鏈 - One bucket: every node on one chain
+    for (int i = 0; i < 8; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(i, i * 10);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.getMaxChainLength() == 8);  // Execute this statement as part of the data structure implementation.
+
+    // 刪除鏈頭、鏈中與鏈尾 - Remove the head, a middle node and the tail
+    assert(ht.remove(7));  // Execute this statement as part of the data structure implementation.
+    assert(ht.remove(3));  // Execute this statement as part of the data structure implementation.
+    assert(ht.remove(0));  // Execute this statement as part of the data structure implementation.
+    assert(!ht.remove(3));  // Execute this statement as part of the data structure implementation.
+    assert(ht.size() == 5);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 8; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        bool removed = (i == 0 || i == 3 || i == 7);  // Assign or update a variable that represents the current algorithm state.
+        assert(ht.contains(i) == !removed);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    // 新插入先用空閒節點，陣列不會變長 - New inserts take free nodes first, so the array does not grow
+    ht.insert(100, 1);  // Execute this statement as part of the data structure implementation.
+    ht.insert(101, 2);  // Execute this statement as part of the data structure implementation.
+    ht.insert(102, 3);  // Execute this statement as part of the data structure implementation.
+    assert(ht.nodeCount() == 8);  // Execute this statement as part of the data structure implementation.
+    ht.insert(103, 4);  // Execute this statement as part of the data structure implementation.
+    assert(ht.nodeCount() == 9);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search(101).value() == 2);  // Execute this statement as part of the data structure implementation.
+    assert(ht.getAverageChainLength() == 9.0);  // Execute this statement as part of the data structure implementation.
+
+    ht.clear();  // Execute this statement as part of the data structure implementation.
+    assert(ht.empty() && ht.nodeCount() == 0 && ht.getTotalProbes() == 0);  // Advance or track the probing sequence used by open addressing.
+    assert(!ht.contains(101));  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_flat_chaining_matches_chained) {  // Execute this statement as part of the data structure implementation.
+    // 與 ChainedHashTable 及 std::unordered_map 做差異比對 / Differential check against ChainedHashTable and std::unordered_map
+    HashSeed seed = HashSeed::random();  // 同一個種子才會有相同的桶分布 - Same seed, same bucket layout
+    FlatChainedHashTable<int, int> flat(64, seed);  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<int, int> chained(64, seed);  // Execute this statement as part of the data structure implementation.
+    std::unordered_map<int, int> ref;  // 參考實作 - Reference implementation
+    unsigned state = 777u;  // Assign or update a variable that represents the current algorithm state.
+    for (int step = 0; step < 20000; ++step) {  // 隨機插入/刪除/查詢 - Random insert/remove/search
+        state = state * 1664525u + 1013904223u;  // Assign or update a variable that represents the current algorithm state.
+        int key = static_cast<int>((state >> 8) % 1024);  // Assign or update a variable that represents the current algorithm state.
+        int op = static_cast<int>(state >> 29);  // Assign or update a variable that represents the current algorithm state.
+        if (op < 4) {  // Evaluate the condition and branch into the appropriate code path.
+            flat.insert(key, step);  // Execute this statement as part of the data structure implementation.
+            chained.insert(key, step);  // Execute this statement as part of the data structure implementation.
+            ref[key] = step;  // Execute this statement as part of the data structure implementation.
+        } else if (op < 7) {  // Evaluate the condition and branch into the appropriate code path.
+            bool expected = (ref.erase(key) == 1);  // Assign or update a variable that represents the current algorithm state.
+            assert(flat.remove(key) == expected);  // Execute this statement as part of the data structure implementation.
+            assert(chained.remove(key) == expected);  // Execute this statement as part of the data structure implementation.
+        } else {  // Handle the alternative branch when the condition is false.
+            auto it = ref.find(key);  // Assign or update a variable that represents the current algorithm state.
+            auto found = flat.search(key);  // Assign or update a variable that represents the current algorithm state.
+            assert(found.has_value() == (it != ref.end()));  // Execute this statement as part of the data structure implementation.
+            assert(!found.has_value() || found.value() == it->second);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        assert(flat.size() == ref.size());  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(flat.getMaxChainLength() == chained.getMaxChainLength());  // 同樣的雜湊，同樣的鏈長 - Same hash, same chain lengths
+    assert(flat.getAverageChainLength() == chained.getAverageChainLength());  // Execute this statement as part of the data structure implementation.
+    assert(flat.nodeCount() <= 1024);  // 空閒串列讓陣列不超過 key 的範圍 - The free list bounds the array by the key range
+}  // Close the current block scope.
+
 // ========== 開放定址法 - 線性探測測試 Open Addressing - Linear Probing Tests ==========
 
 TEST(test_linear_create_empty) {  // Execute this statement as part of the data structure implementation.
@@ -190,23 +306,42 @@ TEST(test_linear_load_factor) {  // Execute this statement as part of the data s
     assert(lf == 0.3);  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
-TEST(test_linear_table_full) {  // Execute this statement as part of the data structure implementation.
+TEST(test_linear_auto_resize) {  // Execute this statement as part of the data structure implementation.
     OpenAddressingHashTable<int, int> ht(5, ProbeMethod::LINEAR);  // Execute this statement as part of the data structure implementation.
 
-    // 插入直到接近負載因子限制（0.7） / Insert 直到接近 load factor 限制 (0.7)
-    ht.insert(0, 0);  // Execute this statement as part of the data structure implementation.
-    ht.insert(1, 1);  // Execute this statement as part of the data structure implementation.
-    ht.insert(2, 2);  // Execute this statement as part of the data structure implementation.
+    // 超過負載因子限制（0.7）時應自動擴容而非拋出例外 / Growing past the 0.7 limit should resize instead of throwing
+    for (int i = 0; i < 100; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(i, i * 2);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.size() == 100);  // Execute this statement as part of the data structure implementation.
+    assert(ht.capacity() >= 143);  // 100 / 0.7
+    assert(ht.loadFactor() <= 0.7);  // Execute this statement as part of the data structure implementation.
+    assert(ht.getRehashCount() >= 1);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    assert(ht.getPurgeCount() == 0);  // 沒有刪除就不需要清除墓碑 - No deletes, no purges
+    for (int i = 0; i < 100; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(ht.search(i).value() == i * 2);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
 
-    // 第4次插入應該會超過負載因子限制 / 第4次 insert should 會超過 load factor 限制
-    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
-    try {  // Execute this statement as part of the data structure implementation.
-        ht.insert(3, 3);  // Execute this statement as part of the data structure implementation.
-        ht.insert(4, 4);  // 這應該拋出例外
-    } catch (const std::runtime_error&) {  // Execute this statement as part of the data structure implementation.
-        threw = true;  // Assign or update a variable that represents the current algorithm state.
+TEST(test_tombstone_purge_under_churn) {  // Handle tombstones so deletions do not break the probing/search sequence.
+    OpenAddressingHashTable<int, int> ht(64, ProbeMethod::LINEAR);  // Execute this statement as part of the data structure implementation.
+
+    // 固定大小 8 的滑動視窗：插入 i、刪除 i-8，墓碑會不斷累積 / Steady-size window of 8: tombstones keep piling up
+    for (int i = 0; i < 10000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(i, i);  // Execute this statement as part of the data structure implementation.
+        if (i >= 8) {  // Evaluate the condition and branch into the appropriate code path.
+            assert(ht.remove(i - 8));  // Handle tombstones so deletions do not break the probing/search sequence.
+        }  // Close the current block scope.
     }  // Close the current block scope.
-    assert(threw);  // Execute this statement as part of the data structure implementation.
+    assert(ht.size() == 8);  // Execute this statement as part of the data structure implementation.
+    assert(ht.capacity() == 64);  // 墓碑以相同容量清除，不會擴容 - Purged at the same capacity, never grown
+    assert(ht.getPurgeCount() > 0);  // Handle tombstones so deletions do not break the probing/search sequence.
+    assert(ht.getPurgeCount() == ht.getRehashCount());  // Rehash entries into a larger table to keep operations near O(1) on average.
+    assert(ht.loadFactor() <= 0.7);  // Execute this statement as part of the data structure implementation.
+    for (int i = 10000 - 8; i < 10000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(ht.search(i).value() == i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(!ht.contains(0));  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
 // ========== 開放定址法 - 二次探測測試 Open Addressing - Quadratic Probing Tests ==========
@@ -278,6 +413,138 @@ TEST(test_double_hash_collisions) {  // Compute a hash-based index so keys map i
     assert(ht.search(20).value() == 300);  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
+/** Doc block start
+ * 每插入三個隨機 key 刪一個：二次探測（2 的冪次容量）與雙重雜湊（非 2 的冪次容量）在負載上限以下
+ * 找不到空位時必須擴容，而不是丟出「表已滿」
+ * Delete one key per three random inserts: quadratic probing (power-of-two capacity) and double
+ * hashing (non-power-of-two capacity) must grow, not throw "table is full", when the probe
+ * sequence finds no free slot below the load limit
+ */  // End of block comment
+TEST(test_quadratic_and_double_hash_grow_under_churn) {  // Advance or track the probing sequence used by open addressing.
+    const std::pair<ProbeMethod, size_t> configs[] = {{ProbeMethod::QUADRATIC, 16}, {ProbeMethod::DOUBLE_HASH, 10}};  // Assign or update a variable that represents the current algorithm state.
+    for (const auto& config : configs) {  // Iterate over a range/collection to process each item in sequence.
+        for (unsigned seed = 1; seed <= 300; ++seed) {  // Iterate over a range/collection to process each item in sequence.
+            OpenAddressingHashTable<int, int> ht(config.second, config.first);  // Execute this statement as part of the data structure implementation.
+            std::unordered_map<int, int> ref;  // 參考實作 - Reference implementation
+            std::vector<int> inserted;  // Assign or update a variable that represents the current algorithm state.
+            unsigned state = seed;  // Assign or update a variable that represents the current algorithm state.
+            for (int step = 0; step < 120; ++step) {  // Iterate over a range/collection to process each item in sequence.
+                state = state * 1664525u + 1013904223u;  // Assign or update a variable that represents the current algorithm state.
+                if (step % 4 == 3) {  // Evaluate the condition and branch into the appropriate code path.
+                    int victim = inserted[state % inserted.size()];  // Assign or update a variable that represents the current algorithm state.
+                    assert(ht.remove(victim) == (ref.erase(victim) == 1));  // Execute this statement as part of the data structure implementation.
+                } else {  // Handle the alternative branch when the condition is false.
+                    int key = static_cast<int>(state);  // Assign or update a variable that represents the current algorithm state.
+                    ht.insert(key, step);  // 不可丟出例外 - Must not throw
+                    ref[key] = step;  // Execute this statement as part of the data structure implementation.
+                    inserted.push_back(key);  // Execute this statement as part of the data structure implementation.
+                }  // Close the current block scope.
+                assert(ht.size() == ref.size());  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            for (const auto& entry : ref) {  // Iterate over a range/collection to process each item in sequence.
+                assert(ht.search(entry.first) == std::optional<int>(entry.second));  // Execute this statement as part of the data structure implementation.
+            }  // Close the current block scope.
+            assert(ht.loadFactor() <= 0.7);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+// ========== 開放定址法 - Robin Hood 測試 Open Addressing - Robin Hood Tests ==========
+
+TEST(test_robin_hood_insert_search_update) {  // Execute this statement as part of the data structure implementation.
+    OpenAddressingHashTable<std::string, int> ht(16, ProbeMethod::ROBIN_HOOD);  // Execute this statement as part of the data structure implementation.
+    ht.insert("apple", 100);  // Execute this statement as part of the data structure implementation.
+    ht.insert("banana", 200);  // Execute this statement as part of the data structure implementation.
+    ht.insert("apple", 150);  // 更新現有鍵 - Update existing key
+
+    assert(ht.getProbeMethod() == ProbeMethod::ROBIN_HOOD);  // Advance or track the probing sequence used by open addressing.
+    assert(ht.size() == 2);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search("apple").value() == 150);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search("banana").value() == 200);  // Execute this statement as part of the data structure implementation.
+    assert(!ht.search("cherry").has_value());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_robin_hood_backward_shift_leaves_no_tombstones) {  // Handle tombstones so deletions do not break the probing/search sequence.
+    OpenAddressingHashTable<int, int> ht(16, ProbeMethod::ROBIN_HOOD);  // Execute this statement as part of the data structure implementation.
+    // 同一起始位置的 key 形成一段連續群集 - Keys with the same home slot form one contiguous cluster
+    ht.insert(0, 0);  // Execute this statement as part of the data structure implementation.
+    ht.insert(16, 1);  // Execute this statement as part of the data structure implementation.
+    ht.insert(32, 2);  // Execute this statement as part of the data structure implementation.
+    ht.insert(1, 3);  // 起始位置 1 被佔用，會被往後推 - Home slot 1 is taken, gets pushed back
+
+    assert(ht.remove(16));  // 從群集中間刪除 - Remove from the middle of the cluster
+    assert(ht.getDeletedCount() == 0);  // Handle tombstones so deletions do not break the probing/search sequence.
+    size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+    assert(ht.search(32, probes).value() == 2);  // Execute this statement as part of the data structure implementation.
+    assert(probes == 2);  // 平移後 32 距起始位置只剩 1 格 - After the shift 32 sits one slot from home
+    assert(ht.search(1).value() == 3);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search(0).value() == 0);  // Execute this statement as part of the data structure implementation.
+    assert(!ht.contains(16));  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_robin_hood_miss_stops_early) {  // Advance or track the probing sequence used by open addressing.
+    OpenAddressingHashTable<int, int> ht(64, ProbeMethod::ROBIN_HOOD);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 8; ++i) {  // 槽位 0..7 各放一個起始位置相符的 key - One home-slot key in each of slots 0..7
+        ht.insert(i, i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+    assert(!ht.search(64, probes).has_value());  // 起始位置 0，但槽位 0 的元素距離為 0 - Home slot 0, resident there has dist 0
+    assert(probes == 2);  // 第二格的距離 0 < 1，提早結束 - Slot 1's dist 0 < 1: stop early
+}  // Close the current block scope.
+
+TEST(test_robin_hood_matches_unordered_map) {  // Execute this statement as part of the data structure implementation.
+    OpenAddressingHashTable<int, int> ht(16, ProbeMethod::ROBIN_HOOD);  // Execute this statement as part of the data structure implementation.
+    ht.setMaxLoadFactor(0.9);  // Robin Hood 可承受較高負載 - Robin Hood tolerates higher load
+    std::unordered_map<int, int> ref;  // 參考實作 - Reference implementation
+    unsigned state = 777u;  // Assign or update a variable that represents the current algorithm state.
+    for (int step = 0; step < 20000; ++step) {  // Iterate over a range/collection to process each item in sequence.
+        state = state * 1664525u + 1013904223u;  // Assign or update a variable that represents the current algorithm state.
+        int key = static_cast<int>((state >> 8) % 1024);  // Assign or update a variable that represents the current algorithm state.
+        int op = static_cast<int>(state >> 29);  // Assign or update a variable that represents the current algorithm state.
+        if (op < 4) {  // Evaluate the condition and branch into the appropriate code path.
+            ht.insert(key, step);  // Execute this statement as part of the data structure implementation.
+            ref[key] = step;  // Execute this statement as part of the data structure implementation.
+        } else if (op < 7) {  // Evaluate the condition and branch into the appropriate code path.
+            assert(ht.remove(key) == (ref.erase(key) == 1));  // Execute this statement as part of the data structure implementation.
+        } else {  // Handle the alternative branch when the condition is false.
+            auto it = ref.find(key);  // Assign or update a variable that represents the current algorithm state.
+            auto found = ht.search(key);  // Assign or update a variable that represents the current algorithm state.
+            assert(found.has_value() == (it != ref.end()));  // Execute this statement as part of the data structure implementation.
+            assert(!found.has_value() || found.value() == it->second);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        assert(ht.size() == ref.size());  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.getDeletedCount() == 0);  // Handle tombstones so deletions do not break the probing/search sequence.
+    assert(ht.loadFactor() <= 0.9);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_probe_histogram_tracks_total_probes) {  // Advance or track the probing sequence used by open addressing.
+    OpenAddressingHashTable<int, int> ht(128, ProbeMethod::LINEAR);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 50; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(i * 7, i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    size_t inserts = 0;  // Assign or update a variable that represents the current algorithm state.
+    size_t weighted = 0;  // Assign or update a variable that represents the current algorithm state.
+    const auto& histogram = ht.getProbeHistogram();  // Advance or track the probing sequence used by open addressing.
+    for (size_t p = 0; p < histogram.size(); ++p) {  // Iterate over a range/collection to process each item in sequence.
+        inserts += histogram[p];  // Execute this statement as part of the data structure implementation.
+        weighted += histogram[p] * p;  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(inserts == 50);  // Execute this statement as part of the data structure implementation.
+    assert(weighted == ht.getTotalProbes());  // 分佈與總數一致 - Distribution agrees with the total
+
+    ht.resetProbeCount();  // Advance or track the probing sequence used by open addressing.
+    assert(ht.getProbeHistogram().empty());  // Advance or track the probing sequence used by open addressing.
+
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        ht.setMaxLoadFactor(1.0);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::invalid_argument&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
 // ========== 通用測試 General Tests ==========
 
 TEST(test_open_addressing_clear) {  // Execute this statement as part of the data structure implementation.
@@ -331,6 +598,557 @@ TEST(test_int_keys_open_addressing) {  // Execute this statement as part of the
     assert(ht.search(3).value() == "three");  // Execute this statement as part of the data structure implementation.
 }  // Close the current block scope.
 
+TEST(test_chaining_batch_operations) {  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<int, int> ht(8);  // Execute this statement as part of the data structure implementation.
+    std::vector<int> keys;  // Execute this statement as part of the data structure implementation.
+    std::vector<int> values;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 500; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        keys.push_back(i * 3);  // Execute this statement as part of the data structure implementation.
+        values.push_back(i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    ht.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+    assert(ht.size() == 500);  // Execute this statement as part of the data structure implementation.
+    assert(ht.capacity() == 500);  // 一次 reserve 到元素數 - Reserved once to the element count
+    assert(ht.loadFactor() <= 1.0);  // Execute this statement as part of the data structure implementation.
+
+    // 命中與未命中交錯，長度不是 BATCH_GROUP 的倍數 - Mixed hits and misses; length not a multiple of BATCH_GROUP
+    std::vector<int> queries;  // Execute this statement as part of the data structure implementation.
+    for (int q = 0; q < 101; ++q) {  // Iterate over a range/collection to process each item in sequence.
+        queries.push_back(q * 5);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::optional<int>> out;  // Execute this statement as part of the data structure implementation.
+    ht.searchBatch(queries, out);  // Execute this statement as part of the data structure implementation.
+    assert(out.size() == queries.size());  // Execute this statement as part of the data structure implementation.
+    for (size_t q = 0; q < queries.size(); ++q) {  // Iterate over a range/collection to process each item in sequence.
+        assert(out[q] == ht.search(queries[q]));  // 與逐一查詢一致 - Matches one-by-one search
+        assert(out[q].has_value() == (queries[q] % 3 == 0));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    ht.insertBatch({0, 9999}, {-1, -2});  // 更新既有 key 並新增一個 - Update one key and add another
+    assert(ht.size() == 501);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search(0).value() == -1);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search(9999).value() == -2);  // Execute this statement as part of the data structure implementation.
+
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        ht.insertBatch({1, 2}, {1});  // Execute this statement as part of the data structure implementation.
+    } catch (const std::invalid_argument&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+
+    // 負數 key 走批次雜湊的符號擴展 - Negative keys exercise the batch hash's sign extension
+    ht.insertBatch({-1, -300}, {1, 300});  // Execute this statement as part of the data structure implementation.
+    ht.searchBatch({-1, -300, -2}, out);  // Execute this statement as part of the data structure implementation.
+    assert(out[0].value() == 1 && out[1].value() == 300 && !out[2].has_value());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_chaining_batch_string_keys) {  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<std::string, int> ht(64);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 400; ++i) {  // 長度 5..~50 不等的 key - Keys of varying length, 5 to ~50 bytes
+        ht.insert(std::string(static_cast<size_t>(i % 46), 'p') + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::string> queries;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 450; i += 7) {  // 混入未命中 - Includes misses
+        queries.push_back(std::string(static_cast<size_t>(i % 46), 'p') + std::to_string(i));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::optional<int>> out;  // Execute this statement as part of the data structure implementation.
+    ht.searchBatch(queries, out);  // Execute this statement as part of the data structure implementation.
+    for (size_t q = 0; q < queries.size(); ++q) {  // Iterate over a range/collection to process each item in sequence.
+        assert(out[q] == ht.search(queries[q]));  // 與逐一查詢一致 - Matches one-by-one search
+        assert(out[q].has_value() == (static_cast<int>(q) * 7 < 400));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_open_addressing_hashes_each_key_once) {  // Compute a hash-based index so keys map into the table's storage.
+    const ProbeMethod methods[] = {ProbeMethod::LINEAR, ProbeMethod::QUADRATIC,  // Execute this statement as part of the data structure implementation.
+                                   ProbeMethod::DOUBLE_HASH, ProbeMethod::ROBIN_HOOD};  // Execute this statement as part of the data structure implementation.
+    for (ProbeMethod method : methods) {  // Iterate over a range/collection to process each item in sequence.
+        OpenAddressingHashTable<CountedKey, int> ht(64, method);  // 不會重建 - Never rebuilds
+        std::vector<CountedKey> keys;  // Execute this statement as part of the data structure implementation.
+        for (int i = 0; i < 40; ++i) {  // 負載 0.625，多數查詢要探測不只一次 - Load 0.625, many lookups probe more than once
+            keys.push_back(CountedKey{i % 10 + (i / 10) * 64});  // 每 4 個 key 共用一個起始槽位 - Four keys per home slot
+            ht.insert(keys.back(), i);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        keys.push_back(CountedKey{-1});  // 未命中 - A miss
+
+        g_countedKeyHashes = 0;  // Execute this statement as part of the data structure implementation.
+        assert(ht.search(keys[39]).value() == 39);  // 探測多次仍只雜湊一次 - Several probes, still one hash
+        assert(g_countedKeyHashes == 1);  // Compute a hash-based index so keys map into the table's storage.
+
+        g_countedKeyHashes = 0;  // Execute this statement as part of the data structure implementation.
+        std::vector<std::optional<int>> out;  // Execute this statement as part of the data structure implementation.
+        ht.searchBatch(keys, out);  // Execute this statement as part of the data structure implementation.
+        assert(g_countedKeyHashes == keys.size());  // 預取時算的雜湊值沿用到探測 - Pass 1's hashes are reused for probing
+        assert(out[7].value() == 7 && !out.back().has_value());  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_open_addressing_batch_operations) {  // Execute this statement as part of the data structure implementation.
+    const ProbeMethod methods[] = {ProbeMethod::LINEAR, ProbeMethod::QUADRATIC,  // Execute this statement as part of the data structure implementation.
+                                   ProbeMethod::DOUBLE_HASH, ProbeMethod::ROBIN_HOOD};  // Execute this statement as part of the data structure implementation.
+    for (ProbeMethod method : methods) {  // Iterate over a range/collection to process each item in sequence.
+        OpenAddressingHashTable<int, int> ht(16, method);  // Execute this statement as part of the data structure implementation.
+        ht.insert(-7, 7);  // Execute this statement as part of the data structure implementation.
+        ht.insert(-8, 8);  // Execute this statement as part of the data structure implementation.
+        ht.remove(-8);  // 留下墓碑（Robin Hood 除外）- Leaves a tombstone (except Robin Hood)
+        std::vector<int> keys;  // Execute this statement as part of the data structure implementation.
+        std::vector<int> values;  // Execute this statement as part of the data structure implementation.
+        for (int i = 0; i < 1000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            keys.push_back(i * 3);  // Execute this statement as part of the data structure implementation.
+            values.push_back(i);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        ht.insertBatch(keys, values);  // Execute this statement as part of the data structure implementation.
+        assert(ht.size() == 1001);  // Execute this statement as part of the data structure implementation.
+        assert(ht.getRehashCount() == 1);  // 只在開頭重建一次 - Rebuilt exactly once, up front
+        assert(ht.getDeletedCount() == 0);  // Handle tombstones so deletions do not break the probing/search sequence.
+        assert(ht.loadFactor() <= 0.7);  // Execute this statement as part of the data structure implementation.
+
+        std::vector<int> queries;  // Execute this statement as part of the data structure implementation.
+        for (int q = -10; q < 91; ++q) {  // Iterate over a range/collection to process each item in sequence.
+            queries.push_back(q * 5);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        std::vector<std::optional<int>> out;  // Execute this statement as part of the data structure implementation.
+        ht.searchBatch(queries, out);  // Execute this statement as part of the data structure implementation.
+        assert(out.size() == queries.size());  // Execute this statement as part of the data structure implementation.
+        for (size_t q = 0; q < queries.size(); ++q) {  // Iterate over a range/collection to process each item in sequence.
+            assert(out[q] == ht.search(queries[q]));  // 與逐一查詢一致 - Matches one-by-one search
+        }  // Close the current block scope.
+        assert(out[0].has_value() == false);  // -50 從未插入 - -50 was never inserted
+        assert(out[10].value() == 0);  // Execute this statement as part of the data structure implementation.
+
+        ht.reserve(10);  // 已足夠，不重建 - Already large enough, no rebuild
+        assert(ht.getRehashCount() == 1);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+/** Doc block start
+ * 插入 0..199、刪掉 3 的倍數後，forEach 應該剛好走過剩下的每一對一次
+ * After inserting 0..199 and removing multiples of 3, forEach must visit each remaining pair exactly once
+ */  // End of block comment
+template <typename Table>  // Execute this statement as part of the data structure implementation.
+void checkForEachVisitsLivePairs(Table& ht) {  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 200; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(i, i * 10);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (int i = 0; i < 200; i += 3) {  // Iterate over a range/collection to process each item in sequence.
+        ht.remove(i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<int> visits(200, 0);  // Execute this statement as part of the data structure implementation.
+    ht.forEach([&visits](const int& key, const int& value) {  // Iterate over a range/collection to process each item in sequence.
+        assert(value == key * 10);  // Execute this statement as part of the data structure implementation.
+        ++visits[key];  // Execute this statement as part of the data structure implementation.
+    });  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 200; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(visits[i] == (i % 3 == 0 ? 0 : 1));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_for_each_all_tables) {  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<int, int> chained(16);  // Execute this statement as part of the data structure implementation.
+    checkForEachVisitsLivePairs(chained);  // Execute this statement as part of the data structure implementation.
+    FlatChainedHashTable<int, int> flat(16);  // 刪除的節點進入空閒串列，不可被走訪 - Freed nodes sit on the free list and must not be visited
+    checkForEachVisitsLivePairs(flat);  // Execute this statement as part of the data structure implementation.
+    OpenAddressingHashTable<int, int> linear(16, ProbeMethod::LINEAR);  // 墓碑不可被走訪 - Tombstones must not be visited
+    checkForEachVisitsLivePairs(linear);  // Execute this statement as part of the data structure implementation.
+    OpenAddressingHashTable<int, int> robinHood(16, ProbeMethod::ROBIN_HOOD);  // Execute this statement as part of the data structure implementation.
+    checkForEachVisitsLivePairs(robinHood);  // Execute this statement as part of the data structure implementation.
+    SwissTable<int, int> swiss;  // Execute this statement as part of the data structure implementation.
+    checkForEachVisitsLivePairs(swiss);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_snapshot_chained_and_open_addressing) {  // Execute this statement as part of the data structure implementation.
+    const std::string path = "test_collision_snapshot.snap";  // Assign or update a variable that represents the current algorithm state.
+    ChainedHashTable<std::string, int> chained(8);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 3000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        chained.insert("k" + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    saveSnapshot(chained, path);  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<std::string, int> chainedLoaded(8);  // Execute this statement as part of the data structure implementation.
+    loadSnapshot(path, chainedLoaded);  // Execute this statement as part of the data structure implementation.
+    assert(chainedLoaded.size() == 3000 && chainedLoaded.capacity() == 3000);  // reserve(3000) 一次到位 - Sized once by reserve(3000)
+    for (int i = 0; i < 3000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(chainedLoaded.search("k" + std::to_string(i)) == i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    const ProbeMethod methods[] = {ProbeMethod::LINEAR, ProbeMethod::QUADRATIC,  // Execute this statement as part of the data structure implementation.
+                                   ProbeMethod::DOUBLE_HASH, ProbeMethod::ROBIN_HOOD};  // Execute this statement as part of the data structure implementation.
+    for (ProbeMethod method : methods) {  // Iterate over a range/collection to process each item in sequence.
+        OpenAddressingHashTable<int, int> ht(16, method);  // Execute this statement as part of the data structure implementation.
+        for (int i = 0; i < 3000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            ht.insert(i * 11, -i);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        ht.remove(0);  // 墓碑不會寫進快照 - Tombstones are not saved
+        saveSnapshot(ht, path);  // Execute this statement as part of the data structure implementation.
+        OpenAddressingHashTable<int, int> streamed(16, method);  // Execute this statement as part of the data structure implementation.
+        OpenAddressingHashTable<int, int> mapped(16, method);  // Execute this statement as part of the data structure implementation.
+        loadSnapshot(path, streamed);  // Execute this statement as part of the data structure implementation.
+        loadSnapshotMapped(path, mapped);  // Execute this statement as part of the data structure implementation.
+        assert(streamed.getRehashCount() == 1 && mapped.getRehashCount() == 1);  // 只在開頭重建一次 - Rebuilt exactly once, up front
+        assert(streamed.size() == 2999 && mapped.size() == 2999 && !mapped.contains(0));  // Execute this statement as part of the data structure implementation.
+        for (int i = 1; i < 3000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+            assert(streamed.search(i * 11) == -i && mapped.search(i * 11) == -i);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    std::remove(path.c_str());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+// ========== Swiss Table 測試 Swiss Table Tests ==========
+
+TEST(test_swiss_insert_search_update) {  // Execute this statement as part of the data structure implementation.
+    SwissTable<std::string, int> ht;  // Execute this statement as part of the data structure implementation.
+    assert(ht.capacity() == 16);  // 一個群組 - One group
+    ht.insert("apple", 100);  // Execute this statement as part of the data structure implementation.
+    ht.insert("banana", 200);  // Execute this statement as part of the data structure implementation.
+    ht.insert("apple", 150);  // 更新現有鍵 - Update existing key
+
+    assert(ht.size() == 2);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search("apple").value() == 150);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search("banana").value() == 200);  // Execute this statement as part of the data structure implementation.
+    assert(!ht.search("cherry").has_value());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_swiss_capacity_rounds_to_power_of_two) {  // Execute this statement as part of the data structure implementation.
+    SwissTable<int, int> ht(100);  // Execute this statement as part of the data structure implementation.
+    assert(ht.capacity() == 128);  // Execute this statement as part of the data structure implementation.
+    assert(ht.growthLeft() == 112);  // 7/8 負載上限 - 7/8 load cap
+
+    bool threw = false;  // Assign or update a variable that represents the current algorithm state.
+    try {  // Execute this statement as part of the data structure implementation.
+        SwissTable<int, int> bad(0);  // Execute this statement as part of the data structure implementation.
+    } catch (const std::invalid_argument&) {  // Execute this statement as part of the data structure implementation.
+        threw = true;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    assert(threw);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_swiss_grows_at_seven_eighths) {  // Execute this statement as part of the data structure implementation.
+    SwissTable<int, int> ht(16);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 14; ++i) {  // 14 = 16 * 7/8 - Exactly the load cap
+        ht.insert(i, i * 10);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.capacity() == 16);  // Execute this statement as part of the data structure implementation.
+    assert(ht.growthLeft() == 0);  // Execute this statement as part of the data structure implementation.
+
+    ht.insert(14, 140);  // 超過上限：容量加倍 - Over the cap: capacity doubles
+    assert(ht.capacity() == 32);  // Execute this statement as part of the data structure implementation.
+    assert(ht.getRehashCount() == 1);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    for (int i = 0; i <= 14; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(ht.search(i).value() == i * 10);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_swiss_remove_without_tombstone) {  // Handle tombstones so deletions do not break the probing/search sequence.
+    SwissTable<int, int> ht(64);  // Execute this statement as part of the data structure implementation.
+    ht.insert(1, 10);  // Execute this statement as part of the data structure implementation.
+    ht.insert(2, 20);  // Execute this statement as part of the data structure implementation.
+
+    // 群組仍有 EMPTY 槽位，刪除可直接回到 EMPTY - The group still has EMPTY slots, so removal returns the slot to EMPTY
+    size_t before = ht.growthLeft();  // Assign or update a variable that represents the current algorithm state.
+    assert(ht.remove(1));  // Execute this statement as part of the data structure implementation.
+    assert(!ht.remove(1));  // Execute this statement as part of the data structure implementation.
+    assert(ht.getDeletedCount() == 0);  // Handle tombstones so deletions do not break the probing/search sequence.
+    assert(ht.growthLeft() == before + 1);  // Execute this statement as part of the data structure implementation.
+    assert(!ht.contains(1));  // Execute this statement as part of the data structure implementation.
+    assert(ht.search(2).value() == 20);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_swiss_churn_keeps_probe_chains) {  // Handle tombstones so deletions do not break the probing/search sequence.
+    SwissTable<int, int> ht(16);  // 單一群組：14 個 key 後群組只剩 2 個 EMPTY - One group
+    for (int i = 0; i < 14; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(i, i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    ht.insert(100, 100);  // 擴容為兩個群組 - Grow to two groups
+    for (int i = 0; i < 14; ++i) {  // 反覆刪除與插入，製造墓碑 - Churn to create tombstones
+        assert(ht.remove(i));  // Handle tombstones so deletions do not break the probing/search sequence.
+        ht.insert(i + 1000, i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.size() == 15);  // Execute this statement as part of the data structure implementation.
+    assert(ht.search(100).value() == 100);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 14; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(!ht.contains(i));  // Execute this statement as part of the data structure implementation.
+        assert(ht.search(i + 1000).value() == i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_swiss_matches_unordered_map) {  // Execute this statement as part of the data structure implementation.
+    SwissTable<int, int> ht;  // Execute this statement as part of the data structure implementation.
+    std::unordered_map<int, int> ref;  // 參考實作 - Reference implementation
+    unsigned state = 12345u;  // Assign or update a variable that represents the current algorithm state.
+    for (int step = 0; step < 20000; ++step) {  // 隨機插入/刪除/查詢 - Random insert/remove/search
+        state = state * 1664525u + 1013904223u;  // Assign or update a variable that represents the current algorithm state.
+        int key = static_cast<int>((state >> 8) % 2048);  // Assign or update a variable that represents the current algorithm state.
+        int op = static_cast<int>(state >> 29);  // Assign or update a variable that represents the current algorithm state.
+        if (op < 4) {  // Evaluate the condition and branch into the appropriate code path.
+            ht.insert(key, step);  // Execute this statement as part of the data structure implementation.
+            ref[key] = step;  // Execute this statement as part of the data structure implementation.
+        } else if (op < 7) {  // Evaluate the condition and branch into the appropriate code path.
+            assert(ht.remove(key) == (ref.erase(key) == 1));  // Execute this statement as part of the data structure implementation.
+        } else {  // Handle the alternative branch when the condition is false.
+            auto it = ref.find(key);  // Assign or update a variable that represents the current algorithm state.
+            auto found = ht.search(key);  // Assign or update a variable that represents the current algorithm state.
+            assert(found.has_value() == (it != ref.end()));  // Execute this statement as part of the data structure implementation.
+            assert(!found.has_value() || found.value() == it->second);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+        assert(ht.size() == ref.size());  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_swiss_clear) {  // Execute this statement as part of the data structure implementation.
+    SwissTable<std::string, int> ht;  // Execute this statement as part of the data structure implementation.
+    ht.insert("a", 1);  // Execute this statement as part of the data structure implementation.
+    ht.insert("b", 2);  // Execute this statement as part of the data structure implementation.
+    ht.clear();  // Execute this statement as part of the data structure implementation.
+
+    assert(ht.empty());  // Execute this statement as part of the data structure implementation.
+    assert(ht.getTotalProbes() == 0);  // Execute this statement as part of the data structure implementation.
+    assert(!ht.contains("a"));  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+// ========== 統計介面測試 Statistics Interface Tests ==========
+
+// 由鏈長分布算出 (桶數, 元素數) - (buckets, entries) implied by a chain-length distribution
+static std::pair<size_t, size_t> chainTotals(const HashTableStats& stats) {  // Execute this statement as part of the data structure implementation.
+    size_t buckets = 0;  // Access or update the bucket storage used to hold entries or chains.
+    size_t entries = 0;  // Assign or update a variable that represents the current algorithm state.
+    for (size_t length = 0; length < stats.chainLengths.size(); ++length) {  // Iterate over a range/collection to process each item in sequence.
+        buckets += stats.chainLengths[length];  // Access or update the bucket storage used to hold entries or chains.
+        entries += stats.chainLengths[length] * length;  // Assign or update a variable that represents the current algorithm state.
+    }  // Close the current block scope.
+    return {buckets, entries};  // Return the computed result to the caller.
+}  // Close the current block scope.
+
+// 直方圖加總應等於操作數與探測總數 - Histogram totals must equal the operation and probe counts
+static void assertHistogramConsistent(const HashTableStats& stats) {  // Advance or track the probing sequence used by open addressing.
+    uint64_t operations = 0;  // Assign or update a variable that represents the current algorithm state.
+    uint64_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+    for (size_t length = 0; length < stats.probeHistogram.size(); ++length) {  // Iterate over a range/collection to process each item in sequence.
+        operations += stats.probeHistogram[length];  // Assign or update a variable that represents the current algorithm state.
+        probes += stats.probeHistogram[length] * length;  // Advance or track the probing sequence used by open addressing.
+    }  // Close the current block scope.
+    assert(operations == stats.operations);  // Execute this statement as part of the data structure implementation.
+    assert(probes == stats.totalProbes);  // Advance or track the probing sequence used by open addressing.
+    assert(stats.probeHistogram.empty() || stats.probeHistogram.back() > 0);  // Advance or track the probing sequence used by open addressing.
+}  // Close the current block scope.
+
+TEST(test_stats_chain_distribution_matches_scans) {  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<int, int> chained(8);  // Execute this statement as part of the data structure implementation.
+    FlatChainedHashTable<int, int> flat(8);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 200; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        chained.insert(i * 7, i);  // Execute this statement as part of the data structure implementation.
+        flat.insert(i * 7, i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (int i = 0; i < 200; i += 3) {  // 刪除中間與鏈尾的節點 - Remove nodes from the middle and tail of chains
+        assert(chained.remove(i * 7));  // Execute this statement as part of the data structure implementation.
+        assert(flat.remove(i * 7));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(!chained.remove(-1) && !flat.remove(-1));  // Execute this statement as part of the data structure implementation.
+
+    HashTableStats chainedStats = chained.stats();  // Execute this statement as part of the data structure implementation.
+    HashTableStats flatStats = flat.stats();  // Execute this statement as part of the data structure implementation.
+    for (const HashTableStats* stats : {&chainedStats, &flatStats}) {  // Iterate over a range/collection to process each item in sequence.
+        assert(chainTotals(*stats) == std::make_pair(size_t{8}, chained.size()));  // Execute this statement as part of the data structure implementation.
+        assert(stats->operations == 200 + 67 + 1);  // 插入 + 刪除 + 未命中的刪除 - Inserts + removals + the missed removal
+        assert(stats->rehashCount == 0 && stats->tombstones == 0);  // Rehash entries into a larger table to keep operations near O(1) on average.
+        assertHistogramConsistent(*stats);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(chainedStats.maxChainLength() == chained.getMaxChainLength());  // Execute this statement as part of the data structure implementation.
+    assert(flatStats.maxChainLength() == flat.getMaxChainLength());  // Execute this statement as part of the data structure implementation.
+    assert(chainedStats.averageChainLength() == chained.getAverageChainLength());  // Execute this statement as part of the data structure implementation.
+    assert(flatStats.bytesAllocated == flat.memoryBytes());  // Execute this statement as part of the data structure implementation.
+
+    // reserve 是一次重建：分布要反映新的桶數 - reserve is a rebuild: the distribution must follow the new bucket count
+    chained.reserve(512);  // Execute this statement as part of the data structure implementation.
+    chainedStats = chained.stats();  // Execute this statement as part of the data structure implementation.
+    assert(chainedStats.rehashCount == 1);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    assert(chainTotals(chainedStats) == std::make_pair(size_t{512}, chained.size()));  // Execute this statement as part of the data structure implementation.
+    assert(chainedStats.maxChainLength() == chained.getMaxChainLength());  // Execute this statement as part of the data structure implementation.
+    chained.resetStats();  // Execute this statement as part of the data structure implementation.
+    chained.clear();  // Execute this statement as part of the data structure implementation.
+    chainedStats = chained.stats();  // Execute this statement as part of the data structure implementation.
+    assert(chainedStats.operations == 0 && chainedStats.rehashCount == 0 && chainedStats.maxChainLength() == 0);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_stats_open_addressing_tombstones) {  // Handle tombstones so deletions do not break the probing/search sequence.
+    OpenAddressingHashTable<int, int> linear(16, ProbeMethod::LINEAR);  // Execute this statement as part of the data structure implementation.
+    SwissTable<int, int> swiss(16);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 300; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        linear.insert(i, i);  // Execute this statement as part of the data structure implementation.
+        swiss.insert(i, i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (int i = 0; i < 300; i += 2) {  // Iterate over a range/collection to process each item in sequence.
+        linear.remove(i);  // Execute this statement as part of the data structure implementation.
+        swiss.remove(i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    for (int i = 0; i < 300; ++i) {  // 一半命中、一半未命中 - Half hits, half misses
+        assert(linear.search(i).has_value() == (i % 2 == 1));  // Execute this statement as part of the data structure implementation.
+        assert(swiss.search(i).has_value() == (i % 2 == 1));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    HashTableStats linearStats = linear.stats();  // Execute this statement as part of the data structure implementation.
+    assert(linearStats.tombstones == linear.getDeletedCount() && linearStats.tombstones == 150);  // Handle tombstones so deletions do not break the probing/search sequence.
+    assert(linearStats.tombstoneRatio() == 150.0 / linear.capacity());  // Handle tombstones so deletions do not break the probing/search sequence.
+    assert(linearStats.rehashCount == linear.getRehashCount() && linearStats.rehashCount > 0);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    assert(linearStats.operations == 300 + 150 + 300);  // 重建中的重新插入不算 - Re-insertions during rebuilds are not counted
+    assert(linearStats.chainLengths.empty());  // Execute this statement as part of the data structure implementation.
+    assertHistogramConsistent(linearStats);  // Execute this statement as part of the data structure implementation.
+
+    HashTableStats swissStats = swiss.stats();  // Execute this statement as part of the data structure implementation.
+    assert(swissStats.tombstones == swiss.getDeletedCount());  // Handle tombstones so deletions do not break the probing/search sequence.
+    assert(swissStats.rehashCount == swiss.getRehashCount() && swissStats.rehashCount > 0);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    assert(swissStats.operations == 300 + 150 + 300);  // Execute this statement as part of the data structure implementation.
+    assert(swissStats.bytesAllocated >= swiss.capacity() * (1 + 2 * sizeof(int)));  // Execute this statement as part of the data structure implementation.
+    assertHistogramConsistent(swissStats);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_stats_hash_table_during_incremental_rehash) {  // Rehash entries into a larger table to keep operations near O(1) on average.
+    HashTable<int, int> table;  // Execute this statement as part of the data structure implementation.
+    bool sawRehash = false;  // Rehash entries into a larger table to keep operations near O(1) on average.
+    for (int i = 0; i < 5000; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        table.insert(i, i);  // Execute this statement as part of the data structure implementation.
+        if (table.isRehashing() && i % 97 == 0) {  // 擴容中也要涵蓋新舊兩個陣列的每個元素 - Mid-rehash the distribution must cover both arrays
+            HashTableStats stats = table.stats();  // Execute this statement as part of the data structure implementation.
+            assert(chainTotals(stats).second == table.size());  // Execute this statement as part of the data structure implementation.
+            sawRehash = true;  // Rehash entries into a larger table to keep operations near O(1) on average.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    assert(sawRehash);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    for (int i = 0; i < 5000; i += 2) {  // Iterate over a range/collection to process each item in sequence.
+        assert(table.remove(i));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    table.reserve(100000);  // 完成搬移並再擴容一次 - Finish the migration and grow once more
+
+    HashTableStats stats = table.stats();  // Execute this statement as part of the data structure implementation.
+    assert(!table.isRehashing());  // Rehash entries into a larger table to keep operations near O(1) on average.
+    assert(chainTotals(stats) == std::make_pair(table.capacity(), table.size()));  // Execute this statement as part of the data structure implementation.
+    assert(stats.rehashCount >= 10 && stats.rehashNanos > 0);  // 16 → 8192 是 9 次，加上 reserve - 16 to 8192 is 9 doublings, plus reserve
+    assert(stats.operations == 5000 + 2500);  // Execute this statement as part of the data structure implementation.
+    assert(stats.bytesAllocated >= table.size() * (2 * sizeof(int) + 3 * sizeof(void*)));  // Execute this statement as part of the data structure implementation.
+    assertHistogramConsistent(stats);  // Execute this statement as part of the data structure implementation.
+
+    std::ostringstream json;  // Execute this statement as part of the data structure implementation.
+    writeStatsJson(json, "hash_table", stats);  // Execute this statement as part of the data structure implementation.
+    assert(json.str().find("\"table\": \"hash_table\"") != std::string::npos);  // Execute this statement as part of the data structure implementation.
+    assert(json.str().find("\"rehash_count\": " + std::to_string(stats.rehashCount)) != std::string::npos);  // Rehash entries into a larger table to keep operations near O(1) on average.
+    assert(json.str().back() == '}');  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+// ========== 種子與樹化測試 Seeding and Treeify Tests ==========
+
+TEST(test_chaining_treeifies_colliding_bucket) {  // Execute this statement as part of the data structure implementation.
+    // 只有一個桶：所有 key 都碰撞 / One bucket: every key collides
+    ChainedHashTable<int, int> ht(1);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 8; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(i, i * 10);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.getTreeBinCount() == 0);  // 8 個還是串列 - Eight entries are still a list
+    ht.insert(8, 80);  // Execute this statement as part of the data structure implementation.
+    assert(ht.getTreeBinCount() == 1);  // 第 9 個觸發樹化 - The ninth triggers treeify
+
+    for (int i = 9; i < 1024; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(i, i * 10);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    ht.insert(500, -1);  // 樹裡的更新 - Update inside the tree
+    assert(ht.size() == 1024 && ht.getMaxChainLength() == 1024);  // Execute this statement as part of the data structure implementation.
+
+    size_t probes = 0;  // Advance or track the probing sequence used by open addressing.
+    for (int i = 0; i < 1024; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        auto found = ht.search(i, probes);  // Advance or track the probing sequence used by open addressing.
+        assert(found.has_value() && found.value() == (i == 500 ? -1 : i * 10));  // Execute this statement as part of the data structure implementation.
+        assert(probes <= 15);  // AVL 高度 ≤ 1.44·log2(1025) - AVL height bound, not 1024 list steps
+    }  // Close the current block scope.
+    assert(!ht.search(5000, probes).has_value() && probes <= 15);  // Advance or track the probing sequence used by open addressing.
+
+    int visited = 0;  // Assign or update a variable that represents the current algorithm state.
+    ht.forEach([&visited](const int& key, const int&) { assert(key == visited); ++visited; });  // 樹依 key 順序走訪 - Tree walks in key order
+    assert(visited == 1024);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_chaining_untreeifies_after_removals) {  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<std::string, int> ht(1);  // std::string 也能以 < 排序 - std::string is ordered by < as well
+    for (int i = 0; i < 20; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert("key" + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.getTreeBinCount() == 1);  // Execute this statement as part of the data structure implementation.
+    assert(!ht.remove("missing"));  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 13; ++i) {  // 20 → 7：仍是樹 - 20 down to 7 keeps the tree
+        assert(ht.remove("key" + std::to_string(i)));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.getTreeBinCount() == 1 && ht.size() == 7);  // Execute this statement as part of the data structure implementation.
+    assert(ht.remove("key13"));  // 剩 6 個：退回串列 - Six left: back to a list
+    assert(ht.getTreeBinCount() == 0 && ht.size() == 6);  // Execute this statement as part of the data structure implementation.
+    for (int i = 14; i < 20; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(ht.search("key" + std::to_string(i)).value() == i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+}  // Close the current block scope.
+
+TEST(test_chaining_treeified_copy_and_reserve) {  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<int, int> ht(2);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 200; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        ht.insert(i, i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(ht.getTreeBinCount() == 2);  // Execute this statement as part of the data structure implementation.
+
+    ChainedHashTable<int, int> copy = ht;  // 深複製樹 - Deep-copies the trees
+    assert(copy.remove(7) && !copy.contains(7) && ht.contains(7));  // Execute this statement as part of the data structure implementation.
+    assert(copy.hashSeed() == ht.hashSeed());  // Execute this statement as part of the data structure implementation.
+
+    ht.reserve(1024);  // 攤平再分配：每條鏈都很短 - Flatten and redistribute: every chain is short again
+    assert(ht.getTreeBinCount() == 0 && ht.size() == 200);  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 200; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(ht.search(i).value() == i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    std::vector<int> keys;  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 100; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        keys.push_back(i * 3);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::optional<int>> found;  // Execute this statement as part of the data structure implementation.
+    copy.searchBatch(keys, found);  // 批次查詢也走樹 - Batch lookups also walk the trees
+    for (size_t i = 0; i < keys.size(); ++i) {  // Iterate over a range/collection to process each item in sequence.
+        assert(found[i].has_value() == (keys[i] < 200 && keys[i] != 7));  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+
+    copy.clear();  // Execute this statement as part of the data structure implementation.
+    assert(copy.getTreeBinCount() == 0 && copy.empty());  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
+TEST(test_chaining_seed_controls_layout) {  // Execute this statement as part of the data structure implementation.
+    // 每個表預設有不同的隨機種子 / Each table gets its own random seed by default
+    ChainedHashTable<std::string, int> a;  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<std::string, int> b;  // Execute this statement as part of the data structure implementation.
+    assert(a.hashSeed() != b.hashSeed());  // Execute this statement as part of the data structure implementation.
+
+    // 固定種子 → 可重現的桶分布 / A fixed seed gives a reproducible layout
+    ChainedHashTable<std::string, int> c(16, HashSeed::fromValue(42));  // Execute this statement as part of the data structure implementation.
+    ChainedHashTable<std::string, int> d(16, HashSeed::fromValue(42));  // Execute this statement as part of the data structure implementation.
+    for (int i = 0; i < 100; ++i) {  // Iterate over a range/collection to process each item in sequence.
+        c.insert("k" + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+        d.insert("k" + std::to_string(i), i);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    std::vector<std::string> orderC;  // Execute this statement as part of the data structure implementation.
+    std::vector<std::string> orderD;  // Execute this statement as part of the data structure implementation.
+    c.forEach([&orderC](const std::string& key, const int&) { orderC.push_back(key); });  // Execute this statement as part of the data structure implementation.
+    d.forEach([&orderD](const std::string& key, const int&) { orderD.push_back(key); });  // Execute this statement as part of the data structure implementation.
+    assert(orderC == orderD);  // Execute this statement as part of the data structure implementation.
+
+    // 對已知種子構造的碰撞 key，換一個種子就分散開來 / Keys crafted to collide under one seed spread out under another
+    ChainedHashTable<int, int> known(64, HashSeed{});  // Execute this statement as part of the data structure implementation.
+    std::vector<int> crafted;  // Execute this statement as part of the data structure implementation.
+    for (int key = 0; crafted.size() < 40; ++key) {  // Iterate over a range/collection to process each item in sequence.
+        if (fmix64(std::hash<int>{}(key)) % 64 == 0) {  // 零種子下落在桶 0 - Lands in bucket 0 under the zero seed
+            crafted.push_back(key);  // Execute this statement as part of the data structure implementation.
+        }  // Close the current block scope.
+    }  // Close the current block scope.
+    ChainedHashTable<int, int> seeded(64, HashSeed::fromValue(7));  // Execute this statement as part of the data structure implementation.
+    for (int key : crafted) {  // Iterate over a range/collection to process each item in sequence.
+        known.insert(key, key);  // Execute this statement as part of the data structure implementation.
+        seeded.insert(key, key);  // Execute this statement as part of the data structure implementation.
+    }  // Close the current block scope.
+    assert(known.getMaxChainLength() == 40 && known.getTreeBinCount() == 1);  // Execute this statement as part of the data structure implementation.
+    assert(seeded.getMaxChainLength() < 10 && seeded.getTreeBinCount() == 0);  // Execute this statement as part of the data structure implementation.
+}  // Close the current block scope.
+
 // ========== 主函式 Main Function ==========
 
 int main() {  // Execute this statement as part of the data structure implementation.
@@ -347,6 +1165,12 @@ int main() {  // Execute this statement as part of the data structure implementa
     RUN_TEST(test_chaining_statistics);  // Execute this statement as part of the data structure implementation.
     RUN_TEST(test_chaining_clear);  // Execute this statement as part of the data structure implementation.
 
+    std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << "--- 扁平節點鏈結法測試 Flat Chaining Tests ---" << std::endl;  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_flat_chaining_insert_search_update);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_flat_chaining_remove_reuses_free_list);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_flat_chaining_matches_chained);  // Execute this statement as part of the data structure implementation.
+
     std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
     std::cout << "--- 開放定址法 - 線性探測測試 Open Addressing - Linear Probing Tests ---" << std::endl;  // Execute this statement as part of the data structure implementation.
     RUN_TEST(test_linear_create_empty);  // Execute this statement as part of the data structure implementation.
@@ -355,7 +1179,8 @@ int main() {  // Execute this statement as part of the data structure implementa
     RUN_TEST(test_linear_remove_with_tombstone);  // Handle tombstones so deletions do not break the probing/search sequence.
     RUN_TEST(test_linear_probe_count);  // Advance or track the probing sequence used by open addressing.
     RUN_TEST(test_linear_load_factor);  // Execute this statement as part of the data structure implementation.
-    RUN_TEST(test_linear_table_full);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_linear_auto_resize);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_tombstone_purge_under_churn);  // Handle tombstones so deletions do not break the probing/search sequence.
 
     std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
     std::cout << "--- 開放定址法 - 二次探測測試 Open Addressing - Quadratic Probing Tests ---" << std::endl;  // Execute this statement as part of the data structure implementation.
@@ -369,6 +1194,15 @@ int main() {  // Execute this statement as part of the data structure implementa
     RUN_TEST(test_double_hash_remove);  // Compute a hash-based index so keys map into the table's storage.
     RUN_TEST(test_double_hash_probe_method);  // Advance or track the probing sequence used by open addressing.
     RUN_TEST(test_double_hash_collisions);  // Compute a hash-based index so keys map into the table's storage.
+    RUN_TEST(test_quadratic_and_double_hash_grow_under_churn);  // Advance or track the probing sequence used by open addressing.
+
+    std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << "--- 開放定址法 - Robin Hood 測試 Open Addressing - Robin Hood Tests ---" << std::endl;  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_robin_hood_insert_search_update);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_robin_hood_backward_shift_leaves_no_tombstones);  // Handle tombstones so deletions do not break the probing/search sequence.
+    RUN_TEST(test_robin_hood_miss_stops_early);  // Advance or track the probing sequence used by open addressing.
+    RUN_TEST(test_robin_hood_matches_unordered_map);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_probe_histogram_tracks_total_probes);  // Advance or track the probing sequence used by open addressing.
 
     std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
     std::cout << "--- 通用測試 General Tests ---" << std::endl;  // Execute this statement as part of the data structure implementation.
@@ -376,6 +1210,35 @@ int main() {  // Execute this statement as part of the data structure implementa
     RUN_TEST(test_open_addressing_statistics);  // Execute this statement as part of the data structure implementation.
     RUN_TEST(test_int_keys_chaining);  // Execute this statement as part of the data structure implementation.
     RUN_TEST(test_int_keys_open_addressing);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_chaining_batch_operations);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_chaining_batch_string_keys);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_open_addressing_batch_operations);
+    RUN_TEST(test_open_addressing_hashes_each_key_once);  // Compute a hash-based index so keys map into the table's storage.  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_for_each_all_tables);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_snapshot_chained_and_open_addressing);  // Execute this statement as part of the data structure implementation.
+
+    std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << "--- Swiss Table 測試 Swiss Table Tests ---" << std::endl;  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_swiss_insert_search_update);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_swiss_capacity_rounds_to_power_of_two);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_swiss_grows_at_seven_eighths);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_swiss_remove_without_tombstone);  // Handle tombstones so deletions do not break the probing/search sequence.
+    RUN_TEST(test_swiss_churn_keeps_probe_chains);  // Handle tombstones so deletions do not break the probing/search sequence.
+    RUN_TEST(test_swiss_matches_unordered_map);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_swiss_clear);  // Execute this statement as part of the data structure implementation.
+
+    std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << "--- 統計介面測試 Statistics Interface Tests ---" << std::endl;  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_stats_chain_distribution_matches_scans);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_stats_open_addressing_tombstones);  // Handle tombstones so deletions do not break the probing/search sequence.
+    RUN_TEST(test_stats_hash_table_during_incremental_rehash);  // Rehash entries into a larger table to keep operations near O(1) on average.
+
+    std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
+    std::cout << "--- 種子與樹化測試 Seeding and Treeify Tests ---" << std::endl;  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_chaining_treeifies_colliding_bucket);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_chaining_untreeifies_after_removals);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_chaining_treeified_copy_and_reserve);  // Execute this statement as part of the data structure implementation.
+    RUN_TEST(test_chaining_seed_controls_layout);  // Execute this statement as part of the data structure implementation.
 
     // 結果摘要 - Results summary
     std::cout << std::endl;  // Execute this statement as part of the data structure implementation.
@@ -0,0 +1,333 @@
+// 03 布穀鳥雜湊示範（C++）/ Cuckoo hashing with 4-way buckets and a stash (C++).  // Bilingual header line for this unit.
+#ifndef CUCKOO_HASHING_HPP  // Header guard to prevent multiple inclusion.
+#define CUCKOO_HASHING_HPP  // Header guard definition.
+
+#include "UniversalHashing.hpp"  // Reuse UniversalHashFamily for both hash functions.
+#include "HashTableStats.hpp"  // Share the chapter-wide statistics interface from 01-basic-hash-table.
+
+#include <cstdint>  // Provide fixed-width integer types.
+#include <optional>  // Provide std::optional for search results.
+#include <random>  // Provide std::mt19937 for eviction choices.
+#include <stdexcept>  // Provide exceptions for validation.
+#include <utility>  // Provide std::pair and std::swap.
+#include <vector>  // Provide std::vector for bucket storage.
+
+namespace hashfunctionsunit {  // Use the same namespace as the rest of this unit.
+
+// Statistics (HASH_TABLE_STATS=1): a probe is one bucket or one stash entry inspected, so an insert's probe count
+// includes one bucket per kick of its eviction chain; rebuilds count every fresh-parameter attempt, as rehashCount().
+class CuckooHashTable {  // int -> int cuckoo table: 2 hash functions, 4-way buckets, small stash.
+public:
+    static constexpr int SLOTS_PER_BUCKET = 4;  // 4 keys + 4 values + bitmap fit one 64-byte cache line.
+    static constexpr int STASH_CAPACITY = 4;  // Homeless entries kept aside before forcing a rehash.
+    static constexpr int MAX_KICKS = 500;  // Eviction chain limit before an insert counts as failed.
+    static constexpr int MAX_REHASH_ATTEMPTS = 8;  // Fresh-parameter attempts at one size before growing.
+    static constexpr std::int32_t PRIME = 2147483647;  // 2^31 - 1: every non-negative int is below p.
+
+    struct alignas(64) Bucket {  // One cache line: lookups touch at most two of these.
+        int keys[SLOTS_PER_BUCKET];  // Stored keys.
+        int values[SLOTS_PER_BUCKET];  // Stored values.
+        std::uint8_t used;  // Bit i set iff slot i holds an entry.
+    };  // End Bucket.
+
+    explicit CuckooHashTable(int bucketCount = 16, std::uint32_t seed = 0u)  // Construct with bucket count and base seed.
+        : buckets_(),  // Allocated below after validation.
+          size_(0),  // Start empty.
+          seed_(seed),  // Base seed for hash parameters.
+          h1_(1, seed, PRIME),  // Placeholder; replaced in resetStorage().
+          h2_(1, seed, PRIME),  // Placeholder; replaced in resetStorage().
+          rng_(seed),  // Eviction RNG (deterministic for a fixed seed).
+          stash_(),  // Empty stash.
+          maxLoad_(0.9),  // Grow past 90% slot occupancy.
+          rehashCount_(0),  // No rehashes yet.
+          failedInserts_(0),  // No failed eviction chains yet.
+          stashedInserts_(0),  // Nothing stashed yet.
+          totalKicks_(0) {  // No evictions yet.
+        if (bucketCount <= 0) {  // Validate bucket count.
+            throw std::invalid_argument("bucketCount must be >= 1");  // Signal invalid input.
+        }  // Close validation.
+        resetStorage(bucketCount);  // Allocate buckets and draw hash parameters.
+    }  // Close constructor.
+
+    int size() const {  // Expose number of stored entries.
+        return size_;  // Return size.
+    }  // End size().
+
+    int bucketCount() const {  // Expose number of buckets.
+        return static_cast<int>(buckets_.size());  // Return bucket count.
+    }  // End bucketCount().
+
+    int capacity() const {  // Expose total slot count (buckets * 4).
+        return bucketCount() * SLOTS_PER_BUCKET;  // Return slot count.
+    }  // End capacity().
+
+    double loadFactor() const {  // Compute alpha = size / slots.
+        return static_cast<double>(size_) / static_cast<double>(capacity());  // Return load factor.
+    }  // End loadFactor().
+
+    void setMaxLoadFactor(double maxLoad) {  // Change the growth threshold (benchmarks pin the size this way).
+        if (!(maxLoad > 0.0 && maxLoad < 1.0)) {  // Validate range.
+            throw std::invalid_argument("maxLoad must be in (0, 1)");  // Signal invalid input.
+        }  // Close validation.
+        maxLoad_ = maxLoad;  // Store threshold.
+    }  // End setMaxLoadFactor().
+
+    int stashSize() const {  // Expose entries currently in the stash.
+        return static_cast<int>(stash_.size());  // Return stash size.
+    }  // End stashSize().
+
+    int rehashCount() const {  // Expose number of full rebuilds (fresh parameters and/or growth).
+        return rehashCount_;  // Return rehash count.
+    }  // End rehashCount().
+
+    long long failedInserts() const {  // Expose eviction chains that hit MAX_KICKS.
+        return failedInserts_;  // Return failure count.
+    }  // End failedInserts().
+
+    long long stashedInserts() const {  // Expose how many homeless entries went to the stash.
+        return stashedInserts_;  // Return stash insert count.
+    }  // End stashedInserts().
+
+    long long totalKicks() const {  // Expose total evictions performed.
+        return totalKicks_;  // Return kick count.
+    }  // End totalKicks().
+
+    void insert(int key, int value) {  // Insert or update key->value.
+        std::size_t probes = 0;  // Buckets and stash entries inspected (recorded in stats builds only).
+        if (int* existing = find(key, probes)) {  // Update in place when present.
+            *existing = value;  // Overwrite value.
+            HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Record the update's probe length.
+            return;  // Size does not change for updates.
+        }  // Close update branch.
+        if (static_cast<double>(size_ + 1) > maxLoad_ * static_cast<double>(capacity())) {  // Grow before exceeding the load limit.
+            rebuild(bucketCount() * 2, std::vector<std::pair<int, int>>{});  // Double buckets with fresh parameters.
+        }  // Close growth branch.
+        size_ += 1;  // Count the new entry (it will live in a bucket or the stash).
+        bool placed = place(key, value, probes);  // Try direct placement, then an eviction chain.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Lookup plus placement, kicks included.
+        if (placed) {  // Placed in a bucket.
+            return;  // Done.
+        }  // Close success branch.
+        failedInserts_ += 1;  // The eviction chain gave up; (key, value) now holds the homeless entry.
+        if (static_cast<int>(stash_.size()) < STASH_CAPACITY) {  // Park it in the stash when there is room.
+            stash_.push_back(std::make_pair(key, value));  // Stash entry.
+            stashedInserts_ += 1;  // Count stash usage.
+            return;  // Done.
+        }  // Close stash branch.
+        rebuild(bucketCount(), std::vector<std::pair<int, int>>{std::make_pair(key, value)});  // Stash full: fresh parameters.
+    }  // End insert().
+
+    std::optional<int> search(int key) const {  // Look up key: at most two buckets (+ stash when non-empty).
+        std::size_t b1 = bucketIndex(h1_, key);  // First candidate bucket.
+        int slot = findInBucket(buckets_[b1], key);  // Scan 4 slots.
+        if (slot >= 0) {  // Found in first bucket.
+            HASH_TABLE_STATS_ONLY(stats_.recordProbes(1));  // One bucket inspected.
+            return buckets_[b1].values[slot];  // Return stored value.
+        }  // Close first-bucket branch.
+        std::size_t b2 = bucketIndex(h2_, key);  // Second candidate bucket.
+        slot = findInBucket(buckets_[b2], key);  // Scan 4 slots.
+        if (slot >= 0) {  // Found in second bucket.
+            HASH_TABLE_STATS_ONLY(stats_.recordProbes(2));  // Two buckets inspected.
+            return buckets_[b2].values[slot];  // Return stored value.
+        }  // Close second-bucket branch.
+        for (std::size_t i = 0; i < stash_.size(); i++) {  // Stash is usually empty; at most STASH_CAPACITY entries.
+            if (stash_[i].first == key) {  // Match found.
+                HASH_TABLE_STATS_ONLY(stats_.recordProbes(3 + i));  // Both buckets plus the stash entries compared.
+                return stash_[i].second;  // Return stored value.
+            }  // Close match branch.
+        }  // Close stash loop.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(2 + stash_.size()));  // A miss inspects both buckets and the whole stash.
+        return std::nullopt;  // Not found.
+    }  // End search().
+
+    bool contains(int key) const {  // Convenience membership test.
+        return search(key).has_value();  // Delegate to search().
+    }  // End contains().
+
+    bool erase(int key) {  // Delete key; return true if removed.
+        HASH_TABLE_STATS_ONLY(std::size_t probes = 0;)  // Buckets and stash entries inspected (stats builds only).
+        for (std::size_t b : {bucketIndex(h1_, key), bucketIndex(h2_, key)}) {  // Check both candidate buckets.
+            HASH_TABLE_STATS_ONLY(++probes);  // One more bucket inspected.
+            int slot = findInBucket(buckets_[b], key);  // Scan 4 slots.
+            if (slot >= 0) {  // Match found.
+                HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Record the hit's probe length.
+                buckets_[b].used = static_cast<std::uint8_t>(buckets_[b].used & ~(1u << slot));  // Free the slot.
+                size_ -= 1;  // Decrease size.
+                drainStash();  // A freed slot may let a stashed entry move back into the buckets.
+                return true;  // Report success.
+            }  // Close match branch.
+        }  // Close bucket loop.
+        for (std::size_t i = 0; i < stash_.size(); i++) {  // Check the stash.
+            HASH_TABLE_STATS_ONLY(++probes);  // One more stash entry inspected.
+            if (stash_[i].first == key) {  // Match found.
+                HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Record the hit's probe length.
+                stash_.erase(stash_.begin() + static_cast<std::ptrdiff_t>(i));  // Remove entry.
+                size_ -= 1;  // Decrease size.
+                return true;  // Report success.
+            }  // Close match branch.
+        }  // Close stash loop.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // A miss inspects both buckets and the whole stash.
+        return false;  // Not found.
+    }  // End erase().
+
+#if HASH_TABLE_STATS  // Statistics exist only when compiled with HASH_TABLE_STATS=1.
+    HashTableStats stats() const {  // Snapshot of the live statistics (no bucket scan).
+        HashTableStats result;  // Start from an empty snapshot.
+        result.size = static_cast<size_t>(size_);  // Copy element count.
+        result.capacity = static_cast<size_t>(capacity());  // Slots, matching loadFactor().
+        stats_.fill(result, 0);  // No chains and no tombstones: probe histogram and rebuilds only.
+        result.bytesAllocated = buckets_.capacity() * sizeof(Bucket) + stash_.capacity() * sizeof(std::pair<int, int>);  // Buckets plus stash.
+        return result;  // Return snapshot.
+    }  // End stats().
+
+    void resetStats() {  // Zero the probe and rebuild counters (rehashCount() is unaffected).
+        stats_.resetCounters();  // Delegate to the recorder.
+    }  // End resetStats().
+#endif  // Close statistics block.
+
+private:
+    std::vector<Bucket> buckets_;  // Bucket array (64-byte aligned elements).
+    int size_;  // Number of stored entries (buckets + stash).
+    std::uint32_t seed_;  // Advances on every rebuild so parameters are fresh.
+    UniversalHashFamily h1_;  // First hash function.
+    UniversalHashFamily h2_;  // Second hash function (independent parameters).
+    std::mt19937 rng_;  // Chooses which slot to evict.
+    std::vector<std::pair<int, int>> stash_;  // Small overflow area.
+    double maxLoad_;  // Slot-occupancy growth threshold.
+    int rehashCount_;  // Full rebuild count.
+    long long failedInserts_;  // Eviction chains that hit MAX_KICKS.
+    long long stashedInserts_;  // Entries sent to the stash.
+    long long totalKicks_;  // Evictions performed.
+#if HASH_TABLE_STATS  // Statistics members exist only when enabled.
+    mutable HashTableStatsRecorder stats_;  // Live statistics (search is const).
+#endif  // Close statistics block.
+
+    static std::size_t bucketIndex(const UniversalHashFamily& h, int key) {  // Map a key to a bucket.
+        return static_cast<std::size_t>(h.hash(key));  // UniversalHashFamily already reduces mod bucket count.
+    }  // End bucketIndex().
+
+    static int findInBucket(const Bucket& bucket, int key) {  // Return slot index of key, or -1.
+        for (int i = 0; i < SLOTS_PER_BUCKET; i++) {  // Scan 4 slots (same cache line).
+            if (((bucket.used >> i) & 1u) != 0u && bucket.keys[i] == key) {  // Occupied and matching.
+                return i;  // Report slot.
+            }  // Close match branch.
+        }  // Close scan loop.
+        return -1;  // Not in this bucket.
+    }  // End findInBucket().
+
+    static bool putInFreeSlot(Bucket& bucket, int key, int value) {  // Store into the first free slot, if any.
+        for (int i = 0; i < SLOTS_PER_BUCKET; i++) {  // Scan slots.
+            if (((bucket.used >> i) & 1u) == 0u) {  // Free slot.
+                bucket.keys[i] = key;  // Store key.
+                bucket.values[i] = value;  // Store value.
+                bucket.used = static_cast<std::uint8_t>(bucket.used | (1u << i));  // Mark used.
+                return true;  // Placed.
+            }  // Close free-slot branch.
+        }  // Close scan loop.
+        return false;  // Bucket full.
+    }  // End putInFreeSlot().
+
+    int* find(int key, std::size_t& probes) {  // Mutable lookup used for in-place updates; counts what it inspects.
+        for (std::size_t b : {bucketIndex(h1_, key), bucketIndex(h2_, key)}) {  // Check both candidate buckets.
+            probes += 1;  // One more bucket inspected.
+            int slot = findInBucket(buckets_[b], key);  // Scan 4 slots.
+            if (slot >= 0) {  // Match found.
+                return &buckets_[b].values[slot];  // Return pointer to value.
+            }  // Close match branch.
+        }  // Close bucket loop.
+        for (auto& kv : stash_) {  // Check the stash.
+            probes += 1;  // One more stash entry inspected.
+            if (kv.first == key) {  // Match found.
+                return &kv.second;  // Return pointer to value.
+            }  // Close match branch.
+        }  // Close stash loop.
+        return nullptr;  // Not found.
+    }  // End find().
+
+    bool place(int& key, int& value, std::size_t& probes) {  // Place an entry; on failure (key, value) hold the homeless entry.
+        std::size_t b = bucketIndex(h1_, key);  // First candidate bucket.
+        probes += 1;  // First bucket inspected.
+        if (putInFreeSlot(buckets_[b], key, value)) {  // Direct placement in the first bucket.
+            return true;  // Placed without evictions.
+        }  // Close first-bucket branch.
+        probes += 1;  // Second bucket inspected.
+        if (putInFreeSlot(buckets_[bucketIndex(h2_, key)], key, value)) {  // Direct placement in the second bucket.
+            return true;  // Placed without evictions.
+        }  // Close direct branch.
+        for (int kick = 0; kick < MAX_KICKS; kick++) {  // Random-walk eviction chain.
+            int victim = static_cast<int>(rng_() % SLOTS_PER_BUCKET);  // Pick a slot to evict.
+            std::swap(key, buckets_[b].keys[victim]);  // Take the victim's slot.
+            std::swap(value, buckets_[b].values[victim]);  // Carry its value along.
+            totalKicks_ += 1;  // Count eviction.
+            std::size_t alt1 = bucketIndex(h1_, key);  // Evicted key's first bucket.
+            b = (alt1 == b) ? bucketIndex(h2_, key) : alt1;  // Move it to its other bucket.
+            probes += 1;  // Each kick inspects one more bucket.
+            if (putInFreeSlot(buckets_[b], key, value)) {  // Free slot there.
+                return true;  // Chain resolved.
+            }  // Close resolved branch.
+        }  // Close kick loop.
+        return false;  // Give up: probable cycle.
+    }  // End place().
+
+    void drainStash() {  // Move stashed entries back into buckets when a direct slot is free.
+        for (std::size_t i = 0; i < stash_.size();) {  // Walk the stash.
+            int key = stash_[i].first;  // Stashed key.
+            int value = stash_[i].second;  // Stashed value.
+            if (putInFreeSlot(buckets_[bucketIndex(h1_, key)], key, value) || putInFreeSlot(buckets_[bucketIndex(h2_, key)], key, value)) {  // Direct slot free.
+                stash_.erase(stash_.begin() + static_cast<std::ptrdiff_t>(i));  // Remove from stash.
+            } else {  // Still no room.
+                i += 1;  // Keep it stashed.
+            }  // Close placement branch.
+        }  // Close stash loop.
+    }  // End drainStash().
+
+    void resetStorage(int bucketCount) {  // Allocate empty buckets and draw fresh hash parameters.
+        buckets_.assign(static_cast<std::size_t>(bucketCount), Bucket{});  // Zeroed buckets (used = 0).
+        seed_ += 2u;  // Advance seed so each rebuild uses new parameters.
+        h1_ = UniversalHashFamily(bucketCount, seed_, PRIME);  // New first hash function.
+        h2_ = UniversalHashFamily(bucketCount, seed_ + 1u, PRIME);  // New, independent second hash function.
+        stash_.clear();  // Stash starts empty.
+    }  // End resetStorage().
+
+    void rebuild(int bucketCount, std::vector<std::pair<int, int>> pending) {  // Rehash everything with fresh parameters.
+        HASH_TABLE_STATS_ONLY(HashTableStatsRecorder::RehashScope rehashScope(stats_);)  // Time every attempt together.
+        for (const Bucket& bucket : buckets_) {  // Collect bucket entries.
+            for (int i = 0; i < SLOTS_PER_BUCKET; i++) {  // Scan slots.
+                if (((bucket.used >> i) & 1u) != 0u) {  // Occupied slot.
+                    pending.push_back(std::make_pair(bucket.keys[i], bucket.values[i]));  // Keep entry.
+                }  // Close occupied branch.
+            }  // Close slot loop.
+        }  // Close bucket loop.
+        pending.insert(pending.end(), stash_.begin(), stash_.end());  // Keep stashed entries too.
+
+        for (int attempt = 0;; attempt++) {  // Retry with new parameters; grow after repeated failures.
+            if (attempt > 0 && attempt % MAX_REHASH_ATTEMPTS == 0) {  // Too many failures at this size.
+                bucketCount *= 2;  // Grow.
+            }  // Close growth branch.
+            resetStorage(bucketCount);  // Fresh buckets and parameters.
+            rehashCount_ += 1;  // Count rebuild attempt.
+            HASH_TABLE_STATS_ONLY(stats_.countRehash());  // Same count in the statistics snapshot.
+            bool ok = true;  // Track whether every entry found a home.
+            for (const auto& kv : pending) {  // Reinsert all entries.
+                int key = kv.first;  // Copy so place() may swap.
+                int value = kv.second;  // Copy so place() may swap.
+                std::size_t probes = 0;  // Unused: the recorder ignores re-insertions during a rebuild.
+                if (!place(key, value, probes)) {  // Eviction chain failed.
+                    if (static_cast<int>(stash_.size()) < STASH_CAPACITY) {  // Use stash when possible.
+                        stash_.push_back(std::make_pair(key, value));  // Stash entry.
+                    } else {  // Stash full: this attempt failed.
+                        ok = false;  // Retry with new parameters.
+                        break;  // Stop this attempt.
+                    }  // Close stash branch.
+                }  // Close failure branch.
+            }  // Close reinsert loop.
+            if (ok) {  // Every entry placed.
+                return;  // Rebuild complete (size_ is unchanged).
+            }  // Close success branch.
+        }  // Close attempt loop.
+    }  // End rebuild().
+};  // End CuckooHashTable.
+
+}  // namespace hashfunctionsunit  // Close namespace.
+
+#endif  // CUCKOO_HASHING_HPP  // End of header guard.
@@ -3,14 +3,23 @@
 #define HASH_FUNCTIONS_HPP  // Header guard definition.
 
 #include <algorithm>  // Provide std::max and std::min for stats computations.
-#include <cmath>  // Provide std::sqrt and std::floor for hashing and std deviation.
+#include <cmath>  // Provide std::sqrt for std deviation and std::floor/std::ldexp for fixed-point conversion.
 #include <cstdlib>  // Provide std::llabs for absolute value of long long.
 #include <cstdint>  // Provide uint32_t/uint64_t for 32-bit hashes.
+#include <cstring>  // Provide std::memcpy for unaligned word loads.
 #include <limits>  // Provide std::numeric_limits for NaN default handling.
 #include <stdexcept>  // Provide exceptions for validation.
 #include <string>  // Provide std::string for string hashing.
+#include <string_view>  // Provide std::string_view so hashes accept any contiguous byte range.
 #include <vector>  // Provide std::vector for distribution storage.
 
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))  // GCC/Clang on x86 can compile per-function ISA targets.
+#define HASH_FUNCTIONS_X86_DISPATCH 1  // Enable SSE4.2 kernels selected at runtime.
+#include <nmmintrin.h>  // Provide _mm_crc32_* intrinsics (usable inside target("sse4.2") functions).
+#else  // Other compilers/architectures.
+#define HASH_FUNCTIONS_X86_DISPATCH 0  // Scalar kernels only.
+#endif  // Close ISA detection.
+
 namespace hashfunctionsunit {  // Use a small namespace to avoid polluting the global namespace.
 
 inline int positiveMod(long long x, int m) {  // Compute x mod m in [0, m) even when x is negative.
@@ -21,6 +30,35 @@ inline int positiveMod(long long x, int m) {  // Compute x mod m in [0, m) even
     return r;  // Return positive remainder.
 }  // End positiveMod().
 
+inline int positiveMod(int x, int m) {  // Same as above for int keys: a 32-bit division is several times cheaper than a 64-bit one on x86.
+    int r = x % m;  // Signed remainder (m >= 1, so INT_MIN % -1 cannot happen).
+    if (r < 0) {  // Adjust negative remainder to be positive.
+        r += m;  // Shift into [0, m).
+    }  // Close adjustment branch.
+    return r;  // Return positive remainder.
+}  // End positiveMod(int).
+
+// ============================================================  // Section banner: integer-only multiplicative hashing.
+// Multiply-Shift Hashing and Range Reduction  // Section title.
+// ============================================================  // Section banner end.
+
+constexpr std::uint64_t FIBONACCI_MULTIPLIER = 0x9E3779B97F4A7C15ULL;  // 2^64 * (sqrt(5) - 1) / 2, i.e. Knuth's A in 0.64 fixed point (odd).
+
+inline std::uint32_t fastRange32(std::uint32_t x, std::uint32_t m) {  // Lemire's reduction: map x in [0, 2^32) onto [0, m) with one multiply instead of x % m.
+    return static_cast<std::uint32_t>((static_cast<std::uint64_t>(x) * m) >> 32);  // floor(x * m / 2^32); uses the HIGH bits of x, so x must be well mixed.
+}  // End fastRange32().
+
+inline std::uint64_t multiplyShiftHash(std::uint64_t key, std::uint64_t a, int r) {  // Dietzfelbinger multiply-shift: top r bits of key * a (mod 2^64), in [0, 2^r).
+    if (r < 1 || r > 64) {  // Shifting a 64-bit value by 64 is undefined.
+        throw std::invalid_argument("r must be in [1, 64]");  // Signal invalid input.
+    }  // Close validation.
+    return (key * a) >> (64 - r);  // Overflow is the intended mod 2^64; the top bits depend on every key bit.
+}  // End multiplyShiftHash().
+
+inline std::uint64_t fibonacciHash(std::uint64_t key, int r) {  // Fibonacci hashing: multiply-shift with the golden-ratio multiplier, for m = 2^r buckets.
+    return multiplyShiftHash(key, FIBONACCI_MULTIPLIER, r);  // Consecutive keys land about 0.618 * 2^r buckets apart.
+}  // End fibonacciHash().
+
 // ============================================================  // Section banner: integer hash functions.
 // Integer Hash Functions  // Section title.
 // ============================================================  // Section banner end.
@@ -29,24 +67,22 @@ inline int divisionHash(int key, int m) {  // Compute division-method hash: h(k)
     if (m <= 0) {  // Validate bucket count to avoid divide-by-zero and invalid ranges.
         throw std::invalid_argument("m must be >= 1");  // Signal invalid input.
     }  // Close validation.
-    return positiveMod(static_cast<long long>(key), m);  // Use positive modulo so result is always in [0, m).
+    return positiveMod(key, m);  // Use positive modulo so result is always in [0, m).
 }  // End divisionHash().
 
-inline int multiplicationHash(int key, int m, double A = std::numeric_limits<double>::quiet_NaN()) {  // Compute multiplication-method hash: floor(m * frac(k*A)).
+inline int multiplicationHash(int key, int m, double A = std::numeric_limits<double>::quiet_NaN()) {  // Compute multiplication-method hash: floor(m * frac(k*A)), in integer arithmetic.
     if (m <= 0) {  // Validate bucket count so we return a valid index range.
         throw std::invalid_argument("m must be >= 1");  // Signal invalid input.
     }  // Close validation.
-    double aConst = std::isnan(A) ? ((std::sqrt(5.0) - 1.0) / 2.0) : A;  // Use golden ratio conjugate when A is not provided.
-    double product = static_cast<double>(key) * aConst;  // Multiply key by A in floating-point.
-    double fractional = product - std::floor(product);  // Extract fractional part in [0, 1) (works for negative too).
-    int index = static_cast<int>(std::floor(static_cast<double>(m) * fractional));  // Scale by m and take floor.
-    if (index >= m) {  // Clamp for rare rounding edge cases (fractional could be ~1.0).
-        index = m - 1;  // Clamp to last valid bucket.
-    }  // Close clamp branch.
-    if (index < 0) {  // Defensive clamp for negative rounding edge cases.
-        index = 0;  // Clamp to first bucket.
-    }  // Close clamp branch.
-    return index;  // Return bucket index.
+    std::uint64_t aFixed = FIBONACCI_MULTIPLIER;  // Golden ratio conjugate when A is not provided.
+    if (!std::isnan(A)) {  // Convert a caller-supplied A to 0.64 fixed point once.
+        if (std::isinf(A)) {  // frac(inf) is undefined.
+            throw std::invalid_argument("A must be finite");  // Signal invalid input.
+        }  // Close validation.
+        aFixed = static_cast<std::uint64_t>(std::ldexp(A - std::floor(A), 64));  // Only frac(A) matters; ldexp is exact, so the result stays below 2^64.
+    }  // Close custom-A branch.
+    std::uint64_t fraction = static_cast<std::uint64_t>(static_cast<std::int64_t>(key)) * aFixed;  // frac(k*A) * 2^64, exact: mod 2^64 drops the integer part (negative k too).
+    return static_cast<int>(fastRange32(static_cast<std::uint32_t>(fraction >> 32), static_cast<std::uint32_t>(m)));  // floor(m * frac) from the top 32 fraction bits; always < m, no clamp.
 }  // End multiplicationHash().
 
 inline long long midSquareHash(int key, int r) {  // Compute mid-square hash by squaring and extracting middle r digits.
@@ -85,7 +121,7 @@ inline int foldingHash(int key, int chunkSize, int m) {  // Compute folding hash
 // String Hash Functions  // Section title.
 // ============================================================  // Section banner end.
 
-inline int simpleSumHash(const std::string& s, int m) {  // Compute simple sum-of-chars hash reduced mod m.
+inline int simpleSumHash(std::string_view s, int m) {  // Compute simple sum-of-chars hash reduced mod m.
     if (m <= 0) {  // Validate bucket count so we return a valid range.
         throw std::invalid_argument("m must be >= 1");  // Signal invalid input.
     }  // Close validation.
@@ -96,7 +132,7 @@ inline int simpleSumHash(const std::string& s, int m) {  // Compute simple sum-o
     return positiveMod(sum, m);  // Reduce mod m for bucket index.
 }  // End simpleSumHash().
 
-inline std::uint32_t polynomialHash(const std::string& s, std::uint32_t a, std::uint32_t m) {  // Compute polynomial rolling hash reduced mod m.
+inline std::uint32_t polynomialHash(std::string_view s, std::uint32_t a, std::uint32_t m) {  // Compute polynomial rolling hash reduced mod m.
     if (m == 0u) {  // Validate modulo so division is defined.
         throw std::invalid_argument("m must be >= 1");  // Signal invalid input.
     }  // Close validation.
@@ -108,7 +144,7 @@ inline std::uint32_t polynomialHash(const std::string& s, std::uint32_t a, std::
     return static_cast<std::uint32_t>(h);  // Return reduced value.
 }  // End polynomialHash().
 
-inline std::uint32_t djb2Hash(const std::string& s) {  // Compute DJB2 hash (32-bit unsigned).
+inline std::uint32_t djb2Hash(std::string_view s) {  // Compute DJB2 hash (32-bit unsigned).
     std::uint32_t h = 5381u;  // Initialize with DJB2 offset basis.
     for (unsigned char c : s) {  // Iterate bytes.
         h = static_cast<std::uint32_t>((h << 5) + h) + static_cast<std::uint32_t>(c);  // Update: h = h*33 + c.
@@ -116,7 +152,7 @@ inline std::uint32_t djb2Hash(const std::string& s) {  // Compute DJB2 hash (32-
     return h;  // Return 32-bit hash (wrap-around is intentional).
 }  // End djb2Hash().
 
-inline std::uint32_t fnv1aHash(const std::string& s) {  // Compute FNV-1a hash (32-bit unsigned).
+inline std::uint32_t fnv1aHash(std::string_view s) {  // Compute FNV-1a hash (32-bit unsigned).
     const std::uint32_t FNV_OFFSET_BASIS = 2166136261u;  // Define FNV offset basis constant.
     const std::uint32_t FNV_PRIME = 16777619u;  // Define FNV prime constant.
     std::uint32_t h = FNV_OFFSET_BASIS;  // Initialize accumulator.
@@ -127,7 +163,7 @@ inline std::uint32_t fnv1aHash(const std::string& s) {  // Compute FNV-1a hash (
     return h;  // Return 32-bit hash.
 }  // End fnv1aHash().
 
-inline std::uint32_t jenkinsOneAtATime(const std::string& s) {  // Compute Jenkins one-at-a-time hash (32-bit unsigned).
+inline std::uint32_t jenkinsOneAtATime(std::string_view s) {  // Compute Jenkins one-at-a-time hash (32-bit unsigned).
     std::uint32_t h = 0u;  // Initialize accumulator.
     for (unsigned char c : s) {  // Iterate bytes.
         h += static_cast<std::uint32_t>(c);  // Add byte value.
@@ -140,6 +176,202 @@ inline std::uint32_t jenkinsOneAtATime(const std::string& s) {  // Compute Jenki
     return h;  // Return 32-bit hash.
 }  // End jenkinsOneAtATime().
 
+// ============================================================  // Section banner: high-throughput string hashes.
+// Word-at-a-Time String Hash Functions  // Section title.
+// ============================================================  // Section banner end.
+
+inline std::uint64_t loadWord64(const unsigned char* p) {  // Read 8 bytes in host byte order from any alignment.
+    std::uint64_t word;  // Destination word.
+    std::memcpy(&word, p, sizeof(word));  // Compiles to a single unaligned load.
+    return word;  // Return loaded word.
+}  // End loadWord64().
+
+inline std::uint64_t loadWord32(const unsigned char* p) {  // Read 4 bytes in host byte order, widened to 64 bits.
+    std::uint32_t word;  // Destination word.
+    std::memcpy(&word, p, sizeof(word));  // Compiles to a single unaligned load.
+    return word;  // Return loaded word.
+}  // End loadWord32().
+
+inline std::uint64_t loadTail64(const unsigned char* p, size_t n) {  // Pack the last 1..7 bytes into one word without a byte loop.
+    if (n >= 4) {  // Two overlapping 4-byte loads cover 4..7 bytes.
+        return loadWord32(p) | (loadWord32(p + n - 4) << 32);  // First and last four bytes.
+    }  // Close 4..7 branch.
+    return (static_cast<std::uint64_t>(p[0]) << 16) | (static_cast<std::uint64_t>(p[n >> 1]) << 8) | p[n - 1];  // First, middle and last byte cover 1..3 bytes.
+}  // End loadTail64().
+
+inline std::uint64_t avalanche64(std::uint64_t h) {  // MurmurHash3 fmix64: every input bit affects every output bit.
+    h ^= h >> 33;  // Fold high bits down.
+    h *= 0xff51afd7ed558ccdULL;  // Spread them up.
+    h ^= h >> 33;  // Fold again.
+    h *= 0xc4ceb9fe1a85ec53ULL;  // Spread again.
+    h ^= h >> 33;  // Final fold.
+    return h;  // Return mixed value.
+}  // End avalanche64().
+
+inline std::uint64_t fnv1aHash64(std::string_view s) {  // Compute byte-at-a-time FNV-1a (64-bit), the reference for the word variant.
+    const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;  // 64-bit FNV offset basis.
+    const std::uint64_t FNV_PRIME = 1099511628211ULL;  // 64-bit FNV prime.
+    std::uint64_t h = FNV_OFFSET_BASIS;  // Initialize accumulator.
+    for (unsigned char c : s) {  // Iterate bytes.
+        h ^= static_cast<std::uint64_t>(c);  // XOR in the next byte.
+        h *= FNV_PRIME;  // Multiply by FNV prime (mod 2^64 via overflow).
+    }  // Close loop.
+    return h;  // Return 64-bit hash.
+}  // End fnv1aHash64().
+
+inline std::uint64_t fnv1aWordHash64(std::string_view s) {  // FNV-1a over 8-byte words: one multiply per word instead of per byte.
+    const std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;  // 64-bit FNV offset basis.
+    const std::uint64_t FNV_PRIME = 1099511628211ULL;  // 64-bit FNV prime.
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());  // Byte view of the key.
+    size_t n = s.size();  // Bytes left to consume.
+    std::uint64_t h = FNV_OFFSET_BASIS ^ static_cast<std::uint64_t>(n);  // Mix the length so zero-padded tails cannot collide.
+    while (n >= 8) {  // Consume whole words.
+        h = (h ^ loadWord64(p)) * FNV_PRIME;  // FNV-1a step on a full word.
+        p += 8;  // Advance one word.
+        n -= 8;  // Account for it.
+    }  // Close word loop.
+    if (n > 0) {  // Consume the 1..7 byte tail as one more word.
+        h = (h ^ loadTail64(p, n)) * FNV_PRIME;  // FNV-1a step on the packed tail.
+    }  // Close tail branch.
+    return avalanche64(h);  // A multiply only carries bits upward, so finish with a full avalanche.
+}  // End fnv1aWordHash64().
+
+inline std::uint32_t fnv1aWordHash(std::string_view s) {  // 32-bit form of fnv1aWordHash64, same shape as fnv1aHash.
+    std::uint64_t h = fnv1aWordHash64(s);  // Full-width hash.
+    return static_cast<std::uint32_t>(h ^ (h >> 32));  // Fold both halves together.
+}  // End fnv1aWordHash().
+
+inline void wyMultiply(std::uint64_t& a, std::uint64_t& b) {  // 64x64 -> 128-bit multiply: a = low half, b = high half.
+#if defined(__SIZEOF_INT128__)  // GCC/Clang expose a native 128-bit type.
+    __extension__ typedef unsigned __int128 Product;  // __extension__ keeps -Wpedantic quiet about the non-ISO type.
+    Product r = static_cast<Product>(a) * b;  // One MUL instruction on x86-64/AArch64.
+    a = static_cast<std::uint64_t>(r);  // Low 64 bits.
+    b = static_cast<std::uint64_t>(r >> 64);  // High 64 bits.
+#else  // Portable schoolbook multiply on 32-bit halves.
+    std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a), lb = static_cast<std::uint32_t>(b);  // Split operands.
+    std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;  // Four partial products.
+    std::uint64_t t = rl + (rm0 << 32);  // Add first middle term to the low word.
+    std::uint64_t carry = t < rl ? 1u : 0u;  // Carry out of the low word.
+    std::uint64_t lo = t + (rm1 << 32);  // Add second middle term.
+    carry += lo < t ? 1u : 0u;  // Second carry.
+    a = lo;  // Low 64 bits.
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;  // High 64 bits.
+#endif  // Close multiply variants.
+}  // End wyMultiply().
+
+inline std::uint64_t wyMix(std::uint64_t a, std::uint64_t b) {  // Fold a 128-bit product back to 64 bits.
+    wyMultiply(a, b);  // Full-width product.
+    return a ^ b;  // XOR the halves.
+}  // End wyMix().
+
+inline std::uint64_t wyHash64(std::string_view s, std::uint64_t seed = 0) {  // wyhash (final4 layout): 16 bytes per 128-bit multiply, 48 per loop turn.
+    const std::uint64_t SECRET[4] = {0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL};  // Default wyhash secret (_wyp).
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());  // Byte view of the key.
+    size_t len = s.size();  // Key length.
+    seed ^= wyMix(seed ^ SECRET[0], SECRET[1]);  // Pre-mix the seed.
+    std::uint64_t a = 0;  // First 64-bit lane of the final block.
+    std::uint64_t b = 0;  // Second 64-bit lane of the final block.
+    if (len <= 16) {  // Short keys: no loop at all.
+        if (len >= 4) {  // 4..16 bytes: four overlapping 4-byte loads.
+            size_t skip = (len >> 3) << 2;  // 0 for 4..7 bytes, 4 for 8..16 bytes.
+            a = (loadWord32(p) << 32) | loadWord32(p + skip);  // Head words.
+            b = (loadWord32(p + len - 4) << 32) | loadWord32(p + len - 4 - skip);  // Tail words.
+        } else if (len > 0) {  // 1..3 bytes.
+            a = (static_cast<std::uint64_t>(p[0]) << 16) | (static_cast<std::uint64_t>(p[len >> 1]) << 8) | p[len - 1];  // First, middle, last byte.
+        }  // Close short-key branches (empty key keeps a = b = 0).
+    } else {  // Long keys.
+        size_t i = len;  // Bytes left.
+        if (i > 48) {  // Three independent multiply chains keep the multiplier busy.
+            std::uint64_t see1 = seed;  // Second lane state.
+            std::uint64_t see2 = seed;  // Third lane state.
+            do {  // Consume 48 bytes per turn.
+                seed = wyMix(loadWord64(p) ^ SECRET[1], loadWord64(p + 8) ^ seed);  // Lane 1.
+                see1 = wyMix(loadWord64(p + 16) ^ SECRET[2], loadWord64(p + 24) ^ see1);  // Lane 2.
+                see2 = wyMix(loadWord64(p + 32) ^ SECRET[3], loadWord64(p + 40) ^ see2);  // Lane 3.
+                p += 48;  // Advance.
+                i -= 48;  // Account for it.
+            } while (i > 48);  // Keep at least one byte for the final block.
+            seed ^= see1 ^ see2;  // Merge lanes.
+        }  // Close 48-byte loop.
+        while (i > 16) {  // Consume 16 bytes at a time.
+            seed = wyMix(loadWord64(p) ^ SECRET[1], loadWord64(p + 8) ^ seed);  // One multiply per 16 bytes.
+            p += 16;  // Advance.
+            i -= 16;  // Account for it.
+        }  // Close 16-byte loop.
+        a = loadWord64(p + i - 16);  // Last 16 bytes (may overlap already-hashed bytes).
+        b = loadWord64(p + i - 8);  // Second half of the last 16 bytes.
+    }  // Close length dispatch.
+    a ^= SECRET[1];  // Key the final block.
+    b ^= seed;  // Chain in the running state.
+    wyMultiply(a, b);  // Full-width product.
+    return wyMix(a ^ SECRET[0] ^ static_cast<std::uint64_t>(len), b ^ SECRET[1]);  // Mix in the length and finish.
+}  // End wyHash64().
+
+struct Crc32cTable {  // Byte-at-a-time lookup table for the Castagnoli polynomial (reflected 0x82F63B78).
+    std::uint32_t entries[256];  // One remainder per byte value.
+
+    constexpr Crc32cTable() : entries{} {  // Build the table at compile time.
+        for (std::uint32_t i = 0; i < 256u; i++) {  // Every byte value.
+            std::uint32_t crc = i;  // Start with the byte.
+            for (int bit = 0; bit < 8; bit++) {  // Shift out eight bits.
+                crc = (crc & 1u) ? ((crc >> 1) ^ 0x82F63B78u) : (crc >> 1);  // Reflected polynomial division step.
+            }  // Close bit loop.
+            entries[i] = crc;  // Store remainder.
+        }  // Close byte loop.
+    }  // End Crc32cTable().
+};  // End Crc32cTable.
+
+inline constexpr Crc32cTable CRC32C_TABLE{};  // Shared table (C++17 inline variable, one copy per program).
+
+inline std::uint32_t crc32cSoftware(std::string_view s) {  // Portable CRC32C, used when SSE4.2 is unavailable.
+    std::uint32_t crc = 0xFFFFFFFFu;  // Standard initial value.
+    for (unsigned char c : s) {  // Iterate bytes.
+        crc = CRC32C_TABLE.entries[(crc ^ c) & 0xFFu] ^ (crc >> 8);  // Table-driven step.
+    }  // Close loop.
+    return ~crc;  // Standard final XOR.
+}  // End crc32cSoftware().
+
+#if HASH_FUNCTIONS_X86_DISPATCH  // Hardware kernel only where it can be compiled.
+__attribute__((target("sse4.2"))) inline std::uint32_t crc32cSse42(std::string_view s) {  // CRC32C with the SSE4.2 crc32 instruction, 8 bytes per step.
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());  // Byte view of the key.
+    size_t n = s.size();  // Bytes left.
+    std::uint32_t crc = 0xFFFFFFFFu;  // Standard initial value.
+#if defined(__x86_64__)  // 64-bit form exists only in long mode.
+    std::uint64_t crc64 = crc;  // Widen for the 64-bit instruction.
+    while (n >= 8) {  // Whole words.
+        crc64 = _mm_crc32_u64(crc64, loadWord64(p));  // One instruction per 8 bytes.
+        p += 8;  // Advance.
+        n -= 8;  // Account for it.
+    }  // Close word loop.
+    crc = static_cast<std::uint32_t>(crc64);  // Narrow back (upper half is always zero).
+#endif  // Close 64-bit loop.
+    while (n > 0) {  // Remaining bytes.
+        crc = _mm_crc32_u8(crc, *p);  // One byte per instruction.
+        p += 1;  // Advance.
+        n -= 1;  // Account for it.
+    }  // Close tail loop.
+    return ~crc;  // Standard final XOR.
+}  // End crc32cSse42().
+#endif  // Close hardware kernel.
+
+inline bool crc32cHardwareAvailable() {  // Report whether crc32cHash uses the SSE4.2 kernel on this CPU.
+#if HASH_FUNCTIONS_X86_DISPATCH  // Query CPUID once.
+    static const bool supported = __builtin_cpu_supports("sse4.2");  // Cached after the first call.
+    return supported;  // Return cached answer.
+#else  // No hardware kernel compiled.
+    return false;  // Always software.
+#endif  // Close dispatch.
+}  // End crc32cHardwareAvailable().
+
+inline std::uint32_t crc32cHash(std::string_view s) {  // CRC32C (Castagnoli): SSE4.2 when the CPU has it, table-driven otherwise.
+#if HASH_FUNCTIONS_X86_DISPATCH  // Runtime dispatch.
+    if (crc32cHardwareAvailable()) {  // SSE4.2 present.
+        return crc32cSse42(s);  // Hardware path.
+    }  // Close hardware branch.
+#endif  // Close dispatch.
+    return crc32cSoftware(s);  // Portable path (same result).
+}  // End crc32cHash().
+
 // ============================================================  // Section banner: distribution analysis.
 // Hash Function Analysis Tools  // Section title.
 // ============================================================  // Section banner end.
@@ -155,14 +387,15 @@ struct DistributionReport {  // Report distribution statistics for a set of keys
     std::vector<int> distribution;  // Raw bucket counts.
 };  // End DistributionReport.
 
-template <typename HashFunc>  // Template for generic (key, m) -> index hash functions.
-inline DistributionReport analyzeDistribution(HashFunc hashFunc, const std::vector<std::string>& keys, int m) {  // Analyze bucket distribution for a string hash function.
+// Key sets too large for a std::vector (log files, billions of keys): see StreamingDistribution.hpp.
+template <typename HashFunc, typename Key>  // Template for generic (key, m) -> index hash functions over any key type.
+inline DistributionReport analyzeDistribution(HashFunc hashFunc, const std::vector<Key>& keys, int m) {  // Analyze bucket distribution for a hash function.
     if (m <= 0) {  // Validate bucket count so arrays have a valid size.
         throw std::invalid_argument("m must be >= 1");  // Signal invalid input.
     }  // Close validation.
 
     std::vector<int> buckets(static_cast<size_t>(m), 0);  // Allocate bucket counters.
-    for (const std::string& key : keys) {  // Hash each key into a bucket.
+    for (const Key& key : keys) {  // Hash each key into a bucket.
         int h = static_cast<int>(hashFunc(key, m));  // Compute bucket index for this key.
         buckets[static_cast<size_t>(h)] += 1;  // Increment bucket occupancy.
     }  // Close loop.
@@ -0,0 +1,458 @@
+// 03 串流平行分布分析（C++）/ Streaming, parallel hash distribution analysis (C++).  // Bilingual header line for this unit.
+#ifndef STREAMING_DISTRIBUTION_HPP  // Header guard to prevent multiple inclusion.
+#define STREAMING_DISTRIBUTION_HPP  // Header guard definition.
+
+#include <algorithm>  // Provide std::sort and std::lower_bound for the carry list.
+#include <atomic>  // Provide std::atomic<std::uint8_t> for the shared counter array.
+#include <cmath>  // Provide std::sqrt for std deviation and the chi-squared z-score.
+#include <cstdint>  // Provide fixed-width integer types.
+#include <cstdlib>  // Provide std::calloc/std::free for counter arrays where mmap is unavailable.
+#include <cstring>  // Provide std::memchr for line splitting and std::memcpy for counter words.
+#include <exception>  // Provide std::exception_ptr to carry worker failures to the caller.
+#include <fstream>  // Provide std::ifstream where mmap is unavailable.
+#include <istream>  // Provide std::istream for pipes and stdin.
+#include <limits>  // Provide std::numeric_limits for the running minimum.
+#include <memory>  // Provide std::unique_ptr for the counter arrays.
+#include <new>  // Provide std::bad_alloc when a counter array cannot be allocated.
+#include <stdexcept>  // Provide exceptions for validation and I/O errors.
+#include <string>  // Provide std::string for paths and stream blocks.
+#include <string_view>  // Provide std::string_view keys and regions.
+#include <thread>  // Provide std::thread for the workers.
+#include <unordered_map>  // Provide the per-thread carry map.
+#include <utility>  // Provide std::pair and std::move.
+#include <vector>  // Provide per-thread state and report vectors.
+
+#if defined(__unix__) || defined(__APPLE__)  // POSIX: map the file instead of reading it.
+#include <fcntl.h>  // Provide open.
+#include <sys/mman.h>  // Provide mmap/madvise/munmap.
+#include <sys/stat.h>  // Provide fstat.
+#include <unistd.h>  // Provide close.
+#define STREAMING_DISTRIBUTION_HAS_MMAP 1  // addFile maps the whole file; counter arrays are anonymous mappings.
+#else  // Other platforms.
+#define STREAMING_DISTRIBUTION_HAS_MMAP 0  // addFile streams the file in blocks.
+#endif  // Close platform detection.
+
+namespace hashfunctionsunit {  // Use the same namespace as the rest of this unit.
+
+constexpr std::uint64_t MAX_STREAMING_BUCKETS = std::uint64_t{1} << 32;  // Largest supported m.
+constexpr size_t STREAMING_BLOCK_BYTES = size_t{64} << 20;  // Block size when reading from a stream.
+constexpr std::uint64_t STREAMING_COUNTER_BUDGET = std::uint64_t{4} << 30;  // Default cap on per-thread counter bytes (m * threads).
+
+struct StreamingDistributionOptions {  // Settings for StreamingDistributionAnalyzer.
+    std::uint64_t buckets = 1024;  // m in [1, 2^32]; a key lands in bucket hash % m.
+    unsigned threads = 0;  // Worker threads (0 = std::thread::hardware_concurrency()).
+    int hashBits = 64;  // Output width of the hash in [1, 64]; only these low bits are used.
+    std::uint64_t avalancheSampleEvery = 4096;  // Every N-th key per thread gets the bit-flip test (0 = off).
+    std::uint64_t counterBudgetBytes = STREAMING_COUNTER_BUDGET;  // Above m * threads bytes, the workers share one atomic counter array.
+};  // End StreamingDistributionOptions.
+
+struct StreamingDistributionReport {  // Distribution, chi-squared, bit-bias and avalanche statistics.
+    std::uint64_t totalKeys;  // Keys analyzed (non-empty lines).
+    std::uint64_t buckets;  // Number of buckets (m).
+    std::uint64_t nonEmptyBuckets;  // Buckets with at least one key.
+    std::uint64_t maxBucketSize;  // Largest bucket.
+    std::uint64_t minBucketSize;  // Smallest bucket (often 0).
+    double avgBucketSize;  // n / m.
+    double stdDeviation;  // Standard deviation of bucket sizes (same definition as analyzeDistribution).
+    double chiSquared;  // Sum over buckets of (size - n/m)^2 / (n/m).
+    double chiSquaredZ;  // (chiSquared - (m-1)) / sqrt(2(m-1)); |z| below about 3 is consistent with a uniform hash.
+    int hashBits;  // Output bits examined below.
+    std::vector<double> bitBias;  // Per output bit j: P(bit j = 1) - 0.5.
+    double maxBitBias;  // Largest |bitBias|.
+    std::uint64_t avalancheTrials;  // (sampled key, flipped input bit) pairs.
+    double avalancheMean;  // Mean fraction of output bits that flipped (ideal 0.5).
+    std::vector<double> avalancheBias;  // Per output bit j: P(bit j flips) - 0.5.
+    double maxAvalancheBias;  // Largest |avalancheBias|.
+};  // End StreamingDistributionReport.
+
+// StreamingDistributionAnalyzer<HashFunc>: analyzeDistribution for key sets that do not fit in a std::vector.
+// Keys are the non-empty lines of a byte region ("\r\n" endings allowed); HashFunc maps std::string_view to the raw
+// hash value (not a bucket index). addRegion splits the region at line boundaries across the worker threads; each
+// worker keeps its own histogram, and report() merges them. Call addRegion/addFile/addStream any number of times.
+// HashFunc is called from every worker at once, so it must not keep mutable state.
+// Counters are one byte per bucket per thread, zero-filled on first touch (huge pages where the kernel allows, so
+// m = 2^32 costs about two thousand page faults rather than a million); a byte that wraps past 255 records a carry in a
+// per-thread map, so a hot bucket costs one map update per 256 keys.
+// Per-thread arrays cost m * threads bytes once every page is touched (2^32 buckets on 32 threads is 128 GiB), so when
+// that exceeds options.counterBudgetBytes the workers share a single m-byte array of relaxed atomic byte counters
+// instead; the worker whose increment wraps a byte records the carry in its own map, so carries stay lock-free. The
+// shared array itself always costs m bytes (4 GiB at m = 2^32), whatever the budget.
+template <typename HashFunc>  // Any callable std::uint64_t(std::string_view).
+class StreamingDistributionAnalyzer {  // Accumulates statistics over any number of regions.
+public:
+    StreamingDistributionAnalyzer(HashFunc hashFunc, const StreamingDistributionOptions& options = StreamingDistributionOptions{})  // Validate options and allocate per-thread state.
+        : hashFunc_(std::move(hashFunc)),  // Store hash.
+          options_(options),  // Store options.
+          mask_(0) {  // Set below once hashBits is validated.
+        if (options_.buckets == 0 || options_.buckets > MAX_STREAMING_BUCKETS) {  // Bucket indices must fit the counters' domain.
+            throw std::invalid_argument("buckets must be in [1, 2^32]");  // Signal invalid input.
+        }  // Close validation.
+        if (options_.hashBits < 1 || options_.hashBits > 64) {  // Shift amounts below must be defined.
+            throw std::invalid_argument("hashBits must be in [1, 64]");  // Signal invalid input.
+        }  // Close validation.
+        mask_ = (options_.hashBits == 64) ? ~std::uint64_t{0} : ((std::uint64_t{1} << options_.hashBits) - 1u);  // Low hashBits bits.
+        unsigned threads = options_.threads;  // Requested worker count.
+        if (threads == 0) {  // Use the whole machine.
+            threads = std::max(1u, std::thread::hardware_concurrency());  // hardware_concurrency may report 0.
+        }  // Close default branch.
+        sharedCounters_ = threads > 1 && options_.buckets > options_.counterBudgetBytes / threads;  // m * threads over budget, without overflow.
+        size_t histograms = sharedCounters_ ? 1u : threads;  // One array per worker, or one for all.
+        for (size_t h = 0; h < histograms; h++) {  // Allocate.
+            histograms_.push_back(allocateCounters(static_cast<size_t>(options_.buckets)));  // m zeroed bytes.
+        }  // Close allocation loop.
+        states_.resize(threads);  // Value-initialized: all counters start at zero.
+        for (size_t t = 0; t < threads; t++) {  // Point every worker at its histogram.
+            states_[t].counts = histograms_[sharedCounters_ ? 0 : t].get();  // Own array, or the shared one.
+            states_[t].untilSample = options_.avalancheSampleEvery;  // First sample after N keys.
+        }  // Close state loop.
+    }  // Close constructor.
+
+    size_t threadCount() const {  // Expose the number of workers.
+        return states_.size();  // One state per worker.
+    }  // End threadCount().
+
+    bool sharedCounters() const {  // True when m * threads exceeded counterBudgetBytes.
+        return sharedCounters_;  // Workers increment one atomic array.
+    }  // End sharedCounters().
+
+    void addRegion(std::string_view region) {  // Analyze every line of a memory region, in parallel.
+        const char* begin = region.data();  // Region start.
+        const char* end = begin + region.size();  // Region end.
+        size_t threads = states_.size();  // Worker count.
+        if (threads == 1) {  // No thread to spawn.
+            processSlice(states_[0], begin, end, end);  // Whole region inline.
+            return;  // Done.
+        }  // Close single-thread branch.
+        std::vector<std::thread> workers;  // Running workers.
+        std::vector<std::exception_ptr> errors(threads);  // First failure of each worker.
+        for (size_t t = 0; t < threads; t++) {  // Slice the region by byte offset.
+            const char* sliceBegin = lineStartAtOrAfter(begin + region.size() * t / threads, begin, end);  // A line belongs to the slice it starts in.
+            const char* sliceEnd = begin + region.size() * (t + 1) / threads;  // Lines starting before this.
+            workers.emplace_back([this, t, sliceBegin, sliceEnd, end, &errors] {  // Worker body.
+                try {  // Exceptions must not escape a std::thread.
+                    processSlice(states_[t], sliceBegin, sliceEnd, end);  // Own histogram, no sharing.
+                } catch (...) {  // Allocation failure in the carry map, or a throwing hash.
+                    errors[t] = std::current_exception();  // Hand it to the caller.
+                }  // Close catch.
+            });  // Close worker.
+        }  // Close spawn loop.
+        for (std::thread& worker : workers) {  // Wait for every slice.
+            worker.join();  // Join.
+        }  // Close join loop.
+        for (const std::exception_ptr& error : errors) {  // Surface the first failure.
+            if (error) {  // Worker failed.
+                std::rethrow_exception(error);  // Rethrow on the caller's thread.
+            }  // Close failure branch.
+        }  // Close error loop.
+    }  // End addRegion().
+
+    void addStream(std::istream& in, size_t blockBytes = STREAMING_BLOCK_BYTES) {  // Analyze a stream (pipe, stdin) in blocks of whole lines.
+        if (blockBytes == 0) {  // Validate block size.
+            throw std::invalid_argument("blockBytes must be >= 1");  // Signal invalid input.
+        }  // Close validation.
+        std::string block;  // Unprocessed bytes: a partial last line carries over to the next block.
+        std::vector<char> buffer(blockBytes);  // Read buffer.
+        while (in) {  // Until EOF or error.
+            in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));  // Read one block.
+            size_t got = static_cast<size_t>(in.gcount());  // Bytes actually read.
+            if (got == 0) {  // Nothing left.
+                break;  // Stop reading.
+            }  // Close EOF branch.
+            block.append(buffer.data(), got);  // Append after the carried partial line.
+            size_t lastNewline = block.rfind('\n');  // End of the last complete line.
+            if (lastNewline == std::string::npos) {  // A line longer than the block: keep reading.
+                continue;  // Next block.
+            }  // Close long-line branch.
+            addRegion(std::string_view(block.data(), lastNewline + 1));  // Whole lines only.
+            block.erase(0, lastNewline + 1);  // Keep the partial line.
+        }  // Close read loop.
+        if (in.bad()) {  // Read error (EOF and short reads are fine).
+            throw std::runtime_error("error while reading key stream");  // Signal I/O failure.
+        }  // Close error branch.
+        addRegion(block);  // Final line without a trailing newline.
+    }  // End addStream().
+
+    void addFile(const std::string& path) {  // Analyze a newline-separated key file.
+#if STREAMING_DISTRIBUTION_HAS_MMAP  // Map the file: workers read their slices straight from the page cache.
+        int fd = ::open(path.c_str(), O_RDONLY);  // Open read-only.
+        if (fd < 0) {  // Missing or unreadable.
+            throw std::runtime_error("cannot open key file: " + path);  // Signal I/O failure.
+        }  // Close open check.
+        struct stat info;  // File metadata.
+        if (::fstat(fd, &info) != 0) {  // Size unknown.
+            ::close(fd);  // Release descriptor.
+            throw std::runtime_error("cannot stat key file: " + path);  // Signal I/O failure.
+        }  // Close stat check.
+        size_t length = static_cast<size_t>(info.st_size);  // File size.
+        if (length == 0) {  // mmap rejects empty mappings; an empty file has no keys.
+            ::close(fd);  // Release descriptor.
+            return;  // Nothing to analyze.
+        }  // Close empty branch.
+        void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);  // Map the whole file.
+        ::close(fd);  // The mapping outlives the descriptor.
+        if (mapped == MAP_FAILED) {  // Mapping failed (e.g. not a regular file).
+            throw std::runtime_error("mmap failed: " + path);  // Signal I/O failure.
+        }  // Close mmap check.
+        ::madvise(mapped, length, MADV_SEQUENTIAL);  // Each worker reads its slice front to back: read ahead, drop pages behind.
+        struct Unmap {  // Unmap on every exit path.
+            void* base;  // Mapping start.
+            size_t length;  // Mapping length.
+            ~Unmap() { ::munmap(base, length); }  // Release mapping.
+        } unmap{mapped, length};  // Guard.
+        addRegion(std::string_view(static_cast<const char*>(mapped), length));  // Analyze in place.
+#else  // No mmap: stream the file.
+        std::ifstream in(path, std::ios::binary);  // Open read-only.
+        if (!in) {  // Missing or unreadable.
+            throw std::runtime_error("cannot open key file: " + path);  // Signal I/O failure.
+        }  // Close open check.
+        addStream(in);  // Block-by-block.
+#endif  // Close platform branch.
+    }  // End addFile().
+
+    StreamingDistributionReport report() const {  // Merge every worker's histogram and compute the statistics.
+        const std::uint64_t m = options_.buckets;  // Bucket count.
+        const size_t threads = states_.size();  // Histograms to merge.
+        std::uint64_t totalKeys = 0;  // n.
+        for (const ThreadState& state : states_) {  // Sum key counts.
+            totalKeys += state.keys;  // Add worker's keys.
+        }  // Close sum loop.
+
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> extra;  // (bucket, 256 * carries) over all workers, sorted by bucket.
+        for (const ThreadState& state : states_) {  // Gather carries.
+            for (const auto& carry : state.carries) {  // One entry per wrapped bucket.
+                extra.emplace_back(carry.first, carry.second * 256u);  // Carries are worth 256 keys each.
+            }  // Close carry loop.
+        }  // Close state loop.
+        std::sort(extra.begin(), extra.end());  // Bucket order, so the scan below walks it in step.
+
+        struct Partial {  // Statistics over one range of buckets.
+            std::uint64_t nonEmpty = 0;  // Non-empty buckets.
+            std::uint64_t minSize = std::numeric_limits<std::uint64_t>::max();  // Smallest bucket.
+            std::uint64_t maxSize = 0;  // Largest bucket.
+            double squaredDeviation = 0.0;  // Sum of (size - mean)^2.
+        };  // End Partial.
+        const double mean = static_cast<double>(totalKeys) / static_cast<double>(m);  // Expected bucket size.
+        std::vector<Partial> partials(threads);  // One range per worker.
+        constexpr std::uint64_t EMPTY_RUN = 8;  // Buckets checked at once for the all-empty fast path (one 8-byte load per worker).
+        auto scanRange = [&](size_t r) {  // Merge buckets [m*r/T, m*(r+1)/T) without storing the merged histogram.
+            std::uint64_t lo = m * r / threads;  // Range start (m * T < 2^64 for any sane T).
+            std::uint64_t hi = m * (r + 1) / threads;  // Range end.
+            auto next = std::lower_bound(extra.begin(), extra.end(), std::make_pair(lo, std::uint64_t{0}));  // First carry in range.
+            Partial& partial = partials[r];  // Output.
+            for (std::uint64_t b = lo; b < hi; b++) {  // Every bucket in range.
+                if ((b % EMPTY_RUN) == 0 && b + EMPTY_RUN <= hi && (next == extra.end() || next->first >= b + EMPTY_RUN)) {  // Aligned run without carries.
+                    std::uint64_t any = 0;  // OR of the run's counters over every worker.
+                    for (const CounterArray& histogram : histograms_) {  // Every histogram's slice of the run.
+                        for (std::uint64_t w = 0; w < EMPTY_RUN; w += 8) {  // 8 counters per load.
+                            std::uint64_t word;  // 8 counters.
+                            std::memcpy(&word, histogram.get() + b + w, sizeof(word));  // Alignment-safe load (workers have joined).
+                            any |= word;  // Merge.
+                        }  // Close word loop.
+                    }  // Close histogram loop.
+                    if (any == 0) {  // Sparse histograms (m >> n) are mostly empty runs.
+                        partial.minSize = 0;  // Empty buckets exist.
+                        partial.squaredDeviation += static_cast<double>(EMPTY_RUN) * mean * mean;  // EMPTY_RUN buckets of size 0.
+                        b += EMPTY_RUN - 1;  // Skip the run (the loop adds the last one).
+                        continue;  // Next run.
+                    }  // Close empty-run branch.
+                }  // Close fast-path check.
+                std::uint64_t size = 0;  // Merged bucket size.
+                for (const CounterArray& histogram : histograms_) {  // Low bytes of every histogram.
+                    size += histogram[b];  // Add its count mod 256.
+                }  // Close histogram loop.
+                while (next != extra.end() && next->first == b) {  // Carries of this bucket (one entry per worker).
+                    size += next->second;  // Add wrapped counts.
+                    ++next;  // Advance.
+                }  // Close carry loop.
+                partial.nonEmpty += (size > 0) ? 1u : 0u;  // Count non-empty.
+                partial.minSize = std::min(partial.minSize, size);  // Track minimum.
+                partial.maxSize = std::max(partial.maxSize, size);  // Track maximum.
+                double diff = static_cast<double>(size) - mean;  // Deviation.
+                partial.squaredDeviation += diff * diff;  // Accumulate.
+            }  // Close bucket loop.
+        };  // End scanRange.
+        if (threads == 1) {  // Scan inline.
+            scanRange(0);  // Whole range.
+        } else {  // Scan ranges in parallel (each reads every histogram, sequentially).
+            std::vector<std::thread> workers;  // Running scanners.
+            for (size_t r = 0; r < threads; r++) {  // One range each.
+                workers.emplace_back(scanRange, r);  // Start scanner.
+            }  // Close spawn loop.
+            for (std::thread& worker : workers) {  // Wait for every range.
+                worker.join();  // Join.
+            }  // Close join loop.
+        }  // Close scan dispatch.
+
+        StreamingDistributionReport report{};  // Value-initialized.
+        report.totalKeys = totalKeys;  // n.
+        report.buckets = m;  // m.
+        report.minBucketSize = std::numeric_limits<std::uint64_t>::max();  // Lowered by the partials.
+        double squaredDeviation = 0.0;  // Combined sum.
+        for (const Partial& partial : partials) {  // Combine ranges.
+            report.nonEmptyBuckets += partial.nonEmpty;  // Sum.
+            report.minBucketSize = std::min(report.minBucketSize, partial.minSize);  // Minimum.
+            report.maxBucketSize = std::max(report.maxBucketSize, partial.maxSize);  // Maximum.
+            squaredDeviation += partial.squaredDeviation;  // Sum.
+        }  // Close combine loop.
+        report.avgBucketSize = mean;  // n / m.
+        report.stdDeviation = std::sqrt(squaredDeviation / static_cast<double>(m));  // Population std deviation.
+        report.chiSquared = (mean > 0.0) ? squaredDeviation / mean : 0.0;  // Pearson statistic against the uniform expectation.
+        double degrees = static_cast<double>(m - 1);  // Degrees of freedom.
+        report.chiSquaredZ = (m > 1) ? (report.chiSquared - degrees) / std::sqrt(2.0 * degrees) : 0.0;  // Normal approximation (good for large m).
+
+        report.hashBits = options_.hashBits;  // Examined width.
+        report.bitBias.assign(static_cast<size_t>(options_.hashBits), 0.0);  // Filled below.
+        report.avalancheBias.assign(static_cast<size_t>(options_.hashBits), 0.0);  // Filled below.
+        std::uint64_t totalFlips = 0;  // Output bit flips over all trials.
+        for (const ThreadState& state : states_) {  // Sum trial counts.
+            report.avalancheTrials += state.avalancheTrials;  // Add worker's trials.
+        }  // Close trial loop.
+        for (int j = 0; j < options_.hashBits; j++) {  // One entry per output bit.
+            std::uint64_t ones = 0;  // Keys whose bit j is set.
+            std::uint64_t flips = 0;  // Trials that flipped bit j.
+            for (const ThreadState& state : states_) {  // Merge workers.
+                const std::uint64_t* byteValues = state.byteValues[j / 8];  // Histogram of the byte holding bit j.
+                for (unsigned v = 0; v < 256u; v++) {  // Every byte value with bit j set.
+                    ones += ((v >> (j % 8)) & 1u) ? byteValues[v] : 0u;  // Add its count.
+                }  // Close value loop.
+                flips += state.avalancheFlips[j];  // Add worker's flips.
+            }  // Close worker loop.
+            double bias = (totalKeys > 0) ? static_cast<double>(ones) / static_cast<double>(totalKeys) - 0.5 : 0.0;  // Deviation from a fair bit.
+            double avalancheBias = (report.avalancheTrials > 0) ? static_cast<double>(flips) / static_cast<double>(report.avalancheTrials) - 0.5 : 0.0;  // Deviation from a fair flip.
+            report.bitBias[static_cast<size_t>(j)] = bias;  // Store.
+            report.avalancheBias[static_cast<size_t>(j)] = avalancheBias;  // Store.
+            report.maxBitBias = std::max(report.maxBitBias, std::abs(bias));  // Track worst bit.
+            report.maxAvalancheBias = std::max(report.maxAvalancheBias, std::abs(avalancheBias));  // Track worst bit.
+            totalFlips += flips;  // Sum.
+        }  // Close bit loop.
+        report.avalancheMean = (report.avalancheTrials > 0) ? static_cast<double>(totalFlips) / (static_cast<double>(report.avalancheTrials) * options_.hashBits) : 0.0;  // Mean flip fraction.
+        return report;  // Return statistics.
+    }  // End report().
+
+private:
+    struct CounterDeleter {  // Releases a counter array from allocateCounters.
+        size_t bytes;  // Mapping length (munmap needs it).
+        void operator()(std::uint8_t* p) const {  // Release.
+#if STREAMING_DISTRIBUTION_HAS_MMAP  // Anonymous mapping.
+            ::munmap(p, bytes);  // Unmap.
+#else  // calloc block.
+            std::free(p);  // Free.
+#endif  // Close platform branch.
+        }  // End operator().
+    };  // End CounterDeleter.
+
+    using CounterArray = std::unique_ptr<std::uint8_t[], CounterDeleter>;  // Owning counter array.
+    using SharedCounter = std::atomic<std::uint8_t>;  // View of a shared array's bytes.
+    static_assert(sizeof(SharedCounter) == 1 && SharedCounter::is_always_lock_free, "shared counters reuse the byte array in place");  // Same layout as the private arrays.
+
+    static CounterArray allocateCounters(size_t bytes) {  // Zeroed array whose pages are committed on first write.
+#if STREAMING_DISTRIBUTION_HAS_MMAP  // Anonymous mapping: zero-filled, and eligible for huge pages.
+        void* mapped = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);  // Reserve.
+        if (mapped == MAP_FAILED) {  // Address space or overcommit limit.
+            throw std::bad_alloc();  // Signal allocation failure.
+        }  // Close failure branch.
+#if defined(MADV_HUGEPAGE)  // Linux transparent huge pages.
+        ::madvise(mapped, bytes, MADV_HUGEPAGE);  // Random increments over GiB-sized arrays: 2 MiB pages cut page faults and TLB misses.
+#endif  // Close THP hint.
+        return CounterArray(static_cast<std::uint8_t*>(mapped), CounterDeleter{bytes});  // Own mapping.
+#else  // Portable fallback.
+        std::uint8_t* block = static_cast<std::uint8_t*>(std::calloc(bytes, 1));  // Zeroed block.
+        if (block == nullptr) {  // m bytes did not fit.
+            throw std::bad_alloc();  // Signal allocation failure.
+        }  // Close failure branch.
+        return CounterArray(block, CounterDeleter{bytes});  // Own block.
+#endif  // Close platform branch.
+    }  // End allocateCounters().
+
+    struct ThreadState {  // Everything one worker writes; only the shared counter array (if any) is touched by others.
+        std::uint8_t* counts = nullptr;  // Bucket sizes mod 256 (one byte per bucket), in histograms_.
+        std::unordered_map<std::uint64_t, std::uint64_t> carries;  // Bucket -> times this worker wrapped its byte past 255.
+        std::uint64_t byteValues[8][256];  // Histogram of each output byte; per-bit counts are derived in report().
+        std::uint64_t avalancheFlips[64];  // Per output bit: flips seen in the avalanche test.
+        std::uint64_t avalancheTrials;  // Flipped input bits tested.
+        std::uint64_t keys;  // Keys analyzed.
+        std::uint64_t untilSample;  // Keys left before the next avalanche sample.
+        std::string scratch;  // Mutable copy of the sampled key.
+    };  // End ThreadState.
+
+    static const char* lineStartAtOrAfter(const char* p, const char* begin, const char* end) {  // First line start at or after p.
+        if (p == begin || p[-1] == '\n') {  // Already at a line start.
+            return p;  // Keep.
+        }  // Close aligned branch.
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));  // End of the line p is inside.
+        return newline ? newline + 1 : end;  // Next line, or nothing left.
+    }  // End lineStartAtOrAfter().
+
+    void processSlice(ThreadState& state, const char* p, const char* sliceEnd, const char* end) {  // Hash every line that starts in [p, sliceEnd).
+        const std::uint64_t m = options_.buckets;  // Bucket count.
+        const int bytes = (options_.hashBits + 7) / 8;  // Output bytes to histogram.
+        while (p < sliceEnd) {  // Line by line.
+            const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));  // The last line may run past sliceEnd.
+            const char* lineEnd = newline ? newline : end;  // Exclusive end of the key.
+            const char* next = newline ? newline + 1 : end;  // Start of the following line.
+            if (lineEnd > p && lineEnd[-1] == '\r') {  // CRLF log files.
+                --lineEnd;  // Drop the carriage return.
+            }  // Close CR branch.
+            if (lineEnd > p) {  // Blank lines are not keys.
+                std::string_view key(p, static_cast<size_t>(lineEnd - p));  // Key bytes, in place.
+                std::uint64_t h = static_cast<std::uint64_t>(hashFunc_(key)) & mask_;  // Raw hash.
+                std::uint64_t bucket = h % m;  // Same reduction as the analyzeDistribution adapters.
+                bool wrapped = sharedCounters_  // Did this increment take the byte from 255 to 0?
+                    ? reinterpret_cast<SharedCounter*>(state.counts)[bucket].fetch_add(1, std::memory_order_relaxed) == 255  // Exactly one worker sees each wrap.
+                    : ++state.counts[bucket] == 0;  // Private byte.
+                if (wrapped) {  // Byte wrapped: 256 more keys.
+                    state.carries[bucket] += 1;  // Record carry.
+                }  // Close wrap branch.
+                for (int b = 0; b < bytes; b++) {  // Byte histograms stand in for 64 per-bit counters.
+                    state.byteValues[b][(h >> (8 * b)) & 0xFFu] += 1;  // Count byte value.
+                }  // Close byte loop.
+                state.keys += 1;  // Count key.
+                if (options_.avalancheSampleEvery != 0 && --state.untilSample == 0) {  // Time for a bit-flip sample.
+                    state.untilSample = options_.avalancheSampleEvery;  // Re-arm.
+                    sampleAvalanche(state, key, h);  // Flip every input bit of this key.
+                }  // Close sample branch.
+            }  // Close key branch.
+            p = next;  // Advance.
+        }  // Close line loop.
+    }  // End processSlice().
+
+    void sampleAvalanche(ThreadState& state, std::string_view key, std::uint64_t h) {  // Strict avalanche test on one key.
+        state.scratch.assign(key.data(), key.size());  // Mutable copy.
+        for (size_t i = 0; i < state.scratch.size(); i++) {  // Every input byte.
+            for (int bit = 0; bit < 8; bit++) {  // Every input bit.
+                state.scratch[i] = static_cast<char>(state.scratch[i] ^ (1 << bit));  // Flip it.
+                std::uint64_t diff = (static_cast<std::uint64_t>(hashFunc_(std::string_view(state.scratch))) & mask_) ^ h;  // Output bits that changed.
+                state.scratch[i] = static_cast<char>(state.scratch[i] ^ (1 << bit));  // Restore it.
+                for (int j = 0; j < options_.hashBits; j++) {  // Tally each output bit.
+                    state.avalancheFlips[j] += (diff >> j) & 1u;  // Count flip.
+                }  // Close output-bit loop.
+                state.avalancheTrials += 1;  // Count trial.
+            }  // Close input-bit loop.
+        }  // Close byte loop.
+    }  // End sampleAvalanche().
+
+    HashFunc hashFunc_;  // Raw hash under test.
+    StreamingDistributionOptions options_;  // Validated options.
+    std::uint64_t mask_;  // Low hashBits bits.
+    std::vector<CounterArray> histograms_;  // One per worker, or a single shared one.
+    bool sharedCounters_ = false;  // Workers increment histograms_[0] atomically.
+    std::vector<ThreadState> states_;  // One per worker.
+};  // End StreamingDistributionAnalyzer.
+
+template <typename HashFunc>  // Any callable std::uint64_t(std::string_view).
+inline StreamingDistributionReport analyzeRegionDistribution(HashFunc hashFunc, std::string_view region, const StreamingDistributionOptions& options = StreamingDistributionOptions{}) {  // One-shot analysis of an in-memory or mmap'd region.
+    StreamingDistributionAnalyzer<HashFunc> analyzer(std::move(hashFunc), options);  // Allocate state.
+    analyzer.addRegion(region);  // Hash every line.
+    return analyzer.report();  // Merge and summarize.
+}  // End analyzeRegionDistribution().
+
+template <typename HashFunc>  // Any callable std::uint64_t(std::string_view).
+inline StreamingDistributionReport analyzeFileDistribution(HashFunc hashFunc, const std::string& path, const StreamingDistributionOptions& options = StreamingDistributionOptions{}) {  // One-shot analysis of a key file.
+    StreamingDistributionAnalyzer<HashFunc> analyzer(std::move(hashFunc), options);  // Allocate state.
+    analyzer.addFile(path);  // Map (or stream) and hash every line.
+    return analyzer.report();  // Merge and summarize.
+}  // End analyzeFileDistribution().
+
+}  // namespace hashfunctionsunit  // Close namespace.
+
+#endif  // STREAMING_DISTRIBUTION_HPP  // End of header guard.
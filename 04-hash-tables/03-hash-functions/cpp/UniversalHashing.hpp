@@ -9,8 +9,11 @@
 #include <random>  // Provide std::mt19937 for deterministic RNG.
 #include <stdexcept>  // Provide exceptions for validation.
 #include <string>  // Provide std::string for values.
+#include <type_traits>  // Provide std::enable_if_t for the default hash family.
 #include <utility>  // Provide std::pair for bucket entries.
 #include <vector>  // Provide std::vector for bucket storage.
+#include "HashFunctions.hpp"  // Provide fastRange32 for the multiply-add-shift family.
+#include "HashTableStats.hpp"  // Share the chapter-wide statistics interface from 01-basic-hash-table.
 
 namespace hashfunctionsunit {  // Use the same namespace as HashFunctions.hpp for this unit.
 
@@ -83,6 +86,44 @@ private:
     int b_;  // Offset parameter.
 };  // End UniversalHashFamily.
 
+// MultiplyAddShiftHashFamily: h_{a,b}(k) = ((a*k + b) mod 2^64) >> 32 for 32-bit keys, scaled into [0, m) with fastRange32.
+// With a and b uniform over 64 bits this is strongly universal onto [0, 2^32) (Dietzfelbinger 1996), and fastRange32
+// keeps Pr[h(x) = h(y)] within (1 + m / 2^32)^2 / m of ideal. One multiply, one add, no division or prime.
+class MultiplyAddShiftHashFamily {  // Same interface as UniversalHashFamily, so UniversalHashTable can use either.
+public:
+    explicit MultiplyAddShiftHashFamily(int m, std::uint32_t seed = 0u)  // Construct family with m and optional seed.
+        : m_(m),  // Store bucket count.
+          rng_(seed),  // Seed RNG (deterministic when seed is fixed).
+          a_(0),  // Initialize a (will be replaced in regenerate()).
+          b_(0) {  // Initialize b.
+        if (m_ <= 0) {  // Validate bucket count.
+            throw std::invalid_argument("m must be >= 1");  // Signal invalid input.
+        }  // Close validation.
+        regenerate();  // Choose initial parameters.
+    }  // Close constructor.
+
+    void regenerate() {  // Choose new random 64-bit parameters (a, b).
+        a_ = rng_();  // Any a works (odd is not required for the add-shift form).
+        b_ = rng_();  // b randomizes the low bits that carry into the top half.
+    }  // End regenerate().
+
+    int hash(int key) const {  // Compute hash value in [0, m).
+        std::uint64_t x = static_cast<std::uint32_t>(key);  // The 32 key bits (negative keys map to their two's complement).
+        std::uint64_t top = (a_ * x + b_) >> 32;  // Strongly universal 32-bit value.
+        return static_cast<int>(fastRange32(static_cast<std::uint32_t>(top), static_cast<std::uint32_t>(m_)));  // Equals top >> (32 - r) when m = 2^r.
+    }  // End hash().
+
+    int m() const {  // Expose m for inspection.
+        return m_;  // Return bucket count.
+    }  // End m().
+
+private:
+    int m_;  // Bucket count.
+    std::mt19937_64 rng_;  // 64-bit RNG for regenerate().
+    std::uint64_t a_;  // Multiplier parameter.
+    std::uint64_t b_;  // Offset parameter.
+};  // End MultiplyAddShiftHashFamily.
+
 class UniversalStringHashFamily {  // Represent a polynomial universal-ish hash family for strings.
 public:
     explicit UniversalStringHashFamily(int m, std::uint32_t seed = 0u, std::optional<int> p = std::nullopt)  // Construct family with m and optional seed/p.
@@ -116,21 +157,47 @@ private:
     int a_;  // Base parameter.
 };  // End UniversalStringHashFamily.
 
-class UniversalHashTable {  // A simple chained hash table for int keys using universal hashing.
+enum class UniversalStorage {  // How UniversalHashTable lays out its entries.
+    CHAINING,  // One std::vector chain per bucket.
+    OPEN_ADDRESSING  // One slot per bucket, linear probing with backward-shift deletion.
+};  // End UniversalStorage.
+
+template <typename K, typename = void>  // Primary template: no default family for this key type.
+struct DefaultUniversalFamily {};  // Pass a Family explicitly for other key types.
+
+template <typename K>  // Integral keys that fit in an int.
+struct DefaultUniversalFamily<K, std::enable_if_t<std::is_integral<K>::value && sizeof(K) <= sizeof(int)>> {  // Use ((a*k + b) mod p) mod m.
+    using type = UniversalHashFamily;  // Integer family.
+};  // End integral specialization.
+
+template <>  // String keys.
+struct DefaultUniversalFamily<std::string> {  // Use the polynomial string family.
+    using type = UniversalStringHashFamily;  // String family.
+};  // End string specialization.
+
+// UniversalHashTable<K, V, Family>: a hash table whose bucket index comes from a universal hash family.
+// Family must provide Family(int m, std::uint32_t seed), regenerate(), and int hash(const K&) const in [0, m).
+// Rebuilds (growth and defensive regeneration) move entries into the new array instead of copying them.
+template <typename K = int, typename V = std::string, typename Family = typename DefaultUniversalFamily<K>::type>  // Defaults keep the original int -> std::string table.
+class UniversalHashTable {  // A hash table for any key type with a universal hash family.
 public:
-    static constexpr double MAX_LOAD_FACTOR = 0.75;  // Resize threshold.
+    static constexpr double MAX_LOAD_FACTOR = 0.75;  // Resize threshold (chaining).
+    static constexpr double MAX_PROBE_LOAD_FACTOR = 0.5;  // Resize threshold (open addressing; linear probing clusters quickly past 0.5).
     static constexpr int MAX_CHAIN_LENGTH = 10;  // Chain length threshold for defensive rehash.
+    static constexpr int MAX_PROBE_LENGTH = 128;  // Probe length threshold for defensive rehash (open addressing).
 
-    explicit UniversalHashTable(int capacity = 16, std::uint32_t seed = 0u)  // Construct table with capacity and base seed.
+    explicit UniversalHashTable(int capacity = 16, std::uint32_t seed = 0u, UniversalStorage storage = UniversalStorage::CHAINING)  // Construct table with capacity, base seed and layout.
         : capacity_(capacity),  // Store capacity.
           size_(0),  // Start empty.
-          buckets_(static_cast<size_t>(capacity), std::vector<std::pair<int, std::string>>{}),  // Allocate empty bucket chains.
+          storage_(storage),  // Store layout.
           seed_(seed),  // Store base seed.
-          hashFamily_(capacity, seed),  // Create hash family for current capacity.
+          hashFamily_(validCapacity(capacity), seed),  // Create hash family for current capacity.
           rehashCount_(0) {  // Start with no rehashes.
-        if (capacity_ <= 0) {  // Validate capacity.
-            throw std::invalid_argument("capacity must be >= 1");  // Signal invalid input.
-        }  // Close validation.
+        if (storage_ == UniversalStorage::CHAINING) {  // Allocate the chosen layout only.
+            buckets_.resize(static_cast<size_t>(capacity_));  // Empty bucket chains.
+        } else {  // Open addressing.
+            slots_.resize(static_cast<size_t>(capacity_));  // Empty slots.
+        }  // Close layout branch.
     }  // Close constructor.
 
     int size() const {  // Expose current number of pairs.
@@ -141,6 +208,10 @@ public:
         return capacity_;  // Return capacity.
     }  // End capacity().
 
+    UniversalStorage storage() const {  // Expose the layout chosen at construction.
+        return storage_;  // Return layout.
+    }  // End storage().
+
     int rehashCount() const {  // Expose number of defensive rehashes.
         return rehashCount_;  // Return rehash count.
     }  // End rehashCount().
@@ -149,94 +220,293 @@ public:
         return static_cast<double>(size_) / static_cast<double>(capacity_);  // Return load factor.
     }  // End loadFactor().
 
-    void insert(int key, const std::string& value) {  // Insert or update key->value.
+    void insert(const K& key, const V& value) {  // Insert or update key->value (copies both).
+        insert(K(key), V(value));  // Delegate to the moving overload.
+    }  // End insert(const&).
+
+    void insert(K&& key, V&& value) {  // Insert or update key->value, moving both into the table.
+        if (storage_ == UniversalStorage::OPEN_ADDRESSING) {  // Dispatch on layout.
+            insertSlot(std::move(key), std::move(value));  // Linear probing path.
+            return;  // Done.
+        }  // Close layout branch.
         int index = hashFamily_.hash(key);  // Compute bucket index.
         auto& bucket = buckets_[static_cast<size_t>(index)];  // Reference bucket chain.
 
+        HASH_TABLE_STATS_ONLY(size_t probes = 0;)  // Count compared entries (stats builds only).
         for (auto& kv : bucket) {  // Search for existing key.
+            HASH_TABLE_STATS_ONLY(++probes);  // One more entry compared.
             if (kv.first == key) {  // Update existing key.
-                kv.second = value;  // Overwrite value.
+                kv.second = std::move(value);  // Overwrite value.
+                HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Record the update's probe length.
                 return;  // Size does not change for updates.
             }  // Close match branch.
         }  // Close scan loop.
 
-        bucket.push_back(std::make_pair(key, value));  // Append new entry.
+        HASH_TABLE_STATS_ONLY(size_t oldCapacity = bucket.capacity();)  // Remember chain capacity to track growth.
+        bucket.emplace_back(std::move(key), std::move(value));  // Append new entry.
         size_ += 1;  // Increase size.
+#if HASH_TABLE_STATS  // Update statistics for the appended entry.
+        chainBytes_ += (bucket.capacity() - oldCapacity) * sizeof(Entry);  // Account for chain reallocation.
+        stats_.chainResized(bucket.size() - 1, bucket.size());  // Chain grew by one.
+        stats_.recordProbes(probes + 1);  // Linking a new entry counts as one probe, as in ChainedHashTable.
+#endif  // Close statistics block.
 
         if (loadFactor() > MAX_LOAD_FACTOR) {  // Resize when load factor is too high.
             resize();  // Rehash into larger table.
         } else if (static_cast<int>(bucket.size()) > MAX_CHAIN_LENGTH) {  // Regenerate when chain becomes suspiciously long.
             regenerateHash();  // Defensive rehash.
         }  // Close defense branch.
-    }  // End insert().
-
-    std::optional<std::string> search(int key) const {  // Search key and return value (nullopt when missing).
-        int index = hashFamily_.hash(key);  // Compute bucket index.
-        const auto& bucket = buckets_[static_cast<size_t>(index)];  // Reference bucket chain.
-        for (const auto& kv : bucket) {  // Scan chain.
-            if (kv.first == key) {  // Match found.
-                return kv.second;  // Return stored value.
-            }  // Close match branch.
-        }  // Close scan loop.
-        return std::nullopt;  // Not found.
+    }  // End insert(&&).
+
+    std::optional<V> search(const K& key) const {  // Search key and return value (nullopt when missing).
+        size_t probes = 0;  // Count compared entries (recorded in stats builds only).
+        const Entry* found = findEntry(key, probes);  // Locate the entry in either layout.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Record hit or miss probe length.
+        if (found == nullptr) {  // Missing key.
+            return std::nullopt;  // Not found.
+        }  // Close miss branch.
+        return found->second;  // Return stored value.
     }  // End search().
 
-    bool erase(int key) {  // Delete key; return true if removed.
+    bool contains(const K& key) const {  // Check membership without copying the value (works for move-only V).
+        size_t probes = 0;  // Count compared entries (recorded in stats builds only).
+        const Entry* found = findEntry(key, probes);  // Locate the entry in either layout.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Record hit or miss probe length.
+        return found != nullptr;  // Present when found.
+    }  // End contains().
+
+    bool erase(const K& key) {  // Delete key; return true if removed.
+        if (storage_ == UniversalStorage::OPEN_ADDRESSING) {  // Dispatch on layout.
+            return eraseSlot(key);  // Backward-shift deletion.
+        }  // Close layout branch.
         int index = hashFamily_.hash(key);  // Compute bucket index.
         auto& bucket = buckets_[static_cast<size_t>(index)];  // Reference bucket chain.
         for (size_t i = 0; i < bucket.size(); i++) {  // Scan chain for key.
             if (bucket[i].first == key) {  // Match found.
                 bucket.erase(bucket.begin() + static_cast<std::ptrdiff_t>(i));  // Remove entry.
                 size_ -= 1;  // Decrease size.
+                HASH_TABLE_STATS_ONLY(stats_.recordProbes(i + 1));  // Entries compared up to the match.
+                HASH_TABLE_STATS_ONLY(stats_.chainResized(bucket.size() + 1, bucket.size()));  // Chain shrank by one.
                 return true;  // Report success.
             }  // Close match branch.
         }  // Close loop.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(bucket.size()));  // A miss compares the whole chain.
         return false;  // Not found.
     }  // End erase().
 
-    int getMaxChainLength() const {  // Compute maximum chain length across buckets.
-        int maxLen = 0;  // Track maximum chain length.
+    int getMaxChainLength() const {  // Longest chain (chaining) or longest probe sequence of a stored key (open addressing).
+        int maxLen = 0;  // Track maximum length.
+        if (storage_ == UniversalStorage::OPEN_ADDRESSING) {  // Probe sequences instead of chains.
+            for (size_t i = 0; i < slots_.size(); i++) {  // Scan all slots.
+                if (slots_[i].has_value()) {  // Only stored keys have a probe sequence.
+                    maxLen = std::max(maxLen, static_cast<int>(distance(homeSlot(slots_[i]->first), i)) + 1);  // Home slot counts as one probe.
+                }  // Close occupied branch.
+            }  // Close scan loop.
+            return maxLen;  // Return longest probe sequence.
+        }  // Close layout branch.
         for (const auto& bucket : buckets_) {  // Scan all buckets.
             maxLen = std::max(maxLen, static_cast<int>(bucket.size()));  // Update max.
         }  // Close scan loop.
         return maxLen;  // Return maximum chain length.
     }  // End getMaxChainLength().
 
+    template <typename Fn>  // Any callable (const K&, const V&).
+    void forEach(Fn&& fn) const {  // Visit every stored pair in storage order.
+        for (const auto& bucket : buckets_) {  // Chaining layout (empty for open addressing).
+            for (const auto& kv : bucket) {  // Visit chain.
+                fn(kv.first, kv.second);  // Report pair.
+            }  // Close chain loop.
+        }  // Close bucket loop.
+        for (const auto& slot : slots_) {  // Open-addressing layout (empty for chaining).
+            if (slot.has_value()) {  // Skip empty slots.
+                fn(slot->first, slot->second);  // Report pair.
+            }  // Close occupied branch.
+        }  // Close slot loop.
+    }  // End forEach().
+
+#if HASH_TABLE_STATS  // Statistics exist only when compiled with HASH_TABLE_STATS=1.
+    HashTableStats stats() const {  // Snapshot of the live statistics (no bucket scan).
+        HashTableStats result;  // Start from an empty snapshot.
+        result.size = static_cast<size_t>(size_);  // Copy element count.
+        result.capacity = static_cast<size_t>(capacity_);  // Copy bucket count.
+        if (storage_ == UniversalStorage::OPEN_ADDRESSING) {  // No chains; backward-shift deletion leaves no tombstones.
+            stats_.fill(result, 0);  // Probe histogram and rebuilds only.
+            result.bytesAllocated = slots_.capacity() * sizeof(Slot);  // Slot array.
+            return result;  // Return snapshot.
+        }  // Close layout branch.
+        stats_.fill(result, static_cast<size_t>(capacity_));  // Copy histograms and derive empty buckets.
+        result.bytesAllocated = buckets_.capacity() * sizeof(Bucket) + chainBytes_;  // Bucket array plus chain storage.
+        return result;  // Return snapshot.
+    }  // End stats().
+
+    void resetStats() {  // Zero the probe and rebuild counters (rehashCount() is unaffected).
+        stats_.resetCounters();  // Delegate to the recorder.
+    }  // End resetStats().
+#endif  // Close statistics block.
+
 private:
+    using Entry = std::pair<K, V>;  // One stored pair.
+    using Bucket = std::vector<Entry>;  // One chain; its capacity is tracked for bytesAllocated.
+    using Slot = std::optional<Entry>;  // One open-addressing slot (empty = nullopt).
+
     int capacity_;  // Number of buckets.
     int size_;  // Number of stored entries.
-    std::vector<std::vector<std::pair<int, std::string>>> buckets_;  // Bucket array: each bucket is a vector chain.
+    UniversalStorage storage_;  // Chosen layout.
+    std::vector<Bucket> buckets_;  // Bucket array: each bucket is a vector chain (chaining only).
+    std::vector<Slot> slots_;  // Slot array (open addressing only).
     std::uint32_t seed_;  // Base seed for deterministic rehashing in tests.
-    mutable UniversalHashFamily hashFamily_;  // Hash family for bucket indices (mutable to allow regenerate).
+    mutable Family hashFamily_;  // Hash family for bucket indices (mutable to allow regenerate).
     int rehashCount_;  // Count of defensive rehashes.
+#if HASH_TABLE_STATS  // Statistics members exist only when enabled.
+    mutable HashTableStatsRecorder stats_;  // Live statistics (search is const).
+    size_t chainBytes_ = 0;  // Heap bytes held by all chains (sum of capacities), tracked on growth.
+#endif  // Close statistics block.
 
-    void resize() {  // Double capacity and reinsert all entries (rehash).
-        std::vector<std::vector<std::pair<int, std::string>>> oldBuckets = buckets_;  // Copy old buckets.
-        capacity_ *= 2;  // Double capacity.
-        buckets_.assign(static_cast<size_t>(capacity_), std::vector<std::pair<int, std::string>>{});  // Allocate new empty buckets.
-        seed_ += 1u;  // Change seed so new hash family differs after resize.
-        hashFamily_ = UniversalHashFamily(capacity_, seed_);  // Create new hash family for new capacity.
-        size_ = 0;  // Reset size and reinsert.
+    static int validCapacity(int capacity) {  // Validate before the hash family sees the capacity.
+        if (capacity <= 0) {  // Validate capacity.
+            throw std::invalid_argument("capacity must be >= 1");  // Signal invalid input.
+        }  // Close validation.
+        return capacity;  // Pass through.
+    }  // End validCapacity().
+
+    size_t homeSlot(const K& key) const {  // First slot probed for key.
+        return static_cast<size_t>(hashFamily_.hash(key));  // Family already reduces mod capacity.
+    }  // End homeSlot().
+
+    size_t nextSlot(size_t i) const {  // Linear probing step with wrap-around.
+        return (i + 1 == slots_.size()) ? 0 : i + 1;  // Wrap at the end (capacity is not a power of two).
+    }  // End nextSlot().
+
+    size_t distance(size_t from, size_t to) const {  // Forward distance from slot `from` to slot `to`.
+        return (to >= from) ? to - from : to + slots_.size() - from;  // Account for wrap-around.
+    }  // End distance().
+
+    const Entry* findEntry(const K& key, size_t& probes) const {  // Locate key in either layout, counting compared entries.
+        if (storage_ == UniversalStorage::OPEN_ADDRESSING) {  // Linear probing.
+            for (size_t i = homeSlot(key); slots_[i].has_value(); i = nextSlot(i)) {  // Stop at the first empty slot.
+                ++probes;  // One more slot compared.
+                if (slots_[i]->first == key) {  // Match found.
+                    return &*slots_[i];  // Return entry.
+                }  // Close match branch.
+            }  // Close probe loop.
+            return nullptr;  // Empty slot reached: missing.
+        }  // Close layout branch.
+        for (const auto& kv : buckets_[static_cast<size_t>(hashFamily_.hash(key))]) {  // Scan chain.
+            ++probes;  // One more entry compared.
+            if (kv.first == key) {  // Match found.
+                return &kv;  // Return entry.
+            }  // Close match branch.
+        }  // Close scan loop.
+        return nullptr;  // Missing.
+    }  // End findEntry().
+
+    void insertSlot(K&& key, V&& value) {  // Open-addressing insert or update.
+        size_t probes = 0;  // Slots compared before the empty slot.
+        size_t i = homeSlot(key);  // Start at the home slot.
+        for (; slots_[i].has_value(); i = nextSlot(i)) {  // Walk the cluster.
+            ++probes;  // One more slot compared.
+            if (slots_[i]->first == key) {  // Update existing key.
+                slots_[i]->second = std::move(value);  // Overwrite value.
+                HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Record the update's probe length.
+                return;  // Size does not change for updates.
+            }  // Close match branch.
+        }  // Close probe loop.
+        slots_[i].emplace(std::move(key), std::move(value));  // Fill the empty slot.
+        size_ += 1;  // Increase size.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes + 1));  // The empty slot counts as one probe.
 
-        for (const auto& bucket : oldBuckets) {  // Reinsert entries into new buckets.
-            for (const auto& kv : bucket) {  // Reinsert one entry.
-                insert(kv.first, kv.second);  // Use insert to maintain invariants.
+        if (loadFactor() > MAX_PROBE_LOAD_FACTOR) {  // Resize when load factor is too high.
+            resize();  // Rehash into larger table.
+        } else if (static_cast<int>(probes) > MAX_PROBE_LENGTH) {  // Regenerate when a cluster becomes suspiciously long.
+            regenerateHash();  // Defensive rehash.
+        }  // Close defense branch.
+    }  // End insertSlot().
+
+    bool eraseSlot(const K& key) {  // Open-addressing delete with backward shift (no tombstones).
+        HASH_TABLE_STATS_ONLY(size_t probes = 0;)  // Count compared slots (stats builds only).
+        size_t hole = homeSlot(key);  // Candidate slot.
+        for (; slots_[hole].has_value(); hole = nextSlot(hole)) {  // Walk the cluster.
+            HASH_TABLE_STATS_ONLY(++probes);  // One more slot compared.
+            if (slots_[hole]->first == key) {  // Match found.
+                break;  // Stop at the match.
+            }  // Close match branch.
+        }  // Close probe loop.
+        HASH_TABLE_STATS_ONLY(stats_.recordProbes(probes));  // Record hit or miss probe length.
+        if (!slots_[hole].has_value()) {  // Empty slot reached: missing.
+            return false;  // Not found.
+        }  // Close miss branch.
+        slots_[hole].reset();  // Remove entry.
+        size_ -= 1;  // Decrease size.
+        for (size_t j = nextSlot(hole); slots_[j].has_value(); j = nextSlot(j)) {  // Shift later cluster members back.
+            size_t home = homeSlot(slots_[j]->first);  // Where this entry wants to live.
+            if (distance(home, j) >= distance(hole, j)) {  // The hole lies on its probe path: move it back.
+                slots_[hole] = std::move(slots_[j]);  // Fill the hole.
+                slots_[j].reset();  // Open a new hole.
+                hole = j;  // Continue from the new hole.
+            }  // Close shift branch.
+        }  // Close shift loop.
+        return true;  // Report success.
+    }  // End eraseSlot().
+
+    void redistribute(int newCapacity) {  // Move every entry into a fresh array under the current hash family.
+#if HASH_TABLE_STATS  // Every chain is rebuilt from scratch.
+        stats_.resetChains();  // Chains are re-counted as entries land.
+#endif  // Close statistics block.
+        capacity_ = newCapacity;  // Adopt new capacity.
+        if (storage_ == UniversalStorage::OPEN_ADDRESSING) {  // Open-addressing layout.
+            std::vector<Slot> oldSlots(static_cast<size_t>(newCapacity));  // Fresh empty slots.
+            slots_.swap(oldSlots);  // Old slots move aside without copying.
+            for (Slot& slot : oldSlots) {  // Visit old slots.
+                if (slot.has_value()) {  // Occupied slot.
+                    size_t i = homeSlot(slot->first);  // New home slot.
+                    while (slots_[i].has_value()) {  // Probe for the first empty slot (keys are unique).
+                        i = nextSlot(i);  // Next slot.
+                    }  // Close probe loop.
+                    slots_[i] = std::move(slot);  // Move the entry over.
+                }  // Close occupied branch.
+            }  // Close slot loop.
+            return;  // oldSlots is freed here.
+        }  // Close layout branch.
+        std::vector<Bucket> oldBuckets(static_cast<size_t>(newCapacity));  // Fresh empty chains.
+        buckets_.swap(oldBuckets);  // Old chains move aside without copying.
+        for (Bucket& chain : oldBuckets) {  // Visit old chains.
+            for (Entry& kv : chain) {  // Move each entry to its new chain.
+                Bucket& target = buckets_[static_cast<size_t>(hashFamily_.hash(kv.first))];  // New chain.
+                target.push_back(std::move(kv));  // Move, not copy.
+                HASH_TABLE_STATS_ONLY(stats_.chainResized(target.size() - 1, target.size()));  // Chain grew by one.
             }  // Close entry loop.
+            Bucket().swap(chain);  // Free the drained chain now, keeping peak memory near one copy of the entries.
         }  // Close bucket loop.
+        HASH_TABLE_STATS_ONLY(recountChainBytes());  // Chain capacities changed; recount once per rebuild.
+    }  // End redistribute().
+
+#if HASH_TABLE_STATS  // Statistics helper exists only when enabled.
+    void recountChainBytes() {  // Sum chain capacities after the bucket array is rebuilt.
+        chainBytes_ = 0;  // Start from zero.
+        for (const Bucket& chain : buckets_) {  // Visit every chain.
+            chainBytes_ += chain.capacity() * sizeof(Entry);  // Add its storage.
+        }  // Close loop.
+    }  // End recountChainBytes().
+#endif  // Close statistics block.
+
+    void resize() {  // Double capacity and move all entries (rehash).
+#if HASH_TABLE_STATS  // Time the rebuild.
+        stats_.countRehash();  // Count growth and defensive rehashes alike.
+        HashTableStatsRecorder::RehashScope rehashScope(stats_);  // Measure wall time until return.
+#endif  // Close statistics block.
+        seed_ += 1u;  // Change seed so new hash family differs after resize.
+        hashFamily_ = Family(capacity_ * 2, seed_);  // Create new hash family for new capacity.
+        redistribute(capacity_ * 2);  // Move entries into the doubled array.
     }  // End resize().
 
     void regenerateHash() {  // Regenerate parameters and redistribute without changing capacity.
+#if HASH_TABLE_STATS  // Time the rebuild.
+        stats_.countRehash();  // Count growth and defensive rehashes alike.
+        HashTableStatsRecorder::RehashScope rehashScope(stats_);  // Measure wall time until return.
+#endif  // Close statistics block.
         rehashCount_ += 1;  // Count this defensive rehash.
-        std::vector<std::vector<std::pair<int, std::string>>> oldBuckets = buckets_;  // Copy old buckets.
-        buckets_.assign(static_cast<size_t>(capacity_), std::vector<std::pair<int, std::string>>{});  // Allocate new empty buckets.
         hashFamily_.regenerate();  // Choose new parameters.
-        size_ = 0;  // Reset size and reinsert.
-
-        for (const auto& bucket : oldBuckets) {  // Reinsert entries.
-            for (const auto& kv : bucket) {  // Reinsert one entry.
-                insert(kv.first, kv.second);  // Use insert to maintain invariants.
-            }  // Close entry loop.
-        }  // Close bucket loop.
+        redistribute(capacity_);  // Move entries into a fresh array of the same size.
     }  // End regenerateHash().
 };  // End UniversalHashTable.
 
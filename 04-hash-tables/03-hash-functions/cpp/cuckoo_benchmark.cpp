@@ -0,0 +1,147 @@
+// 03 布穀鳥雜湊效能量測（C++）/ Cuckoo hashing benchmark (C++).  // Bilingual file header.
+//
+// Part 1: insert failure rate, stash usage and rebuilds at fixed size for loads 0.5 .. 0.98 over several seeds.
+// Part 2: lookup latency percentiles (hit and miss) vs UniversalHashTable (chaining) and std::unordered_map.
+// Usage: ./cuckoo_benchmark [log2(buckets)=16] [seeds=10]
+
+#include "CuckooHashing.hpp"  // Cuckoo table under test.
+#include "UniversalHashing.hpp"  // Chained universal-hash table for comparison.
+
+#include <algorithm>  // Provide std::sort.
+#include <chrono>  // Provide steady_clock timing.
+#include <cstdint>  // Provide fixed-width integer types.
+#include <iomanip>  // Provide output formatting.
+#include <iostream>  // Provide std::cout for reports.
+#include <string>  // Provide std::string / std::stoi.
+#include <unordered_map>  // Provide std::unordered_map for comparison.
+#include <vector>  // Provide std::vector for keys and samples.
+
+using Clock = std::chrono::steady_clock;  // Monotonic clock for timing.
+
+static const int BATCH = 16;  // Lookups per timed sample (amortizes clock overhead).
+
+static int scrambleKey(std::uint32_t x) {  // murmur3 fmix32: bijective, so consecutive inputs give unique spread keys.
+    x ^= x >> 16;  // Mix high bits down.
+    x *= 0x85ebca6bu;  // Multiply by odd constant.
+    x ^= x >> 13;  // Mix again.
+    x *= 0xc2b2ae35u;  // Multiply by odd constant.
+    x ^= x >> 16;  // Final mix.
+    return static_cast<int>(x);  // Reinterpret as int key.
+}  // End scrambleKey().
+
+static double percentile(const std::vector<double>& sorted, double q) {  // q-th percentile of a sorted sample.
+    std::size_t index = static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1));  // Nearest-rank index.
+    return sorted[index];  // Return sample value.
+}  // End percentile().
+
+template <typename Lookup>  // Any callable int -> bool.
+static std::vector<double> sampleLatency(const std::vector<int>& keys, Lookup lookup, long long& checksum) {  // Per-lookup ns for each batch of BATCH keys.
+    std::vector<double> samples;  // Collected samples.
+    samples.reserve(keys.size() / BATCH + 1);  // One sample per batch.
+    for (std::size_t i = 0; i + BATCH <= keys.size(); i += BATCH) {  // Walk keys batch by batch.
+        Clock::time_point start = Clock::now();  // Start batch timer.
+        for (int j = 0; j < BATCH; j++) {  // Run the batch.
+            checksum += lookup(keys[i + static_cast<std::size_t>(j)]) ? 1 : 0;  // Keep results live.
+        }  // Close batch loop.
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();  // Batch duration.
+        samples.push_back(ns / BATCH);  // Store per-lookup average for this batch.
+    }  // Close sample loop.
+    std::sort(samples.begin(), samples.end());  // Sort for percentiles.
+    return samples;  // Return sorted samples.
+}  // End sampleLatency().
+
+static void printLatency(const std::string& name, const std::vector<double>& hit, const std::vector<double>& miss) {  // Print one latency row.
+    std::cout << "  " << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)  // Row label.
+              << std::setw(9) << percentile(hit, 0.5) << std::setw(9) << percentile(hit, 0.99)  // Hit p50 / p99.
+              << std::setw(9) << percentile(hit, 0.999) << std::setw(9) << hit.back()  // Hit p99.9 / max.
+              << std::setw(9) << percentile(miss, 0.5) << std::setw(9) << percentile(miss, 0.99)  // Miss p50 / p99.
+              << std::setw(9) << percentile(miss, 0.999) << std::setw(9) << miss.back() << "\n";  // Miss p99.9 / max.
+}  // End printLatency().
+
+static void runFailureRates(int buckets, int seeds) {  // Part 1: how often eviction chains fail at each load.
+    const double loads[] = {0.5, 0.8, 0.9, 0.95, 0.98};  // Target slot occupancies (4-way buckets saturate near 0.98).
+    std::cout << "== Insert failures (buckets=" << buckets << ", slots=" << buckets * hashfunctionsunit::CuckooHashTable::SLOTS_PER_BUCKET  // Section header.
+              << ", seeds=" << seeds << ") ==\n";  // Section header (cont.).
+    std::cout << std::setw(6) << "load" << std::setw(14) << "fail rate" << std::setw(12) << "stashed"  // Column titles.
+              << std::setw(12) << "rehashes" << std::setw(14) << "kicks/insert" << std::setw(12) << "grew" << "\n";  // Column titles (cont.).
+    for (double load : loads) {  // One row per load.
+        long long failed = 0;  // Failed eviction chains across seeds.
+        long long stashed = 0;  // Stash placements across seeds.
+        long long rehashes = 0;  // Rebuilds across seeds.
+        long long kicks = 0;  // Evictions across seeds.
+        long long inserts = 0;  // Inserts across seeds.
+        int grew = 0;  // Runs whose rebuilds had to double the table.
+        for (int seed = 0; seed < seeds; seed++) {  // Independent runs.
+            hashfunctionsunit::CuckooHashTable ht(buckets, static_cast<std::uint32_t>(seed) * 1000u);  // Fresh table per seed.
+            ht.setMaxLoadFactor(0.99);  // Pin the size: no load-driven growth below 99%.
+            int n = static_cast<int>(load * static_cast<double>(ht.capacity()));  // Entries for this load.
+            for (int i = 0; i < n; i++) {  // Insert distinct keys.
+                ht.insert(scrambleKey(static_cast<std::uint32_t>(i) + static_cast<std::uint32_t>(seed) * 0x01000000u), i);  // Different key set per seed.
+            }  // Close insert loop.
+            failed += ht.failedInserts();  // Accumulate failures.
+            stashed += ht.stashedInserts();  // Accumulate stash usage.
+            rehashes += ht.rehashCount();  // Accumulate rebuilds.
+            kicks += ht.totalKicks();  // Accumulate evictions.
+            inserts += n;  // Accumulate inserts.
+            grew += ht.bucketCount() > buckets ? 1 : 0;  // Count forced growth.
+        }  // Close seed loop.
+        std::cout << std::fixed << std::setprecision(2) << std::setw(6) << load  // Load column.
+                  << std::scientific << std::setprecision(2) << std::setw(14) << static_cast<double>(failed) / static_cast<double>(inserts)  // Failure rate.
+                  << std::setw(12) << stashed << std::setw(12) << rehashes  // Stash and rebuild counts.
+                  << std::fixed << std::setprecision(3) << std::setw(14) << static_cast<double>(kicks) / static_cast<double>(inserts)  // Average evictions.
+                  << std::setw(12) << grew << "\n";  // Forced growth count.
+    }  // Close load loop.
+}  // End runFailureRates().
+
+static void runLatency(int buckets, long long& checksum) {  // Part 2: lookup latency distribution at load 0.9.
+    hashfunctionsunit::CuckooHashTable cuckoo(buckets, 42u);  // Cuckoo table at fixed size.
+    cuckoo.setMaxLoadFactor(0.95);  // Keep it at the requested load.
+    int n = static_cast<int>(0.9 * static_cast<double>(cuckoo.capacity()));  // 90% of slots.
+    std::vector<int> hits(static_cast<std::size_t>(n));  // Present keys.
+    std::vector<int> misses(static_cast<std::size_t>(n));  // Absent keys.
+    for (int i = 0; i < n; i++) {  // Build disjoint key sets.
+        hits[static_cast<std::size_t>(i)] = scrambleKey(static_cast<std::uint32_t>(i));  // Present key.
+        misses[static_cast<std::size_t>(i)] = scrambleKey(static_cast<std::uint32_t>(i + n));  // Absent key.
+    }  // Close key loop.
+
+    hashfunctionsunit::UniversalHashTable chained(buckets, 42u);  // Chained table (grows past 0.75 on its own).
+    std::unordered_map<int, int> stdMap;  // Standard library reference.
+    stdMap.reserve(static_cast<std::size_t>(n));  // Avoid rehash during setup.
+    for (int i = 0; i < n; i++) {  // Fill all three tables.
+        cuckoo.insert(hits[static_cast<std::size_t>(i)], i);  // Cuckoo insert.
+        chained.insert(hits[static_cast<std::size_t>(i)], "v");  // Chained insert (short value keeps SSO).
+        stdMap[hits[static_cast<std::size_t>(i)]] = i;  // std insert.
+    }  // Close fill loop.
+    std::reverse(hits.begin(), hits.end());  // Look up in a different order than inserted.
+
+    std::cout << "\n== Lookup latency, ns/lookup over batches of " << BATCH << " (n=" << n << ", cuckoo load="  // Section header.
+              << std::fixed << std::setprecision(3) << cuckoo.loadFactor() << ", stash=" << cuckoo.stashSize() << ") ==\n";  // Section header (cont.).
+    std::cout << "  " << std::left << std::setw(20) << "table" << std::right  // Column titles.
+              << std::setw(9) << "hit p50" << std::setw(9) << "p99" << std::setw(9) << "p99.9" << std::setw(9) << "max"  // Hit columns.
+              << std::setw(9) << "miss p50" << std::setw(9) << "p99" << std::setw(9) << "p99.9" << std::setw(9) << "max" << "\n";  // Miss columns.
+
+    auto cuckooLookup = [&cuckoo](int key) { return cuckoo.contains(key); };  // Cuckoo lookup.
+    auto chainedLookup = [&chained](int key) { return chained.search(key).has_value(); };  // Chained lookup.
+    auto stdLookup = [&stdMap](int key) { return stdMap.find(key) != stdMap.end(); };  // std lookup.
+    std::vector<double> hit = sampleLatency(hits, cuckooLookup, checksum);  // Cuckoo hits.
+    std::vector<double> miss = sampleLatency(misses, cuckooLookup, checksum);  // Cuckoo misses.
+    printLatency("CuckooHashTable", hit, miss);  // Print cuckoo row.
+    hit = sampleLatency(hits, chainedLookup, checksum);  // Chained hits.
+    miss = sampleLatency(misses, chainedLookup, checksum);  // Chained misses.
+    printLatency("UniversalHashTable", hit, miss);  // Print chained row.
+    hit = sampleLatency(hits, stdLookup, checksum);  // std hits.
+    miss = sampleLatency(misses, stdLookup, checksum);  // std misses.
+    printLatency("std::unordered_map", hit, miss);  // Print std row.
+}  // End runLatency().
+
+int main(int argc, char** argv) {  // Entry point for the benchmark.
+    int logBuckets = (argc > 1) ? std::stoi(argv[1]) : 16;  // Default 2^16 buckets (2^18 slots).
+    int seeds = (argc > 2) ? std::stoi(argv[2]) : 10;  // Independent runs per load.
+    int buckets = 1 << logBuckets;  // Bucket count.
+    long long checksum = 0;  // Keeps lookups from being optimized away.
+
+    runFailureRates(buckets, seeds);  // Part 1.
+    runLatency(buckets, checksum);  // Part 2.
+    std::cout << "\nchecksum=" << checksum << "\n";  // Print checksum.
+    return 0;  // Exit success.
+}  // End main().
@@ -0,0 +1,138 @@
+// 03 整數雜湊吞吐量與品質量測（C++）/ Integer hash throughput and quality benchmark (C++).  // Bilingual file header.
+//
+// Throughput: hashes the same key array with every integer hash into a bucket count read at run time (so the
+// compiler cannot turn `% m` into a multiply) and reports ns/key, minimum over rounds.
+// Quality: feeds every hash through analyzeDistribution over sequential, stride-1024 and random keys, into
+// m = 1024 and m = 1000.
+// Usage: ./integer_hash_benchmark [keys=65536] [rounds=200] [qualityKeys=100000]
+
+#include "HashFunctions.hpp"  // Hash functions under test.
+#include "UniversalHashing.hpp"  // Universal families under test.
+
+#include <algorithm>  // Provide std::min for best-of-rounds.
+#include <chrono>  // Provide steady_clock timing.
+#include <cmath>  // Provide std::sqrt and std::floor for the reference formulas.
+#include <cstdint>  // Provide fixed-width integers.
+#include <iomanip>  // Provide output formatting.
+#include <iostream>  // Provide std::cout for reports.
+#include <random>  // Provide std::mt19937 for random keys.
+#include <string>  // Provide std::stoi for arguments.
+#include <vector>  // Provide key lists.
+
+using Clock = std::chrono::steady_clock;  // Monotonic clock for timing.
+
+static int floatMultiplicationHash(int key, int m) {  // multiplicationHash as it was before: key * A in double, floor, clamp.
+    double aConst = (std::sqrt(5.0) - 1.0) / 2.0;  // Golden ratio conjugate.
+    double product = static_cast<double>(key) * aConst;  // Multiply key by A in floating-point.
+    double fractional = product - std::floor(product);  // Extract fractional part in [0, 1).
+    int index = static_cast<int>(std::floor(static_cast<double>(m) * fractional));  // Scale by m and take floor.
+    if (index >= m) {  // Clamp for rounding edge cases.
+        index = m - 1;  // Clamp to last valid bucket.
+    }  // Close clamp branch.
+    return index < 0 ? 0 : index;  // Defensive clamp.
+}  // End floatMultiplicationHash().
+
+static int log2Exact(int m) {  // r such that m = 2^r, or -1 when m is not a power of two.
+    for (int r = 0; r < 31; r++) {  // Try every shift.
+        if ((1 << r) == m) {  // Found.
+            return r;  // Return exponent.
+        }  // Close match branch.
+    }  // Close loop.
+    return -1;  // Not a power of two.
+}  // End log2Exact().
+
+template <typename HashFunc>  // Any (key, m) -> index callable; inlined into the timing loop.
+static double nsPerKey(HashFunc hashFunc, const std::vector<int>& keys, int m, size_t rounds, std::uint64_t& sink) {  // Best-of-rounds time per key.
+    double best = 1e30;  // Minimum over rounds filters scheduler noise.
+    for (size_t r = 0; r < rounds; r++) {  // Repeat the key set.
+        Clock::time_point start = Clock::now();  // Round start.
+        std::uint64_t sum = 0;  // Keeps results live.
+        for (int key : keys) {  // Independent hashes: measures throughput, not latency.
+            sum += static_cast<std::uint64_t>(hashFunc(key, m));  // Accumulate.
+        }  // Close key loop.
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();  // Round time.
+        best = std::min(best, ns / static_cast<double>(keys.size()));  // Keep the fastest round.
+        sink += sum;  // Publish.
+    }  // Close round loop.
+    return best;  // ns per key.
+}  // End nsPerKey().
+
+static void runThroughput(const std::vector<int>& keys, size_t rounds, int m) {  // Time every hash into m buckets.
+    int r = log2Exact(m);  // Shift for the power-of-two-only hashes.
+    hashfunctionsunit::UniversalHashFamily universal(m, 42u);  // ((a*k + b) mod p) mod m.
+    hashfunctionsunit::MultiplyAddShiftHashFamily mas(m, 42u);  // ((a*k + b) >> 32) scaled by fastRange32.
+    std::uint64_t sink = 0;  // Keeps every result live.
+    auto row = [](const char* name, double ns) {  // Print one row.
+        std::cout << "  " << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(2) << std::setw(8) << ns << "\n";  // Name and ns/key.
+    };  // End row.
+
+    std::cout << "m=" << m << " (ns/key, best of " << rounds << " rounds)\n";  // Section header.
+    row("multiplicationHash (double, before)", nsPerKey([](int k, int mm) { return floatMultiplicationHash(k, mm); }, keys, m, rounds, sink));  // Old floating-point path.
+    row("multiplicationHash (fixed point)", nsPerKey([](int k, int mm) { return hashfunctionsunit::multiplicationHash(k, mm); }, keys, m, rounds, sink));  // New integer path.
+    row("positiveMod (64-bit division, before)", nsPerKey([](int k, int mm) { return hashfunctionsunit::positiveMod(static_cast<long long>(k), mm); }, keys, m, rounds, sink));  // divisionHash before.
+    row("divisionHash (32-bit division)", nsPerKey([](int k, int mm) { return hashfunctionsunit::divisionHash(k, mm); }, keys, m, rounds, sink));  // divisionHash now.
+    row("UniversalHashFamily::hash", nsPerKey([&universal](int k, int) { return universal.hash(k); }, keys, m, rounds, sink));  // Two divisions.
+    row("MultiplyAddShiftHashFamily::hash", nsPerKey([&mas](int k, int) { return mas.hash(k); }, keys, m, rounds, sink));  // One multiply per stage.
+    row("fibonacciHash(k, 32) % m", nsPerKey([](int k, int mm) { return static_cast<std::uint32_t>(hashfunctionsunit::fibonacciHash(static_cast<std::uint32_t>(k), 32)) % static_cast<std::uint32_t>(mm); }, keys, m, rounds, sink));  // Division reduction.
+    row("fastRange32(fibonacciHash(k, 32), m)", nsPerKey([](int k, int mm) { return hashfunctionsunit::fastRange32(static_cast<std::uint32_t>(hashfunctionsunit::fibonacciHash(static_cast<std::uint32_t>(k), 32)), static_cast<std::uint32_t>(mm)); }, keys, m, rounds, sink));  // Multiply reduction.
+    if (r >= 0) {  // Only defined for m = 2^r.
+        row("fibonacciHash(k, r)", nsPerKey([r](int k, int) { return hashfunctionsunit::fibonacciHash(static_cast<std::uint32_t>(k), r); }, keys, m, rounds, sink));  // Multiply + shift.
+    }  // Close power-of-two branch.
+    std::cout << "  (sink " << (sink & 0xFFFF) << ")\n";  // Prevent dead-code elimination.
+}  // End runThroughput().
+
+static void runQuality(const char* label, const std::vector<int>& keys) {  // Distribution of every hash over one key set.
+    std::cout << "\nquality: " << label << " (" << keys.size() << " keys)\n";  // Section header.
+    for (int m : {1024, 1000}) {  // Power of two and a non-power of two.
+        double avg = static_cast<double>(keys.size()) / m;  // Mean bucket size.
+        double uniform = std::sqrt(avg * (1.0 - 1.0 / m));  // Binomial std deviation for an ideal hash.
+        std::cout << "  m=" << m << ", uniform std dev " << std::fixed << std::setprecision(2) << uniform << "\n";  // Sub-header.
+        hashfunctionsunit::UniversalHashFamily universal(m, 42u);  // Fixed seed for reproducible rows.
+        hashfunctionsunit::MultiplyAddShiftHashFamily mas(m, 42u);  // Fixed seed for reproducible rows.
+        auto row = [&keys, m](const char* name, auto hashFunc) {  // Analyze and print one hash.
+            auto report = hashfunctionsunit::analyzeDistribution(hashFunc, keys, m);  // Bucket the keys.
+            std::cout << "    " << std::left << std::setw(36) << name << std::right << " std dev " << std::setw(8) << report.stdDeviation  // Spread.
+                      << "  max " << std::setw(6) << report.maxBucketSize << "  empty " << std::setw(4) << (m - report.nonEmptyBuckets) << "\n";  // Worst bucket and holes.
+        };  // End row.
+        row("divisionHash", [](int k, int mm) { return hashfunctionsunit::divisionHash(k, mm); });  // k mod m.
+        row("multiplicationHash (double, before)", [](int k, int mm) { return floatMultiplicationHash(k, mm); });  // Old path.
+        row("multiplicationHash (fixed point)", [](int k, int mm) { return hashfunctionsunit::multiplicationHash(k, mm); });  // New path.
+        row("fastRange32(fibonacciHash(k, 32), m)", [](int k, int mm) { return static_cast<int>(hashfunctionsunit::fastRange32(static_cast<std::uint32_t>(hashfunctionsunit::fibonacciHash(static_cast<std::uint32_t>(k), 32)), static_cast<std::uint32_t>(mm))); });  // Fibonacci for any m.
+        row("UniversalHashFamily", [&universal](int k, int) { return universal.hash(k); });  // Textbook family.
+        row("MultiplyAddShiftHashFamily", [&mas](int k, int) { return mas.hash(k); });  // Multiply-add-shift family.
+    }  // Close bucket-count loop.
+}  // End runQuality().
+
+int main(int argc, char** argv) {  // Parse arguments and run both sections.
+    int keyCount = (argc > 1) ? std::stoi(argv[1]) : 65536;  // Keys per timing round (fits in L2).
+    int rounds = (argc > 2) ? std::stoi(argv[2]) : 200;  // Timing rounds per row.
+    int qualityKeys = (argc > 3) ? std::stoi(argv[3]) : 100000;  // Keys per quality run.
+    if (keyCount <= 0 || rounds <= 0 || qualityKeys <= 0) {  // Validate.
+        std::cerr << "keys, rounds and qualityKeys must be >= 1\n";  // Report.
+        return 1;  // Exit failure.
+    }  // Close validation.
+
+    std::mt19937 rng(12345u);  // Deterministic random keys.
+    std::vector<int> randomKeys;  // Full 32-bit range, negatives included.
+    for (int i = 0; i < std::max(keyCount, qualityKeys); i++) {  // Build once, reuse for both sections.
+        randomKeys.push_back(static_cast<int>(rng()));  // One key.
+    }  // Close key loop.
+
+    std::vector<int> timingKeys(randomKeys.begin(), randomKeys.begin() + keyCount);  // Timing key set.
+    volatile int runtimeM[] = {1024, 1000};  // volatile: the compiler must not specialize % m for a constant.
+    for (int i = 0; i < 2; i++) {  // One table per bucket count.
+        runThroughput(timingKeys, static_cast<size_t>(rounds), runtimeM[i]);  // Time.
+    }  // Close bucket-count loop.
+
+    std::vector<int> sequential;  // 0, 1, 2, ...
+    std::vector<int> strided;  // 0, 1024, 2048, ... (identical low bits).
+    for (int i = 0; i < qualityKeys; i++) {  // Build both structured key sets.
+        sequential.push_back(i);  // Sequential key.
+        strided.push_back(static_cast<int>(static_cast<unsigned>(i) * 1024u));  // Stride-1024 key (wraps past 2^31, like an address).
+    }  // Close key loop.
+    randomKeys.resize(static_cast<size_t>(qualityKeys));  // Same size as the structured sets.
+    runQuality("sequential 0..n-1", sequential);  // Easy for everything.
+    runQuality("stride 1024", strided);  // Breaks k mod 2^r.
+    runQuality("random 32-bit", randomKeys);  // Baseline.
+    return 0;  // Exit success.
+}  // End main().
@@ -0,0 +1,144 @@
+// 03 串流分布分析量測（C++）/ Streaming distribution analysis benchmark (C++).  // Bilingual file header.
+//
+// Writes `keys` synthetic request-log lines to a file, then analyzes them three ways and reports time and the growth
+// of the process peak RSS: (1) getline into std::vector<std::string> + analyzeDistribution, (2) the streaming analyzer
+// over the mmap'd file with avalanche sampling off, (3) the same with `threads` workers and avalanche sampling on.
+// Then prints the streaming quality report (chi-squared z, bit bias, avalanche) for several hashes.
+// Usage: ./streaming_distribution_benchmark [keys=10000000] [log2Buckets=20] [threads=0] [path=streaming_keys.txt]
+
+#include "HashFunctions.hpp"  // Hashes and the in-memory analyzer.
+#include "StreamingDistribution.hpp"  // Streaming analyzer under test.
+
+#include <sys/resource.h>  // Provide getrusage for peak RSS.
+
+#include <algorithm>  // Provide std::max for RSS growth.
+#include <chrono>  // Provide steady_clock timing.
+#include <cstdint>  // Provide fixed-width integers.
+#include <cstdio>  // Provide std::remove for the key file.
+#include <fstream>  // Provide std::ofstream/std::ifstream for the key file.
+#include <iomanip>  // Provide output formatting.
+#include <iostream>  // Provide std::cout for reports.
+#include <random>  // Provide std::mt19937_64 for synthetic keys.
+#include <stdexcept>  // Provide std::invalid_argument for bad arguments.
+#include <string>  // Provide std::string keys and argument parsing.
+#include <string_view>  // Provide hash signatures.
+#include <vector>  // Provide the in-memory key list.
+
+using Clock = std::chrono::steady_clock;  // Monotonic clock for timing.
+
+static double peakRssMegabytes() {  // Peak resident set size of this process so far.
+    struct rusage usage {};  // Filled by getrusage.
+    getrusage(RUSAGE_SELF, &usage);  // Query this process.
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;  // Linux reports kilobytes.
+}  // End peakRssMegabytes().
+
+static double secondsSince(Clock::time_point start) {  // Elapsed wall time.
+    return std::chrono::duration<double>(Clock::now() - start).count();  // Seconds.
+}  // End secondsSince().
+
+static std::uint64_t wyRaw(std::string_view s) {  // Hash used for the timing comparison.
+    return hashfunctionsunit::wyHash64(s);  // 64-bit wyhash.
+}  // End wyRaw().
+
+static void writeKeys(const std::string& path, std::uint64_t keys) {  // Request-log-like lines: "GET /api/v1/users/<id>/orders/<id>".
+    std::ofstream out(path, std::ios::binary);  // Overwrite.
+    if (!out) {  // Unwritable location.
+        throw std::runtime_error("cannot write " + path);  // Report.
+    }  // Close open check.
+    std::mt19937_64 rng(2026u);  // Fixed seed: same file every run.
+    const char* methods[] = {"GET", "GET", "GET", "POST", "PUT", "DELETE"};  // Skewed like real traffic.
+    std::string line;  // Reused line buffer.
+    for (std::uint64_t i = 0; i < keys; i++) {  // One line per key.
+        std::uint64_t r = rng();  // Random bits for this line.
+        line.assign(methods[r % 6]);  // Method.
+        line += " /api/v1/users/";  // Shared prefix.
+        line += std::to_string((r >> 8) % 1000000);  // User id (repeats: a million users).
+        line += "/orders/";  // Shared infix.
+        line += std::to_string(i);  // Unique order id.
+        line += '\n';  // Terminator.
+        out << line;  // Append.
+    }  // Close line loop.
+}  // End writeKeys().
+
+static void printReport(const char* name, const hashfunctionsunit::StreamingDistributionReport& report, double seconds) {  // One quality row.
+    std::cout << "  " << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(2)  // Name.
+              << std::setw(8) << seconds << " s" << std::setw(10) << report.stdDeviation << std::setw(10) << report.chiSquaredZ  // Time, spread, z.
+              << std::setprecision(4) << std::setw(10) << report.maxBitBias << std::setw(10) << report.avalancheMean << std::setw(10) << report.maxAvalancheBias << "\n";  // Bit statistics.
+}  // End printReport().
+
+int main(int argc, char** argv) {  // Parse arguments and run every configuration.
+    try {  // Report bad arguments and I/O errors cleanly.
+        std::uint64_t keys = (argc > 1) ? std::stoull(argv[1]) : 10000000u;  // Lines in the key file.
+        int log2Buckets = (argc > 2) ? std::stoi(argv[2]) : 20;  // m = 2^log2Buckets.
+        unsigned threads = (argc > 3) ? static_cast<unsigned>(std::stoul(argv[3])) : 0u;  // 0 = hardware_concurrency.
+        std::string path = (argc > 4) ? argv[4] : "streaming_keys.txt";  // Key file location.
+        if (keys == 0 || log2Buckets < 0 || log2Buckets > 32) {  // Validate.
+            throw std::invalid_argument("keys must be >= 1 and log2Buckets in [0, 32]");  // Reject.
+        }  // Close validation.
+        std::uint64_t m = std::uint64_t{1} << log2Buckets;  // Bucket count.
+
+        writeKeys(path, keys);  // Generate input.
+        std::cout << "keys=" << keys << " buckets=2^" << log2Buckets << " threads=" << (threads ? threads : std::thread::hardware_concurrency()) << " file=" << path << "\n";  // Configuration.
+        std::cout << std::fixed << std::setprecision(2);  // Two decimals.
+
+        hashfunctionsunit::StreamingDistributionOptions options;  // Streaming settings.
+        options.buckets = m;  // m.
+        options.threads = 1;  // Single worker first.
+        options.avalancheSampleEvery = 0;  // Histogram only, comparable to analyzeDistribution.
+        double rss0 = peakRssMegabytes();  // Baseline.
+        Clock::time_point start = Clock::now();  // Timer.
+        auto single = hashfunctionsunit::analyzeFileDistribution(wyRaw, path, options);  // Streaming, one worker.
+        double singleSeconds = secondsSince(start);  // Elapsed.
+        double rss1 = peakRssMegabytes();  // After streaming.
+        std::cout << "streaming, 1 thread, no avalanche   " << std::setw(7) << singleSeconds << " s  " << std::setw(7) << static_cast<double>(keys) / singleSeconds / 1e6 << " Mkeys/s  peak RSS +" << std::max(0.0, rss1 - rss0) << " MB\n";  // Row.
+
+        options.threads = threads;  // Requested worker count.
+        options.avalancheSampleEvery = 4096;  // Default sampling.
+        start = Clock::now();  // Timer.
+        auto parallel = hashfunctionsunit::analyzeFileDistribution(wyRaw, path, options);  // Streaming, all workers.
+        double parallelSeconds = secondsSince(start);  // Elapsed.
+        double rss2 = peakRssMegabytes();  // After parallel run.
+        std::cout << "streaming, N threads, avalanche     " << std::setw(7) << parallelSeconds << " s  " << std::setw(7) << static_cast<double>(keys) / parallelSeconds / 1e6 << " Mkeys/s  peak RSS +" << std::max(0.0, rss2 - rss1) << " MB\n";  // Row.
+
+        if (log2Buckets <= 30) {  // analyzeDistribution takes an int bucket count.
+            start = Clock::now();  // Timer (load + analyze).
+            std::vector<std::string> lines;  // Materialized keys.
+            {  // Scope closes the file.
+                std::ifstream in(path);  // Text read.
+                std::string line;  // Current line.
+                while (std::getline(in, line)) {  // One key per line.
+                    lines.push_back(line);  // Copy into the vector.
+                }  // Close read loop.
+            }  // Close scope.
+            double loadSeconds = secondsSince(start);  // Read time.
+            auto inMemory = hashfunctionsunit::analyzeDistribution(  // Bucket the vector.
+                [](const std::string& k, int buckets) { return static_cast<int>(wyRaw(k) % static_cast<std::uint64_t>(buckets)); },  // Same reduction.
+                lines, static_cast<int>(m)  // Keys and m.
+            );  // Close call.
+            double inMemorySeconds = secondsSince(start);  // Total.
+            double rss3 = peakRssMegabytes();  // After materializing.
+            std::cout << "vector + analyzeDistribution        " << std::setw(7) << inMemorySeconds << " s  " << std::setw(7) << static_cast<double>(keys) / inMemorySeconds / 1e6 << " Mkeys/s  peak RSS +" << std::max(0.0, rss3 - rss2) << " MB  (load " << loadSeconds << " s)\n";  // Row.
+            std::cout << "  same histogram: " << ((inMemory.maxBucketSize == static_cast<int>(single.maxBucketSize) && inMemory.nonEmptyBuckets == static_cast<int>(parallel.nonEmptyBuckets)) ? "yes" : "NO") << "\n";  // Cross-check.
+        }  // Close in-memory branch.
+
+        std::cout << "\nquality (streaming, threads=" << (threads ? threads : std::thread::hardware_concurrency()) << ", avalanche every 4096th key)\n";  // Section header.
+        std::cout << "  " << std::left << std::setw(16) << "hash" << std::right << std::setw(10) << "time" << std::setw(10) << "std dev" << std::setw(10) << "chi2 z" << std::setw(10) << "bit bias" << std::setw(10) << "aval" << std::setw(10) << "aval bias" << "\n";  // Column header.
+        auto run = [&](const char* name, auto hash, int bits) {  // Analyze and print one hash.
+            hashfunctionsunit::StreamingDistributionOptions quality = options;  // Same settings.
+            quality.hashBits = bits;  // Output width.
+            Clock::time_point t0 = Clock::now();  // Timer.
+            auto report = hashfunctionsunit::analyzeFileDistribution(hash, path, quality);  // Analyze.
+            printReport(name, report, secondsSince(t0));  // Row.
+        };  // End run.
+        run("djb2Hash", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::djb2Hash(s); }, 32);  // Byte-at-a-time, weak.
+        run("fnv1aHash", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::fnv1aHash(s); }, 32);  // Byte-at-a-time.
+        run("crc32cHash", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::crc32cHash(s); }, 32);  // Linear.
+        run("fnv1aWordHash64", [](std::string_view s) { return hashfunctionsunit::fnv1aWordHash64(s); }, 64);  // Word-at-a-time.
+        run("wyHash64", wyRaw, 64);  // Reference-quality hash.
+        std::remove(path.c_str());  // Clean up.
+        return 0;  // Exit success.
+    } catch (const std::exception& ex) {  // Bad arguments or I/O.
+        std::cerr << ex.what() << "\n";  // Print message.
+        return 1;  // Exit failure.
+    }  // Close catch.
+}  // End main().
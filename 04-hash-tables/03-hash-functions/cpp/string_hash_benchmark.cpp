@@ -0,0 +1,129 @@
+// 03 字串雜湊吞吐量與品質量測（C++）/ String hash throughput and quality benchmark (C++).  // Bilingual file header.
+//
+// Throughput: hashes many independent keys of one length at a time and reports ns/key, GB/s and
+// bytes/cycle (TSC cycles on x86, so it follows the nominal clock rather than turbo).
+// Quality: feeds every hash through analyzeDistribution over "key_i" and zero-padded decimal keys,
+// into a power-of-two table (low bits only) and into m = 1000 (all bits via modulo).
+// Usage: ./string_hash_benchmark [bytesPerLength=16777216] [qualityKeys=100000]
+
+#include "HashFunctions.hpp"  // Hash functions under test.
+
+#if HASH_FUNCTIONS_X86_DISPATCH  // TSC is the only cycle counter we can read portably enough.
+#include <x86intrin.h>  // Provide __rdtsc.
+#endif  // Close TSC include.
+
+#include <chrono>  // Provide steady_clock timing.
+#include <cmath>  // Provide std::sqrt for the uniform reference.
+#include <cstdint>  // Provide fixed-width integers.
+#include <functional>  // Provide std::hash for the standard-library baseline.
+#include <iomanip>  // Provide output formatting.
+#include <iostream>  // Provide std::cout for reports.
+#include <string>  // Provide std::string key storage.
+#include <string_view>  // Provide non-owning keys.
+#include <vector>  // Provide key lists.
+
+using Clock = std::chrono::steady_clock;  // Monotonic clock for timing.
+
+struct NamedHash {  // One row of the report.
+    const char* name;  // Display name.
+    std::uint64_t (*fn)(std::string_view);  // Widened to 64 bits so every hash fits one signature.
+};  // End NamedHash.
+
+static const NamedHash HASHES[] = {  // Byte-at-a-time baselines first, then the word-at-a-time kernels.
+    {"djb2Hash", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::djb2Hash(s); }},  // 1 byte per step.
+    {"fnv1aHash", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::fnv1aHash(s); }},  // 1 byte per step.
+    {"jenkinsOneAtATime", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::jenkinsOneAtATime(s); }},  // 1 byte per step.
+    {"polynomialHash(31,1e9+7)", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::polynomialHash(s, 31u, 1000000007u); }},  // Modulo per byte.
+    {"fnv1aHash64", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::fnv1aHash64(s); }},  // 1 byte per step, 64-bit.
+    {"fnv1aWordHash64", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::fnv1aWordHash64(s); }},  // 8 bytes per step.
+    {"wyHash64", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::wyHash64(s); }},  // 16 bytes per multiply.
+    {"crc32cHash", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::crc32cHash(s); }},  // SSE4.2 when available.
+    {"crc32cSoftware", [](std::string_view s) -> std::uint64_t { return hashfunctionsunit::crc32cSoftware(s); }},  // Table fallback.
+    {"std::hash<string_view>", [](std::string_view s) -> std::uint64_t { return std::hash<std::string_view>{}(s); }},  // Library baseline.
+};  // End HASHES.
+
+static std::uint64_t readCycles() {  // Current TSC value, or 0 where unavailable.
+#if HASH_FUNCTIONS_X86_DISPATCH  // x86 has a readable time-stamp counter.
+    return __rdtsc();  // Read TSC.
+#else  // No portable counter.
+    return 0;  // Cycles column prints as 0.
+#endif  // Close counter selection.
+}  // End readCycles().
+
+static void runThroughput(size_t bytesPerLength) {  // Time every hash at every key length.
+    const size_t lengths[] = {4, 8, 16, 32, 64, 256, 1024, 4096};  // Short identifiers up to page-sized blobs.
+    const size_t keyCount = 1024;  // Distinct keys per length (stay in L1/L2 for short keys).
+    std::string buffer(keyCount + 4096 + 8, '\0');  // Keys are overlapping windows, one byte apart.
+    std::uint64_t state = 0x9e3779b97f4a7c15ULL;  // LCG state for random bytes.
+    for (char& c : buffer) {  // Fill with random bytes.
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;  // LCG step.
+        c = static_cast<char>(state >> 56);  // Take the best-mixed byte.
+    }  // Close fill loop.
+
+    std::cout << "throughput (" << bytesPerLength << " bytes hashed per cell)\n";  // Section header.
+    std::cout << std::left << std::setw(26) << "hash" << std::right << std::setw(7) << "len" << std::setw(11) << "ns/key" << std::setw(9) << "GB/s" << std::setw(12) << "bytes/cyc" << "\n";  // Column header.
+    std::uint64_t sink = 0;  // Keeps results live.
+    for (const NamedHash& h : HASHES) {  // One block per hash.
+        for (size_t len : lengths) {  // One row per key length.
+            std::vector<std::string_view> keys;  // Windows at successive offsets (mixed alignment).
+            for (size_t i = 0; i < keyCount; i++) {  // Build keys.
+                keys.emplace_back(buffer.data() + i, len);  // One window.
+            }  // Close key loop.
+            size_t rounds = std::max<size_t>(1, bytesPerLength / (len * keyCount));  // Same byte volume for every length.
+            Clock::time_point start = Clock::now();  // Wall clock start.
+            std::uint64_t cycles0 = readCycles();  // Cycle start.
+            for (size_t r = 0; r < rounds; r++) {  // Repeat the key set.
+                for (std::string_view key : keys) {  // Independent hashes: measures throughput, not latency.
+                    sink += h.fn(key);  // Accumulate.
+                }  // Close key loop.
+            }  // Close round loop.
+            std::uint64_t cycles = readCycles() - cycles0;  // Elapsed cycles.
+            double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();  // Elapsed nanoseconds.
+            double calls = static_cast<double>(rounds * keyCount);  // Hash invocations.
+            double bytes = calls * static_cast<double>(len);  // Bytes hashed.
+            std::cout << std::left << std::setw(26) << h.name << std::right << std::setw(7) << len << std::fixed  // Row label.
+                      << std::setprecision(1) << std::setw(11) << ns / calls << std::setprecision(2) << std::setw(9) << bytes / ns  // ns/key and GB/s.
+                      << std::setw(12) << (cycles == 0 ? 0.0 : bytes / static_cast<double>(cycles)) << "\n";  // bytes/cycle.
+        }  // Close length loop.
+    }  // Close hash loop.
+    std::cout << "(sink " << (sink & 0xFFFF) << ", crc32c hardware " << (hashfunctionsunit::crc32cHardwareAvailable() ? "yes" : "no") << ")\n";  // Prevent dead-code elimination.
+}  // End runThroughput().
+
+static void runQuality(const char* label, const std::vector<std::string>& keys) {  // Distribution of every hash over one key set.
+    std::cout << "\nquality: " << label << " (" << keys.size() << " keys)\n";  // Section header.
+    for (int m : {1024, 1000}) {  // Power of two (low bits) and a modulo (all bits).
+        double avg = static_cast<double>(keys.size()) / m;  // Mean bucket size.
+        double uniform = std::sqrt(avg * (1.0 - 1.0 / m));  // Binomial std deviation for an ideal hash.
+        std::cout << "  m=" << m << (m == 1024 ? " (h & (m-1))" : " (h % m)") << ", uniform std dev " << std::fixed << std::setprecision(2) << uniform << "\n";  // Sub-header.
+        for (const NamedHash& h : HASHES) {  // One row per hash.
+            auto report = hashfunctionsunit::analyzeDistribution(  // Bucket the keys.
+                [&h](const std::string& k, int buckets) { return static_cast<int>(h.fn(k) % static_cast<std::uint64_t>(buckets)); },  // Hash adapter.
+                keys, m  // Provide keys and bucket count.
+            );  // Close call.
+            std::cout << "    " << std::left << std::setw(26) << h.name << std::right << " std dev " << std::setw(7) << report.stdDeviation  // Spread.
+                      << "  max " << std::setw(4) << report.maxBucketSize << "  empty " << std::setw(4) << (m - report.nonEmptyBuckets) << "\n";  // Worst bucket and holes.
+        }  // Close hash loop.
+    }  // Close bucket-count loop.
+}  // End runQuality().
+
+int main(int argc, char** argv) {  // Parse arguments and run both sections.
+    size_t bytesPerLength = (argc > 1) ? static_cast<size_t>(std::stoull(argv[1])) : (size_t(1) << 24);  // Bytes hashed per (hash, length) cell.
+    int qualityKeys = (argc > 2) ? std::stoi(argv[2]) : 100000;  // Keys per quality run.
+    if (bytesPerLength == 0 || qualityKeys <= 0) {  // Validate.
+        std::cerr << "bytesPerLength and qualityKeys must be >= 1\n";  // Report.
+        return 1;  // Exit failure.
+    }  // Close validation.
+
+    runThroughput(bytesPerLength);  // Speed section.
+
+    std::vector<std::string> prefixed;  // "key_0", "key_1", ...
+    std::vector<std::string> padded;  // "00000000", "00000001", ... (differences only in the last bytes).
+    for (int i = 0; i < qualityKeys; i++) {  // Build both key sets.
+        prefixed.push_back("key_" + std::to_string(i));  // Prefixed decimal.
+        std::string digits = std::to_string(i);  // Decimal digits.
+        padded.push_back(std::string(digits.size() < 8 ? 8 - digits.size() : 0, '0') + digits);  // Zero-pad to one 8-byte word.
+    }  // Close key loop.
+    runQuality("\"key_i\"", prefixed);  // Common identifier shape.
+    runQuality("zero-padded 8-digit", padded);  // Exactly one word, varying in its high bytes.
+    return 0;  // Exit success.
+}  // End main().
@@ -2,10 +2,23 @@
 
 #include "HashFunctions.hpp"  // Include hash function APIs under test.
 #include "UniversalHashing.hpp"  // Include universal hashing APIs under test.
+#include "CuckooHashing.hpp"  // Include cuckoo hash table under test.
+#include "StreamingDistribution.hpp"  // Include the streaming analyzer under test.
 
+#include <climits>  // Provide INT_MIN/INT_MAX for edge keys.
+#include <cmath>  // Provide std::abs for floating-point tolerances.
+#include <cstdint>  // Provide std::uint32_t for wrapping key arithmetic.
+#include <cstdio>  // Provide std::remove for the temporary key file.
+#include <fstream>  // Provide std::ofstream for the temporary key file.
 #include <iostream>  // Provide std::cout for status output.
+#include <limits>  // Provide std::numeric_limits for the infinite-A check.
+#include <memory>  // Provide std::unique_ptr for move-only values.
+#include <random>  // Provide std::mt19937 for randomized differential tests.
+#include <sstream>  // Provide std::istringstream for the streaming analyzer.
 #include <stdexcept>  // Provide exception base types for assertions.
 #include <string>  // Provide std::string for test values.
+#include <string_view>  // Provide std::string_view keys for the templated analyzer.
+#include <unordered_map>  // Provide a reference map for differential tests.
 #include <vector>  // Provide std::vector for test key sets.
 
 static void assertTrue(bool condition, const char* message) {  // Minimal assertion helper.
@@ -43,6 +56,66 @@ static void testIntegerHashFunctions() {  // Verify basic properties for integer
     assertTrue(0 <= fold && fold < 100, "foldingHash should be in [0, m)");  // Validate range.
 }  // Close testIntegerHashFunctions().
 
+static void testMultiplyShiftHashing() {  // Verify fastRange32, multiply-shift / Fibonacci hashing and the integer multiplicationHash.
+    assertEquals(0, hashfunctionsunit::fastRange32(0u, 1000u), "fastRange32(0) should be 0");  // Lowest input.
+    assertEquals(999, hashfunctionsunit::fastRange32(0xFFFFFFFFu, 1000u), "fastRange32(max) should be m-1");  // Highest input.
+    assertEquals(0, hashfunctionsunit::fastRange32(0xFFFFFFFFu, 1u), "fastRange32 with m=1 should be 0");  // Single bucket.
+    std::uint32_t previous = 0u;  // fastRange32 is monotone in x.
+    for (std::uint64_t x = 0; x <= 0xFFFFFFFFull; x += 0x10001ull) {  // Sweep the 32-bit range.
+        std::uint32_t h = hashfunctionsunit::fastRange32(static_cast<std::uint32_t>(x), 1000u);  // Reduce.
+        assertTrue(h < 1000u && h >= previous, "fastRange32 should be in [0, m) and monotone");  // Validate.
+        assertEquals(static_cast<long long>(x >> 22), hashfunctionsunit::fastRange32(static_cast<std::uint32_t>(x), 1024u), "fastRange32 with m=2^r should take the top r bits");  // Power of two.
+        previous = h;  // Remember.
+    }  // Close sweep.
+
+    assertEquals(static_cast<long long>(hashfunctionsunit::FIBONACCI_MULTIPLIER >> 1), static_cast<long long>(hashfunctionsunit::fibonacciHash(1u, 63)), "fibonacciHash(1, 63) should be the multiplier's top 63 bits");  // Known value.
+    assertEquals(static_cast<long long>(0x9E3779B9u >> 22), static_cast<long long>(hashfunctionsunit::fibonacciHash(1u, 10)), "fibonacciHash(1, 10) should be the multiplier's top 10 bits");  // Known value.
+    for (int r : {1, 10, 32}) {  // Several table sizes.
+        for (std::uint64_t key = 0; key < 1000; key++) {  // Check a range of keys.
+            std::uint64_t h = hashfunctionsunit::fibonacciHash(key, r);  // Hash.
+            assertTrue(h < (std::uint64_t{1} << r), "fibonacciHash should be in [0, 2^r)");  // Validate range.
+            assertTrue(h == ((key * 0x9E3779B97F4A7C15ULL) >> (64 - r)), "fibonacciHash should be (key * C) >> (64 - r)");  // Validate formula.
+        }  // Close key loop.
+    }  // Close r loop.
+    assertTrue(hashfunctionsunit::multiplyShiftHash(5u, 3u, 64) == 15u, "multiplyShiftHash with r=64 should keep the whole product");  // No shift.
+    bool threw = false;  // Track rejection of r = 0.
+    try {  // r = 0 would shift by 64.
+        hashfunctionsunit::multiplyShiftHash(1u, 3u, 0);  // Invalid.
+    } catch (const std::invalid_argument&) {  // Expected.
+        threw = true;  // Record.
+    }  // Close catch.
+    assertTrue(threw, "multiplyShiftHash should reject r = 0");  // Validate.
+    threw = false;  // Reset.
+    try {  // r = 65 is out of range.
+        hashfunctionsunit::fibonacciHash(1u, 65);  // Invalid.
+    } catch (const std::invalid_argument&) {  // Expected.
+        threw = true;  // Record.
+    }  // Close catch.
+    assertTrue(threw, "fibonacciHash should reject r > 64");  // Validate.
+
+    for (int key : {0, 1, 2, 12345, -1, -12345, INT_MAX, INT_MIN}) {  // Include negative and extreme keys.
+        assertEquals(static_cast<long long>(hashfunctionsunit::fibonacciHash(static_cast<std::uint64_t>(static_cast<std::int64_t>(key)), 7)), hashfunctionsunit::multiplicationHash(key, 128), "multiplicationHash with m=2^r should equal fibonacciHash");  // Same fixed-point product.
+        int h = hashfunctionsunit::multiplicationHash(key, 1000);  // Non-power-of-two m.
+        assertTrue(0 <= h && h < 1000, "multiplicationHash should be in [0, m) for extreme keys");  // Validate range.
+    }  // Close key loop.
+    for (int key = -50; key < 50; key++) {  // frac(k * 0.5) is 0 or 0.5, exactly representable.
+        assertEquals((key % 2 == 0) ? 0 : 50, hashfunctionsunit::multiplicationHash(key, 100, 0.5), "multiplicationHash with A=0.5 should be exact");  // Validate custom A.
+        assertEquals(hashfunctionsunit::multiplicationHash(key, 100, 0.5), hashfunctionsunit::multiplicationHash(key, 100, 2.5), "only frac(A) should matter");  // Integer part of A drops out.
+    }  // Close key loop.
+    threw = false;  // Reset.
+    try {  // Infinite A has no fractional part.
+        hashfunctionsunit::multiplicationHash(1, 100, std::numeric_limits<double>::infinity());  // Invalid.
+    } catch (const std::invalid_argument&) {  // Expected.
+        threw = true;  // Record.
+    }  // Close catch.
+    assertTrue(threw, "multiplicationHash should reject infinite A");  // Validate.
+
+    for (int key : {0, 7, -7, 96, -97, INT_MAX, INT_MIN}) {  // 32-bit positiveMod overload.
+        long long expected = ((static_cast<long long>(key) % 97) + 97) % 97;  // Reference remainder.
+        assertEquals(expected, hashfunctionsunit::divisionHash(key, 97), "divisionHash should match the reference remainder");  // Validate.
+    }  // Close key loop.
+}  // Close testMultiplyShiftHashing().
+
 static void testStringHashFunctions() {  // Verify basic properties for string hash functions.
     int m = 100;  // Bucket count for modulo-based hashes.
     for (const std::string& s : std::vector<std::string>{"hello", "world", "test", "hash"}) {  // Test a small set of strings.
@@ -90,6 +163,227 @@ static void testDistributionAnalyzer() {  // Verify distribution analyzer return
     assertTrue(r2.stdDeviation < 10.0, "fnv1a std deviation should be reasonably small");  // Loose std-dev check.
 }  // Close testDistributionAnalyzer().
 
+static void testWordAtATimeStringHashes() {  // Verify the word-at-a-time, wyhash and CRC32C kernels.
+    assertTrue(hashfunctionsunit::fnv1aHash64("") == 14695981039346656037ULL, "fnv1aHash64(\"\") should be the offset basis");  // Reference value.
+    assertTrue(hashfunctionsunit::fnv1aHash64("a") == 0xaf63dc4c8601ec8cULL, "fnv1aHash64(\"a\") should match the FNV reference");  // Reference value.
+
+    const char* vectors[] = {"", "a", "abc", "message digest", "abcdefghijklmnopqrstuvwxyz",  // wyhash final4 test vectors (seed = index).
+                             "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",  // 62 bytes: 48-byte loop path.
+                             "12345678901234567890123456789012345678901234567890123456789012345678901234567890"};  // 80 bytes.
+    const std::uint64_t expected[] = {0x0409638ee2bde459ULL, 0xa8412d091b5fe0a9ULL, 0x32dd92e4b2915153ULL, 0x8619124089a3a16bULL,  // Reference outputs.
+                                      0x7a43afb61d7f5f40ULL, 0xff42329b90e50d58ULL, 0xc39cab13b115aad3ULL};  // Reference outputs.
+    for (int i = 0; i < 7; i++) {  // Check each vector.
+        assertTrue(hashfunctionsunit::wyHash64(vectors[i], static_cast<std::uint64_t>(i)) == expected[i], "wyHash64 should match the wyhash test vectors");  // Compare.
+    }  // Close loop.
+
+    assertTrue(hashfunctionsunit::crc32cSoftware("123456789") == 0xE3069283u, "crc32cSoftware should match the CRC32C check value");  // Standard check value.
+    std::string buffer;  // Bytes shared by every length and offset below.
+    for (int i = 0; i < 300; i++) {  // Build a deterministic buffer.
+        buffer.push_back(static_cast<char>((i * 131 + 7) & 0xFF));  // Mixed byte values, including high bytes.
+    }  // Close loop.
+    std::string_view all(buffer);  // View over the buffer.
+    for (size_t len = 0; len <= 100; len++) {  // Every tail size and both loop paths.
+        std::string_view aligned = all.substr(0, len);  // Key at offset 0.
+        std::string copy(all.substr(3, len));  // Same length, different bytes, owned.
+        std::string_view shifted = all.substr(3, len);  // Same bytes as copy at an odd offset.
+        assertTrue(hashfunctionsunit::crc32cHash(aligned) == hashfunctionsunit::crc32cSoftware(aligned), "crc32cHash should agree with the software kernel");  // Dispatch check.
+        assertTrue(hashfunctionsunit::fnv1aWordHash64(copy) == hashfunctionsunit::fnv1aWordHash64(shifted), "fnv1aWordHash64 should not depend on alignment");  // Alignment independence.
+        assertTrue(hashfunctionsunit::wyHash64(copy) == hashfunctionsunit::wyHash64(shifted), "wyHash64 should not depend on alignment");  // Alignment independence.
+        if (len > 0) {  // Compare against the one-byte-shorter prefix.
+            std::string_view shorter = all.substr(0, len - 1);  // Prefix.
+            assertTrue(hashfunctionsunit::fnv1aWordHash64(aligned) != hashfunctionsunit::fnv1aWordHash64(shorter), "fnv1aWordHash64 prefixes should differ");  // Length is mixed in.
+            assertTrue(hashfunctionsunit::wyHash64(aligned) != hashfunctionsunit::wyHash64(shorter), "wyHash64 prefixes should differ");  // Length is mixed in.
+        }  // Close prefix branch.
+    }  // Close length loop.
+    assertTrue(hashfunctionsunit::fnv1aWordHash(std::string("a")) != hashfunctionsunit::fnv1aWordHash(std::string("a\0", 2)), "zero-padded tails should not collide");  // Tail packing.
+}  // Close testWordAtATimeStringHashes().
+
+static void testDistributionAnalyzerStringViewKeys() {  // Feed the new kernels through analyzeDistribution with string_view keys.
+    std::vector<std::string> storage;  // Owns the key bytes.
+    for (int i = 0; i < 10000; i++) {  // Build 10000 keys "key_i".
+        storage.push_back("key_" + std::to_string(i));  // Append one key.
+    }  // Close loop.
+    std::vector<std::string_view> keys(storage.begin(), storage.end());  // Non-owning keys.
+
+    auto r1 = hashfunctionsunit::analyzeDistribution(  // Word FNV into a power-of-two table (low bits only).
+        [](std::string_view k, int m) { return static_cast<int>(hashfunctionsunit::fnv1aWordHash(k) & static_cast<std::uint32_t>(m - 1)); },  // Hash adapter.
+        keys, 1024  // Provide keys and bucket count.
+    );  // Close call.
+    assertEquals(10000, r1.totalKeys, "analyzer should count string_view keys");  // Validate count.
+    assertTrue(r1.stdDeviation < 5.0, "fnv1aWordHash low bits should be close to uniform");  // Uniform is about 3.1.
+
+    auto r2 = hashfunctionsunit::analyzeDistribution(  // wyhash into a power-of-two table.
+        [](std::string_view k, int m) { return static_cast<int>(hashfunctionsunit::wyHash64(k) & static_cast<std::uint64_t>(m - 1)); },  // Hash adapter.
+        keys, 1024  // Provide keys and bucket count.
+    );  // Close call.
+    assertTrue(r2.stdDeviation < 5.0, "wyHash64 low bits should be close to uniform");  // Uniform is about 3.1.
+
+    auto r3 = hashfunctionsunit::analyzeDistribution(  // CRC32C reduced with a modulo.
+        [](std::string_view k, int m) { return static_cast<int>(hashfunctionsunit::crc32cHash(k) % static_cast<std::uint32_t>(m)); },  // Hash adapter.
+        keys, 1000  // Provide keys and bucket count.
+    );  // Close call.
+    assertTrue(r3.stdDeviation < 5.0, "crc32cHash should spread keys across buckets");  // Loose std-dev check.
+}  // Close testDistributionAnalyzerStringViewKeys().
+
+static std::uint64_t fnvRaw(std::string_view s) {  // Raw 32-bit FNV-1a for the streaming analyzer.
+    return hashfunctionsunit::fnv1aHash(s);  // Widen.
+}  // Close fnvRaw().
+
+static void testStreamingDistributionMatchesInMemory() {  // The streaming analyzer must agree with analyzeDistribution.
+    std::vector<std::string> keys;  // Materialized keys for the reference.
+    std::string region;  // Same keys, one per line.
+    for (int i = 0; i < 5000; i++) {  // Build both.
+        keys.push_back("key_" + std::to_string(i));  // One key.
+        region += keys.back() + "\n";  // One line.
+    }  // Close loop.
+    auto reference = hashfunctionsunit::analyzeDistribution(  // In-memory reference with h % m.
+        [](const std::string& k, int m) { return static_cast<int>(fnvRaw(k) % static_cast<std::uint64_t>(m)); },  // Hash adapter.
+        keys, 97  // Provide keys and bucket count.
+    );  // Close call.
+    for (unsigned threads : {1u, 3u, 8u}) {  // Slicing must not lose or duplicate lines.
+        hashfunctionsunit::StreamingDistributionOptions options;  // Defaults otherwise.
+        options.buckets = 97;  // Same m.
+        options.threads = threads;  // Worker count.
+        options.hashBits = 32;  // fnv1aHash is 32-bit.
+        auto report = hashfunctionsunit::analyzeRegionDistribution(fnvRaw, region, options);  // Analyze.
+        assertEquals(5000, static_cast<long long>(report.totalKeys), "streaming totalKeys should match");  // Validate n.
+        assertEquals(reference.nonEmptyBuckets, static_cast<long long>(report.nonEmptyBuckets), "streaming nonEmptyBuckets should match");  // Validate.
+        assertEquals(reference.maxBucketSize, static_cast<long long>(report.maxBucketSize), "streaming maxBucketSize should match");  // Validate.
+        assertEquals(reference.minBucketSize, static_cast<long long>(report.minBucketSize), "streaming minBucketSize should match");  // Validate.
+        assertTrue(std::abs(reference.stdDeviation - report.stdDeviation) < 1e-9, "streaming stdDeviation should match");  // Validate.
+        assertEquals(32, static_cast<long long>(report.bitBias.size()), "bitBias should have hashBits entries");  // Validate width.
+    }  // Close thread loop.
+}  // Close testStreamingDistributionMatchesInMemory().
+
+static void testStreamingDistributionInputs() {  // Files, streams, line endings and argument validation.
+    std::string region = "alpha\r\nbeta\n\n\ngamma\r\ndelta";  // CRLF, blank lines, no trailing newline.
+    hashfunctionsunit::StreamingDistributionOptions options;  // Small table.
+    options.buckets = 16;  // m.
+    options.threads = 2;  // Two slices.
+    auto fromRegion = hashfunctionsunit::analyzeRegionDistribution(fnvRaw, region, options);  // Reference.
+    assertEquals(4, static_cast<long long>(fromRegion.totalKeys), "blank lines should be skipped");  // Four keys.
+    auto cleanKeys = hashfunctionsunit::analyzeRegionDistribution(fnvRaw, std::string_view("alpha\nbeta\ngamma\ndelta\n"), options);  // Same keys without CR.
+    assertEquals(static_cast<long long>(cleanKeys.maxBucketSize), static_cast<long long>(fromRegion.maxBucketSize), "CR should be stripped");  // Same buckets.
+    assertTrue(std::abs(cleanKeys.stdDeviation - fromRegion.stdDeviation) < 1e-12, "CR should not change the distribution");  // Same buckets.
+
+    std::string many;  // Larger input for block carry-over.
+    for (int i = 0; i < 3000; i++) {  // Variable-length lines.
+        many += std::string(static_cast<size_t>(i % 37), 'x') + std::to_string(i) + "\n";  // One line.
+    }  // Close loop.
+    auto expected = hashfunctionsunit::analyzeRegionDistribution(fnvRaw, many, options);  // Whole region at once.
+    hashfunctionsunit::StreamingDistributionAnalyzer<std::uint64_t (*)(std::string_view)> streamed(fnvRaw, options);  // Block reader.
+    std::istringstream in(many);  // Stream source.
+    streamed.addStream(in, 100);  // Blocks shorter than some lines.
+    auto fromStream = streamed.report();  // Summarize.
+    assertEquals(static_cast<long long>(expected.totalKeys), static_cast<long long>(fromStream.totalKeys), "stream totalKeys should match region");  // Validate.
+    assertTrue(std::abs(expected.stdDeviation - fromStream.stdDeviation) < 1e-12, "stream distribution should match region");  // Validate.
+
+    const char* path = "streaming_distribution_test_keys.txt";  // Temporary file in the working directory.
+    {  // Scope closes the file before reading it.
+        std::ofstream out(path, std::ios::binary);  // Write keys.
+        out << many;  // Same content.
+    }  // Close scope.
+    auto fromFile = hashfunctionsunit::analyzeFileDistribution(fnvRaw, path, options);  // mmap path.
+    std::remove(path);  // Clean up.
+    assertEquals(static_cast<long long>(expected.totalKeys), static_cast<long long>(fromFile.totalKeys), "file totalKeys should match region");  // Validate.
+    assertTrue(std::abs(expected.stdDeviation - fromFile.stdDeviation) < 1e-12, "file distribution should match region");  // Validate.
+
+    bool threw = false;  // Missing file.
+    try {  // Open must fail.
+        hashfunctionsunit::analyzeFileDistribution(fnvRaw, "no_such_key_file.txt", options);  // Invalid.
+    } catch (const std::runtime_error&) {  // Expected.
+        threw = true;  // Record.
+    }  // Close catch.
+    assertTrue(threw, "missing key file should throw");  // Validate.
+    for (std::uint64_t buckets : {std::uint64_t{0}, (std::uint64_t{1} << 32) + 1u}) {  // Out-of-range m.
+        threw = false;  // Reset.
+        try {  // Constructor validates.
+            hashfunctionsunit::StreamingDistributionOptions bad;  // Invalid m.
+            bad.buckets = buckets;  // Set.
+            hashfunctionsunit::StreamingDistributionAnalyzer<std::uint64_t (*)(std::string_view)> analyzer(fnvRaw, bad);  // Should throw.
+        } catch (const std::invalid_argument&) {  // Expected.
+            threw = true;  // Record.
+        }  // Close catch.
+        assertTrue(threw, "buckets outside [1, 2^32] should throw");  // Validate.
+    }  // Close bucket loop.
+}  // Close testStreamingDistributionInputs().
+
+static void testStreamingDistributionStatistics() {  // Counter carries, chi-squared, bit bias and avalanche.
+    std::string same;  // 1000 copies of one key: one bucket wraps its byte counter three times.
+    for (int i = 0; i < 1000; i++) {  // Build.
+        same += "hot\n";  // One line.
+    }  // Close loop.
+    hashfunctionsunit::StreamingDistributionOptions options;  // Defaults otherwise.
+    options.buckets = 64;  // m.
+    options.threads = 3;  // Carries from several workers land on the same bucket.
+    auto hot = hashfunctionsunit::analyzeRegionDistribution(fnvRaw, same, options);  // Analyze.
+    assertEquals(1000, static_cast<long long>(hot.maxBucketSize), "byte counters should carry past 255");  // Validate.
+    assertEquals(1, static_cast<long long>(hot.nonEmptyBuckets), "identical keys should use one bucket");  // Validate.
+
+    std::string decimal;  // Keys 0..1023; hashing a key to its own value fills every bucket exactly once.
+    for (int i = 0; i < 1024; i++) {  // Build.
+        decimal += std::to_string(i) + "\n";  // One line.
+    }  // Close loop.
+    auto parse = [](std::string_view s) {  // Identity on the number (flipped bits just give other values).
+        std::uint64_t value = 0;  // Decimal accumulator.
+        for (unsigned char c : s) {  // Horner step per digit.
+            value = value * 10u + static_cast<std::uint64_t>(c - '0');  // Wraps for non-digits, which is fine.
+        }  // Close digit loop.
+        return value;  // Parsed value.
+    };  // End parse.
+    options.buckets = 256;  // Each bucket gets exactly 4 keys.
+    options.hashBits = 10;  // Values fit in 10 bits.
+    options.avalancheSampleEvery = 1;  // Test every key.
+    auto exact = hashfunctionsunit::analyzeRegionDistribution(parse, decimal, options);  // Analyze.
+    assertTrue(exact.chiSquared == 0.0 && exact.stdDeviation == 0.0, "a perfectly even spread should have chi-squared 0");  // Validate.
+    assertTrue(exact.chiSquaredZ < -10.0, "a perfectly even spread is far too regular for a random hash");  // Validate.
+    assertTrue(exact.maxBitBias < 1e-12, "0..1023 should set every bit exactly half the time");  // Validate.
+    assertEquals(8 * (10 * 1 + 90 * 2 + 900 * 3 + 24 * 4), static_cast<long long>(exact.avalancheTrials), "every input bit of every key should be flipped once");  // Validate sampling.
+
+    std::string random;  // Random-looking keys for a good hash.
+    for (int i = 0; i < 20000; i++) {  // Build.
+        random += "user-" + std::to_string(i * 7919) + "\n";  // One line.
+    }  // Close loop.
+    options.buckets = 1000;  // m.
+    options.hashBits = 64;  // Full width.
+    options.avalancheSampleEvery = 100;  // 200 samples.
+    auto good = hashfunctionsunit::analyzeRegionDistribution([](std::string_view s) { return hashfunctionsunit::wyHash64(s); }, random, options);  // Analyze.
+    assertTrue(std::abs(good.chiSquaredZ) < 6.0, "wyHash64 should look uniform");  // Validate.
+    assertTrue(good.maxBitBias < 0.03, "wyHash64 should have no biased output bit");  // Validate.
+    assertTrue(std::abs(good.avalancheMean - 0.5) < 0.01 && good.maxAvalancheBias < 0.05, "wyHash64 should avalanche");  // Validate.
+    options.hashBits = 32;  // djb2Hash is 32-bit.
+    auto weak = hashfunctionsunit::analyzeRegionDistribution([](std::string_view s) -> std::uint64_t { return hashfunctionsunit::djb2Hash(s); }, random, options);  // h*33 + c only carries upward.
+    assertTrue(weak.avalancheMean < 0.4 && weak.maxAvalancheBias > 0.25, "djb2Hash should show poor avalanche");  // Validate.
+    auto constant = hashfunctionsunit::analyzeRegionDistribution([](std::string_view) { return std::uint64_t{0}; }, random, options);  // Worst possible hash.
+    assertTrue(constant.maxBitBias == 0.5 && constant.avalancheMean == 0.0, "a constant hash should be maximally biased");  // Validate.
+}  // Close testStreamingDistributionStatistics().
+
+static void testStreamingDistributionSharedCounters() {  // Over the counter budget, workers share one atomic array.
+    std::string region;  // Spread keys plus one hot key whose byte wraps from several workers.
+    for (int i = 0; i < 4000; i++) {  // Build.
+        region += "key_" + std::to_string(i) + "\nhot\n";  // Two lines.
+    }  // Close loop.
+    hashfunctionsunit::StreamingDistributionOptions options;  // Defaults otherwise.
+    options.buckets = 97;  // m.
+    options.threads = 4;  // Several writers per bucket.
+    options.hashBits = 32;  // fnv1aHash is 32-bit.
+    hashfunctionsunit::StreamingDistributionAnalyzer<std::uint64_t (*)(std::string_view)> separate(fnvRaw, options);  // 4 * 97 bytes fit the default budget.
+    assertTrue(!separate.sharedCounters(), "per-thread counters should be used within the budget");  // Validate mode.
+    options.counterBudgetBytes = 97 * 4 - 1;  // One byte short of per-thread arrays.
+    hashfunctionsunit::StreamingDistributionAnalyzer<std::uint64_t (*)(std::string_view)> shared(fnvRaw, options);  // Same input, shared array.
+    assertTrue(shared.sharedCounters(), "counters over the budget should be shared");  // Validate mode.
+    assertEquals(4, static_cast<long long>(shared.threadCount()), "sharing counters should keep every worker");  // Validate workers.
+    separate.addRegion(region);  // Analyze.
+    shared.addRegion(region);  // Analyze.
+    auto expected = separate.report();  // Reference.
+    auto actual = shared.report();  // Shared-counter result.
+    assertEquals(8000, static_cast<long long>(actual.totalKeys), "shared counters should count every key");  // Validate n.
+    assertEquals(static_cast<long long>(expected.maxBucketSize), static_cast<long long>(actual.maxBucketSize), "shared counters should carry like private ones");  // Hot bucket wraps 15 times.
+    assertEquals(static_cast<long long>(expected.minBucketSize), static_cast<long long>(actual.minBucketSize), "shared minBucketSize should match");  // Validate.
+    assertEquals(static_cast<long long>(expected.nonEmptyBuckets), static_cast<long long>(actual.nonEmptyBuckets), "shared nonEmptyBuckets should match");  // Validate.
+    assertTrue(std::abs(expected.stdDeviation - actual.stdDeviation) < 1e-9, "shared stdDeviation should match");  // Validate.
+}  // Close testStreamingDistributionSharedCounters().
+
 static void testUniversalHashFamily() {  // Verify universal hash family properties.
     int m = 100;  // Bucket count.
     hashfunctionsunit::UniversalHashFamily uh(m, 123u);  // Use deterministic seed for stable tests.
@@ -136,6 +430,49 @@ static void testUniversalHashCollisionProbabilityBound() {  // Empirically verif
     assertTrue(probability < (2.0 / static_cast<double>(m)), "collision probability should be < 2/m");  // Allow variance like Python test.
 }  // Close testUniversalHashCollisionProbabilityBound().
 
+static void testMultiplyAddShiftHashFamily() {  // Verify the multiply-add-shift family: range, determinism, collision bound, table use.
+    for (int m : {1, 100, 1000, 1024}) {  // Power-of-two and other bucket counts.
+        hashfunctionsunit::MultiplyAddShiftHashFamily mas(m, 123u);  // Deterministic seed.
+        for (int key = -1000; key < 1000; key++) {  // Check a range of keys, negative included.
+            int h = mas.hash(key);  // Compute hash value.
+            assertTrue(0 <= h && h < m, "MultiplyAddShiftHashFamily hash should be in [0, m)");  // Validate range.
+        }  // Close key loop.
+        assertEquals(mas.hash(12345), mas.hash(12345), "MultiplyAddShiftHashFamily should be deterministic within an instance");  // Validate determinism.
+        hashfunctionsunit::MultiplyAddShiftHashFamily same(m, 123u);  // Same seed.
+        assertEquals(mas.hash(-42), same.hash(-42), "same seed should give the same function");  // Validate reproducibility.
+    }  // Close m loop.
+
+    hashfunctionsunit::MultiplyAddShiftHashFamily regen(1000, 7u);  // Family to regenerate.
+    int changed = 0;  // Count regenerations that move key 12345.
+    for (int i = 0; i < 10; i++) {  // Repeat regenerations.
+        int before = regen.hash(12345);  // Hash under current parameters.
+        regen.regenerate();  // New (a, b).
+        changed += (regen.hash(12345) != before) ? 1 : 0;  // Count changes.
+    }  // Close loop.
+    assertTrue(changed > 0, "regenerate should change hash value sometimes");  // Very unlikely to never change.
+
+    int m = 50;  // Bucket count for probability bound 1/m.
+    int trials = 5000;  // Same shape as the UniversalHashFamily bound test.
+    int collisions = 0;  // Collision counter.
+    for (int t = 0; t < trials; t++) {  // Repeat trials with different deterministic seeds.
+        hashfunctionsunit::MultiplyAddShiftHashFamily mas(m, static_cast<std::uint32_t>(t));  // Use seed=t to vary parameters.
+        if (mas.hash(100) == mas.hash(200)) {  // Count collisions.
+            collisions += 1;  // Increment collision counter.
+        }  // Close collision branch.
+    }  // Close loop.
+    assertTrue(static_cast<double>(collisions) / static_cast<double>(trials) < 2.0 / static_cast<double>(m), "collision probability should be < 2/m");  // Validate bound.
+
+    hashfunctionsunit::UniversalHashTable<int, int, hashfunctionsunit::MultiplyAddShiftHashFamily> ht(16, 9u);  // Plug the family into the table.
+    for (int i = 0; i < 2000; i++) {  // Multiples of 1024: all identical low bits.
+        ht.insert(i * 1024, i);  // Insert.
+    }  // Close loop.
+    assertEquals(2000, ht.size(), "multiply-add-shift table should hold every entry");  // Validate size.
+    for (int i = 0; i < 2000; i++) {  // Validate lookups after resizes.
+        assertTrue(ht.search(i * 1024).value_or(-1) == i, "multiply-add-shift table lookup should succeed");  // Validate lookup.
+    }  // Close loop.
+    assertTrue(ht.getMaxChainLength() <= hashfunctionsunit::UniversalHashTable<int, int, hashfunctionsunit::MultiplyAddShiftHashFamily>::MAX_CHAIN_LENGTH, "chains should stay short for strided keys");  // Spread check.
+}  // Close testMultiplyAddShiftHashFamily().
+
 static void testUniversalStringHashFamily() {  // Verify universal string hash family range and determinism.
     int m = 100;  // Bucket count.
     hashfunctionsunit::UniversalStringHashFamily ush(m, 999u);  // Use deterministic seed for stable tests.
@@ -175,16 +512,273 @@ static void testUniversalHashTableManyInsertions() {  // Verify correctness afte
     }  // Close loop.
 }  // Close testUniversalHashTableManyInsertions().
 
+static void testUniversalHashTableStats() {  // Verify the live statistics against full scans (built with HASH_TABLE_STATS=1).
+    hashfunctionsunit::UniversalHashTable ht(16, 321u);  // Create empty table with deterministic seed.
+    for (int i = 0; i < 100; i++) {  // Insert 100 items (forces several resizes).
+        ht.insert(i, "value_" + std::to_string(i));  // Insert i -> value_i.
+    }  // Close loop.
+    HashTableStats stats = ht.stats();  // Take a snapshot.
+    assertEquals(100, static_cast<long long>(stats.operations), "re-insertions during resize should not be recorded");  // Only the 100 inserts.
+    assertTrue(stats.rehashCount >= 3, "growing from 16 to 128+ buckets should count every resize");  // Validate rebuild count.
+    assertEquals(ht.getMaxChainLength(), static_cast<long long>(stats.maxChainLength()), "live max chain should match the scan");  // Compare with full scan.
+    long long buckets = 0;  // Sum of the distribution.
+    long long entries = 0;  // Entries implied by the distribution.
+    for (size_t length = 0; length < stats.chainLengths.size(); length++) {  // Walk the distribution.
+        buckets += static_cast<long long>(stats.chainLengths[length]);  // Count buckets.
+        entries += static_cast<long long>(stats.chainLengths[length] * length);  // Count entries.
+    }  // Close loop.
+    assertEquals(ht.capacity(), buckets, "chain distribution should cover every bucket");  // Validate bucket total.
+    assertEquals(100, entries, "chain distribution should cover every entry");  // Validate entry total.
+    assertTrue(stats.bytesAllocated > 0 && stats.tombstones == 0, "chaining should report bytes and no tombstones");  // Validate other fields.
+
+    assertTrue(ht.erase(5), "erase(5) should succeed");  // Remove one entry.
+    assertTrue(!ht.search(5).has_value(), "search(5) should miss");  // Record one miss.
+    stats = ht.stats();  // Refresh snapshot.
+    assertEquals(102, static_cast<long long>(stats.operations), "erase and search should each be recorded");  // Validate op count.
+    assertEquals(99, static_cast<long long>(stats.size), "size should drop after erase");  // Validate size.
+    ht.resetStats();  // Zero the counters.
+    stats = ht.stats();  // Refresh snapshot.
+    assertTrue(stats.operations == 0 && stats.rehashCount == 0 && stats.maxChainLength() > 0, "resetStats should keep the chain distribution");  // Validate reset.
+}  // Close testUniversalHashTableStats().
+
+static void testUniversalHashTableStringKeys() {  // Verify the templated table with the default string family.
+    hashfunctionsunit::UniversalHashTable<std::string, int> ht(8, 55u);  // String keys pick UniversalStringHashFamily.
+    for (int i = 0; i < 500; i++) {  // Insert enough keys to force resizes.
+        ht.insert("key_" + std::to_string(i), i);  // Insert key_i -> i.
+    }  // Close loop.
+    assertEquals(500, ht.size(), "size should be 500 after 500 string inserts");  // Validate size.
+    assertTrue(ht.capacity() >= 500 * 4 / 3, "table should have grown past the load limit");  // Validate growth.
+    for (int i = 0; i < 500; i++) {  // Validate lookups.
+        auto v = ht.search("key_" + std::to_string(i));  // Search key.
+        assertTrue(v.has_value() && v.value() == i, "search(key_i) should return i after resizes");  // Validate value.
+    }  // Close loop.
+    assertTrue(ht.erase("key_7") && !ht.contains("key_7") && ht.contains("key_8"), "erase should remove only its key");  // Validate erase.
+}  // Close testUniversalHashTableStringKeys().
+
+static void testUniversalHashTableOpenAddressing() {  // Differential test of the open-addressing layout against std::unordered_map.
+    hashfunctionsunit::UniversalHashTable ht(16, 77u, hashfunctionsunit::UniversalStorage::OPEN_ADDRESSING);  // CTAD keeps int -> std::string.
+    std::unordered_map<int, std::string> reference;  // Reference map.
+    std::mt19937 rng(2024u);  // Deterministic operation stream.
+    std::uniform_int_distribution<int> keyDist(0, 3000);  // Small key space so erases hit and clusters form.
+    for (int step = 0; step < 40000; step++) {  // Random insert/erase/search mix.
+        int key = keyDist(rng);  // Pick key.
+        int op = static_cast<int>(rng() % 10u);  // Pick operation.
+        if (op < 5) {  // Insert or update.
+            ht.insert(key, std::to_string(step));  // Table insert.
+            reference[key] = std::to_string(step);  // Reference insert.
+        } else if (op < 8) {  // Erase (backward shift must keep later keys reachable).
+            assertTrue(ht.erase(key) == (reference.erase(key) == 1), "open-addressing erase should match reference");  // Compare results.
+        } else {  // Search.
+            auto found = ht.search(key);  // Table search.
+            auto it = reference.find(key);  // Reference search.
+            assertTrue(found.has_value() == (it != reference.end()), "open-addressing search presence should match reference");  // Compare presence.
+            assertTrue(!found.has_value() || found.value() == it->second, "open-addressing search value should match reference");  // Compare value.
+        }  // Close operation branch.
+    }  // Close loop.
+    assertEquals(static_cast<long long>(reference.size()), ht.size(), "open-addressing size should match reference");  // Validate size.
+    assertTrue(ht.loadFactor() <= hashfunctionsunit::UniversalHashTable<>::MAX_PROBE_LOAD_FACTOR, "open addressing should stay at or below its load limit");  // Validate load.
+    for (const auto& kv : reference) {  // Every surviving key is still reachable.
+        assertTrue(ht.search(kv.first).value_or("") == kv.second, "every reference key should be found");  // Validate reachability.
+    }  // Close loop.
+    long long visited = 0;  // Count forEach visits.
+    ht.forEach([&visited](const int&, const std::string&) { visited++; });  // Visit every slot.
+    assertEquals(static_cast<long long>(reference.size()), visited, "forEach should visit every stored pair");  // Validate forEach.
+
+    HashTableStats stats = ht.stats();  // Take a snapshot.
+    assertTrue(stats.tombstones == 0 && stats.chainLengths.empty(), "backward-shift deletion leaves no tombstones and no chains");  // Validate layout stats.
+    assertTrue(stats.rehashCount >= 5 && stats.bytesAllocated > 0, "growing from 16 slots should count rebuilds");  // Validate rebuilds.
+}  // Close testUniversalHashTableOpenAddressing().
+
+static void testUniversalHashTableMoveOnlyValues() {  // Rebuilds must move entries: std::unique_ptr values cannot be copied.
+    for (auto storage : {hashfunctionsunit::UniversalStorage::CHAINING, hashfunctionsunit::UniversalStorage::OPEN_ADDRESSING}) {  // Both layouts.
+        hashfunctionsunit::UniversalHashTable<int, std::unique_ptr<int>> ht(4, 9u, storage);  // Move-only values.
+        for (int i = 0; i < 2000; i++) {  // Many resizes.
+            ht.insert(int(i), std::make_unique<int>(i * 2));  // Move the pointer in.
+        }  // Close loop.
+        assertEquals(2000, ht.size(), "move-only table should hold every entry");  // Validate size.
+        long long sum = 0;  // Sum pointed-to values.
+        ht.forEach([&sum](const int& key, const std::unique_ptr<int>& value) {  // Visit every pair.
+            assertTrue(value != nullptr && *value == key * 2, "moved value should keep its pointee");  // Validate pointee.
+            sum += *value;  // Accumulate.
+        });  // Close visitor.
+        assertEquals(2LL * 1999 * 2000 / 2, sum, "every value should be visited once");  // Validate sum.
+        assertTrue(ht.erase(10) && !ht.contains(10) && ht.contains(11), "erase should work with move-only values");  // Validate erase.
+    }  // Close layout loop.
+}  // Close testUniversalHashTableMoveOnlyValues().
+
+struct XorShiftFamily {  // A minimal custom family for 64-bit keys: seeded multiply-xorshift, then mod m.
+    XorShiftFamily(int m, std::uint32_t seed) : m_(m), multiplier_((static_cast<std::uint64_t>(seed) << 1) | 0x9e3779b97f4a7c15ULL) {}  // Odd multiplier derived from seed.
+    void regenerate() { multiplier_ += 0x632be59bd9b4e019ULL; multiplier_ |= 1u; }  // Pick a new odd multiplier.
+    int hash(std::uint64_t key) const {  // Bucket index in [0, m).
+        std::uint64_t h = key * multiplier_;  // Multiply.
+        h ^= h >> 32;  // Fold high bits down.
+        return static_cast<int>(h % static_cast<std::uint64_t>(m_));  // Reduce mod m.
+    }  // End hash().
+    int m_;  // Bucket count.
+    std::uint64_t multiplier_;  // Odd multiplier.
+};  // End XorShiftFamily.
+
+static void testUniversalHashTableCustomFamily() {  // Verify a user-supplied family plugs in.
+    hashfunctionsunit::UniversalHashTable<std::uint64_t, int, XorShiftFamily> ht(16, 3u);  // 64-bit keys have no default family.
+    for (int i = 0; i < 1000; i++) {  // Keys spaced far apart in 64-bit space.
+        ht.insert(static_cast<std::uint64_t>(i) << 40, i);  // Insert.
+    }  // Close loop.
+    assertEquals(1000, ht.size(), "custom-family table should hold every entry");  // Validate size.
+    for (int i = 0; i < 1000; i++) {  // Validate lookups after resizes under the custom family.
+        assertTrue(ht.search(static_cast<std::uint64_t>(i) << 40).value_or(-1) == i, "custom-family lookup should succeed");  // Validate lookup.
+    }  // Close loop.
+    assertTrue(!ht.contains(1u), "custom-family miss should report absent");  // Validate miss.
+}  // Close testUniversalHashTableCustomFamily().
+
+static void testCuckooHashTable() {  // Verify cuckoo table insert/search/update/erase.
+    hashfunctionsunit::CuckooHashTable ht(4, 7u);  // Create small table with deterministic seed.
+    ht.insert(10, 100);  // Insert 10 -> 100.
+    ht.insert(-5, 50);  // Negative keys are valid too.
+    assertTrue(ht.search(10).has_value() && ht.search(10).value() == 100, "search(10) should return 100");  // Validate search.
+    assertTrue(ht.search(-5).has_value() && ht.search(-5).value() == 50, "search(-5) should return 50");  // Validate search.
+    assertTrue(!ht.contains(11), "contains(11) should be false");  // Validate missing.
+
+    ht.insert(10, 1000);  // Update existing key.
+    assertTrue(ht.search(10).value() == 1000, "update should overwrite value");  // Validate update.
+    assertEquals(2, ht.size(), "size should remain 2 after update");  // Validate size.
+
+    assertTrue(ht.erase(10), "erase(10) should succeed");  // Delete existing.
+    assertTrue(!ht.contains(10), "10 should be missing after erase");  // Validate deletion.
+    assertTrue(!ht.erase(10), "erase(10) should return false when missing");  // Validate missing delete.
+    assertEquals(1, ht.size(), "size should be 1 after erase");  // Validate size.
+}  // Close testCuckooHashTable().
+
+static void testCuckooHashTableGrowth() {  // Verify growth keeps every entry reachable.
+    hashfunctionsunit::CuckooHashTable ht(1, 11u);  // Start with a single bucket.
+    for (int i = 0; i < 5000; i++) {  // Insert many keys.
+        ht.insert(i * 7919, i);  // Spread keys a little.
+    }  // Close loop.
+    assertEquals(5000, ht.size(), "size should be 5000 after inserts");  // Validate size.
+    assertTrue(ht.loadFactor() <= 0.9, "load factor should stay under the default limit");  // Validate growth policy.
+    assertTrue(ht.rehashCount() > 0, "growth should have rebuilt the table");  // Validate rebuilds happened.
+    for (int i = 0; i < 5000; i++) {  // Validate lookups.
+        auto v = ht.search(i * 7919);  // Search key.
+        assertTrue(v.has_value() && v.value() == i, "search should return the inserted value");  // Validate value.
+    }  // Close loop.
+}  // Close testCuckooHashTableGrowth().
+
+static void testCuckooHashTableHighLoad() {  // Verify correctness near full slot occupancy (stash and rehash paths).
+    hashfunctionsunit::CuckooHashTable ht(256, 3u);  // 1024 slots.
+    ht.setMaxLoadFactor(0.95);  // Allow up to 972 entries before growth.
+    auto keyOf = [](int i) {  // Spread keys; unsigned arithmetic wraps instead of overflowing int.
+        return static_cast<int>(static_cast<std::uint32_t>(i) * 2654435u + 1u);  // Distinct for i < 2^32 (odd multiplier).
+    };  // End keyOf.
+    for (int i = 0; i < 970; i++) {  // Fill to ~95%.
+        ht.insert(keyOf(i), i);  // Distinct keys.
+    }  // Close loop.
+    assertEquals(256, ht.bucketCount(), "table should not grow below the load limit");  // Validate pinned size.
+    assertTrue(ht.stashSize() <= hashfunctionsunit::CuckooHashTable::STASH_CAPACITY, "stash should stay bounded");  // Validate stash bound.
+    for (int i = 0; i < 970; i++) {  // Validate every entry.
+        auto v = ht.search(keyOf(i));  // Search key.
+        assertTrue(v.has_value() && v.value() == i, "high-load search should find every key");  // Validate value.
+    }  // Close loop.
+    assertTrue(!ht.contains(2), "absent key should be missing at high load");  // Validate miss.
+}  // Close testCuckooHashTableHighLoad().
+
+static void testCuckooHashTableMatchesReference() {  // Differential test against std::unordered_map.
+    hashfunctionsunit::CuckooHashTable ht(8, 99u);  // Small table so growth/eviction paths run often.
+    std::unordered_map<int, int> reference;  // Reference model.
+    std::mt19937 rng(2024u);  // Deterministic operation stream.
+    std::uniform_int_distribution<int> keyDist(-500, 500);  // Small key range forces updates and erases.
+    for (int step = 0; step < 20000; step++) {  // Random operations.
+        int key = keyDist(rng);  // Choose key.
+        int op = static_cast<int>(rng() % 3u);  // Choose insert/erase/search.
+        if (op == 0) {  // Insert or update.
+            ht.insert(key, step);  // Apply to table.
+            reference[key] = step;  // Apply to model.
+        } else if (op == 1) {  // Erase.
+            bool removed = reference.erase(key) == 1u;  // Apply to model.
+            assertTrue(ht.erase(key) == removed, "erase result should match reference");  // Compare.
+        } else {  // Search.
+            auto it = reference.find(key);  // Query model.
+            auto v = ht.search(key);  // Query table.
+            assertTrue(v.has_value() == (it != reference.end()), "presence should match reference");  // Compare presence.
+            assertTrue(!v.has_value() || v.value() == it->second, "value should match reference");  // Compare value.
+        }  // Close op dispatch.
+        assertEquals(static_cast<long long>(reference.size()), ht.size(), "size should match reference");  // Compare size.
+    }  // Close loop.
+}  // Close testCuckooHashTableMatchesReference().
+
+static void testCuckooHashTableInvalidArguments() {  // Verify argument validation.
+    bool threw = false;  // Track exception.
+    try {  // Expect failure.
+        hashfunctionsunit::CuckooHashTable bad(0);  // Zero buckets is invalid.
+    } catch (const std::invalid_argument&) {  // Expected exception type.
+        threw = true;  // Record exception.
+    }  // Close catch.
+    assertTrue(threw, "bucketCount=0 should throw invalid_argument");  // Validate exception.
+
+    hashfunctionsunit::CuckooHashTable ht;  // Default table.
+    threw = false;  // Reset flag.
+    try {  // Expect failure.
+        ht.setMaxLoadFactor(1.0);  // Full occupancy is not allowed.
+    } catch (const std::invalid_argument&) {  // Expected exception type.
+        threw = true;  // Record exception.
+    }  // Close catch.
+    assertTrue(threw, "setMaxLoadFactor(1.0) should throw invalid_argument");  // Validate exception.
+}  // Close testCuckooHashTableInvalidArguments().
+
+static void testCuckooHashTableStats() {  // Verify the shared statistics interface on the cuckoo table (built with HASH_TABLE_STATS=1).
+    hashfunctionsunit::CuckooHashTable ht(4, 7u);  // 16 slots, empty stash.
+    ht.insert(10, 100);  // Miss in both buckets, then a direct slot: 3 probes.
+    assertTrue(ht.search(10).has_value(), "search(10) should hit");  // One or two buckets.
+    assertTrue(!ht.search(11).has_value(), "search(11) should miss");  // Both buckets, empty stash: 2 probes.
+    assertTrue(ht.erase(10), "erase(10) should succeed");  // One or two buckets.
+    HashTableStats stats = ht.stats();  // Take a snapshot.
+    assertEquals(4, static_cast<long long>(stats.operations), "insert, two searches and erase should be recorded");  // Validate op count.
+    assertTrue(stats.totalProbes >= 7 && stats.totalProbes <= 9, "probes should count buckets inspected");  // 3 + {1,2} + 2 + {1,2}.
+    assertEquals(3, static_cast<long long>(stats.maxProbes()), "a new key inspects both buckets before placing");  // Validate histogram.
+    assertTrue(stats.tombstones == 0 && stats.chainLengths.empty(), "cuckoo has no tombstones and no chains");  // Validate layout stats.
+    assertEquals(static_cast<long long>(ht.capacity()), static_cast<long long>(stats.capacity), "capacity should count slots");  // Validate capacity.
+
+    for (int i = 0; i < 2000; i++) {  // Grow from 4 buckets (kicks, stash and rebuilds).
+        ht.insert(i * 7919, i);  // Spread keys a little.
+    }  // Close loop.
+    stats = ht.stats();  // Refresh snapshot.
+    assertEquals(2004, static_cast<long long>(stats.operations), "re-insertions during rebuilds should not be recorded");  // Only the user operations.
+    assertEquals(ht.rehashCount(), static_cast<long long>(stats.rehashCount), "rebuild count should match rehashCount()");  // Validate rebuilds.
+    assertTrue(stats.rehashNanos > 0, "rebuild time should be measured");  // Validate timing.
+    assertTrue(stats.bytesAllocated >= static_cast<size_t>(ht.bucketCount()) * sizeof(hashfunctionsunit::CuckooHashTable::Bucket), "bytes should cover the buckets");  // Validate bytes.
+    assertEquals(2000, static_cast<long long>(stats.size), "size should be copied");  // Validate size.
+    ht.resetStats();  // Zero the counters.
+    stats = ht.stats();  // Refresh snapshot.
+    assertTrue(stats.operations == 0 && stats.rehashCount == 0 && ht.rehashCount() > 0, "resetStats should leave rehashCount() alone");  // Validate reset.
+}  // Close testCuckooHashTableStats().
+
 int main() {  // Run all tests and print status.
     try {  // Catch failures and print a clean message.
         testIntegerHashFunctions();  // Run integer hash tests.
+        testMultiplyShiftHashing();  // Run multiply-shift / fastRange32 tests.
         testStringHashFunctions();  // Run string hash tests.
         testDistributionAnalyzer();  // Run distribution analyzer tests.
+        testWordAtATimeStringHashes();  // Run word-at-a-time / wyhash / CRC32C tests.
+        testDistributionAnalyzerStringViewKeys();  // Run string_view analyzer tests.
+        testStreamingDistributionMatchesInMemory();  // Run streaming analyzer equivalence tests.
+        testStreamingDistributionInputs();  // Run streaming analyzer input tests.
+        testStreamingDistributionStatistics();  // Run streaming analyzer statistics tests.
+        testStreamingDistributionSharedCounters();  // Run streaming analyzer shared-counter tests.
         testUniversalHashFamily();  // Run universal hash family tests.
         testUniversalHashCollisionProbabilityBound();  // Run collision probability bound test.
+        testMultiplyAddShiftHashFamily();  // Run multiply-add-shift family tests.
         testUniversalStringHashFamily();  // Run universal string hash tests.
         testUniversalHashTable();  // Run universal hash table tests.
         testUniversalHashTableManyInsertions();  // Run bulk insert test.
+        testUniversalHashTableStats();  // Run statistics test.
+        testUniversalHashTableStringKeys();  // Run string-key table test.
+        testUniversalHashTableOpenAddressing();  // Run open-addressing differential test.
+        testUniversalHashTableMoveOnlyValues();  // Run move-only value test.
+        testUniversalHashTableCustomFamily();  // Run custom family test.
+        testCuckooHashTable();  // Run cuckoo table basic tests.
+        testCuckooHashTableGrowth();  // Run cuckoo growth test.
+        testCuckooHashTableHighLoad();  // Run cuckoo high-load test.
+        testCuckooHashTableMatchesReference();  // Run cuckoo differential test.
+        testCuckooHashTableInvalidArguments();  // Run cuckoo validation tests.
+        testCuckooHashTableStats();  // Run cuckoo statistics test.
         std::cout << "All tests PASSED.\n";  // Print success.
         return 0;  // Exit success.
     } catch (const std::exception& ex) {  // Print any test failure.
@@ -0,0 +1,68 @@
+// 03 通用雜湊表重建量測（C++）/ UniversalHashTable rehash benchmark (C++).  // Bilingual file header.
+//
+// Inserts `entries` int -> std::string pairs into a UniversalHashTable starting from 16 buckets and reports
+// total insert time, time spent in rebuilds (growth + defensive regeneration, from the stats interface),
+// the final footprint, and the process peak RSS. Run one configuration per process so peak RSS is its own.
+// Usage: ./universal_rehash_benchmark [entries=10000000] [storage=chain|open] [valueLength=16]
+
+#include "UniversalHashing.hpp"  // Table under test.
+
+#include <sys/resource.h>  // Provide getrusage for peak RSS.
+
+#include <chrono>  // Provide steady_clock timing.
+#include <iomanip>  // Provide output formatting.
+#include <iostream>  // Provide std::cout for reports.
+#include <stdexcept>  // Provide std::invalid_argument for bad arguments.
+#include <string>  // Provide std::string values and argument parsing.
+
+#if !HASH_TABLE_STATS  // Rebuild time comes from the statistics interface.
+#error "universal_rehash_benchmark needs HASH_TABLE_STATS=1"
+#endif  // Close guard.
+
+using Clock = std::chrono::steady_clock;  // Monotonic clock for timing.
+
+static double peakRssMegabytes() {  // Peak resident set size of this process so far.
+    struct rusage usage {};  // Filled by getrusage.
+    getrusage(RUSAGE_SELF, &usage);  // Query this process.
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;  // Linux reports kilobytes.
+}  // End peakRssMegabytes().
+
+int main(int argc, char** argv) {  // Parse arguments and run one configuration.
+    try {  // Report bad arguments cleanly.
+        int entries = (argc > 1) ? std::stoi(argv[1]) : 10000000;  // Number of distinct keys.
+        std::string storageName = (argc > 2) ? argv[2] : "chain";  // Layout name.
+        int valueLength = (argc > 3) ? std::stoi(argv[3]) : 16;  // 16+ bytes puts each value on the heap (past SSO).
+        if (entries <= 0 || valueLength < 0) {  // Validate counts.
+            throw std::invalid_argument("entries must be >= 1 and valueLength >= 0");  // Reject.
+        }  // Close validation.
+        hashfunctionsunit::UniversalStorage storage = hashfunctionsunit::UniversalStorage::CHAINING;  // Default layout.
+        if (storageName == "open") {  // Open addressing requested.
+            storage = hashfunctionsunit::UniversalStorage::OPEN_ADDRESSING;  // Switch layout.
+        } else if (storageName != "chain") {  // Unknown layout.
+            throw std::invalid_argument("storage must be chain or open");  // Reject.
+        }  // Close layout parsing.
+
+        double baselineMb = peakRssMegabytes();  // RSS before the table exists.
+        hashfunctionsunit::UniversalHashTable table(16, 42u, storage);  // int -> std::string via CTAD.
+        Clock::time_point start = Clock::now();  // Start insert timer.
+        for (int key = 0; key < entries; key++) {  // Sequential keys: universal hashing spreads them evenly.
+            table.insert(int(key), std::string(static_cast<size_t>(valueLength), 'v'));  // Move a fresh value in.
+        }  // Close insert loop.
+        double insertMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();  // Total insert time.
+
+        HashTableStats stats = table.stats();  // Rebuild counters and footprint.
+        std::cout << std::fixed << std::setprecision(1);  // One decimal for all figures.
+        std::cout << "storage=" << storageName << " entries=" << entries << " valueLength=" << valueLength << "\n";  // Configuration.
+        std::cout << "  capacity           " << table.capacity() << "\n";  // Final bucket/slot count.
+        std::cout << "  rebuilds           " << stats.rehashCount << " (defensive " << table.rehashCount() << ")\n";  // Growth + regeneration.
+        std::cout << "  insert total ms    " << insertMs << "\n";  // Whole insert phase.
+        std::cout << "  rebuild ms         " << static_cast<double>(stats.rehashNanos) / 1e6 << "\n";  // Time inside rebuilds.
+        std::cout << "  table bytes MB     " << static_cast<double>(stats.bytesAllocated) / (1024.0 * 1024.0) << "\n";  // Arrays and chains (not value heap buffers).
+        std::cout << "  peak RSS MB        " << peakRssMegabytes() - baselineMb << "\n";  // Includes the transient old array during rebuilds.
+        std::cout << "  max chain / probe  " << table.getMaxChainLength() << "\n";  // Longest chain or probe sequence.
+        return 0;  // Exit success.
+    } catch (const std::exception& ex) {  // Bad arguments.
+        std::cerr << ex.what() << "\n";  // Print message.
+        return 1;  // Exit failure.
+    }  // Close catch.
+}  // End main().